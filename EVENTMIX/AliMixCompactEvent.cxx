@@ -0,0 +1,112 @@
+//
+// Class AliMixCompactEvent
+//
+// AliMixCompactEvent keeps a compact projection of one event
+// (vertex, centrality and flat track arrays) used by the
+// compact mode of AliMixEventPool
+//
+// author:
+//        Martin Vala (martin.vala@cern.ch)
+//
+
+#include "AliAODTrack.h"
+#include "AliCentrality.h"
+#include "AliVEvent.h"
+#include "AliVTrack.h"
+#include "AliVVertex.h"
+
+#include "AliMixCompactEvent.h"
+
+ClassImp(AliMixCompactEvent)
+
+//_________________________________________________________________________________________________
+AliMixCompactEvent::AliMixCompactEvent() :
+   fCentrality(-1),
+   fPt(),
+   fEta(),
+   fPhi(),
+   fCharge(),
+   fFlags()
+{
+   //
+   // Default constructor.
+   //
+   fVertex[0] = fVertex[1] = fVertex[2] = 0;
+}
+
+//_________________________________________________________________________________________________
+void AliMixCompactEvent::Clear()
+{
+   //
+   // Clears tracks (memory is kept for the next event)
+   //
+   fVertex[0] = fVertex[1] = fVertex[2] = 0;
+   fCentrality = -1;
+   fPt.clear();
+   fEta.clear();
+   fPhi.clear();
+   fCharge.clear();
+   fFlags.clear();
+}
+
+//_________________________________________________________________________________________________
+void AliMixCompactEvent::Release()
+{
+   //
+   // Clears tracks and frees their memory
+   //
+   Clear();
+   std::vector<Float_t>().swap(fPt);
+   std::vector<Float_t>().swap(fEta);
+   std::vector<Float_t>().swap(fPhi);
+   std::vector<Char_t>().swap(fCharge);
+   std::vector<UInt_t>().swap(fFlags);
+}
+
+//_________________________________________________________________________________________________
+void AliMixCompactEvent::Fill(AliVEvent *ev, UInt_t filterMask, Float_t ptMin, const char *centEstimator)
+{
+   //
+   // Fills projection of event
+   //
+   Clear();
+   if (!ev) return;
+   const AliVVertex *vtx = ev->GetPrimaryVertex();
+   if (vtx) {
+      fVertex[0] = vtx->GetX();
+      fVertex[1] = vtx->GetY();
+      fVertex[2] = vtx->GetZ();
+   }
+   AliCentrality *c = ev->GetCentrality();
+   if (c) fCentrality = c->GetCentralityPercentile(centEstimator);
+
+   Int_t nTracks = ev->GetNumberOfTracks();
+   AliVTrack *track;
+   AliAODTrack *aodTrack;
+   UInt_t flags;
+   for (Int_t i = 0; i < nTracks; i++) {
+      track = dynamic_cast<AliVTrack *>(ev->GetTrack(i));
+      if (!track || track->Pt() < ptMin) continue;
+      aodTrack = dynamic_cast<AliAODTrack *>(track);
+      if (aodTrack) {
+         if (filterMask && !aodTrack->TestFilterBit(filterMask)) continue;
+         flags = aodTrack->GetFilterMap();
+      } else {
+         flags = (UInt_t) track->GetStatus();
+      }
+      fPt.push_back(track->Pt());
+      fEta.push_back(track->Eta());
+      fPhi.push_back(track->Phi());
+      fCharge.push_back(track->Charge());
+      fFlags.push_back(flags);
+   }
+}
+
+//_________________________________________________________________________________________________
+Long64_t AliMixCompactEvent::GetBytes() const
+{
+   //
+   // Returns memory used by event (including reserved track capacity)
+   //
+   return sizeof(AliMixCompactEvent) + fPt.capacity() * (3 * sizeof(Float_t) + sizeof(Char_t) + sizeof(UInt_t));
+}
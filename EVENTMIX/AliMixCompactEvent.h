@@ -0,0 +1,57 @@
+//
+// Class AliMixCompactEvent
+//
+// AliMixCompactEvent keeps a compact projection of one event
+// (vertex, centrality and flat track arrays) used by the
+// compact mode of AliMixEventPool
+//
+// author:
+//        Martin Vala (martin.vala@cern.ch)
+//
+
+#ifndef ALIMIXCOMPACTEVENT_H
+#define ALIMIXCOMPACTEVENT_H
+
+#include <vector>
+
+#include <Rtypes.h>
+#include <TString.h>
+
+class AliVEvent;
+class AliMixCompactEvent {
+public:
+   AliMixCompactEvent();
+   virtual ~AliMixCompactEvent() {}
+
+   // fills the projection of ev, keeping the capacity of the track arrays
+   void        Fill(AliVEvent *ev, UInt_t filterMask = 0, Float_t ptMin = 0.0, const char *centEstimator = "V0M");
+   void        Clear();
+   void        Release();
+
+   Long64_t    GetBytes() const;
+   Int_t       GetNumberOfTracks() const { return fPt.size(); }
+   Float_t     GetVertexX() const { return fVertex[0]; }
+   Float_t     GetVertexY() const { return fVertex[1]; }
+   Float_t     GetVertexZ() const { return fVertex[2]; }
+   Float_t     GetCentrality() const { return fCentrality; }
+
+   // flat track arrays (structure of arrays)
+   const Float_t *GetPt() const { return fPt.data(); }
+   const Float_t *GetEta() const { return fEta.data(); }
+   const Float_t *GetPhi() const { return fPhi.data(); }
+   const Char_t  *GetCharge() const { return fCharge.data(); }
+   const UInt_t  *GetFlags() const { return fFlags.data(); }
+
+private:
+   Float_t              fVertex[3];    // primary vertex position
+   Float_t              fCentrality;   // centrality percentile (-1 if not available)
+   std::vector<Float_t> fPt;           // track pt
+   std::vector<Float_t> fEta;          // track eta
+   std::vector<Float_t> fPhi;          // track phi
+   std::vector<Char_t>  fCharge;       // track charge
+   std::vector<UInt_t>  fFlags;        // AOD filter map or ESD status bits
+
+   ClassDef(AliMixCompactEvent, 1)
+};
+
+#endif
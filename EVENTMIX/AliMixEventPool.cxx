@@ -23,7 +23,18 @@ AliMixEventPool::AliMixEventPool(const char *name, const char *title) : TNamed(n
    fListOfEventCuts(),
    fBinNumber(0),
    fBufferSize(0),
-   fMixNumber(0)
+   fMixNumber(0),
+   fCompactDepth(0),
+   fCompactMaxBytes(0),
+   fCompactFilterMask(0),
+   fCompactPtMin(0),
+   fCompactCentEstimator("V0M"),
+   fCompactDefaultPolicy(kEvictOldest),
+   fCompactPolicy(),
+   fCompactEvents(),
+   fCompactHead(),
+   fCompactN(),
+   fCompactBytes(0)
 {
    //
    // Default constructor.
@@ -37,7 +48,18 @@ AliMixEventPool::AliMixEventPool(const AliMixEventPool &obj) : TNamed(obj),
    fListOfEventCuts(obj.fListOfEventCuts),
    fBinNumber(obj.fBinNumber),
    fBufferSize(obj.fBufferSize),
-   fMixNumber(obj.fMixNumber)
+   fMixNumber(obj.fMixNumber),
+   fCompactDepth(obj.fCompactDepth),
+   fCompactMaxBytes(obj.fCompactMaxBytes),
+   fCompactFilterMask(obj.fCompactFilterMask),
+   fCompactPtMin(obj.fCompactPtMin),
+   fCompactCentEstimator(obj.fCompactCentEstimator),
+   fCompactDefaultPolicy(obj.fCompactDefaultPolicy),
+   fCompactPolicy(obj.fCompactPolicy),
+   fCompactEvents(),
+   fCompactHead(),
+   fCompactN(),
+   fCompactBytes(0)
 {
    //
    // Copy constructor
@@ -59,6 +81,17 @@ AliMixEventPool &AliMixEventPool::operator=(const AliMixEventPool &obj)
       fBinNumber = obj.fBinNumber;
       fBufferSize = obj.fBufferSize;
       fMixNumber = obj.fMixNumber;
+      fCompactDepth = obj.fCompactDepth;
+      fCompactMaxBytes = obj.fCompactMaxBytes;
+      fCompactFilterMask = obj.fCompactFilterMask;
+      fCompactPtMin = obj.fCompactPtMin;
+      fCompactCentEstimator = obj.fCompactCentEstimator;
+      fCompactDefaultPolicy = obj.fCompactDefaultPolicy;
+      fCompactPolicy = obj.fCompactPolicy;
+      fCompactEvents.clear();
+      fCompactHead.clear();
+      fCompactN.clear();
+      fCompactBytes = 0;
    }
    return *this;
 }
@@ -111,6 +144,13 @@ Int_t AliMixEventPool::Init()
    fBinNumber++;
    AliDebug(AliLog::kDebug, Form("fBinnumber = %d", fBinNumber));
    AddEntryList();
+   if (IsCompactMode()) {
+      Int_t nBins = fListOfEntryList.GetEntries();
+      fCompactEvents.assign(nBins, std::vector<AliMixCompactEvent>());
+      fCompactHead.assign(nBins, 0);
+      fCompactN.assign(nBins, 0);
+      fCompactBytes = 0;
+   }
    AliDebug(AliLog::kDebug + 5, "->");
    return 0;
 }
@@ -192,8 +232,22 @@ TEntryList *AliMixEventPool::FindEntryList(AliVEvent *ev, Int_t &idEntryList)
    // Find entrlist in list of entrlist
    //
    AliDebug(AliLog::kDebug + 5, "<-");
+   Int_t id = FindBinIndex(ev);
+   if (id < 0) return 0;
+   idEntryList = id;
+   AliDebug(AliLog::kDebug + 5, "->");
+   return (TEntryList *) fListOfEntryList.At(idEntryList - 1);
+}
+
+//_________________________________________________________________________________________________
+Int_t AliMixEventPool::FindBinIndex(AliVEvent *ev)
+{
+   //
+   // Find bin index (starting from 1, -1 if event is outside of bins)
+   //
+   AliDebug(AliLog::kDebug + 5, "<-");
    Int_t num = fListOfEventCuts.GetEntriesFast();
-   if (num < 1) return 0;
+   if (num < 1) return -1;
    Int_t *indexes = new Int_t[num] ;
    Int_t *lenght = new Int_t[num];
    Int_t i = 0;
@@ -205,20 +259,126 @@ TEntryList *AliMixEventPool::FindEntryList(AliVEvent *ev, Int_t &idEntryList)
          AliDebug(AliLog::kDebug, Form("idEntryList %d", -1));
          delete [] indexes;
          delete [] lenght;
-         return 0;
+         return -1;
       }
       lenght[i] = cut->GetNumberOfBins();
       AliDebug(AliLog::kDebug + 1, Form("indexes[%d] %d", i, indexes[i]));
       i++;
    }
-   idEntryList = 0;
+   Int_t idEntryList = 0;
    SearchIndexRecursive(fListOfEventCuts.GetEntries() - 1, &indexes[0], &lenght[0], idEntryList);
    AliDebug(AliLog::kDebug, Form("idEntryList %d", idEntryList - 1));
    // index which start with 0 (idEntryList-1)
    delete [] indexes;
    delete [] lenght;
    AliDebug(AliLog::kDebug + 5, "->");
-   return (TEntryList *) fListOfEntryList.At(idEntryList - 1);
+   return idEntryList;
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventPool::SetCompactMode(Int_t depth, Long64_t maxBytes, EEvictionPolicy_t policy)
+{
+   //
+   // Enables compact mode: the last "depth" events of each bin are kept
+   // in memory, using at most maxBytes (0 means no memory cap)
+   //
+   fCompactDepth = depth;
+   fCompactMaxBytes = maxBytes;
+   fCompactDefaultPolicy = policy;
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventPool::SetCompactEvictionPolicy(Int_t idEntryList, EEvictionPolicy_t policy)
+{
+   //
+   // Sets eviction policy of one bin (idEntryList as returned by FindEntryList)
+   //   kEvictOldest : full bin drops its oldest event
+   //   kKeepOldest  : full bin rejects new events
+   //
+   if (idEntryList < 1) return;
+   if ((Int_t)fCompactPolicy.size() < idEntryList) fCompactPolicy.resize(idEntryList, -1);
+   fCompactPolicy[idEntryList - 1] = policy;
+}
+
+//_________________________________________________________________________________________________
+Int_t AliMixEventPool::GetCompactPolicy(Int_t bin) const
+{
+   //
+   // Returns eviction policy of bin (starting from 0)
+   //
+   if (bin < (Int_t)fCompactPolicy.size() && fCompactPolicy[bin] >= 0) return fCompactPolicy[bin];
+   return fCompactDefaultPolicy;
+}
+
+//_________________________________________________________________________________________________
+Int_t AliMixEventPool::AddCompactEvent(AliVEvent *ev)
+{
+   //
+   // Stores projection of event in its bin.
+   // Returns bin index (idEntryList) or -1 if event was not stored
+   //
+   if (!IsCompactMode() || !ev) return -1;
+   Int_t id = FindBinIndex(ev);
+   if (id < 1 || id > (Int_t)fCompactEvents.size()) return -1;
+   Int_t bin = id - 1;
+   Int_t policy = GetCompactPolicy(bin);
+
+   std::vector<AliMixCompactEvent> &ring = fCompactEvents[bin];
+   if (ring.empty()) {
+      ring.resize(fCompactDepth);
+      fCompactBytes += fCompactDepth * sizeof(AliMixCompactEvent);
+   }
+   if (fCompactN[bin] == fCompactDepth) {
+      if (policy == kKeepOldest) return -1;
+      // oldest event is at head and will be overwritten
+      fCompactN[bin]--;
+   }
+   Int_t slot = fCompactHead[bin];
+   fCompactBytes -= ring[slot].GetBytes();
+   ring[slot].Fill(ev, fCompactFilterMask, fCompactPtMin, fCompactCentEstimator.Data());
+   fCompactBytes += ring[slot].GetBytes();
+   fCompactHead[bin] = (slot + 1) % fCompactDepth;
+   fCompactN[bin]++;
+
+   // memory cap: evict oldest events of this bin or reject the new one
+   while (fCompactMaxBytes > 0 && fCompactBytes > fCompactMaxBytes) {
+      if (policy == kKeepOldest || fCompactN[bin] <= 1) {
+         fCompactBytes -= ring[slot].GetBytes();
+         ring[slot].Release();
+         fCompactBytes += ring[slot].GetBytes();
+         fCompactHead[bin] = slot;
+         fCompactN[bin]--;
+         AliDebug(AliLog::kDebug, Form("Memory cap %lld reached, event not stored in bin %d", fCompactMaxBytes, id));
+         return -1;
+      }
+      Int_t oldest = (fCompactHead[bin] - fCompactN[bin] + fCompactDepth) % fCompactDepth;
+      fCompactBytes -= ring[oldest].GetBytes();
+      ring[oldest].Release();
+      fCompactBytes += ring[oldest].GetBytes();
+      fCompactN[bin]--;
+   }
+   return id;
+}
+
+//_________________________________________________________________________________________________
+Int_t AliMixEventPool::GetNumberOfCompactEvents(Int_t idEntryList) const
+{
+   //
+   // Returns number of stored events in bin
+   //
+   if (idEntryList < 1 || idEntryList > (Int_t)fCompactN.size()) return 0;
+   return fCompactN[idEntryList - 1];
+}
+
+//_________________________________________________________________________________________________
+const AliMixCompactEvent *AliMixEventPool::GetCompactEvent(Int_t idEntryList, Int_t i) const
+{
+   //
+   // Returns stored event i of bin (i=0 is the most recent one)
+   //
+   if (i < 0 || i >= GetNumberOfCompactEvents(idEntryList)) return 0;
+   Int_t bin = idEntryList - 1;
+   return &fCompactEvents[bin][(fCompactHead[bin] - 1 - i + fCompactDepth) % fCompactDepth];
 }
 
 //_________________________________________________________________________________________________
@@ -11,14 +11,20 @@
 #ifndef ALIMIXEVENTPOOL_H
 #define ALIMIXEVENTPOOL_H
 
+#include <vector>
+
 #include <TObjArray.h>
 #include <TNamed.h>
 
+#include "AliMixCompactEvent.h"
+
 class TEntryList;
 class AliMixEventCutObj;
 class AliVEvent;
 class AliMixEventPool : public TNamed {
 public:
+   enum EEvictionPolicy_t {kEvictOldest = 0, kKeepOldest = 1};
+
    AliMixEventPool(const char *name = "mixEventPool", const char *title = "Mix event pool");
    AliMixEventPool(const AliMixEventPool &obj);
    AliMixEventPool &operator= (const AliMixEventPool &obj);
@@ -36,6 +42,18 @@ public:
 
    Bool_t      AddEntry(Long64_t entry, AliVEvent *ev);
    TEntryList *FindEntryList(AliVEvent *ev, Int_t &idEntryList);
+   Int_t       FindBinIndex(AliVEvent *ev);
+
+   // compact mode: keeps projections of accepted events in memory (ring buffer per bin)
+   void        SetCompactMode(Int_t depth, Long64_t maxBytes = 0, EEvictionPolicy_t policy = kEvictOldest);
+   void        SetCompactEvictionPolicy(Int_t idEntryList, EEvictionPolicy_t policy);
+   void        SetCompactTrackSelection(UInt_t filterMask, Float_t ptMin = 0.0) { fCompactFilterMask = filterMask; fCompactPtMin = ptMin; }
+   void        SetCompactCentralityEstimator(const char *estimator) { fCompactCentEstimator = estimator; }
+   Bool_t      IsCompactMode() const { return fCompactDepth > 0; }
+   Int_t       AddCompactEvent(AliVEvent *ev);
+   Int_t       GetNumberOfCompactEvents(Int_t idEntryList) const;
+   const AliMixCompactEvent *GetCompactEvent(Int_t idEntryList, Int_t i) const;
+   Long64_t    GetCompactBytes() const { return fCompactBytes; }
 
    void        AddCut(AliMixEventCutObj *cut);
 
@@ -58,7 +76,22 @@ private:
    Int_t       fBufferSize;            // buffer size
    Int_t       fMixNumber;             // mixing number
 
-   ClassDef(AliMixEventPool, 1)
+   Int_t       fCompactDepth;          // number of events kept per bin in compact mode (0 = off)
+   Long64_t    fCompactMaxBytes;       // memory cap of compact mode (0 = no cap)
+   UInt_t      fCompactFilterMask;     // AOD filter mask of stored tracks
+   Float_t     fCompactPtMin;          // minimum pt of stored tracks
+   TString     fCompactCentEstimator;  // centrality estimator of stored events
+   Int_t       fCompactDefaultPolicy;  // eviction policy of bins without explicit policy
+   std::vector<Int_t> fCompactPolicy;  // eviction policy per bin
+
+   std::vector<std::vector<AliMixCompactEvent> > fCompactEvents; //! ring buffers per bin
+   std::vector<Int_t> fCompactHead;    //! next slot to be written per bin
+   std::vector<Int_t> fCompactN;       //! number of stored events per bin
+   Long64_t    fCompactBytes;          //! memory used by stored events
+
+   Int_t       GetCompactPolicy(Int_t bin) const;
+
+   ClassDef(AliMixEventPool, 2)
 };
 
 #endif
@@ -11,6 +11,7 @@
 #include <TChain.h>
 #include <TChainElement.h>
 #include <TSystem.h>
+#include <TMath.h>
 
 #include "AliLog.h"
 #include "AliAnalysisManager.h"
@@ -195,6 +196,10 @@ Bool_t AliMixInputEventHandler::GetEntry()
    if (!fEventPool) {
       MixStd();
    }
+   // events are taken from memory in compact mode
+   else if (fEventPool->IsCompactMode()) {
+      MixCompact();
+   }
    // if buffer size is higher then 1
    else if (fBufferSize > 1) {
       MixBuffer();
@@ -272,6 +277,48 @@ Bool_t AliMixInputEventHandler::MixStd()
    return kTRUE;
 }
 
+//_____________________________________________________________________________
+Bool_t AliMixInputEventHandler::MixCompact()
+{
+   //
+   // Mix with compact events stored in event pool (no input is read again).
+   // In UserExecMix() the mixed event is available via
+   //    GetEventPool()->GetCompactEvent(CurrentBinIndex(), CurrentEntryMix())
+   //
+   AliDebug(AliLog::kDebug + 5, Form("<-"));
+   AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+   AliMultiInputEventHandler *mh = dynamic_cast<AliMultiInputEventHandler *>(mgr->GetInputEventHandler());
+   AliInputEventHandler *inEvHMain = 0;
+   if (mh) inEvHMain = dynamic_cast<AliInputEventHandler *>(mh->GetFirstInputEventHandler());
+   else inEvHMain = dynamic_cast<AliInputEventHandler *>(mgr->GetInputEventHandler());
+   if (!inEvHMain) return kFALSE;
+
+   // check for PhysSelection
+   if (!IsEventCurrentSelected()) return kFALSE;
+
+   AliVEvent *ev = inEvHMain->GetEvent();
+   Int_t idEntryList = fEventPool->FindBinIndex(ev);
+   fNumberMixed = 0;
+   if (idEntryList < 0) {
+      UserExecMixAllTasks(fEntryCounter, -1, fEntryCounter, -1, 0);
+      return kTRUE;
+   }
+   Int_t nStored = fEventPool->GetNumberOfCompactEvents(idEntryList);
+   if (nStored < fMixNumber && !fDoMixIfNotEnoughEvents) {
+      UserExecMixAllTasks(fEntryCounter, idEntryList, fEntryCounter, -1, 0);
+   } else {
+      Int_t mixNum = TMath::Min(nStored, fMixNumber > 0 ? fMixNumber : nStored);
+      for (Int_t i = 0; i < mixNum; i++) {
+         fNumberMixed++;
+         UserExecMixAllTasks(fEntryCounter, idEntryList, fEntryCounter, i, fNumberMixed);
+      }
+   }
+   // current event is stored after mixing, so that it is not mixed with itself
+   fEventPool->AddCompactEvent(ev);
+   AliDebug(AliLog::kDebug + 5, Form("->"));
+   return kTRUE;
+}
+
 //_____________________________________________________________________________
 Bool_t AliMixInputEventHandler::MixBuffer()
 {
@@ -101,6 +101,7 @@ private:
    Long64_t fCurrentEntryMainTree; //! current entry in current tree (main event)
 
    virtual Bool_t          MixStd();
+   virtual Bool_t          MixCompact();
    virtual Bool_t          MixBuffer();
    virtual Bool_t          MixEventsMoreTimesWithOneEvent();
    virtual Bool_t          MixEventsMoreTimesWithBuffer();
@@ -13,9 +13,15 @@
 #include "AliExternalBDT.h"
 
 #include <cassert>
+#include <cerrno>
+#include <cstdio>
 #include <iostream>
+#include <limits>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace {
   inline bool checkFile (const std::string name) {
@@ -27,57 +33,117 @@ namespace {
       return false;
     }
   }
+
+  inline void removeDirectory (const std::string &path) {
+    system((std::string("rm -rf ") + path).data());
+  }
+
+  /// mkdir -p: creates the missing parents, an already existing directory is not an error
+  inline bool makeDirectories (const std::string &path) {
+    for (size_t pos = path.find('/', 1); ; pos = path.find('/', pos + 1)) {
+      const std::string dir = path.substr(0, pos);
+      if (!dir.empty() && mkdir(dir.data(), 0755) != 0 && errno != EEXIST) return false;
+      if (pos == std::string::npos) break;
+    }
+    struct stat info;
+    return stat(path.data(), &info) == 0 && S_ISDIR(info.st_mode);
+  }
+
+  /// 64 bit FNV-1a hash, used to build content-addressed cache keys
+  inline void hashBytes (uint64_t &hash, const char *data, size_t size) {
+    for (size_t iByte = 0; iByte < size; ++iByte) {
+      hash ^= static_cast<unsigned char>(data[iByte]);
+      hash *= 1099511628211ull;
+    }
+  }
 }
 
 AliExternalBDT::AliExternalBDT(std::string name) :
   fBDTname{name},
+  fCacheDir{""},
+  fCompilerFlags{"-O1"},
+  fLibraryPath{""},
   fModel{},
   fModelPath{""},
   fModelName{""},
   fCompiler{},
-  fPredictor{}
+  fPredictor{},
+  fEntries{},
+  fBatchInput{},
+  fBatchOutput{}
 {
 }
 
 
-bool AliExternalBDT::CompileAndLoadModelLibrary() {
-  std::string path = GetUniquePath();
-  if (checkFile(path + "/main.so")) {
-    std::cout << "Library found: " << path.data() << "/main.so . Loading it!" << std::endl;
-  } else {
-    std::cout << "Starting the model compilation, depending on the model size it can take a while..." << std::endl;
-    system((std::string("gcc -c -O1 -fPIC ") + path + "/main.c -o " + path + "/main.o && gcc -shared " + path + \
-          "/main.o -o " + path + "/main.so").data());
+bool AliExternalBDT::CompileAndLoadModelLibrary(const std::string &codePath) {
+  std::cout << "Starting the model compilation, depending on the model size it can take a while..." << std::endl;
+  const int status = system((std::string("gcc -c ") + fCompilerFlags + " -fPIC " + codePath + "/main.c -o " +
+        codePath + "/main.o && gcc -shared " + codePath + "/main.o -o " + codePath + "/main.so").data());
+  if (status != 0) {
+    std::cerr << "Model compilation failed." << std::endl;
+    removeDirectory(codePath);
+    return false;
+  }
+  /// publish atomically: concurrent jobs compiling the same model rename identical libraries
+  if (std::rename((codePath + "/main.so").data(), fLibraryPath.data()) != 0 && !checkFile(fLibraryPath)) {
+    std::cerr << "Publishing of " << fLibraryPath.data() << " failed." << std::endl;
+    removeDirectory(codePath);
+    return false;
   }
-  return LoadModelLibrary(path + "/main.so");
+  removeDirectory(codePath);
+  return LoadModelLibrary(fLibraryPath);
 }
 
-bool AliExternalBDT::CreateModelCode() {
-  std::string path = GetUniquePath();
-  if (checkFile(path + "/main.c")) {
-    std::cout << "Code found: " << path.data() << "/main.c . \
-      Remove it or unset/change the AliExternalBDT name to force its regeneration." << std::endl;
-  } else {
-    const int status_comp = TreeliteCompilerCreate("ast_native", &fCompiler);
-    if (status_comp != 0) {
-      std::cerr << "Compiler creation failed." << std::endl;
-      return false;
-    }
-    const int status_gen = TreeliteCompilerGenerateCode(fCompiler, fModel, 1, path.data());
-    if (status_gen != 0) {
-      std::cerr << "Code generation failed." << std::endl;
-      return false;
-    }
+bool AliExternalBDT::CreateModelCode(const std::string &codePath) {
+  if (mkdir(codePath.data(), 0755) != 0) {
+    std::cerr << "Cannot create the code directory " << codePath.data() << std::endl;
+    return false;
+  }
+  const int status_comp = TreeliteCompilerCreate("ast_native", &fCompiler);
+  if (status_comp != 0) {
+    std::cerr << "Compiler creation failed." << std::endl;
+    removeDirectory(codePath);
+    return false;
+  }
+  const int status_gen = TreeliteCompilerGenerateCode(fCompiler, fModel, 1, codePath.data());
+  TreeliteCompilerFree(fCompiler);
+  if (status_gen != 0) {
+    std::cerr << "Code generation failed." << std::endl;
+    removeDirectory(codePath);
+    return false;
   }
   return true;
 }
 
-std::string AliExternalBDT::GetUniquePath() {
-  if (fBDTname.empty()) {
-    return fModelName + std::to_string((unsigned long)this);
-  } else {
-    return fBDTname + "_" + fModelName;
+std::string AliExternalBDT::GetCacheDirectory() const {
+  if (!fCacheDir.empty()) return fCacheDir;
+  const char *envDir = getenv("ALIEXTERNALBDT_CACHE_DIR");
+  return envDir ? std::string(envDir) : std::string(".");
+}
+
+bool AliExternalBDT::GetCacheKey(std::string &key) const {
+  FILE *file = fopen(fModelPath.data(), "rb");
+  if (file == NULL) {
+    std::cerr << "Cannot read the model file " << fModelPath.data() << std::endl;
+    return false;
+  }
+  uint64_t hash = 14695981039346656037ull;
+  char buffer[65536];
+  size_t nRead = 0;
+  while ((nRead = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    hashBytes(hash, buffer, nRead);
   }
+  fclose(file);
+  hashBytes(hash, fCompilerFlags.data(), fCompilerFlags.size());
+  char hex[17];
+  snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+  key = hex;
+  return true;
+}
+
+std::string AliExternalBDT::GetTemporaryPath(const std::string &key) const {
+  return GetCacheDirectory() + "/" + fModelName + "_" + key + ".tmp" + std::to_string(getpid()) + "_" +
+    std::to_string((unsigned long)this);
 }
 
 bool AliExternalBDT::LoadModel(const std::string &path, int type) {
@@ -87,6 +153,14 @@ bool AliExternalBDT::LoadModel(const std::string &path, int type) {
   }
   fModelPath = path;
   fModelName = fModelPath.substr(fModelPath.find_last_of("\\/")+1,fModelPath.size());
+  std::string key;
+  if (!GetCacheKey(key)) return false;
+  fLibraryPath = GetCacheDirectory() + "/" + fModelName + "_" + key + ".so";
+  if (checkFile(fLibraryPath)) {
+    std::cout << "Library found: " << fLibraryPath.data() << " . Loading it!" << std::endl;
+    return LoadModelLibrary(fLibraryPath);
+  }
+
   int status = 0;
   switch (type) {
     case 0:
@@ -103,9 +177,20 @@ bool AliExternalBDT::LoadModel(const std::string &path, int type) {
     std::cerr << "Model loading failed" << std::endl;
     return false;
   }
-  if (!CreateModelCode()) return false;
-  if (!CompileAndLoadModelLibrary()) return false;
-  return true;
+  const std::string cacheDir = GetCacheDirectory();
+  if (!makeDirectories(cacheDir)) {
+    std::cerr << "Cannot create the cache directory " << cacheDir.data() << std::endl;
+    TreeliteFreeModel(fModel);
+    fModel = nullptr;
+    return false;
+  }
+  const std::string codePath = GetTemporaryPath(key);
+  const bool codeCreated = CreateModelCode(codePath);
+  /// the model is only needed to generate the code
+  TreeliteFreeModel(fModel);
+  fModel = nullptr;
+  if (!codeCreated) return false;
+  return CompileAndLoadModelLibrary(codePath);
 }
 
 bool AliExternalBDT::LoadXGBoostModel(std::string path) {
@@ -128,16 +213,47 @@ bool AliExternalBDT::LoadModelLibrary(std::string path) {
 }
 
 double AliExternalBDT::Predict(double *features, int size, bool useRawScore) {
-  std::vector<TreelitePredictorEntry> entries(size);
-  for (size_t iEntry = 0; iEntry < entries.size(); ++iEntry) {
-    entries[iEntry].fvalue = static_cast<float>(features[iEntry]);
+  fEntries.resize(size);
+  for (size_t iEntry = 0; iEntry < fEntries.size(); ++iEntry) {
+    fEntries[iEntry].fvalue = static_cast<float>(features[iEntry]);
   }
   size_t out_size{0u};
   TreelitePredictorQueryResultSizeSingleInst(fPredictor, &out_size);
   assert(out_size == 1);
   float output = 0.f;
-  TreelitePredictorPredictInst(fPredictor, entries.data(),
+  TreelitePredictorPredictInst(fPredictor, fEntries.data(),
       static_cast<int>(useRawScore), &output,
       &out_size);
   return output;
 }
+
+bool AliExternalBDT::PredictBatch(const double *features, int nRows, int nFeatures, double *scores, bool useRawScore) {
+  if (nRows <= 0) return true;
+  const size_t nValues = static_cast<size_t>(nRows) * nFeatures;
+  if (fBatchInput.size() < nValues) fBatchInput.resize(nValues);
+  if (fBatchOutput.size() < static_cast<size_t>(nRows)) fBatchOutput.resize(nRows);
+  for (size_t iValue = 0; iValue < nValues; ++iValue) {
+    fBatchInput[iValue] = static_cast<float>(features[iValue]);
+  }
+
+  DenseBatchHandle batch;
+  if (TreeliteAssembleDenseBatch(fBatchInput.data(), std::numeric_limits<float>::quiet_NaN(),
+        static_cast<size_t>(nRows), static_cast<size_t>(nFeatures), &batch) != 0) {
+    std::cerr << "Dense batch assembly failed" << std::endl;
+    return false;
+  }
+  size_t out_size{0u};
+  TreelitePredictorQueryResultSize(fPredictor, batch, 0, &out_size);
+  assert(out_size == static_cast<size_t>(nRows));
+  const int status = TreelitePredictorPredictBatch(fPredictor, batch, 0, 0,
+      static_cast<int>(useRawScore), fBatchOutput.data(), &out_size);
+  TreeliteDeleteDenseBatch(batch);
+  if (status != 0) {
+    std::cerr << "Batch prediction failed" << std::endl;
+    return false;
+  }
+  for (int iRow = 0; iRow < nRows; ++iRow) {
+    scores[iRow] = fBatchOutput[iRow];
+  }
+  return true;
+}
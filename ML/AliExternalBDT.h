@@ -29,20 +29,40 @@ public:
   bool LoadModelLibrary(std::string path);
   bool LoadXGBoostModel(std::string path);
 
+  /// Compiled models are cached as <dir>/<model>_<hash>.so, where the hash covers the model
+  /// file and the compiler flags. The directory defaults to $ALIEXTERNALBDT_CACHE_DIR or to
+  /// the working directory, and can point to a directory shared among jobs.
+  void SetCacheDirectory(std::string dir) { fCacheDir = dir; }
+  void SetOptimisationLevel(int level) { fCompilerFlags = "-O" + std::to_string(level); }
+  void SetCompilerFlags(std::string flags) { fCompilerFlags = flags; }
+
   double Predict(double *features, int size, bool useRaw = false);
+  /// Batched prediction on a contiguous row-major [nRows x nFeatures] matrix.
+  /// The internal buffers are reused between calls, so that no allocation
+  /// happens once they reached the largest batch size.
+  bool PredictBatch(const double *features, int nRows, int nFeatures, double *scores, bool useRaw = false);
 
 private:
-  bool CompileAndLoadModelLibrary();
-  bool CreateModelCode();
-  std::string GetUniquePath();
+  bool CompileAndLoadModelLibrary(const std::string &codePath);
+  bool CreateModelCode(const std::string &codePath);
+  std::string GetCacheDirectory() const;
+  bool GetCacheKey(std::string &key) const;
+  std::string GetTemporaryPath(const std::string &key) const;
   bool LoadModel(const std::string &path, int type);
 
-  std::string fBDTname;       /// Unique name of this external BDT handler
+  std::string fBDTname;       /// Name of this external BDT handler
+  std::string fCacheDir;      /// Directory of the compiled model cache
+  std::string fCompilerFlags; /// Flags used to compile the generated model code
+  std::string fLibraryPath;   /// Path of the compiled model in the cache
   ModelHandle fModel;
   std::string fModelPath;
   std::string fModelName;
   CompilerHandle fCompiler;
   PredictorHandle fPredictor;
+
+  std::vector<TreelitePredictorEntry> fEntries; /// single instance input buffer
+  std::vector<float> fBatchInput;               /// dense batch input buffer
+  std::vector<float> fBatchOutput;              /// dense batch output buffer
 };
 
 #endif
@@ -20,13 +20,15 @@
 #include <TSystem.h>
 #include "AliLog.h"
 #include "AliExternalBDT.h"
+#include "AliMLTreeEnsemble.h"
 
 /// \cond CLASSIMP
 ClassImp(AliMLModelHandler);
 /// \endcond
 
 //_______________________________________________________________________________
-AliMLModelHandler::AliMLModelHandler() : TNamed(), fModel{nullptr}, fPath{}, fLibrary{}, fScoreCut{} {
+AliMLModelHandler::AliMLModelHandler()
+    : TNamed(), fModel{nullptr}, fNativeModel{nullptr}, fPath{}, fLibrary{}, fScoreCut{} {
   //
   // Default constructor
   //
@@ -34,12 +36,15 @@ AliMLModelHandler::AliMLModelHandler() : TNamed(), fModel{nullptr}, fPath{}, fLi
 
 //_______________________________________________________________________________
 AliMLModelHandler::AliMLModelHandler(const YAML::Node &node)
-    : TNamed(), fModel{nullptr}, fPath{node["path"].as<std::string>()},
+    : TNamed(), fModel{nullptr}, fNativeModel{nullptr}, fPath{node["path"].as<std::string>()},
       fLibrary{node["library"].as<std::string>()}, fScoreCut{node["cut"].as<double>()} {
   //
   // Standard constructor
   //
   fModel = new AliExternalBDT();
+  /// optional "evaluator: native" to bypass the treelite code generation
+  if (node["evaluator"] && node["evaluator"].as<std::string>() == "native")
+    fNativeModel = new AliMLTreeEnsemble();
 }
 
 AliMLModelHandler::~AliMLModelHandler() {
@@ -48,16 +53,20 @@ AliMLModelHandler::~AliMLModelHandler() {
   //
   if(fModel)
     delete fModel;
+  if(fNativeModel)
+    delete fNativeModel;
 }
 
 //_______________________________________________________________________________
 AliMLModelHandler::AliMLModelHandler(const AliMLModelHandler &source)
-    : TNamed(source.GetName(), source.GetTitle()), fModel{nullptr}, fPath{source.fPath},
+    : TNamed(source.GetName(), source.GetTitle()), fModel{nullptr}, fNativeModel{nullptr}, fPath{source.fPath},
       fLibrary{source.fLibrary}, fScoreCut{source.fScoreCut} {
   //
   // Copy constructor
   //
   fModel = new AliExternalBDT(*source.fModel);
+  if(source.fNativeModel)
+    fNativeModel = new AliMLTreeEnsemble(*source.fNativeModel);
 }
 
 AliMLModelHandler &AliMLModelHandler::operator=(const AliMLModelHandler &source) {
@@ -71,6 +80,9 @@ AliMLModelHandler &AliMLModelHandler::operator=(const AliMLModelHandler &source)
   if(fModel)
     delete fModel;
   fModel = new AliExternalBDT(*source.fModel);
+  if(fNativeModel)
+    delete fNativeModel;
+  fNativeModel = source.fNativeModel ? new AliMLTreeEnsemble(*source.fNativeModel) : nullptr;
 
   fPath      = source.fPath;
   fLibrary   = source.fLibrary;
@@ -88,6 +100,18 @@ bool AliMLModelHandler::CompileModel() {
 
   std::string localpath = ImportFile(fPath);
 
+  if (fNativeModel) {
+    switch (libraryMap[GetLibrary()]) {
+      case kXGBoost:
+        return fNativeModel->LoadXGBoostJSONModel(localpath.data());
+      case kLightGBM:
+        return fNativeModel->LoadLightGBMModel(localpath.data());
+      default:
+        AliErrorClass("The native evaluator supports only kXGBoost (JSON) and kLightGBM models");
+        return false;
+    }
+  }
+
   switch (libraryMap[GetLibrary()]) {
     case kXGBoost: {
       return fModel->LoadXGBoostModel(localpath.data());
@@ -108,6 +132,20 @@ bool AliMLModelHandler::CompileModel() {
   }
 }
 
+//_______________________________________________________________________________
+double AliMLModelHandler::Predict(double *features, int size, bool useRaw) {
+  if (fNativeModel)
+    return fNativeModel->Predict(features, size, useRaw);
+  return fModel->Predict(features, size, useRaw);
+}
+
+//_______________________________________________________________________________
+bool AliMLModelHandler::PredictBatch(const double *features, int nRows, int nFeatures, double *scores, bool useRaw) {
+  if (fNativeModel)
+    return fNativeModel->PredictBatch(features, nRows, nFeatures, scores, useRaw);
+  return fModel->PredictBatch(features, nRows, nFeatures, scores, useRaw);
+}
+
 //_______________________________________________________________________________
 std::string AliMLModelHandler::ImportFile(std::string path) {
   std::string modelname = path.substr(path.find_last_of("/") + 1);
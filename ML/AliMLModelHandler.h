@@ -22,6 +22,7 @@ namespace YAML {
   class Node;
 }
 class AliExternalBDT;
+class AliMLTreeEnsemble;
 
 class AliMLModelHandler : public TNamed {
 public:
@@ -35,15 +36,21 @@ public:
   AliMLModelHandler &operator=(const AliMLModelHandler &source);
 
   AliExternalBDT *GetModel() { return fModel; }
+  AliMLTreeEnsemble *GetNativeModel() { return fNativeModel; }
+  bool UseNativeEvaluator() const { return fNativeModel != nullptr; }
   std::string const &GetPath() const { return fPath; }
   std::string const &GetLibrary() const { return fLibrary; }
   double const &GetScoreCut() const { return fScoreCut; }
 
   bool CompileModel();
+  /// prediction with the evaluator selected in the config (treelite or native)
+  double Predict(double *features, int size, bool useRaw);
+  bool PredictBatch(const double *features, int nRows, int nFeatures, double *scores, bool useRaw);
   static std::string ImportFile(std::string path);
 
 private:
   AliExternalBDT *fModel;  //!<!
+  AliMLTreeEnsemble *fNativeModel;  //!<! set if the native evaluator is requested in the config
 
   std::string fPath;       ///
   std::string fLibrary;    ///
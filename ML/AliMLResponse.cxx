@@ -29,7 +29,8 @@ ClassImp(AliMLResponse);
 //_______________________________________________________________________________
 AliMLResponse::AliMLResponse()
     : TNamed(), fConfigFilePath{}, fModels{}, fCentClasses{}, fBins{}, fVariableNames{}, fNBins{}, fNVariables{},
-      fBinsBegin{}, fRaw{} {
+      fBinsBegin{}, fRaw{}, fFeatures{}, fBatchBins{}, fBatchOffsets{}, fBatchOrder{}, fBatchFeatures{},
+      fBatchScores{} {
   //
   // Default constructor
   //
@@ -38,7 +39,8 @@ AliMLResponse::AliMLResponse()
 //_______________________________________________________________________________
 AliMLResponse::AliMLResponse(const Char_t *name, const Char_t *title)
     : TNamed(name, title), fConfigFilePath{""}, fModels{}, fCentClasses{}, fBins{}, fVariableNames{}, fNBins{},
-      fNVariables{}, fBinsBegin{}, fRaw{} {
+      fNVariables{}, fBinsBegin{}, fRaw{}, fFeatures{}, fBatchBins{}, fBatchOffsets{}, fBatchOrder{},
+      fBatchFeatures{}, fBatchScores{} {
   //
   // Standard constructor
   //
@@ -55,7 +57,8 @@ AliMLResponse::~AliMLResponse() {
 AliMLResponse::AliMLResponse(const AliMLResponse &source)
     : TNamed(source.GetName(), source.GetTitle()), fConfigFilePath{source.fConfigFilePath}, fModels{source.fModels},
       fCentClasses{source.fCentClasses}, fBins{source.fBins}, fVariableNames{source.fVariableNames},
-      fNBins{source.fNBins}, fNVariables{source.fNVariables}, fBinsBegin{source.fBinsBegin}, fRaw{source.fRaw} {
+      fNBins{source.fNBins}, fNVariables{source.fNVariables}, fBinsBegin{source.fBinsBegin}, fRaw{source.fRaw},
+      fFeatures{}, fBatchBins{}, fBatchOffsets{}, fBatchOrder{}, fBatchFeatures{}, fBatchScores{} {
   //
   // Copy constructor
   //
@@ -151,28 +154,29 @@ int AliMLResponse::FindBin(double binvar) {
 }
 
 //_______________________________________________________________________________
-double AliMLResponse::Predict(double binvar, map<string, double> varmap) {
+double AliMLResponse::Predict(double binvar, const map<string, double> &varmap) {
   if ((int)varmap.size() < fNVariables) {
     AliFatal("The variable map you provided to the predictor has a size smaller than the variable list size! Exit");
   }
 
-  vector<double> features;
-  for (const auto &varname : fVariableNames) {
-    if (varmap.find(varname) == varmap.end()) {
-      AliFatal(Form("Variable |%s| not found in variable list provided in config! Exit", varname.data()));
+  fFeatures.resize(fNVariables);
+  for (int iVar = 0; iVar < fNVariables; ++iVar) {
+    const auto var = varmap.find(fVariableNames[iVar]);
+    if (var == varmap.end()) {
+      AliFatal(Form("Variable |%s| not found in variable list provided in config! Exit", fVariableNames[iVar].data()));
     }
-    features.push_back(varmap[varname]);
+    fFeatures[iVar] = var->second;
   }
 
   int bin = FindBin(binvar);
   if (bin < 0)
     return -999.;
 
-  return fModels.at(bin - 1).GetModel()->Predict(&features[0], fNVariables, fRaw);
+  return fModels.at(bin - 1).Predict(fFeatures.data(), fNVariables, fRaw);
 }
 
 //_______________________________________________________________________________
-double AliMLResponse::Predict(double binvar, vector<double> variables) {
+double AliMLResponse::Predict(double binvar, const vector<double> &variables) {
   if ((int)variables.size() != fNVariables) {
     AliFatal(Form("Number of variables passed (%d) different from the one used in the model (%d)! Exit",
                   (int)variables.size(), fNVariables));
@@ -182,17 +186,68 @@ double AliMLResponse::Predict(double binvar, vector<double> variables) {
   if (bin < 0)
     return -999.;
 
-  return fModels.at(bin - 1).GetModel()->Predict(&variables[0], fNVariables, fRaw);
+  return fModels.at(bin - 1).Predict(const_cast<double *>(variables.data()), fNVariables, fRaw);
 }
 
 //_______________________________________________________________________________
-bool AliMLResponse::IsSelected(double binvar, std::map<std::string, double> varmap) {
+void AliMLResponse::PredictBatch(const vector<double> &binvars, const vector<double> &features,
+                                 vector<double> &scores) {
+  const int nCand = binvars.size();
+  if ((int)features.size() != nCand * fNVariables) {
+    AliFatal(Form("Size of the feature matrix (%d) different from candidates x variables (%d x %d)! Exit",
+                  (int)features.size(), nCand, fNVariables));
+  }
+  scores.assign(nCand, -999.);
+  if (nCand == 0)
+    return;
+
+  /// counting sort of the candidates by model bin, bins 0 and fNBins are outside the binning.
+  /// After the placement pass fBatchOffsets[bin] is the first sorted row of bin.
+  fBatchBins.resize(nCand);
+  fBatchOffsets.assign(fNBins + 3, 0);
+  for (int iCand = 0; iCand < nCand; ++iCand) {
+    int bin = std::lower_bound(fBins.begin(), fBins.end(), binvars[iCand]) - fBins.begin();
+    fBatchBins[iCand] = bin;
+    fBatchOffsets[bin + 2]++;
+  }
+  for (int iBin = 2; iBin < fNBins + 3; ++iBin) {
+    fBatchOffsets[iBin] += fBatchOffsets[iBin - 1];
+  }
+  fBatchOrder.resize(nCand);
+  fBatchFeatures.resize(features.size());
+  fBatchScores.resize(nCand);
+  for (int iCand = 0; iCand < nCand; ++iCand) {
+    const int row = fBatchOffsets[fBatchBins[iCand] + 1]++;
+    fBatchOrder[row] = iCand;
+    std::copy(features.begin() + iCand * fNVariables, features.begin() + (iCand + 1) * fNVariables,
+              fBatchFeatures.begin() + row * fNVariables);
+  }
+
+  /// one model call per populated bin, then scatter back to the input order
+  for (int iBin = 1; iBin < fNBins; ++iBin) {
+    const int first = fBatchOffsets[iBin];
+    const int nRows = fBatchOffsets[iBin + 1] - first;
+    if (nRows == 0)
+      continue;
+    bool status = fModels.at(iBin - 1).PredictBatch(&fBatchFeatures[first * fNVariables], nRows, fNVariables,
+                                                     &fBatchScores[first], fRaw);
+    if (!status) {
+      AliFatal("Error in batched model prediction! Exit");
+    }
+    for (int iRow = first; iRow < first + nRows; ++iRow) {
+      scores[fBatchOrder[iRow]] = fBatchScores[iRow];
+    }
+  }
+}
+
+//_______________________________________________________________________________
+bool AliMLResponse::IsSelected(double binvar, const std::map<std::string, double> &varmap) {
   double score{0.};
   return IsSelected(binvar, varmap, score);
 }
 
 //_______________________________________________________________________________
-bool AliMLResponse::IsSelected(double binvar, std::vector<double> variables) {
+bool AliMLResponse::IsSelected(double binvar, const std::vector<double> &variables) {
   double score{0.};
   return IsSelected(binvar, variables, score);
 }
\ No newline at end of file
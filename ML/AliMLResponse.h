@@ -49,17 +49,21 @@ public:
   /// return the bin index
   int FindBin(double binvar);
   /// return the ML model predicted score (raw or proba, depending on useraw)
-  double Predict(double binvar, std::map<std::string, double> varmap);
+  double Predict(double binvar, const std::map<std::string, double> &varmap);
   /// overload to pass directly a vector of variables
-  double Predict(double binvar, std::vector<double> variables);
+  double Predict(double binvar, const std::vector<double> &variables);
+  /// batched prediction: features is a row-major [binvars.size() x NUM_VAR] matrix, candidates
+  /// are grouped by model bin and scores outside the binning range are set to -999.
+  void PredictBatch(const std::vector<double> &binvars, const std::vector<double> &features,
+                    std::vector<double> &scores);
   /// return true if predicted score for map is above the threshold given in the config
-  bool IsSelected(double binvar, std::map<std::string, double> varmap);
+  bool IsSelected(double binvar, const std::map<std::string, double> &varmap);
   /// overload for getting the model score too
-  template <typename F> bool IsSelected(double binvar, std::map<std::string, double> varmap, F &score);
+  template <typename F> bool IsSelected(double binvar, const std::map<std::string, double> &varmap, F &score);
   /// overload to pass directly a vector of variables
-  bool IsSelected(double binvar, std::vector<double> variables);
+  bool IsSelected(double binvar, const std::vector<double> &variables);
   /// overload for getting the model score too
-  template <typename F> bool IsSelected(double binvar, std::vector<double> variables, F &score);
+  template <typename F> bool IsSelected(double binvar, const std::vector<double> &variables, F &score);
 
 protected:
   std::string fConfigFilePath;    /// path of the config file
@@ -76,12 +80,19 @@ protected:
 
   bool fRaw;    /// set to true to use raw score instead of probability
 
+  std::vector<double> fFeatures;       //!<! feature buffer for the map based prediction
+  std::vector<int> fBatchBins;         //!<! model bin of each candidate of the batch
+  std::vector<int> fBatchOffsets;      //!<! first sorted row of each model bin in the batch
+  std::vector<int> fBatchOrder;        //!<! candidate indices sorted by model bin
+  std::vector<double> fBatchFeatures;  //!<! features of the batch grouped by model bin
+  std::vector<double> fBatchScores;    //!<! scores of the batch grouped by model bin
+
   /// \cond CLASSIMP
   ClassDef(AliMLResponse, 2);    ///
   /// \endcond
 };
 
-template <typename F> bool AliMLResponse::IsSelected(double binvar, std::map<std::string, double> varmap, F &score) {
+template <typename F> bool AliMLResponse::IsSelected(double binvar, const std::map<std::string, double> &varmap, F &score) {
   int bin = FindBin(binvar);
   if (bin < 0)
     return false;
@@ -89,7 +100,7 @@ template <typename F> bool AliMLResponse::IsSelected(double binvar, std::map<std
   return score >= fModels.at(bin - 1).GetScoreCut();
 }
 
-template <typename F> bool AliMLResponse::IsSelected(double binvar, std::vector<double> variables, F &score) {
+template <typename F> bool AliMLResponse::IsSelected(double binvar, const std::vector<double> &variables, F &score) {
   int bin = FindBin(binvar);
   if (bin < 0)
     return false;
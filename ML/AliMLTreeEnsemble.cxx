@@ -0,0 +1,260 @@
+// Copyright CERN. This software is distributed under the terms of the GNU
+// General Public License v3 (GPL Version 3).
+//
+// See http://www.gnu.org/licenses/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file AliMLTreeEnsemble.cxx
+/// \author maximiliano.puccio@cern.ch, pietro.fecchio@cern.ch
+
+#include "AliMLTreeEnsemble.h"
+
+#include "yaml-cpp/yaml.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+
+namespace {
+  template <typename T> std::vector<T> splitValues(const std::string &line) {
+    std::vector<T> values;
+    std::istringstream stream(line);
+    T value;
+    while (stream >> value) values.push_back(value);
+    return values;
+  }
+}
+
+AliMLTreeEnsemble::AliMLTreeEnsemble() :
+  fFeature{},
+  fThreshold{},
+  fLeft{},
+  fNaNRight{},
+  fValue{},
+  fTreeRoots{},
+  fTreeDepths{},
+  fBaseMargin{0.},
+  fSigmoidScale{1.},
+  fInput{},
+  fCurrent{},
+  fMargin{}
+{
+}
+
+void AliMLTreeEnsemble::Clear() {
+  fFeature.clear();
+  fThreshold.clear();
+  fLeft.clear();
+  fNaNRight.clear();
+  fValue.clear();
+  fTreeRoots.clear();
+  fTreeDepths.clear();
+  fBaseMargin = 0.;
+  fSigmoidScale = 1.;
+}
+
+void AliMLTreeEnsemble::AddTree(const std::vector<Node> &nodes, bool strictLess) {
+  /// breadth-first relayout: the two children of every split node are allocated next to each other
+  const int root = fFeature.size();
+  std::vector<int> queue{0}, newIndex{root}, depth{0};
+  fFeature.push_back(0);
+  fThreshold.push_back(0.f);
+  fLeft.push_back(root);
+  fNaNRight.push_back(0);
+  fValue.push_back(0.f);
+  int maxDepth = 0;
+  for (size_t iQueue = 0; iQueue < queue.size(); ++iQueue) {
+    const Node &node = nodes[queue[iQueue]];
+    const int index = newIndex[iQueue];
+    if (node.fLeft < 0) {
+      /// x >= NaN is false for any x, +inf included, and fNaNRight stays 0: a leaf is never left
+      fThreshold[index] = std::numeric_limits<float>::quiet_NaN();
+      fLeft[index] = index;
+      fValue[index] = node.fValue;
+      continue;
+    }
+    /// LightGBM goes left for x <= thr, moved to the x < thr' convention of XGBoost
+    const float threshold = strictLess ? node.fThreshold :
+      std::nextafter(node.fThreshold, std::numeric_limits<float>::infinity());
+    const int left = fFeature.size();
+    fFeature[index] = node.fFeature;
+    fThreshold[index] = threshold;
+    fLeft[index] = left;
+    fNaNRight[index] = node.fNaNAsZero ? (0.f >= threshold) : !node.fDefaultLeft;
+    for (int child : {node.fLeft, node.fRight}) {
+      queue.push_back(child);
+      newIndex.push_back(fFeature.size());
+      depth.push_back(depth[iQueue] + 1);
+      maxDepth = std::max(maxDepth, depth[iQueue] + 1);
+      fFeature.push_back(0);
+      fThreshold.push_back(0.f);
+      fLeft.push_back(0);
+      fNaNRight.push_back(0);
+      fValue.push_back(0.f);
+    }
+  }
+  fTreeRoots.push_back(root);
+  fTreeDepths.push_back(maxDepth);
+}
+
+bool AliMLTreeEnsemble::LoadXGBoostJSONModel(std::string path) {
+  Clear();
+  YAML::Node model;
+  try {
+    model = YAML::LoadFile(path);
+  } catch (std::exception &e) {
+    std::cerr << "XGBoost JSON model loading failed: " << e.what() << std::endl;
+    return false;
+  }
+  const YAML::Node learner = model["learner"];
+  if (!learner) {
+    std::cerr << "Invalid XGBoost JSON model, the learner is missing" << std::endl;
+    return false;
+  }
+  const std::string objective = learner["objective"]["name"].as<std::string>();
+  const double baseScore = learner["learner_model_param"]["base_score"].as<double>();
+  if (objective == "binary:logistic" || objective == "reg:logistic") {
+    fBaseMargin = std::log(baseScore / (1. - baseScore));
+    fSigmoidScale = 1.;
+  } else if (objective == "binary:logitraw" || objective == "reg:squarederror") {
+    fBaseMargin = baseScore;
+    fSigmoidScale = 0.;
+  } else {
+    std::cerr << "XGBoost objective " << objective << " not supported by the native evaluator" << std::endl;
+    return false;
+  }
+
+  for (const auto &tree : learner["gradient_booster"]["model"]["trees"]) {
+    const auto left = tree["left_children"].as<std::vector<int>>();
+    const auto right = tree["right_children"].as<std::vector<int>>();
+    const auto feature = tree["split_indices"].as<std::vector<int>>();
+    const auto condition = tree["split_conditions"].as<std::vector<float>>();
+    const auto defaultLeft = tree["default_left"].as<std::vector<int>>();
+    std::vector<Node> nodes(left.size());
+    for (size_t iNode = 0; iNode < nodes.size(); ++iNode) {
+      /// split_conditions holds the leaf value for leaves
+      nodes[iNode] = {feature[iNode], condition[iNode], left[iNode], right[iNode],
+                      defaultLeft[iNode] != 0, false, condition[iNode]};
+    }
+    AddTree(nodes, true);
+  }
+  return !fTreeRoots.empty();
+}
+
+bool AliMLTreeEnsemble::LoadLightGBMModel(std::string path) {
+  Clear();
+  std::ifstream file(path);
+  if (!file.is_open()) {
+    std::cerr << "Cannot open the LightGBM model " << path.data() << std::endl;
+    return false;
+  }
+  fSigmoidScale = 0.;
+  std::map<std::string, std::string> tree;
+  auto flushTree = [&]() {
+    if (tree.empty()) return true;
+    const int nLeaves = std::stoi(tree["num_leaves"]);
+    const auto leafValue = splitValues<float>(tree["leaf_value"]);
+    std::vector<Node> nodes(2 * nLeaves - 1);
+    if (nLeaves > 1) {
+      const auto feature = splitValues<int>(tree["split_feature"]);
+      const auto threshold = splitValues<double>(tree["threshold"]);
+      const auto decision = splitValues<int>(tree["decision_type"]);
+      const auto left = splitValues<int>(tree["left_child"]);
+      const auto right = splitValues<int>(tree["right_child"]);
+      for (int iNode = 0; iNode < nLeaves - 1; ++iNode) {
+        const int missingType = (decision[iNode] >> 2) & 3;
+        if ((decision[iNode] & 1) || missingType == 1) {
+          std::cerr << "Categorical splits and zero as missing value are not supported by the native evaluator"
+                    << std::endl;
+          return false;
+        }
+        /// leaves are referenced as ~leafIndex and are stored after the split nodes
+        const int leftNode = left[iNode] >= 0 ? left[iNode] : nLeaves - 1 + ~left[iNode];
+        const int rightNode = right[iNode] >= 0 ? right[iNode] : nLeaves - 1 + ~right[iNode];
+        nodes[iNode] = {feature[iNode], static_cast<float>(threshold[iNode]), leftNode, rightNode,
+                        (decision[iNode] & 2) != 0, missingType != 2, 0.f};
+      }
+    }
+    for (int iLeaf = 0; iLeaf < nLeaves; ++iLeaf) {
+      nodes[nLeaves - 1 + iLeaf] = {0, 0.f, -1, -1, false, false, leafValue[iLeaf]};
+    }
+    AddTree(nodes, false);
+    tree.clear();
+    return true;
+  };
+
+  bool inTree = false;
+  std::string line;
+  while (std::getline(file, line)) {
+    const size_t equal = line.find('=');
+    const std::string key = line.substr(0, equal);
+    if (key == "Tree" || key == "end of trees") {
+      if (!flushTree()) return false;
+      inTree = key == "Tree";
+      continue;
+    }
+    if (equal == std::string::npos) continue;
+    const std::string value = line.substr(equal + 1);
+    if (inTree) {
+      tree[key] = value;
+    } else if (key == "objective") {
+      if (value.find("binary") == 0) {
+        const size_t sigmoid = value.find("sigmoid:");
+        fSigmoidScale = sigmoid == std::string::npos ? 1. : std::stod(value.substr(sigmoid + 8));
+      }
+    }
+  }
+  if (!flushTree()) return false;
+  return !fTreeRoots.empty();
+}
+
+double AliMLTreeEnsemble::Predict(double *features, int size, bool useRaw) {
+  double score = 0.;
+  PredictBatch(features, 1, size, &score, useRaw);
+  return score;
+}
+
+bool AliMLTreeEnsemble::PredictBatch(const double *features, int nRows, int nFeatures, double *scores, bool useRaw) {
+  fInput.resize(kBlockSize * nFeatures);
+  fCurrent.resize(kBlockSize);
+  fMargin.resize(kBlockSize);
+  const int *feature = fFeature.data();
+  const float *threshold = fThreshold.data();
+  const int *left = fLeft.data();
+  const int *nanRight = fNaNRight.data();
+  for (int iFirst = 0; iFirst < nRows; iFirst += kBlockSize) {
+    const int nBlock = std::min(kBlockSize, nRows - iFirst);
+    for (int iValue = 0; iValue < nBlock * nFeatures; ++iValue) {
+      fInput[iValue] = static_cast<float>(features[iFirst * nFeatures + iValue]);
+    }
+    const float *input = fInput.data();
+    int *current = fCurrent.data();
+    double *margin = fMargin.data();
+    std::fill(margin, margin + nBlock, fBaseMargin);
+    for (size_t iTree = 0; iTree < fTreeRoots.size(); ++iTree) {
+      std::fill(current, current + nBlock, fTreeRoots[iTree]);
+      for (int iDepth = 0; iDepth < fTreeDepths[iTree]; ++iDepth) {
+        for (int iRow = 0; iRow < nBlock; ++iRow) {
+          const int node = current[iRow];
+          const float x = input[iRow * nFeatures + feature[node]];
+          current[iRow] = left[node] + ((x >= threshold[node]) | ((x != x) & nanRight[node]));
+        }
+      }
+      for (int iRow = 0; iRow < nBlock; ++iRow) {
+        margin[iRow] += fValue[current[iRow]];
+      }
+    }
+    for (int iRow = 0; iRow < nBlock; ++iRow) {
+      scores[iFirst + iRow] = (useRaw || fSigmoidScale == 0.) ? margin[iRow] :
+        1. / (1. + std::exp(-fSigmoidScale * margin[iRow]));
+    }
+  }
+  return true;
+}
@@ -0,0 +1,58 @@
+#include <TRandom3.h>
+#include <TStopwatch.h>
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "AliExternalBDT.h"
+
+#define DELTA 1.0e-6
+
+/// Compare the per-candidate and the batched inference path of AliExternalBDT
+/// on random features. Both paths must return the same scores.
+int benchmark_AliExternalBDT(string path = "", int nCand = 1000000, int nFeatures = 12, int batchSize = 1000) {
+
+  string model_path = path == "" ? "test_xgboost_pt8_12.model" : path + "/" + "test_xgboost_pt8_12.model";
+
+  AliExternalBDT *fBDT = new AliExternalBDT();
+  if (!fBDT->LoadXGBoostModel(model_path.data())) {
+    return 1;
+  }
+
+  TRandom3 rnd(42);
+  std::vector<double> features(static_cast<size_t>(nCand) * nFeatures);
+  for (auto &feature : features) feature = rnd.Uniform(-1., 1.);
+
+  std::vector<double> scoresSingle(nCand), scoresBatch(nCand);
+
+  TStopwatch timer;
+  timer.Start();
+  for (int iCand = 0; iCand < nCand; ++iCand) {
+    scoresSingle[iCand] = fBDT->Predict(&features[static_cast<size_t>(iCand) * nFeatures], nFeatures, true);
+  }
+  timer.Stop();
+  const double tSingle = timer.RealTime();
+
+  timer.Start();
+  for (int iFirst = 0; iFirst < nCand; iFirst += batchSize) {
+    const int nRows = iFirst + batchSize > nCand ? nCand - iFirst : batchSize;
+    fBDT->PredictBatch(&features[static_cast<size_t>(iFirst) * nFeatures], nRows, nFeatures, &scoresBatch[iFirst], true);
+  }
+  timer.Stop();
+  const double tBatch = timer.RealTime();
+  delete fBDT;
+
+  std::cout << "Per-candidate: " << tSingle << " s (" << nCand / tSingle << " cand/s)" << std::endl;
+  std::cout << "Batched (" << batchSize << "): " << tBatch << " s (" << nCand / tBatch << " cand/s)" << std::endl;
+
+  for (int iCand = 0; iCand < nCand; ++iCand) {
+    if (std::abs(scoresSingle[iCand] - scoresBatch[iCand]) > DELTA) {
+      std::cout << "TEST: Fail!" << std::endl;
+      return 1;
+    }
+  }
+  std::cout << "TEST: Success!" << std::endl;
+  return 0;
+}
@@ -0,0 +1,139 @@
+#include <TRandom3.h>
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "AliExternalBDT.h"
+#include "AliMLTreeEnsemble.h"
+
+#define DELTA 1.0e-5
+
+/// Unbalanced XGBoost trees in the JSON format with, for each node: left child, right child, split feature,
+/// split condition (leaf value for leaves), default left. Tree 0 finishes at depth 1 for x1 < 0.5, so its
+/// leaves are kept for one more step of the lockstep traversal.
+const int kNTestTrees = 2;
+const int kNTestNodes = 5;
+const int kTestTrees[kNTestTrees][kNTestNodes][5] = {{{1, 2, 1, 0, 1}, {-1, -1, 0, 0, 0}, {3, 4, 0, 0, 0},
+                                                      {-1, -1, 0, 0, 0}, {-1, -1, 0, 0, 0}},
+                                                     {{1, 2, 0, 0, 0}, {3, 4, 1, 0, 1}, {-1, -1, 0, 0, 0},
+                                                      {-1, -1, 0, 0, 0}, {-1, -1, 0, 0, 0}}};
+const float kTestConditions[kNTestTrees][kNTestNodes] = {{0.5f, 1.f, -0.25f, 2.f, 4.f}, {0.f, -0.5f, 8.f, 16.f, 32.f}};
+
+/// Reference traversal of the test trees, one candidate and one node at a time (XGBoost semantics)
+double scalarTestPrediction(const double *features) {
+  double margin = 0.;
+  for (int iTree = 0; iTree < kNTestTrees; ++iTree) {
+    int node = 0;
+    while (kTestTrees[iTree][node][0] >= 0) {
+      const float x = features[kTestTrees[iTree][node][2]];
+      const bool goLeft = std::isnan(x) ? kTestTrees[iTree][node][4] != 0 : x < kTestConditions[iTree][node];
+      node = kTestTrees[iTree][node][goLeft ? 0 : 1];
+    }
+    margin += kTestConditions[iTree][node];
+  }
+  return margin;
+}
+
+/// Compare the native evaluator with the reference traversal for infinite and missing features
+bool testSpecialValues(string json_path = "test_AliMLTreeEnsemble_special.json") {
+  std::ofstream json(json_path);
+  json << "{\"learner\": {\"objective\": {\"name\": \"binary:logitraw\"}, "
+       << "\"learner_model_param\": {\"base_score\": \"0\"}, "
+       << "\"gradient_booster\": {\"model\": {\"trees\": [";
+  const char *fields[5] = {"left_children", "right_children", "split_indices", "split_conditions", "default_left"};
+  for (int iTree = 0; iTree < kNTestTrees; ++iTree) {
+    json << (iTree ? ", {" : "{");
+    for (int iField = 0; iField < 5; ++iField) {
+      json << (iField ? ", \"" : "\"") << fields[iField] << "\": [";
+      for (int iNode = 0; iNode < kNTestNodes; ++iNode) {
+        json << (iNode ? ", " : "");
+        if (iField == 3) {
+          json << kTestConditions[iTree][iNode];
+        } else {
+          json << kTestTrees[iTree][iNode][iField];
+        }
+      }
+      json << "]";
+    }
+    json << "}";
+  }
+  json << "]}}}}" << std::endl;
+  json.close();
+
+  AliMLTreeEnsemble native;
+  if (!native.LoadXGBoostJSONModel(json_path)) {
+    return false;
+  }
+  const double values[] = {-std::numeric_limits<double>::infinity(), -1., -0.25, 0., 0.5, 1.,
+                           std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()};
+  const int nValues = sizeof(values) / sizeof(values[0]);
+  std::vector<double> features;
+  for (int i0 = 0; i0 < nValues; ++i0) {
+    for (int i1 = 0; i1 < nValues; ++i1) {
+      features.push_back(values[i0]);
+      features.push_back(values[i1]);
+    }
+  }
+  const int nCand = features.size() / 2;
+  std::vector<double> scores(nCand);
+  native.PredictBatch(features.data(), nCand, 2, scores.data(), true);
+  bool success = true;
+  for (int iCand = 0; iCand < nCand; ++iCand) {
+    const double reference = scalarTestPrediction(&features[2 * iCand]);
+    if (scores[iCand] != reference || native.Predict(&features[2 * iCand], 2, true) != reference) {
+      std::cout << "TEST: Fail! features (" << features[2 * iCand] << ", " << features[2 * iCand + 1]
+                << "): " << scores[iCand] << " vs " << reference << std::endl;
+      success = false;
+    }
+  }
+  return success;
+}
+
+/// Compare the native tree evaluator with the treelite compiled model on random features, some of them
+/// infinite or missing. The same XGBoost model is needed in the binary (treelite) and in the JSON (native) format.
+int test_AliMLTreeEnsemble(string model_path = "test_xgboost_pt8_12.model",
+                           string json_path = "test_xgboost_pt8_12.json", int nCand = 100000, int nFeatures = 12) {
+
+  if (!testSpecialValues()) {
+    return 1;
+  }
+
+  AliExternalBDT *fBDT = new AliExternalBDT();
+  if (!fBDT->LoadXGBoostModel(model_path.data())) {
+    return 1;
+  }
+  AliMLTreeEnsemble *fNative = new AliMLTreeEnsemble();
+  if (!fNative->LoadXGBoostJSONModel(json_path.data())) {
+    return 1;
+  }
+
+  TRandom3 rnd(42);
+  std::vector<double> features(static_cast<size_t>(nCand) * nFeatures);
+  for (auto &feature : features) feature = rnd.Uniform(-1., 1.);
+  /// a few percent of infinite and missing features (treelite treats NaN as missing)
+  const double special[3] = {std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+                             std::numeric_limits<double>::quiet_NaN()};
+  for (auto &feature : features) {
+    if (rnd.Rndm() < 0.03) feature = special[rnd.Integer(3)];
+  }
+
+  std::vector<double> scoresTreelite(nCand), scoresNative(nCand);
+  fBDT->PredictBatch(features.data(), nCand, nFeatures, scoresTreelite.data(), true);
+  fNative->PredictBatch(features.data(), nCand, nFeatures, scoresNative.data(), true);
+  delete fBDT;
+  delete fNative;
+
+  for (int iCand = 0; iCand < nCand; ++iCand) {
+    if (std::abs(scoresTreelite[iCand] - scoresNative[iCand]) > DELTA) {
+      std::cout << "TEST: Fail! candidate " << iCand << ": " << scoresTreelite[iCand] << " vs "
+                << scoresNative[iCand] << std::endl;
+      return 1;
+    }
+  }
+  std::cout << "TEST: Success!" << std::endl;
+  return 0;
+}
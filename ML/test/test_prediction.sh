@@ -8,3 +8,4 @@ curl http://personalpages.to.infn.it/~fecchio/test_extBDT/test_tree_pt8_12.root
 curl http://personalpages.to.infn.it/~fecchio/test_extBDT/xgboost_pred.txt -o ${DIRPATH}/xgboost_pred.txt
 
 root -q -b -l ../macros/test_AliEsternalBDT.cc\(\"${DIRPATH}\"\)
+root -q -b -l ../macros/benchmark_AliExternalBDT.cc\(\"${DIRPATH}\"\)
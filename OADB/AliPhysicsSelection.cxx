@@ -65,6 +65,8 @@
 //   Origin: Jan Fiete Grosse-Oetringhaus, CERN 
 //           Michele Floris, CERN
 //-------------------------------------------------------------------------
+#include <algorithm>
+#include <cctype>
 #include <vector>
 
 #include <Riostream.h>
@@ -91,6 +93,7 @@
 
 #include "AliVEvent.h"
 #include "AliESDEvent.h"
+#include "AliESDRun.h"
 #include "AliAnalysisTaskSE.h"
 #include "AliAnalysisManager.h"
 #include "TPRegexp.h"
@@ -111,6 +114,50 @@
 
 class StringToRegexp : public std::map<std::string, TPRegexp> {};
 
+// trigger class spec (see CheckTriggerClass) resolved to the trigger classes of one run
+struct CompiledTriggerClass {
+  Bool_t fCompiled;                                        // kFALSE if the spec has to be checked with CheckTriggerClass
+  std::vector<std::pair<ULong64_t, ULong64_t> > fRequired; // per required entry the classes (bits 0-49, 50-99) of which one has to be fired
+  ULong64_t fRejected[2];                                  // classes of which none may be fired
+  std::vector<Int_t> fBCs;                                 // accepted bunch crossings (any if empty)
+  UInt_t fReturnCode;                                      // value returned if successful
+  Int_t fTriggerLogic;                                     // triggerLogic value
+};
+
+class CompiledTriggerClasses : public std::vector<CompiledTriggerClass> {};
+
+namespace {
+  // number following one of the prefixes #&* in a trigger class spec
+  Int_t ReadTriggerNumber(const char*& str) {
+    Int_t ret = 0;
+    while (*str && *str != ' ')
+      ret = 10 * ret + (*str++ - '0');
+    return ret;
+  }
+
+  // true if the regexp built by FindRegexp is a plain list of class names, which
+  // cannot match across the separators of the fired trigger classes
+  Bool_t IsPlainClassList(const std::string& triggers) {
+    if (triggers.empty()) return kFALSE;
+    for (char c : triggers)
+      if (!isalnum(c) && c != '-' && c != '_' && c != ',' && c != '[' && c != ']') return kFALSE;
+    return kTRUE;
+  }
+
+  UInt_t CheckCompiledTriggerClass(const CompiledTriggerClass& spec, const ULong64_t masks[2], Int_t bc, Int_t& triggerLogic) {
+    if ((masks[0] & spec.fRejected[0]) || (masks[1] & spec.fRejected[1]))
+      return kFALSE; // rejected found
+    for (const auto& required : spec.fRequired)
+      if (!(masks[0] & required.first) && !(masks[1] & required.second))
+        return kFALSE; // required not found
+    if (!spec.fBCs.empty() && std::find(spec.fBCs.begin(), spec.fBCs.end(), bc) == spec.fBCs.end())
+      return kFALSE;
+
+    triggerLogic = spec.fTriggerLogic;
+    return spec.fReturnCode;
+  }
+}
+
 ClassImp(AliPhysicsSelection)
 
 AliPhysicsSelection::AliPhysicsSelection() :
@@ -132,7 +179,10 @@ fPSOADB(0),
 fFillOADB(0),
 fTriggerOADB(0),
 fTriggerToFormula(new StringToFormula()),
-fTriggerToRegexp(new StringToRegexp())
+fTriggerToRegexp(new StringToRegexp()),
+fUseCompiledTriggerClasses(kTRUE),
+fCompiledRun(-1),
+fCompiledTriggerClasses(new CompiledTriggerClasses())
 {
   // constructor
   fCollTrigClasses.SetOwner(1);
@@ -162,7 +212,10 @@ AliPhysicsSelection::AliPhysicsSelection(const char *name) :
  fFillOADB(0),
  fTriggerOADB(0),
  fTriggerToFormula(new StringToFormula()),
- fTriggerToRegexp(new StringToRegexp())
+ fTriggerToRegexp(new StringToRegexp()),
+ fUseCompiledTriggerClasses(kTRUE),
+ fCompiledRun(-1),
+ fCompiledTriggerClasses(new CompiledTriggerClasses())
  {
    // constructor
    fCollTrigClasses.SetOwner(1);
@@ -179,6 +232,7 @@ AliPhysicsSelection::~AliPhysicsSelection(){
   if (fTriggerOADB)  delete fTriggerOADB;
   delete fTriggerToFormula;
   delete fTriggerToRegexp;
+  delete fCompiledTriggerClasses;
 }
 
 UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char* trigger, Int_t& triggerLogic) const {
@@ -199,15 +253,6 @@ UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char
 
   AliDebug(AliLog::kDebug+1, Form("Processing event with triggers %s", classes.Data()));
 
-  struct Util {
-    static Int_t atoi(const char*& str) {
-      Int_t ret = 0;
-      while (*str && *str != ' ')
-        ret = 10 * ret + (*str++ - '0');
-      return ret;
-    }
-  };
-
   std::string str;
   while (true) {
     // finished
@@ -234,19 +279,19 @@ UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char
     if (*trigger == '#') {
       foundBCRequirement = kTRUE;
 
-      if (event->GetBunchCrossNumber() == Util::atoi(++trigger))
+      if (event->GetBunchCrossNumber() == ReadTriggerNumber(++trigger))
         foundCorrectBC = kTRUE;
 
       continue;
     }
     // return value
     if (*trigger == '&') {
-      returnCode = Util::atoi(++trigger);
+      returnCode = ReadTriggerNumber(++trigger);
       continue;
     }
     // triggerLogic value
     if (*trigger == '*') {
-      triggerLogicLocal = Util::atoi(++trigger);
+      triggerLogicLocal = ReadTriggerNumber(++trigger);
       continue;
     }
 
@@ -259,6 +304,95 @@ UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char
   return returnCode;
 }
 
+void AliPhysicsSelection::CompileTriggerClasses(const AliVEvent* event){
+  // resolves the trigger class specs (see CheckTriggerClass) of fCollTrigClasses and fBGTrigClasses
+  // to the trigger classes of the current run, such that the per-event check reduces to a few mask
+  // comparisons. The required and rejected entries are matched with the regexps of FindRegexp on the
+  // individual class names, which gives the same result as on the fired trigger classes of the event
+  // as long as the entries are plain class lists. Other specs as well as events without trigger class
+  // names (AOD) are left to CheckTriggerClass
+  fCompiledRun = event->GetRunNumber();
+  fCompiledTriggerClasses->clear();
+  if (event->GetDataLayoutType() != AliVEvent::kESD) return;
+  const AliESDRun* esdRun = ((AliESDEvent*) event)->GetESDRun();
+  if (!esdRun) return;
+
+  const Int_t nClasses = 100; // classes covered by GetTriggerMask and GetTriggerMaskNext50
+  std::vector<TString> classNames(nClasses);
+  Int_t nNames = 0;
+  for (Int_t i=0; i<nClasses; i++) {
+    const char* name = esdRun->GetTriggerClass(i);
+    if (name && *name) {
+      classNames[i] = name;
+      nNames++;
+    }
+  }
+  if (!nNames) {
+    // all specs would resolve to empty masks, the fired trigger classes are checked instead
+    AliWarning(Form("No trigger class names in the ESD run header of run %d, trigger classes are checked with CheckTriggerClass", fCompiledRun));
+    return;
+  }
+
+  Int_t nColl = fCollTrigClasses.GetEntries();
+  Int_t nBG   = fBGTrigClasses.GetEntries();
+  fCompiledTriggerClasses->resize(nColl+nBG);
+  Int_t nCompiled = 0;
+  std::string str;
+  for (Int_t i=0; i<nColl+nBG; i++) {
+    const char* trigger = i<nColl ? fCollTrigClasses.At(i)->GetName() : fBGTrigClasses.At(i-nColl)->GetName();
+    CompiledTriggerClass& spec = (*fCompiledTriggerClasses)[i];
+    spec.fCompiled = kTRUE;
+    spec.fRejected[0] = spec.fRejected[1] = 0;
+    spec.fReturnCode = AliVEvent::kUserDefined;
+    spec.fTriggerLogic = 0;
+
+    while (*trigger) {
+      if (*trigger == '+' || *trigger == '-') {
+        Bool_t flag = (*trigger == '+');
+        trigger++;
+
+        const char* begin = trigger;
+        while (*trigger && *trigger != ' ')
+          trigger++;
+        str.assign(begin, trigger);
+        if (!IsPlainClassList(str)) {
+          spec.fCompiled = kFALSE;
+          continue;
+        }
+
+        auto& re = FindRegexp(str);
+        ULong64_t mask[2] = {0, 0};
+        for (Int_t j=0; j<nClasses; j++) {
+          if (classNames[j].IsNull() || re.Match(classNames[j], "", 0, 1) < 1) continue;
+          mask[j/50] |= 1ULL << (j%50);
+        }
+        if (flag) {
+          spec.fRequired.push_back(std::make_pair(mask[0], mask[1]));
+        } else {
+          spec.fRejected[0] |= mask[0];
+          spec.fRejected[1] |= mask[1];
+        }
+        continue;
+      }
+      if (*trigger == '#') {
+        spec.fBCs.push_back(ReadTriggerNumber(++trigger));
+        continue;
+      }
+      if (*trigger == '&') {
+        spec.fReturnCode = ReadTriggerNumber(++trigger);
+        continue;
+      }
+      if (*trigger == '*') {
+        spec.fTriggerLogic = ReadTriggerNumber(++trigger);
+        continue;
+      }
+      trigger++;
+    }
+    if (spec.fCompiled) nCompiled++;
+  }
+  AliInfo(Form("Compiled %d of %d trigger class specs for run %d", nCompiled, nColl+nBG, fCompiledRun));
+}
+
 /// Evaluate if the given event fulfills a given trigger logic
 ///
 /// \param event Pointer to the current event
@@ -302,6 +436,14 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
     if (eventType != 7) return kFALSE;
   }
   
+  if (fUseCompiledTriggerClasses && fCompiledRun != fCurrentRun) CompileTriggerClasses(event);
+  const Bool_t compiled = fUseCompiledTriggerClasses && !fCompiledTriggerClasses->empty();
+  ULong64_t masks[2] = {0, 0};
+  if (compiled) {
+    masks[0] = event->GetHeader()->GetTriggerMask();
+    masks[1] = event->GetHeader()->GetTriggerMaskNext50();
+  }
+  
   UInt_t accept = 0;
   Int_t nColl = fCollTrigClasses.GetEntries();
   Int_t nBG   = fBGTrigClasses.GetEntries();
@@ -313,7 +455,9 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
     triggerAnalysis->FillTriggerClasses(event);
     
     Int_t triggerLogic = 0;
-    UInt_t singleTriggerResult = CheckTriggerClass(event, triggerClass, triggerLogic);
+    UInt_t singleTriggerResult = (compiled && (*fCompiledTriggerClasses)[i].fCompiled) ?
+      CheckCompiledTriggerClass((*fCompiledTriggerClasses)[i], masks, event->GetBunchCrossNumber(), triggerLogic) :
+      CheckTriggerClass(event, triggerClass, triggerLogic);
     if (!singleTriggerResult) continue;
     Bool_t onlineDecision  = EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetHardwareTrigger(triggerLogic), kFALSE);
     Bool_t offlineDecision = EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetOfflineTrigger(triggerLogic), kTRUE);
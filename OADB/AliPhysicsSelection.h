@@ -45,6 +45,7 @@ class AliOADBFillingScheme;
 class AliOADBTriggerAnalysis;
 class TPRegexp;
 class StringToRegexp;
+class CompiledTriggerClasses;
 
 typedef std::pair<R5TFormula, std::vector<AliTriggerAnalysis::Trigger>> FormulaAndBits;
 typedef std::map<std::string, FormulaAndBits> StringToFormula;
@@ -99,10 +100,12 @@ public:
   void DetectPassName();
   void ReadOCDB(Bool_t val) { fReadOCDB=val; }
   Bool_t IsMC() const { return fMC; }
+  void SetUseCompiledTriggerClasses(Bool_t flag = kTRUE) { fUseCompiledTriggerClasses = flag; }
 protected:
   UInt_t CheckTriggerClass(const AliVEvent* event, const char* trigger, Int_t& triggerLogic) const;
   Bool_t EvaluateTriggerLogic(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, const char* triggerLogic, Bool_t offline);
   const char * GetTriggerString(TObjString * obj);
+  void CompileTriggerClasses(const AliVEvent* event);
 
   TString fPassName;          // pass name for current run
   Int_t fCurrentRun;          // run number for which the object is initialized
@@ -128,6 +131,10 @@ protected:
   StringToRegexp* fTriggerToRegexp; //!
   TPRegexp& FindRegexp(const std::string& triggers) const;
 
+  Bool_t fUseCompiledTriggerClasses;                 //! use the trigger class specs compiled per run instead of CheckTriggerClass
+  Int_t fCompiledRun;                                //! run for which fCompiledTriggerClasses is compiled
+  CompiledTriggerClasses* fCompiledTriggerClasses;   //! trigger class specs of fCollTrigClasses and fBGTrigClasses resolved to class masks
+
   ClassDef(AliPhysicsSelection, 24)
 private:
   AliPhysicsSelection(const AliPhysicsSelection&);
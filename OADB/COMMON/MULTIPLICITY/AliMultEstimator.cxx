@@ -19,12 +19,203 @@
 #include "TObjString.h"
 #include "TBrowser.h"
 #include "TFormula.h"
+#include "TMath.h"
 #include "RVersion.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
 
 ClassImp(AliMultEstimator);
+
+Bool_t AliMultEstimator::fgUseTFormula = kFALSE;
+
+namespace {
+    //Opcodes of the compiled estimator definitions (stack machine)
+    enum EMultEstimatorOp {
+        kOpConst, kOpVar, kOpNeg, kOpNot,
+        kOpAdd, kOpSub, kOpMul, kOpDiv,
+        kOpLt, kOpGt, kOpLe, kOpGe, kOpEq, kOpNe, kOpAnd, kOpOr,
+        kOpPow, kOpAbs, kOpSqrt, kOpExp, kOpLog, kOpLog10
+    };
+    const Int_t kMaxStack = 32;
+
+    //Recursive descent parser for the TFormula expressions of SetupFormula
+    //(variables as "[i]"), with C++ precedence and double arithmetic as in
+    //the code TFormula generates. Anything that might not evaluate
+    //identically (unknown functions or identifiers, float or integer
+    //division literals, ...) is rejected, TFormula is used in that case.
+    class AliMultEstimatorCompiler {
+    public:
+        AliMultEstimatorCompiler(const TString& lExpr, Int_t lNVars,
+                                 std::vector<Int_t>& lCode, std::vector<Double_t>& lConstants, std::vector<Int_t>& lVariables) :
+        fExpr(lExpr.Data()), fPos(0), fNVars(lNVars), fDepth(0), fMaxDepth(0),
+        fCode(lCode), fConstants(lConstants), fVariables(lVariables) {}
+
+        Bool_t Compile() {
+            Bool_t lIsInt = kFALSE;
+            if ( !ParseBinary(0, lIsInt) ) return kFALSE;
+            SkipSpaces();
+            return fExpr[fPos] == '\0' && fDepth == 1 && fMaxDepth <= kMaxStack;
+        }
+
+    private:
+        //Binary operators by increasing precedence
+        Int_t MatchOperator(Int_t lLevel) {
+            SkipSpaces();
+            const char *c = fExpr + fPos;
+            switch ( lLevel ) {
+                case 0: if ( c[0]=='|' && c[1]=='|' ) { fPos+=2; return kOpOr; } break;
+                case 1: if ( c[0]=='&' && c[1]=='&' ) { fPos+=2; return kOpAnd; } break;
+                case 2:
+                    if ( c[0]=='=' && c[1]=='=' ) { fPos+=2; return kOpEq; }
+                    if ( c[0]=='!' && c[1]=='=' ) { fPos+=2; return kOpNe; }
+                    break;
+                case 3:
+                    if ( c[0]=='<' && c[1]=='=' ) { fPos+=2; return kOpLe; }
+                    if ( c[0]=='>' && c[1]=='=' ) { fPos+=2; return kOpGe; }
+                    if ( c[0]=='<' ) { fPos++; return kOpLt; }
+                    if ( c[0]=='>' ) { fPos++; return kOpGt; }
+                    break;
+                case 4:
+                    if ( c[0]=='+' ) { fPos++; return kOpAdd; }
+                    if ( c[0]=='-' ) { fPos++; return kOpSub; }
+                    break;
+                case 5:
+                    if ( c[0]=='*' ) { fPos++; return kOpMul; }
+                    if ( c[0]=='/' ) { fPos++; return kOpDiv; }
+                    break;
+            }
+            return -1;
+        }
+
+        Bool_t ParseBinary(Int_t lLevel, Bool_t& lIsInt) {
+            if ( lLevel > 5 ) return ParseUnary(lIsInt);
+            if ( !ParseBinary(lLevel+1, lIsInt) ) return kFALSE;
+            Int_t lOp;
+            while ( (lOp = MatchOperator(lLevel)) >= 0 ) {
+                Bool_t lIsIntRight = kFALSE;
+                if ( !ParseBinary(lLevel+1, lIsIntRight) ) return kFALSE;
+                //integer division would not be a floating point division
+                if ( lOp == kOpDiv && lIsInt && lIsIntRight ) return kFALSE;
+                if ( lOp >= kOpLt ) lIsInt = kTRUE; //comparisons and logic yield bool
+                else lIsInt = lIsInt && lIsIntRight;
+                Emit( lOp, -1 );
+            }
+            return kTRUE;
+        }
+
+        Bool_t ParseUnary(Bool_t& lIsInt) {
+            SkipSpaces();
+            const char c = fExpr[fPos];
+            if ( c=='-' || c=='+' || ( c=='!' && fExpr[fPos+1]!='=' ) ) {
+                fPos++;
+                if ( !ParseUnary(lIsInt) ) return kFALSE;
+                if ( c=='-' ) Emit( kOpNeg, 0 );
+                if ( c=='!' ) {
+                    Emit( kOpNot, 0 );
+                    lIsInt = kTRUE;
+                }
+                return kTRUE;
+            }
+            return ParsePrimary(lIsInt);
+        }
+
+        Bool_t ParsePrimary(Bool_t& lIsInt) {
+            SkipSpaces();
+            const char c = fExpr[fPos];
+            if ( c=='(' ) {
+                fPos++;
+                if ( !ParseBinary(0, lIsInt) ) return kFALSE;
+                return Expect(')');
+            }
+            if ( c=='[' ) {
+                //input variable
+                fPos++;
+                char *lEnd = 0;
+                const long lIdx = strtol( fExpr+fPos, &lEnd, 10 );
+                if ( lEnd == fExpr+fPos || lIdx < 0 || lIdx >= fNVars ) return kFALSE;
+                fPos = lEnd - fExpr;
+                if ( !Expect(']') ) return kFALSE;
+                Emit( kOpVar, 1 );
+                fCode.push_back( lIdx );
+                if ( std::find( fVariables.begin(), fVariables.end(), (Int_t) lIdx ) == fVariables.end() )
+                    fVariables.push_back( lIdx );
+                lIsInt = kFALSE;
+                return kTRUE;
+            }
+            if ( isdigit(c) || c=='.' ) {
+                //numeric literal, as a C++ double (or int) literal
+                char *lEnd = 0;
+                const Double_t lVal = strtod( fExpr+fPos, &lEnd );
+                if ( lEnd == fExpr+fPos ) return kFALSE;
+                lIsInt = kTRUE;
+                for ( const char *p = fExpr+fPos; p < lEnd; p++ ) {
+                    if ( *p=='.' || *p=='e' || *p=='E' ) lIsInt = kFALSE;
+                    if ( *p=='x' || *p=='X' ) return kFALSE; //hexadecimal
+                }
+                if ( isalnum(*lEnd) || *lEnd=='_' || *lEnd=='.' ) return kFALSE; //suffixes
+                if ( lIsInt && ( fExpr[fPos]=='0' && lEnd-(fExpr+fPos) > 1 ) ) return kFALSE; //octal
+                if ( lIsInt && lVal > 2147483647. ) return kFALSE;
+                fPos = lEnd - fExpr;
+                Emit( kOpConst, 1 );
+                fCode.push_back( fConstants.size() );
+                fConstants.push_back( lVal );
+                return kTRUE;
+            }
+            if ( isalpha(c) || c=='_' ) {
+                //function call
+                const Int_t lStart = fPos;
+                while ( isalnum(fExpr[fPos]) || fExpr[fPos]=='_' || fExpr[fPos]==':' ) fPos++;
+                const TString lName( fExpr+lStart, fPos-lStart );
+                Int_t lOp = -1;
+                Int_t lNArgs = 1;
+                if ( lName=="TMath::Power" || lName=="pow"   || lName=="std::pow" ) { lOp = kOpPow; lNArgs = 2; }
+                if ( lName=="TMath::Abs"   || lName=="fabs"  || lName=="std::fabs" ) lOp = kOpAbs;
+                if ( lName=="TMath::Sqrt"  || lName=="sqrt"  || lName=="std::sqrt" ) lOp = kOpSqrt;
+                if ( lName=="TMath::Exp"   || lName=="exp"   || lName=="std::exp"   ) lOp = kOpExp;
+                if ( lName=="TMath::Log"   || lName=="log"   || lName=="std::log"   ) lOp = kOpLog;
+                if ( lName=="TMath::Log10" || lName=="log10" || lName=="std::log10" ) lOp = kOpLog10;
+                if ( lOp < 0 || !Expect('(') ) return kFALSE;
+                for ( Int_t iArg=0; iArg<lNArgs; iArg++ ) {
+                    if ( iArg > 0 && !Expect(',') ) return kFALSE;
+                    Bool_t lIsIntArg = kFALSE;
+                    if ( !ParseBinary(0, lIsIntArg) ) return kFALSE;
+                }
+                if ( !Expect(')') ) return kFALSE;
+                Emit( lOp, 1-lNArgs );
+                lIsInt = kFALSE;
+                return kTRUE;
+            }
+            return kFALSE;
+        }
+
+        void SkipSpaces() { while ( isspace(fExpr[fPos]) ) fPos++; }
+        Bool_t Expect(char c) {
+            SkipSpaces();
+            if ( fExpr[fPos] != c ) return kFALSE;
+            fPos++;
+            return kTRUE;
+        }
+        void Emit(Int_t lOp, Int_t lStackChange) {
+            fCode.push_back( lOp );
+            fDepth += lStackChange;
+            if ( fDepth > fMaxDepth ) fMaxDepth = fDepth;
+        }
+
+        const char *fExpr;
+        Int_t fPos;
+        Int_t fNVars;
+        Int_t fDepth;    //stack depth after the code emitted so far
+        Int_t fMaxDepth; //maximum stack depth
+        std::vector<Int_t>&    fCode;
+        std::vector<Double_t>& fConstants;
+        std::vector<Int_t>&    fVariables;
+    };
+}
 //________________________________________________________________
 AliMultEstimator::AliMultEstimator() :
   TNamed(), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0),
+fCompiled(kFALSE), fCode(), fConstants(), fVariables(), fValues(),
 fkUseAnchor(kFALSE), fAnchorPoint(0), fAnchorPercentile(100.0)
 {
   // Constructor
@@ -32,6 +223,7 @@ fkUseAnchor(kFALSE), fAnchorPoint(0), fAnchorPercentile(100.0)
 }
 AliMultEstimator::AliMultEstimator(const char * name, const char * title, TString lInitDef):
 TNamed(name,title), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0),
+fCompiled(kFALSE), fCode(), fConstants(), fVariables(), fValues(),
 fkUseAnchor(kFALSE), fAnchorPoint(0), fAnchorPercentile(100.0)
 {
     //Named, titled, definition constructor
@@ -46,6 +238,11 @@ fValue(e.fValue),
 fMean(e.fMean),
 fPercentile(e.fPercentile),
 fFormula(0),
+fCompiled(e.fCompiled),
+fCode(e.fCode),
+fConstants(e.fConstants),
+fVariables(e.fVariables),
+fValues(e.fValues),
 fkUseAnchor(e.fkUseAnchor),
 fAnchorPoint(e.fAnchorPoint),
 fAnchorPercentile(e.fAnchorPercentile)
@@ -67,6 +264,11 @@ AliMultEstimator& AliMultEstimator::operator=(const AliMultEstimator& e)
     if (fFormula) delete fFormula;
     fFormula = 0;
     if (e.fFormula) fFormula = new TFormula(*e.fFormula);
+    fCompiled   = e.fCompiled;
+    fCode       = e.fCode;
+    fConstants  = e.fConstants;
+    fVariables  = e.fVariables;
+    fValues     = e.fValues;
     
     //Anchor point configs
     fkUseAnchor         = e.fkUseAnchor;
@@ -121,14 +323,26 @@ void AliMultEstimator::SetupFormula(const AliMultInput* lInput)
         lVarName.Prepend("(");
         expr.ReplaceAll(lVarName, repl);
     }
+    if (fFormula) delete fFormula;
     fFormula = new TFormula(Form("e%s", GetName()), expr);
 #if ROOT_VERSION_CODE < ROOT_VERSION(5,99,4)
     fFormula->Optimize();
 #endif
+    //Same expression compiled for the per-event evaluation
+    fCompiled = Compile(expr, nVar);
+    fValues.assign(nVar, 0.);
 }
 //________________________________________________________________
 Float_t AliMultEstimator::Evaluate(const AliMultInput* lInput)
 {
+    if (fCompiled && !fgUseTFormula) {
+        //only the variables used by the definition
+        for (UInt_t i = 0; i < fVariables.size(); i++) {
+            AliMultVariable* v = lInput->GetVariable(fVariables[i]);
+            fValues[fVariables[i]] = v->IsInteger() ? v->GetValueInteger() : v->GetValue();
+        }
+        return Evaluate(&fValues[0]);
+    }
     if (!fFormula) return fValue = 0;
     for (Int_t i = 0; i < lInput->GetNVariables(); i++) {
         AliMultVariable* v = lInput->GetVariable(i);
@@ -138,3 +352,57 @@ Float_t AliMultEstimator::Evaluate(const AliMultInput* lInput)
     }
     return fValue = fFormula->Eval(0);
 }
+//________________________________________________________________
+Bool_t AliMultEstimator::Compile(const TString& lExpr, Int_t lNVars)
+{
+    fCode.clear();
+    fConstants.clear();
+    fVariables.clear();
+    AliMultEstimatorCompiler lCompiler(lExpr, lNVars, fCode, fConstants, fVariables);
+    if (lCompiler.Compile()) return kTRUE;
+    Printf("AliMultEstimator %s: definition %s not compiled, using TFormula", GetName(), fDefinition.Data());
+    fCode.clear();
+    fConstants.clear();
+    fVariables.clear();
+    return kFALSE;
+}
+//________________________________________________________________
+Float_t AliMultEstimator::Evaluate(const Double_t* lValues)
+{
+    if (!fCompiled || fgUseTFormula) {
+        if (!fFormula) return fValue = 0;
+        for (UInt_t i = 0; i < fValues.size(); i++) fFormula->SetParameter(i, lValues[i]);
+        return fValue = fFormula->Eval(0);
+    }
+    Double_t lStack[kMaxStack];
+    Int_t    lTop = -1;
+    const Int_t* lCode = &fCode[0];
+    const Int_t  lSize = fCode.size();
+    for (Int_t i = 0; i < lSize; i++) {
+        switch (lCode[i]) {
+            case kOpConst: lStack[++lTop] = fConstants[lCode[++i]]; break;
+            case kOpVar:   lStack[++lTop] = lValues[lCode[++i]];    break;
+            case kOpNeg:   lStack[lTop] = -lStack[lTop];            break;
+            case kOpNot:   lStack[lTop] = !lStack[lTop];            break;
+            case kOpAdd:   lTop--; lStack[lTop] = lStack[lTop] +  lStack[lTop+1]; break;
+            case kOpSub:   lTop--; lStack[lTop] = lStack[lTop] -  lStack[lTop+1]; break;
+            case kOpMul:   lTop--; lStack[lTop] = lStack[lTop] *  lStack[lTop+1]; break;
+            case kOpDiv:   lTop--; lStack[lTop] = lStack[lTop] /  lStack[lTop+1]; break;
+            case kOpLt:    lTop--; lStack[lTop] = lStack[lTop] <  lStack[lTop+1]; break;
+            case kOpGt:    lTop--; lStack[lTop] = lStack[lTop] >  lStack[lTop+1]; break;
+            case kOpLe:    lTop--; lStack[lTop] = lStack[lTop] <= lStack[lTop+1]; break;
+            case kOpGe:    lTop--; lStack[lTop] = lStack[lTop] >= lStack[lTop+1]; break;
+            case kOpEq:    lTop--; lStack[lTop] = lStack[lTop] == lStack[lTop+1]; break;
+            case kOpNe:    lTop--; lStack[lTop] = lStack[lTop] != lStack[lTop+1]; break;
+            case kOpAnd:   lTop--; lStack[lTop] = lStack[lTop] && lStack[lTop+1]; break;
+            case kOpOr:    lTop--; lStack[lTop] = lStack[lTop] || lStack[lTop+1]; break;
+            case kOpPow:   lTop--; lStack[lTop] = TMath::Power(lStack[lTop], lStack[lTop+1]); break;
+            case kOpAbs:   lStack[lTop] = TMath::Abs  (lStack[lTop]); break;
+            case kOpSqrt:  lStack[lTop] = TMath::Sqrt (lStack[lTop]); break;
+            case kOpExp:   lStack[lTop] = TMath::Exp  (lStack[lTop]); break;
+            case kOpLog:   lStack[lTop] = TMath::Log  (lStack[lTop]); break;
+            case kOpLog10: lStack[lTop] = TMath::Log10(lStack[lTop]); break;
+        }
+    }
+    return fValue = lStack[0];
+}
@@ -1,5 +1,6 @@
 #ifndef AliMultEstimator_H
 #define AliMultEstimator_H
+#include <vector>
 #include <TNamed.h>
 class AliMultInput;
 class TFormula;
@@ -43,8 +44,20 @@ public:
     //Pre-processing for speed
     void SetupFormula(const AliMultInput* lInput);
     Float_t Evaluate(const AliMultInput* lInput);
+
+    //Compiled definition (SetupFormula): evaluation from a flat array of
+    //input values, indexed as the variables of the AliMultInput
+    Bool_t  IsCompiled() const { return fCompiled; }
+    const std::vector<Int_t>& GetCompiledVariables() const { return fVariables; }
+    Float_t Evaluate(const Double_t* lValues);
+
+    //Evaluate through TFormula even if compiled (validation, benchmarking)
+    static void   SetUseTFormula( Bool_t lVal = kTRUE ) { fgUseTFormula = lVal; }
+    static Bool_t GetUseTFormula() { return fgUseTFormula; }
     
 private:
+    Bool_t Compile(const TString& lExpr, Int_t lNVars);
+
     TString fDefinition; //How to evaluate based on AliMultVariables
     Bool_t fIsInteger; //Requires special treatment when calibrating
     
@@ -52,6 +65,14 @@ private:
     Float_t fMean;   // estimator mean value
     Float_t fPercentile;   //Percentile
     TFormula* fFormula; //!
+
+    //Compiled definition: stack machine code, literals and variables used
+    Bool_t                fCompiled;  //!
+    std::vector<Int_t>    fCode;      //!
+    std::vector<Double_t> fConstants; //!
+    std::vector<Int_t>    fVariables; //!
+    std::vector<Double_t> fValues;    //! input values for Evaluate(const AliMultInput*)
+    static Bool_t fgUseTFormula;      // use TFormula evaluation
     
     //Anchor point definition
     Bool_t  fkUseAnchor;        //Use Anchor Logic (default: No)
@@ -0,0 +1,141 @@
+/**********************************************
+ *
+ * Mergeable quantile sketch for the streaming
+ * multiplicity calibration
+ *
+ * Values are stored exactly until fExactLimit
+ * entries have been seen, and ranks are then
+ * identical to a full sort. Beyond that, values
+ * are kept in levels: level h holds values of
+ * weight 2^h and is compacted once it reaches
+ * fCapacity values (sort, keep every other value
+ * with alternating offset, promote to h+1).
+ *
+ * Accuracy: a compaction of level h changes the
+ * rank of any value by at most 2^h. The sum is
+ * tracked in fRankError, which is a guaranteed
+ * bound on the rank error of GetValueAtRank and
+ * never exceeds H*N/fCapacity, H being the number
+ * of levels (~log2(N/fCapacity)+1). Example: with
+ * fCapacity = 16384 and N = 1e8, the bound is
+ * below 0.1% of N, i.e. 0.1 percentile units.
+ *
+ * Sketches filled on disjoint subsets of the data
+ * can be merged with Add; the bounds add up.
+ *
+ **********************************************/
+
+#include <algorithm>
+#include "TMath.h"
+#include "AliMultQuantileSketch.h"
+
+ClassImp(AliMultQuantileSketch);
+
+//________________________________________________________________
+AliMultQuantileSketch::AliMultQuantileSketch(Long64_t lExactLimit, Int_t lCapacity) :
+TObject(), fExactLimit(lExactLimit), fCapacity(lCapacity), fN(0), fExact(kTRUE), fRankError(0),
+fLevels(1), fOffset(1,kFALSE), fSorted(kFALSE), fValues(), fCumWeights()
+{
+    // Constructor
+    if ( fCapacity < 2 ) fCapacity = 2;
+    if ( fExactLimit < 0 ) fExactLimit = 0;
+}
+//________________________________________________________________
+AliMultQuantileSketch::~AliMultQuantileSketch(){
+    // destructor
+}
+//________________________________________________________________
+void AliMultQuantileSketch::Fill ( Float_t lValue ){
+    fLevels[0].push_back( lValue );
+    fN++;
+    fSorted = kFALSE;
+    if ( fExact ){
+        if ( fN <= fExactLimit ) return;
+        //Switch to approximate mode
+        fExact = kFALSE;
+        CompactAll();
+        return;
+    }
+    if ( (Int_t) fLevels[0].size() >= fCapacity ) CompactAll();
+}
+//________________________________________________________________
+void AliMultQuantileSketch::Add ( const AliMultQuantileSketch &lOther ){
+    if ( lOther.fN == 0 ) return;
+    if ( fLevels.size() < lOther.fLevels.size() ){
+        fLevels.resize( lOther.fLevels.size() );
+        fOffset.resize( lOther.fLevels.size(), kFALSE );
+    }
+    for( UInt_t iL=0; iL<lOther.fLevels.size(); iL++)
+        fLevels[iL].insert( fLevels[iL].end(), lOther.fLevels[iL].begin(), lOther.fLevels[iL].end() );
+    fN         += lOther.fN;
+    fRankError += lOther.fRankError;
+    fSorted     = kFALSE;
+    if ( fExact && ( !lOther.fExact || fN > fExactLimit ) ) fExact = kFALSE;
+    if ( !fExact ) CompactAll();
+}
+//________________________________________________________________
+void AliMultQuantileSketch::Compact ( UInt_t lLevel ){
+    if ( lLevel+1 >= fLevels.size() ){
+        fLevels.resize( lLevel+2 );
+        fOffset.resize( lLevel+2, kFALSE );
+    }
+    std::vector<Float_t> &lBuffer = fLevels[lLevel];
+    std::vector<Float_t> &lNext   = fLevels[lLevel+1];
+    std::sort( lBuffer.begin(), lBuffer.end() );
+
+    //Odd leftover (largest value) stays at this level
+    const size_t lNPairs = lBuffer.size()/2;
+    const size_t lOffset = fOffset[lLevel] ? 1 : 0;
+    for( size_t iP=0; iP<lNPairs; iP++) lNext.push_back( lBuffer[2*iP+lOffset] );
+    if ( lBuffer.size() % 2 ) lBuffer[0] = lBuffer.back();
+    lBuffer.resize( lBuffer.size() % 2 );
+
+    fOffset[lLevel] = !fOffset[lLevel];
+    fRankError += TMath::Power(2., (Double_t) lLevel);
+}
+//________________________________________________________________
+void AliMultQuantileSketch::CompactAll(){
+    for( UInt_t iL=0; iL<fLevels.size(); iL++){
+        if ( (Int_t) fLevels[iL].size() >= fCapacity ) Compact( iL );
+    }
+}
+//________________________________________________________________
+void AliMultQuantileSketch::Finalize(){
+    if ( fSorted ) return;
+    if ( fExact ){
+        //Exact: one sorted array, rank = index
+        std::sort( fLevels[0].begin(), fLevels[0].end() );
+        fValues.clear();
+        fCumWeights.clear();
+        fSorted = kTRUE;
+        return;
+    }
+    std::vector< std::pair<Float_t, Long64_t> > lWeighted;
+    for( UInt_t iL=0; iL<fLevels.size(); iL++){
+        const Long64_t lWeight = ((Long64_t)1) << iL;
+        for( size_t iV=0; iV<fLevels[iL].size(); iV++)
+            lWeighted.push_back( std::make_pair( fLevels[iL][iV], lWeight ) );
+    }
+    std::sort( lWeighted.begin(), lWeighted.end() );
+    fValues.resize( lWeighted.size() );
+    fCumWeights.resize( lWeighted.size() );
+    Long64_t lCumulative = 0;
+    for( size_t iV=0; iV<lWeighted.size(); iV++){
+        lCumulative += lWeighted[iV].second;
+        fValues[iV]     = lWeighted[iV].first;
+        fCumWeights[iV] = lCumulative;
+    }
+    fSorted = kTRUE;
+}
+//________________________________________________________________
+Float_t AliMultQuantileSketch::GetValueAtRank ( Long64_t lRank ){
+    if ( fN == 0 ) return 0;
+    if ( lRank < 0    ) lRank = 0;
+    if ( lRank >= fN  ) lRank = fN-1;
+    Finalize();
+    if ( fExact ) return fLevels[0][lRank];
+    //First value whose cumulative weight exceeds the rank
+    std::vector<Long64_t>::const_iterator lIt = std::upper_bound( fCumWeights.begin(), fCumWeights.end(), lRank );
+    if ( lIt == fCumWeights.end() ) return fValues.back();
+    return fValues[ lIt - fCumWeights.begin() ];
+}
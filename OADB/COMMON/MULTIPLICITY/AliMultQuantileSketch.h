@@ -0,0 +1,50 @@
+#ifndef AliMultQuantileSketch_H
+#define AliMultQuantileSketch_H
+#include <vector>
+#include <TObject.h>
+
+class AliMultQuantileSketch : public TObject {
+
+public:
+    AliMultQuantileSketch(Long64_t lExactLimit = 1048576, Int_t lCapacity = 16384);
+    ~AliMultQuantileSketch();
+
+    //Filling and merging (Add: sketches filled in parallel, same configuration)
+    void Fill ( Float_t lValue );
+    void Add  ( const AliMultQuantileSketch &lOther );
+
+    //Getters
+    Long64_t GetEntries() const { return fN; }
+    Bool_t   IsExact()    const { return fExact; }
+    Long64_t GetExactLimit() const { return fExactLimit; }
+    Int_t    GetCapacity()   const { return fCapacity; }
+
+    //Guaranteed upper bound on |estimated rank - true rank| of any value
+    //(zero as long as the sketch is exact)
+    Double_t GetMaxRankError() const { return fRankError; }
+
+    //Value at (ascending, 0-based) rank lRank; ranks outside [0,N) are clamped
+    Float_t GetValueAtRank ( Long64_t lRank );
+
+private:
+    void Compact ( UInt_t lLevel );
+    void CompactAll();
+    void Finalize();
+
+    Long64_t fExactLimit; //keep every value up to this number of entries
+    Int_t    fCapacity;   //max number of values per level once approximate
+    Long64_t fN;          //number of entries
+    Bool_t   fExact;      //all values are still stored
+    Double_t fRankError;  //accumulated rank error bound
+
+    std::vector< std::vector<Float_t> > fLevels; //values of weight 2^level
+    std::vector<Bool_t>                 fOffset; //alternating pair offset per level
+    Bool_t                              fSorted; //! fValues/fCumWeights up to date
+    std::vector<Float_t>                fValues;     //! sorted values (query)
+    std::vector<Long64_t>               fCumWeights; //! cumulative weights (query)
+
+    ClassDef(AliMultQuantileSketch, 2);
+    //1 - original implementation
+    //2 - levels stored, a sketch read back can be merged and queried
+};
+#endif
@@ -37,7 +37,8 @@ fThisEvent_HasNoInconsistentVertices(0),
 fThisEvent_PassesTrackletVsCluster(0),
 fThisEvent_IsNotAsymmetricInVZERO(0),
 fThisEvent_IsNotIncompleteDAQ(0),
-fThisEvent_HasGoodVertex2016(0)
+fThisEvent_HasGoodVertex2016(0),
+fSetupInput(0), fSetupEstimators(), fSetupVariables(), fSetupIndices(), fSetupValues()
 {
   // Constructor
     fEstimatorList = new TList();
@@ -55,7 +56,8 @@ fThisEvent_HasNoInconsistentVertices(0),
 fThisEvent_PassesTrackletVsCluster(0),
 fThisEvent_IsNotAsymmetricInVZERO(0),
 fThisEvent_IsNotIncompleteDAQ(0),
-fThisEvent_HasGoodVertex2016(0)
+fThisEvent_HasGoodVertex2016(0),
+fSetupInput(0), fSetupEstimators(), fSetupVariables(), fSetupIndices(), fSetupValues()
 {
   // Constructor
     fEstimatorList = new TList();
@@ -77,7 +79,8 @@ fThisEvent_HasNoInconsistentVertices(lCopyMe.fThisEvent_HasNoInconsistentVertice
 fThisEvent_PassesTrackletVsCluster(lCopyMe.fThisEvent_PassesTrackletVsCluster),
 fThisEvent_IsNotAsymmetricInVZERO(lCopyMe.fThisEvent_IsNotAsymmetricInVZERO),
 fThisEvent_IsNotIncompleteDAQ(lCopyMe.fThisEvent_IsNotIncompleteDAQ),
-fThisEvent_HasGoodVertex2016(lCopyMe.fThisEvent_HasGoodVertex2016)
+fThisEvent_HasGoodVertex2016(lCopyMe.fThisEvent_HasGoodVertex2016),
+fSetupInput(0), fSetupEstimators(), fSetupVariables(), fSetupIndices(), fSetupValues()
 {
     TIter next(lCopyMe.fEstimatorList);
     AliMultEstimator* est = 0;
@@ -88,7 +91,8 @@ fThisEvent_HasGoodVertex2016(lCopyMe.fThisEvent_HasGoodVertex2016)
 AliMultSelection::AliMultSelection(AliMultSelection *lCopyMe)
     : AliMultSelectionBase(*lCopyMe),
       fNEsts(0),
-      fEstimatorList(0)
+      fEstimatorList(0),
+      fSetupInput(0)
 {
     fEvSelCode = lCopyMe->GetEvSelCode();
 
@@ -156,6 +160,7 @@ void AliMultSelection::CleanUp()
     fEstimatorList = 0;
     fNEsts = 0;
     fEvSelCode = 0;
+    fSetupInput = 0;
 }
 //________________________________________________________________
 AliMultSelection& AliMultSelection::operator=(const AliMultSelection& lCopyMe)
@@ -165,6 +170,7 @@ AliMultSelection& AliMultSelection::operator=(const AliMultSelection& lCopyMe)
     SetTitle(lCopyMe.GetTitle());
     fNEsts = 0;
     fEvSelCode = lCopyMe.fEvSelCode; 
+    fSetupInput = 0; //Setup has to be redone for the new estimators
     if (fEstimatorList) {
         delete fEstimatorList;
         fEstimatorList = 0;
@@ -187,6 +193,7 @@ void AliMultSelection::AddEstimator(AliMultEstimator *lEst)
     }
     fEstimatorList->Add(lEst);
     fNEsts++;
+    fSetupInput = 0;
 }
 //________________________________________________________________
 AliMultEstimator* AliMultSelection::GetEstimator (const TString& lName) const
@@ -239,6 +246,17 @@ void AliMultSelection::Evaluate( AliMultInput *lInput )
 //Master function to evaluate all existing estimators based on
 //a set of input variables. Error handling to be done with care...
 {
+    if (lInput && lInput == fSetupInput && !AliMultEstimator::GetUseTFormula()) {
+        //Read the bound variables once, then evaluate all estimators
+        for (UInt_t i = 0; i < fSetupVariables.size(); i++) {
+            const AliMultVariable* v = fSetupVariables[i];
+            fSetupValues[fSetupIndices[i]] = v->IsInteger() ? v->GetValueInteger() : v->GetValue();
+        }
+        const Double_t* lValues = fSetupValues.empty() ? 0 : &fSetupValues[0];
+        for (UInt_t i = 0; i < fSetupEstimators.size(); i++)
+            fSetupEstimators[i]->Evaluate(lValues);
+        return;
+    }
     //Loop over estimators defined in the acquired list
     AliMultEstimator* estimator = 0;
     TIter             next(fEstimatorList);
@@ -285,4 +303,30 @@ void AliMultSelection::Setup(const AliMultInput* inp)
     
     while ((estimator = static_cast<AliMultEstimator*>(next())))
         estimator->SetupFormula(inp);
+
+    //Bindings: variables used by the compiled definitions, all of them
+    //as soon as one estimator is evaluated with TFormula
+    fSetupInput = inp;
+    fSetupEstimators.clear();
+    fSetupVariables.clear();
+    fSetupIndices.clear();
+    if (!inp) return;
+    const Int_t nVar = inp->GetNVariables();
+    std::vector<Bool_t> lUsed(nVar, kFALSE);
+    next.Reset();
+    while ((estimator = static_cast<AliMultEstimator*>(next()))) {
+        fSetupEstimators.push_back(estimator);
+        if (!estimator->IsCompiled()) {
+            lUsed.assign(nVar, kTRUE);
+            continue;
+        }
+        const std::vector<Int_t>& lVars = estimator->GetCompiledVariables();
+        for (UInt_t i = 0; i < lVars.size(); i++) lUsed[lVars[i]] = kTRUE;
+    }
+    for (Int_t i = 0; i < nVar; i++) {
+        if (!lUsed[i]) continue;
+        fSetupVariables.push_back(inp->GetVariable(i));
+        fSetupIndices.push_back(i);
+    }
+    fSetupValues.assign(nVar, 0.);
 }
@@ -1,11 +1,13 @@
 #ifndef AliMultSelection_H
 #define AliMultSelection_H
+#include <vector>
 #include <TNamed.h>
 #include <TList.h>
 #include "AliMultSelectionBase.h"
 #include "AliMultEstimator.h"
 
 class AliMultInput;
+class AliMultVariable;
 
 class AliMultSelection : public AliMultSelectionBase {
     
@@ -42,7 +44,8 @@ public:
     //Master "Evaluate"
     void Evaluate ( AliMultInput *lInput );
     
-    //Get ready: prepare/optimize TFormulas
+    //Get ready: prepare/optimize TFormulas, compile the definitions
+    //and bind the variables evaluated for lInput
     void Setup(const AliMultInput *lInput);
     
     TList *GetEstimatorList() { return fEstimatorList; } 
@@ -90,6 +93,13 @@ private:
     Bool_t fThisEvent_IsNotIncompleteDAQ;       //!
     Bool_t fThisEvent_HasGoodVertex2016;         //!
     
+    //Bindings of Setup: input variables read once per event for all estimators
+    const AliMultInput*            fSetupInput;      //! input given to Setup
+    std::vector<AliMultEstimator*> fSetupEstimators; //! estimators
+    std::vector<AliMultVariable*>  fSetupVariables;  //! variables used by the estimators
+    std::vector<Int_t>             fSetupIndices;    //! their index in the input
+    std::vector<Double_t>          fSetupValues;     //! values, indexed as the input variables
+    
     ClassDef(AliMultSelection, 6)
     // 1 - original implementation
     // 2 - added fEvSelCode for EvSel bypass + getter changed
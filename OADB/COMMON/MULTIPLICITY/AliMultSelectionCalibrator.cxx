@@ -28,13 +28,264 @@
 #include "TFile.h"
 #include "TStopwatch.h"
 #include "TArrayL64.h"
+#include <algorithm>
+#include "TTree.h"
+#include "TH1F.h"
+#include "TMath.h"
+#include "RVersion.h"
+#include "AliMultQuantileSketch.h"
+#if !defined(__CINT__) && !defined(__MAKECINT__) && (__cplusplus >= 201103L) && (ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0))
+#include <thread>
+#include <functional>
+#include "TROOT.h"
+#define ALIMULTSELECTIONCALIBRATOR_THREADS
+#endif
 
 ClassImp(AliMultSelectionCalibrator);
 
+namespace {
+    //Settings of the streaming calibration, shared (read-only) by all workers
+    struct AliMultCalibStreamConfig {
+        TString  fInputFileName;
+        Bool_t   fAutoDiscover;
+        Bool_t   fCheckTriggerType;
+        UInt_t   fTrigType;
+        TString  fFiredTrigString;
+        //Copy of the AliMultSelectionCuts configuration
+        Float_t  fVzCut;
+        Bool_t   fTriggerCut;
+        Bool_t   fINELgtZEROCut;
+        Bool_t   fRejectPileupInMultBinsCut;
+        Bool_t   fTrackletsVsClustersCut;
+        Bool_t   fVertexConsistencyCut;
+        Bool_t   fNonZeroNContribs;
+        Bool_t   fIsNotAsymmetricInVZERO;
+        Bool_t   fIsNotIncompleteDAQ;
+        Bool_t   fHasGoodVertex2016;
+        const std::map<int, int> *fRunRangesMap;
+        Long64_t fExactLimit;
+        Int_t    fSketchCapacity;
+    };
+
+    //Per run (range) statistics accumulated while streaming
+    struct AliMultCalibRunStats {
+        Long64_t fFirstEntry; //first entry of this run: run ordering in autodiscover mode
+        Long64_t fNEvents;    //selected events used for calibration
+        std::vector<Double_t> fSum;
+        std::vector<Double_t> fMin;
+        std::vector<Double_t> fMax;
+        std::vector<Long64_t> fNAboveAnchor;
+        std::vector<AliMultQuantileSketch> fSketch;       //floating point estimators
+        std::vector< std::map<Float_t, Long64_t> > fCounts; //integer estimators: value -> events
+    };
+
+    //One worker: contiguous range of entries with its own file, input and estimators
+    struct AliMultCalibStreamWorker {
+        Long64_t fFirstEntry;
+        Long64_t fLastEntry;
+        Bool_t   fCountOnly; //pre-pass for fMaxEventsPerRun: event selection only
+        Bool_t   fOK;
+        AliMultInput *fInput;
+        std::vector<AliMultSelection*> fSelections; //one per run range (one in autodiscover mode)
+        std::map<Int_t, Long64_t> fQuota;           //max events to use per run (range), if capped
+        std::map<Int_t, AliMultCalibRunStats> fRuns;
+    };
+
+    //Owns the inputs and estimators of the workers, released on any return of CalibrateStreaming()
+    struct AliMultCalibStreamWorkerCleaner {
+        std::vector<AliMultCalibStreamWorker> &fWorkers;
+        AliMultCalibStreamWorkerCleaner( std::vector<AliMultCalibStreamWorker> &lWorkers ) : fWorkers( lWorkers ) {}
+        ~AliMultCalibStreamWorkerCleaner(){
+            for( UInt_t iW=0; iW<fWorkers.size(); iW++){
+                AliMultCalibStreamWorker &lWorker = fWorkers[iW];
+                for( UInt_t iSel=0; iSel<lWorker.fSelections.size(); iSel++) delete lWorker.fSelections[iSel];
+                lWorker.fSelections.clear();
+                if ( !lWorker.fInput ) continue;
+                for(Long_t iVar=0; iVar<lWorker.fInput->GetNVariables(); iVar++) delete lWorker.fInput->GetVariable(iVar);
+                delete lWorker.fInput;
+                lWorker.fInput = 0x0;
+            }
+        }
+    };
+
+    AliMultCalibRunStats MakeRunStats( AliMultSelection *lSel, const AliMultCalibStreamConfig &lConfig, Long64_t lFirstEntry ){
+        AliMultCalibRunStats lStats;
+        const Int_t lNEst = lSel->GetNEstimators();
+        lStats.fFirstEntry = lFirstEntry;
+        lStats.fNEvents    = 0;
+        //same initial values as the buffer-based Calibrate()
+        lStats.fSum.assign( lNEst, 0. );
+        lStats.fMin.assign( lNEst, 1e+6 );
+        lStats.fMax.assign( lNEst, -1e+3 );
+        lStats.fNAboveAnchor.assign( lNEst, 0 );
+        lStats.fSketch.assign( lNEst, AliMultQuantileSketch( lConfig.fExactLimit, lConfig.fSketchCapacity ) );
+        lStats.fCounts.resize( lNEst );
+        return lStats;
+    }
+
+    void MergeRunStats( AliMultCalibRunStats &lStats, const AliMultCalibRunStats &lOther ){
+        if ( lOther.fFirstEntry < lStats.fFirstEntry ) lStats.fFirstEntry = lOther.fFirstEntry;
+        lStats.fNEvents += lOther.fNEvents;
+        for( UInt_t iEst=0; iEst<lStats.fSum.size(); iEst++){
+            lStats.fSum[iEst] += lOther.fSum[iEst];
+            if ( lOther.fMin[iEst] < lStats.fMin[iEst] ) lStats.fMin[iEst] = lOther.fMin[iEst];
+            if ( lOther.fMax[iEst] > lStats.fMax[iEst] ) lStats.fMax[iEst] = lOther.fMax[iEst];
+            lStats.fNAboveAnchor[iEst] += lOther.fNAboveAnchor[iEst];
+            lStats.fSketch[iEst].Add( lOther.fSketch[iEst] );
+            for( std::map<Float_t, Long64_t>::const_iterator lIt = lOther.fCounts[iEst].begin(); lIt != lOther.fCounts[iEst].end(); ++lIt)
+                lStats.fCounts[iEst][lIt->first] += lIt->second;
+        }
+    }
+
+    void ProcessStreamWorker( const AliMultCalibStreamConfig &lConfig, AliMultCalibStreamWorker &lWorker ){
+        lWorker.fOK = kFALSE;
+        TFile *lFile = TFile::Open( lConfig.fInputFileName.Data(), "READ");
+        if( !lFile ) return;
+        TTree* lTree = (TTree*)lFile->FindObjectAny("fTreeEvent");
+        if( !lTree ) {
+            delete lFile;
+            return;
+        }
+
+        //Event Selection Variables
+        Bool_t fEvSel_IsNotPileupInMultBins      = kFALSE ;
+        Bool_t fEvSel_Triggered                  = kFALSE ;
+        Bool_t fEvSel_INELgtZERO                 = kFALSE ;
+        Bool_t fEvSel_PassesTrackletVsCluster    = kFALSE ;
+        Bool_t fEvSel_HasNoInconsistentVertices  = kFALSE ;
+        Bool_t fEvSel_IsNotAsymmetricInVZERO     = kFALSE ;
+        Bool_t fEvSel_IsNotIncompleteDAQ         = kFALSE ;
+        Bool_t fEvSel_HasGoodVertex2016          = kFALSE ;
+        Int_t fRunNumber;
+
+        //FIXME/CAUTION: non-zero if using tree without that branch
+        Int_t fnContributors = 1000;
+
+        UInt_t fEvSel_TriggerMask;
+
+        lTree->SetBranchAddress("fEvSel_IsNotPileupInMultBins",&fEvSel_IsNotPileupInMultBins);
+        lTree->SetBranchAddress("fEvSel_PassesTrackletVsCluster",&fEvSel_PassesTrackletVsCluster);
+        lTree->SetBranchAddress("fEvSel_HasNoInconsistentVertices",&fEvSel_HasNoInconsistentVertices);
+        lTree->SetBranchAddress("fEvSel_Triggered",&fEvSel_Triggered);
+        lTree->SetBranchAddress("fEvSel_TriggerMask",&fEvSel_TriggerMask);
+        lTree->SetBranchAddress("fEvSel_INELgtZERO",&fEvSel_INELgtZERO);
+        lTree->SetBranchAddress("fRunNumber",&fRunNumber);
+        lTree->SetBranchAddress("fnContributors", &fnContributors);
+        lTree->SetBranchAddress("fEvSel_IsNotAsymmetricInVZERO", &fEvSel_IsNotAsymmetricInVZERO);
+        lTree->SetBranchAddress("fEvSel_IsNotIncompleteDAQ", &fEvSel_IsNotIncompleteDAQ);
+        lTree->SetBranchAddress("fEvSel_HasGoodVertex2016", &fEvSel_HasGoodVertex2016);
+
+        TString *fFiredTriggerClasses = new TString();
+        lTree->SetBranchAddress("fFiredTriggerClasses",&fFiredTriggerClasses);
+
+        //Binding to input variables of this worker
+        AliMultInput *lInput = lWorker.fInput;
+        for(Long_t iVar=0; iVar<lInput->GetNVariables(); iVar++) {
+            if( !lInput->GetVariable(iVar)->IsInteger() ) {
+                lTree->SetBranchAddress(lInput->GetVariable(iVar)->GetName(),&lInput->GetVariable(iVar)->GetRValue());
+            } else {
+                lTree->SetBranchAddress(lInput->GetVariable(iVar)->GetName(),&lInput->GetVariable(iVar)->GetRValueInteger());
+            }
+        }
+
+        if( lWorker.fCountOnly ){
+            //Only the event selection is needed in the pre-pass
+            const char *lSelectionBranches[] = {
+                "fEvSel_IsNotPileupInMultBins", "fEvSel_PassesTrackletVsCluster", "fEvSel_HasNoInconsistentVertices",
+                "fEvSel_Triggered", "fEvSel_TriggerMask", "fEvSel_INELgtZERO", "fRunNumber", "fnContributors",
+                "fEvSel_IsNotAsymmetricInVZERO", "fEvSel_IsNotIncompleteDAQ", "fEvSel_HasGoodVertex2016",
+                "fFiredTriggerClasses", "fEvSel_VtxZ" };
+            lTree->SetBranchStatus("*",0);
+            for( UInt_t iB=0; iB<sizeof(lSelectionBranches)/sizeof(lSelectionBranches[0]); iB++)
+                if( lTree->GetBranch(lSelectionBranches[iB]) ) lTree->SetBranchStatus(lSelectionBranches[iB],1);
+        }
+
+        AliMultVariable *lVtxZLocalPointer = lInput -> GetVariable("fEvSel_VtxZ");
+
+        for(Long64_t iEv = lWorker.fFirstEntry; iEv<lWorker.fLastEntry; iEv++) {
+            lTree->GetEntry(iEv);
+            //Perform Event selection (identical to Calibrate)
+            Bool_t lSaveThisEvent = kTRUE;
+
+            Bool_t isSelected = fEvSel_TriggerMask & lConfig.fTrigType;
+            if(!isSelected && lConfig.fCheckTriggerType) lSaveThisEvent = kFALSE;
+
+            if(lConfig.fFiredTrigString.EqualTo("")==kFALSE) {
+                if (fFiredTriggerClasses->Contains( lConfig.fFiredTrigString.Data() ) == kFALSE ) lSaveThisEvent = kFALSE;
+            }
+
+            if( lConfig.fTriggerCut                && ! fEvSel_Triggered  ) lSaveThisEvent = kFALSE;
+            if( lConfig.fINELgtZEROCut             && ! fEvSel_INELgtZERO ) lSaveThisEvent = kFALSE;
+            if( TMath::Abs( lVtxZLocalPointer->GetValue() ) > lConfig.fVzCut ) lSaveThisEvent = kFALSE;
+            if( lConfig.fRejectPileupInMultBinsCut && ! fEvSel_IsNotPileupInMultBins    ) lSaveThisEvent = kFALSE;
+            if( lConfig.fTrackletsVsClustersCut    && ! fEvSel_PassesTrackletVsCluster  ) lSaveThisEvent = kFALSE;
+            if( lConfig.fVertexConsistencyCut      && ! fEvSel_HasNoInconsistentVertices) lSaveThisEvent = kFALSE;
+            if( lConfig.fNonZeroNContribs          &&  fnContributors < 1 ) lSaveThisEvent = kFALSE;
+            if( lConfig.fIsNotAsymmetricInVZERO    && ! fEvSel_IsNotAsymmetricInVZERO) lSaveThisEvent = kFALSE;
+            if( lConfig.fIsNotIncompleteDAQ        && ! fEvSel_IsNotIncompleteDAQ) lSaveThisEvent = kFALSE;
+            if( lConfig.fHasGoodVertex2016         && ! fEvSel_HasGoodVertex2016) lSaveThisEvent = kFALSE;
+
+            Int_t lKey = fRunNumber;
+            if ( !lConfig.fAutoDiscover ){
+                //Consult map for run range equivalency
+                std::map<int, int>::const_iterator lRange = lConfig.fRunRangesMap->find( fRunNumber );
+                if ( lRange == lConfig.fRunRangesMap->end() ) continue;
+                lKey = lRange->second;
+            }
+            AliMultSelection *lSel = lWorker.fSelections[ lConfig.fAutoDiscover ? 0 : lKey ];
+
+            //Runs are registered at their first event, selected or not (as in Calibrate)
+            std::map<Int_t, AliMultCalibRunStats>::iterator lRun = lWorker.fRuns.find( lKey );
+            if ( lRun == lWorker.fRuns.end() )
+                lRun = lWorker.fRuns.insert( std::make_pair( lKey, MakeRunStats( lSel, lConfig, iEv ) ) ).first;
+            if ( !lSaveThisEvent ) continue;
+
+            AliMultCalibRunStats &lStats = lRun->second;
+            std::map<Int_t, Long64_t>::const_iterator lQuota = lWorker.fQuota.find( lKey );
+            if ( lQuota != lWorker.fQuota.end() && lStats.fNEvents >= lQuota->second ) continue;
+            lStats.fNEvents++;
+            if ( lWorker.fCountOnly ) continue;
+
+            lSel->Evaluate( lInput );
+            for( Int_t iEst=0; iEst<lSel->GetNEstimators(); iEst++){
+                AliMultEstimator *lEst = lSel->GetEstimator(iEst);
+                const Float_t lThisVal = lEst->GetValue();
+                lStats.fSum[iEst] += lThisVal;
+                if( lThisVal < lStats.fMin[iEst] ) lStats.fMin[iEst] = lThisVal;
+                if( lThisVal > lStats.fMax[iEst] ) lStats.fMax[iEst] = lThisVal;
+                if( lEst->IsInteger() ){
+                    lStats.fCounts[iEst][lThisVal]++;
+                } else {
+                    lStats.fSketch[iEst].Fill( lThisVal );
+                    if( lEst->GetUseAnchor() && lThisVal > lEst->GetAnchorPoint() ) lStats.fNAboveAnchor[iEst]++;
+                }
+            }
+        }
+        delete fFiredTriggerClasses;
+        delete lFile;
+        lWorker.fOK = kTRUE;
+    }
+
+    void RunStreamWorkers( const AliMultCalibStreamConfig &lConfig, std::vector<AliMultCalibStreamWorker> &lWorkers ){
+#ifdef ALIMULTSELECTIONCALIBRATOR_THREADS
+        if ( lWorkers.size() > 1 ){
+            std::vector<std::thread> lThreads;
+            for( UInt_t iW=0; iW<lWorkers.size(); iW++)
+                lThreads.push_back( std::thread( ProcessStreamWorker, std::cref(lConfig), std::ref(lWorkers[iW]) ) );
+            for( UInt_t iW=0; iW<lThreads.size(); iW++) lThreads[iW].join();
+            return;
+        }
+#endif
+        for( UInt_t iW=0; iW<lWorkers.size(); iW++) ProcessStreamWorker( lConfig, lWorkers[iW] );
+    }
+}
+
+
 AliMultSelectionCalibrator::AliMultSelectionCalibrator() : TNamed(),
 fInput(0), fSelection(0), lDesiredBoundaries(0), lNDesiredBoundaries(0),
 fRunToUseAsDefault(-1), fMaxEventsPerRun(1e+9), fCheckTriggerType(kFALSE),
 fTrigType(AliVEvent::kAny), fPrefilterOnly(kFALSE), fFiredTrigString(""),
+fNThreads(1), fStreamingExactLimit(1048576), fStreamingSketchCapacity(16384),
 fNRunRanges(0), fRunRangesMap(), fMultSelectionList(0),
 fInputFileName(""), fBufferFileName("buffer.root"),
 fOutputFileName(""), fMultSelectionCuts(0), fCalibHists(0)
@@ -65,6 +316,7 @@ AliMultSelectionCalibrator::AliMultSelectionCalibrator(const char * name, const
 fInput(0), fSelection(0), lDesiredBoundaries(0), lNDesiredBoundaries(0),
 fRunToUseAsDefault(-1), fMaxEventsPerRun(1e+9), fCheckTriggerType(kFALSE),
 fTrigType(AliVEvent::kAny), fPrefilterOnly(kFALSE), fFiredTrigString(""),
+fNThreads(1), fStreamingExactLimit(1048576), fStreamingSketchCapacity(16384),
 fNRunRanges(0), fRunRangesMap(), fMultSelectionList(0),
 fInputFileName(""), fBufferFileName("buffer.root"),
 fOutputFileName(""), fMultSelectionCuts(0), fCalibHists(0)
@@ -502,13 +754,6 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
     TFile * f = new TFile (fOutputFileName.Data(), "recreate");
     AliOADBContainer * oadbContMS = new AliOADBContainer("MultSel");
 
-    AliOADBMultSelection * oadbMultSelection = 0x0;
-    AliMultSelectionCuts * cuts = 0x0;
-    AliMultSelection     * fsels = 0x0;
-
-    //Actual Calibration Histograms
-    TH1F * hCalibData[lNEstimators];
-
     cout<<"(5) Generate Boundaries through a loop in all desired estimators"<<endl;
     for(Int_t iRun=0; iRun<fNRunRanges; iRun++) {
 
@@ -575,47 +820,8 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
                     //fSelection->PrintInfo();
                     lNrawBoundaries[lB] = fSelection->GetEstimator(iEst)->GetValue();
                 }
-                //Cross-check correct rejection of anything beyond anchor point
-                if( fSelection->GetEstimator(iEst)->GetUseAnchor() && ntot != 0 ){
-                    for( Long_t lB=0; lB<lNDesiredBoundaries-1; lB++) {
-                        if (lNrawBoundaries[lB+1]>fSelection->GetEstimator(iEst)->GetAnchorPoint()){
-                            if(lNrawBoundaries[lB]<fSelection->GetEstimator(iEst)->GetAnchorPoint()){
-                                //This is the threshold, should actually be identical to anchor point please
-                                lNrawBoundaries[lB] = fSelection->GetEstimator(iEst)->GetAnchorPoint();
-                            }
-                        }
-                    }
-                }
-
                 cout<<" Done! Saving... "<<endl;
-
-                if( lInsane[iEst][iRun] == kFALSE) {
-                    //Create a sane calibration histogram
-                    //Should not be the source of excessive memory consumption...
-                    //...but can be rearranged if needed!
-                    hCalib[iRun][iEst] = new TH1F(Form("hCalib_%i_%s",lRunNumbers[iRun],fSelection->GetEstimator(iEst)->GetName()),"",lNDesiredBoundaries-1,lNrawBoundaries);
-                    hCalib[iRun][iEst]->SetDirectory(0);
-                    hCalib[iRun][iEst]->SetBinContent(0,100.5); //Just in case correction functions screw up the values ...
-                    for(Long_t ibin=1; ibin<hCalib[iRun][iEst]->GetNbinsX()+1; ibin++){
-                        hCalib[iRun][iEst] -> SetBinContent(ibin, lMiddleOfBins[ibin-1]);
-
-                        //override in case anchored!
-                        if( fSelection->GetEstimator(iEst)->GetUseAnchor() ){
-                            if ( hCalib[iRun][iEst]->GetBinCenter(ibin) < fSelection->GetEstimator(iEst)->GetAnchorPoint() ){
-                                //Override, this is useless!
-                                //Alberica's recommendation: outside of user range to be sure!
-                                hCalib[iRun][iEst] -> SetBinContent(ibin, 100.5);
-                            }
-                        }
-                    }
-                }else{
-                    hCalib[iRun][iEst] = new TH1F(Form("hCalib_%i_%s",lRunNumbers[iRun],fSelection->GetEstimator(iEst)->GetName()),"",1,0,1);
-                    hCalib[iRun][iEst]->SetDirectory(0);
-                    //There was insufficient information to generate a meaningful calibration for this estimator!
-                    hCalib[iRun][iEst]->SetBinContent(0,AliMultSelectionCuts::kNoCalib);
-                    hCalib[iRun][iEst]->SetBinContent(1,AliMultSelectionCuts::kNoCalib);
-                    hCalib[iRun][iEst]->SetBinContent(2,AliMultSelectionCuts::kNoCalib);
-                }
+                hCalib[iRun][iEst] = BuildCalibHistogram( lRunNumbers[iRun], fSelection->GetEstimator(iEst), ntot, lNrawBoundaries, lMiddleOfBins, lInsane[iEst][iRun] );
                 //==== End Floating Point Calibration Engine ====
             } else {
                 //==== Integer Value Calibration Engine ====
@@ -634,19 +840,7 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
                     //hTemporary->SetDirectory(0);
                     lRunStats[iRun] = sTree[iRun]->Draw(Form("%s>>hTemporary",fSelection->GetEstimator(iEst)->GetDefinition().Data()),"","goff");
                     cout<<"entries = "<<lRunStats[iRun]<<endl;
-                    //In memory now: histogram with content, please normalize to unity
-                    hTemporary->Scale(1./((double)(lRunStats[iRun])));
-
-                    Float_t lBoundaries[lNBins+1]; //to store cumulative function
-                    lBoundaries[0] = 0;
-                    for(Long_t iB=1; iB<hTemporary->GetNbinsX()+1; iB++) {
-                        lBoundaries[iB] = lBoundaries[iB-1]+hTemporary->GetBinContent(iB);
-                    }
-                    //This won't follow what was requested (it cannot, mathematically)
-                    hCalib[iRun][iEst] = new TH1F(Form("hCalib_%i_%s",lRunNumbers[iRun],fSelection->GetEstimator(iEst)->GetName()),"",lNBins,lLowEdge,lHighEdge);
-                    hCalib[iRun][iEst]->SetDirectory(0);
-                    for(Long_t ibin=1; ibin<hCalib[iRun][iEst]->GetNbinsX()+1; ibin++) hCalib[iRun][iEst] -> SetBinContent(ibin, 100.0-50.0*(lBoundaries[ibin-1]+lBoundaries[ibin]));
-                    //Enough info for calibration determined...
+                    hCalib[iRun][iEst] = BuildIntegerCalibHistogram( lRunNumbers[iRun], fSelection->GetEstimator(iEst), hTemporary, lRunStats[iRun], lNBins, lLowEdge, lHighEdge );
                     delete hTemporary;
                     hTemporary = 0x0;
                 }
@@ -654,111 +848,489 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
         }
 
         //Write OADB object
-        if ( !lAutoDiscover ){
-            cout<<"--- Processing run range "<<fFirstRun[iRun]<<"-"<<fLastRun[iRun]<<" ("<<iRun<<"/"<<fNRunRanges<<")..."<<endl;
-        }else{
-            cout<<"--- Processing run "<<lRunNumbers[iRun]<<" ("<<iRun<<"/"<<fNRunRanges<<")..."<<endl;
+        Double_t lAvEstThisRun[lNEstimators];
+        for ( Int_t iEst=0; iEst<lNEstimatorsThis; iEst++) lAvEstThisRun[iEst] = lAvEst[iEst][iRun];
+        SaveCalibration( oadbContMS, iRun, lAutoDiscover, lRunNumbers[iRun], hCalib[iRun], lAvEstThisRun, lRunStats[iRun] );
+    }
+
+    if( fRunToUseAsDefault < 0 ) SaveLastAsDefault( oadbContMS, hCalib[fNRunRanges-1] );
+
+    cout<<"All done, will write OADB..."<<endl;
+
+    oadbContMS->Write();
+    cout<<" Done!"<<endl;
+    return kTRUE;
+}
+//________________________________________________________________
+Bool_t AliMultSelectionCalibrator::CalibrateStreaming() {
+    // Streaming version of Calibrate(), writing the same OADB output
+    //
+    // The input tree is read once, split in fNThreads contiguous entry ranges
+    // processed in parallel (each worker with its own file, AliMultInput and
+    // estimator copies). Per run (range) and estimator the workers accumulate
+    // averages, extremes, the anchor statistics and the value distribution:
+    // integer estimators as value -> count maps (exact), floating point ones
+    // as AliMultQuantileSketch, exact up to fStreamingExactLimit events per run
+    // (identical boundaries to Calibrate()) and with a guaranteed rank error
+    // bound beyond, printed per estimator. No buffer trees are written.
+    //
+    // With fMaxEventsPerRun below the number of entries, a pre-pass reading the
+    // event selection branches only determines how many events each worker may
+    // use, such that the first fMaxEventsPerRun selected events are used as in
+    // Calibrate().
+
+    cout<<"=== STARTING STREAMING CALIBRATION PROCEDURE ==="<<endl;
+    cout<<" * Input File.....: "<<fInputFileName.Data()<<endl;
+    cout<<" * Output File....: "<<fOutputFileName.Data()<<endl;
+    cout<<" * Threads........: "<<fNThreads<<endl;
+    cout<<" * Exact quantiles: up to "<<fStreamingExactLimit<<" events per run"<<endl;
+    cout<<endl;
+    cout<<" * Event Selection Peformed: "<<endl;
+    fMultSelectionCuts -> Print();
+    cout<<endl;
+
+    // STEP 1: Basic I/O
+    cout<<"(1) Opening File"<<endl;
+    TFile *fInputFile = TFile::Open( fInputFileName.Data(), "READ");
+    if(!fInputFile) {
+        AliWarningF("File %s not found!", fInputFileName.Data() );
+        return kFALSE;
+    }
+    TTree* fTree = (TTree*)fInputFile->FindObjectAny("fTreeEvent");
+    if(!fTree) {
+        AliWarning("fTreeEvent object not found!" );
+        delete fInputFile;
+        return kFALSE;
+    }
+    const Long64_t lNEv = fTree->GetEntries();
+    delete fInputFile;
+    cout<<"(1) File opened, event count is "<<lNEv<<endl;
+
+    Bool_t lAutoDiscover = kFALSE;
+    if ( fInput->GetNVariables() < 1 ){
+        cout<<"Error: No Input Variables configured!"<<endl;
+        cout<<"The simplest way to get rid of this problem is to remember to call SetupStandardInput()!"<<endl;
+        return kFALSE; //failure to calibrate
+    }
+    if ( fMultSelectionList->GetEntries() == 0 ){
+        AliInfo("===============================================");
+        AliInfo(" Calibrator invoked without run mappings");
+        AliInfo(" Auto run discovery mode will be used!");
+        AliInfo("===============================================");
+        lAutoDiscover = kTRUE;
+    }
+    if ( lAutoDiscover && !fSelection ) {
+        cout<<"Error: no default AliMultSelection defined!"<<endl;
+        cout<<"The simplest way to get rid of this problem is to remember to call SetMultSelection(...)!"<<endl;
+        return kFALSE; //failure to calibrate
+    }
+
+    AliMultCalibStreamConfig lConfig;
+    lConfig.fInputFileName             = fInputFileName;
+    lConfig.fAutoDiscover              = lAutoDiscover;
+    lConfig.fCheckTriggerType          = fCheckTriggerType;
+    lConfig.fTrigType                  = fTrigType;
+    lConfig.fFiredTrigString           = fFiredTrigString;
+    lConfig.fVzCut                     = fMultSelectionCuts->GetVzCut();
+    lConfig.fTriggerCut                = fMultSelectionCuts->GetTriggerCut();
+    lConfig.fINELgtZEROCut             = fMultSelectionCuts->GetINELgtZEROCut();
+    lConfig.fRejectPileupInMultBinsCut = fMultSelectionCuts->GetRejectPileupInMultBinsCut();
+    lConfig.fTrackletsVsClustersCut    = fMultSelectionCuts->GetTrackletsVsClustersCut();
+    lConfig.fVertexConsistencyCut      = fMultSelectionCuts->GetVertexConsistencyCut();
+    lConfig.fNonZeroNContribs          = fMultSelectionCuts->GetNonZeroNContribs();
+    lConfig.fIsNotAsymmetricInVZERO    = fMultSelectionCuts->GetIsNotAsymmetricInVZERO();
+    lConfig.fIsNotIncompleteDAQ        = fMultSelectionCuts->GetIsNotIncompleteDAQ();
+    lConfig.fHasGoodVertex2016         = fMultSelectionCuts->GetHasGoodVertex2016();
+    lConfig.fRunRangesMap              = &fRunRangesMap;
+    lConfig.fExactLimit                = fStreamingExactLimit;
+    lConfig.fSketchCapacity            = fStreamingSketchCapacity;
+
+    //Workers: contiguous entry ranges, private copies of input and estimators
+    //(formulas are set up here, in the main thread)
+    Int_t lNWorkers = fNThreads > 0 ? fNThreads : 1;
+    if ( lNEv < lNWorkers ) lNWorkers = lNEv > 0 ? lNEv : 1;
+#ifdef ALIMULTSELECTIONCALIBRATOR_THREADS
+    if ( lNWorkers > 1 ) ROOT::EnableThreadSafety();
+#else
+    if ( lNWorkers > 1 ) AliWarning("No thread support in this build, workers will run sequentially");
+#endif
+    std::vector<AliMultCalibStreamWorker> lWorkers( lNWorkers );
+    AliMultCalibStreamWorkerCleaner lWorkersCleaner( lWorkers );
+    for( Int_t iW=0; iW<lNWorkers; iW++){
+        AliMultCalibStreamWorker &lWorker = lWorkers[iW];
+        lWorker.fFirstEntry = (lNEv*iW)/lNWorkers;
+        lWorker.fLastEntry  = (lNEv*(iW+1))/lNWorkers;
+        lWorker.fCountOnly  = kFALSE;
+        lWorker.fOK         = kFALSE;
+        lWorker.fInput      = new AliMultInput();
+        for(Long_t iVar=0; iVar<fInput->GetNVariables(); iVar++)
+            lWorker.fInput->AddVariable( new AliMultVariable( *fInput->GetVariable(iVar) ) );
+        const Int_t lNSelections = lAutoDiscover ? 1 : fNRunRanges;
+        for( Int_t iSel=0; iSel<lNSelections; iSel++){
+            AliMultSelection *lSel = new AliMultSelection( lAutoDiscover ? fSelection : (AliMultSelection*) fMultSelectionList->At(iSel) );
+            lSel->Setup( lWorker.fInput );
+            lWorker.fSelections.push_back( lSel );
         }
-        oadbMultSelection = new AliOADBMultSelection();
-        cuts              = new AliMultSelectionCuts();
-        cuts = fMultSelectionCuts;
-        fsels             = new AliMultSelection( fSelection );
+    }
 
-        oadbMultSelection->SetEventCuts    (cuts );
-        oadbMultSelection->SetMultSelection(fsels);
-        for ( Int_t iEst=0; iEst<lNEstimatorsThis; iEst++) {
-            //Average values
-            fsels->GetEstimator(iEst)->SetMean( lAvEst[iEst][iRun] );
+    TStopwatch timer;
+    timer.Start ( kTRUE );
+
+    if ( fMaxEventsPerRun < lNEv ){
+        cout<<"(2) Pre-pass: counting selected events per run (max. "<<fMaxEventsPerRun<<" events per run)"<<endl;
+        for( Int_t iW=0; iW<lNWorkers; iW++) lWorkers[iW].fCountOnly = kTRUE;
+        RunStreamWorkers( lConfig, lWorkers );
+        //Each worker may use what's left of the run budget after the previous workers
+        std::map<Int_t, Long64_t> lUsed;
+        for( Int_t iW=0; iW<lNWorkers; iW++){
+            if ( !lWorkers[iW].fOK ){
+                AliWarningF("Worker %i failed to read %s!", iW, fInputFileName.Data() );
+                return kFALSE;
+            }
+            for( std::map<Int_t, AliMultCalibRunStats>::const_iterator lIt = lWorkers[iW].fRuns.begin(); lIt != lWorkers[iW].fRuns.end(); ++lIt){
+                Long64_t &lUsedThisRun = lUsed[lIt->first];
+                Long64_t lQuota = fMaxEventsPerRun - lUsedThisRun;
+                if ( lQuota < 0 ) lQuota = 0;
+                if ( lQuota > lIt->second.fNEvents ) lQuota = lIt->second.fNEvents;
+                lWorkers[iW].fQuota[lIt->first] = lQuota;
+                lUsedThisRun += lQuota;
+            }
+            lWorkers[iW].fRuns.clear();
+            lWorkers[iW].fCountOnly = kFALSE;
+        }
+    }
 
-            //Beware similar names! Will be saved ...
-            hCalibData[iEst] = (TH1F*) hCalib[iRun][iEst]->Clone( Form("hCalib_%s",fSelection->GetEstimator(iEst)->GetName()) );
-            oadbMultSelection->AddCalibHisto( hCalibData[iEst] );
-            hCalibData[iEst]->SetDirectory(0);
+    cout<<"(2) Streaming events, computing averages and quantiles"<<endl;
+    RunStreamWorkers( lConfig, lWorkers );
+    timer.Stop();
+    cout<<"Streamed "<<lNEv<<" events with "<<lNWorkers<<" workers in "<<timer.RealTime()<<"s"<<endl;
+
+    //Merge in worker (entry) order, releasing the worker statistics run by run
+    std::map<Int_t, AliMultCalibRunStats> lMerged;
+    for( Int_t iW=0; iW<lNWorkers; iW++){
+        if ( !lWorkers[iW].fOK ){
+            AliWarningF("Worker %i failed to read %s!", iW, fInputFileName.Data() );
+            return kFALSE;
         }
-        cout<<"=================================================================================="<<endl;
-        if ( !lAutoDiscover ){
-            cout<<"AliMultSelection Object to be saved for run range "<<fFirstRun[iRun]<<"-"<<fLastRun[iRun]<<")"<<endl;
-        }else{
-            cout<<"AliMultSelection Object to be saved for run "<<lRunNumbers[iRun]<<")"<<endl;
+        std::map<Int_t, AliMultCalibRunStats> &lRuns = lWorkers[iW].fRuns;
+        while( !lRuns.empty() ){
+            std::map<Int_t, AliMultCalibRunStats>::iterator lIt = lRuns.begin();
+            std::map<Int_t, AliMultCalibRunStats>::iterator lRun = lMerged.find( lIt->first );
+            if ( lRun == lMerged.end() ) std::swap( lMerged[lIt->first], lIt->second );
+            else MergeRunStats( lRun->second, lIt->second );
+            lRuns.erase( lIt );
         }
-        fsels->PrintInfo();
-        cuts->Print();
-        cout<<"=================================================================================="<<endl;
-        //Protection against saving a calibration object that has been acquired
-        //with insufficient statistics
-        if ( lRunStats[iRun] > 1000){
-            if ( !lAutoDiscover ) {
-                oadbContMS->AppendObject(oadbMultSelection, fFirstRun[iRun], fLastRun[iRun] );
-            }else{
-                oadbContMS->AppendObject(oadbMultSelection, lRunNumbers[iRun], lRunNumbers[iRun] );
+    }
+
+    //Run (range) index -> key of the merged statistics
+    const int lMax = 1000;
+    const int lNEstimators = 50; //this is the MAX VALUE!
+    Int_t lRunNumbers[lMax];
+    Int_t lRunKeys[lMax];
+    for( Int_t ix=0; ix<lMax;ix++){
+        lRunNumbers[ix] = 0;
+        lRunKeys[ix] = ix;
+    }
+    if ( lAutoDiscover ){
+        //Same ordering as in Calibrate(): by first appearance in the input
+        std::vector< std::pair<Long64_t, Int_t> > lFirstEntries;
+        for( std::map<Int_t, AliMultCalibRunStats>::const_iterator lIt = lMerged.begin(); lIt != lMerged.end(); ++lIt)
+            lFirstEntries.push_back( std::make_pair( lIt->second.fFirstEntry, lIt->first ) );
+        std::sort( lFirstEntries.begin(), lFirstEntries.end() );
+        for( UInt_t iRun=0; iRun<lFirstEntries.size(); iRun++){
+            if ( fNRunRanges >= lMax ){
+                AliWarningF("More than %i runs found, ignoring the remaining ones!", lMax);
+                break;
             }
+            cout<<"(Autodiscover) New Run Found: "<<lFirstEntries[iRun].second<<", added as #"<<fNRunRanges<<endl;
+            fRunRangesMap.insert( std::pair<int,int>(lFirstEntries[iRun].second,fNRunRanges));
+            lRunNumbers[fNRunRanges] = lFirstEntries[iRun].second;
+            lRunKeys[fNRunRanges]    = lFirstEntries[iRun].second;
+            fNRunRanges++;
+        }
+    }
+
+    if(!lAutoDiscover){
+        cout<<"(3) Inspect Run Ranges and corresponding statistics: "<<endl;
+        for(Int_t iRun = 0; iRun<fNRunRanges; iRun++) {
+            std::map<Int_t, AliMultCalibRunStats>::const_iterator lRun = lMerged.find( lRunKeys[iRun] );
+            cout<<" --- Range #"<<iRun<<", ("<<fFirstRun[iRun]<<" - "<<fLastRun[iRun]<<"), N(events) = "<<(lRun != lMerged.end() ? lRun->second.fNEvents : 0)<<endl;
+        }
+    }else{
+        cout<<"(3) Inspect Runs and corresponding statistics: "<<endl;
+        for(Int_t iRun = 0; iRun<fNRunRanges; iRun++) {
+            cout<<" --- Run #"<<iRun<<", (#"<<lRunNumbers[iRun]<<"), N(events) = "<<lMerged[ lRunKeys[iRun] ].fNEvents<<endl;
         }
+    }
+    cout<<endl;
+
+    if( fPrefilterOnly ){
+        cout<<"Streaming calibration does not write filtered trees, use Calibrate() for debugging..."<<endl;
+        return 0;
+    }
 
-        Bool_t lThisIsReference = kFALSE;
-        if(!lAutoDiscover){
-            if ( fFirstRun[iRun] <= fRunToUseAsDefault && fRunToUseAsDefault <= fLastRun[iRun]) lThisIsReference = kTRUE;
+    Double_t lNrawBoundaries[1000];
+    Double_t lMiddleOfBins[1000];
+    for( Long_t lB=1; lB<lNDesiredBoundaries; lB++) {
+        //place squarely at the middle to ensure it's all fine
+        lMiddleOfBins[lB-1] = 0.5*(lDesiredBoundaries[lB]+lDesiredBoundaries[lB-1]);
+    }
+
+    //Open output OADB file, generate everything within loop
+    TFile * f = new TFile (fOutputFileName.Data(), "recreate");
+    AliOADBContainer * oadbContMS = new AliOADBContainer("MultSel");
+
+    //Calibration histograms of the current (last) run, SaveCalibration and SaveLastAsDefault store clones
+    TH1F *hCalib[lNEstimators];
+    Int_t lNCalib = 0;
+    Double_t lAvEst[lNEstimators];
+    Long_t lRunStats = 0;
+
+    cout<<"(4) Generate Boundaries through a loop in all desired estimators"<<endl;
+    for(Int_t iRun=0; iRun<fNRunRanges; iRun++) {
+
+        //Contextualize AliMultSelection for this run
+        if ( !lAutoDiscover ) fSelection = (AliMultSelection*) fMultSelectionList->At(iRun);
+
+        // Calibration pre-optimization and setup
+        fSelection->Setup ( fInput );
+
+        const Int_t lNEstimatorsThis = fSelection->GetNEstimators();
+        for(Int_t iEst=0; iEst<lNCalib; iEst++) delete hCalib[iEst];
+        lNCalib = lNEstimatorsThis;
+
+        //Runs (ranges) without any event in the input
+        std::map<Int_t, AliMultCalibRunStats>::iterator lRun = lMerged.find( lRunKeys[iRun] );
+        if ( lRun == lMerged.end() ) lRun = lMerged.insert( std::make_pair( lRunKeys[iRun], MakeRunStats( fSelection, lConfig, -1 ) ) ).first;
+        AliMultCalibRunStats &lStats = lRun->second;
+
+        const Long64_t ntot = lStats.fNEvents;
+        if ( !lAutoDiscover ){
+            cout<<"--- Processing run range "<<fFirstRun[iRun]<<"-"<<fLastRun[iRun]<<" ("<<iRun<<"/"<<fNRunRanges<<"), with "<<ntot<<" events..."<<endl;
         }else{
-            if ( lRunNumbers[iRun] == fRunToUseAsDefault ) lThisIsReference = kTRUE;
+            cout<<"--- Processing run "<<lRunNumbers[iRun]<<" ("<<iRun<<"/"<<fNRunRanges<<"), with "<<ntot<<" events..."<<endl;
         }
-        if( lThisIsReference ){
-            //========================================================================
-            //DEFAULT OADB Object saving procedure STARTS here
-            oadbMultSelection = new AliOADBMultSelection("Default");
-            cuts              = new AliMultSelectionCuts();
-            cuts = fMultSelectionCuts;
-            fsels             = new AliMultSelection    ( fSelection         );
-
-            const Int_t lNEstimatorsThis = fSelection->GetNEstimators();
-
-            //Default Stuff
-            TH1F * hDummy[lNEstimatorsThis];
-            for ( Int_t iEst=0; iEst<lNEstimatorsThis; iEst++) {
-                //Get Meaningful means
-                fsels->GetEstimator(iEst)->SetMean( lAvEst[iEst][iRun] );
-                //Clone last histogram ...
-                hDummy[iEst]= (TH1F*) hCalib[iRun][iEst]->Clone( Form("hCalib_%s",fSelection->GetEstimator(iEst)->GetName()) );
-                hDummy[iEst]->SetDirectory(0);
+        for(Int_t iEst=0; iEst<lNEstimatorsThis; iEst++) {
+            AliMultEstimator *lEst = fSelection->GetEstimator(iEst);
+            const Double_t lMinEst = lStats.fMin[iEst];
+            const Double_t lMaxEst = lStats.fMax[iEst];
+            lAvEst[iEst] = ( ntot < 1 ) ? -1 : lStats.fSum[iEst] / ( (Double_t) ntot );
+            cout<<"--- Estimator "<<lEst->GetName()<<": Min = "<<lMinEst<<", Max = "<<lMaxEst<<", Av = "<<lAvEst[iEst]<<endl;
+
+            //No valid information to do calibration, please be careful !
+            const Bool_t lInsane = ( TMath::Abs( lMinEst - lMaxEst ) < 1e-6 );
+
+            if( ! ( lEst->IsInteger() ) ) {
+                //==== Floating Point Calibration Engine ====
+                AliMultQuantileSketch &lSketch = lStats.fSketch[iEst];
+                if ( !lSketch.IsExact() ){
+                    cout<<"--- Approximate quantiles: rank error below "<<lSketch.GetMaxRankError()<<" events ("
+                    <<100.*lSketch.GetMaxRankError()/((Double_t)ntot)<<" percentile units)"<<endl;
+                }
+                lRunStats = ntot;
+                Long64_t lAcceptedEvents = 0;
+                if( lEst->GetUseAnchor() ){
+                    lAcceptedEvents = lStats.fNAboveAnchor[iEst];
+                    lRunStats = lAcceptedEvents;
+                }
+                lNrawBoundaries[0] = 0.0; //Defined OK even if anchored
+                //Overwrite lower boundary in case this has a negative minimum...
+                if ( lMinEst < 0 ) lNrawBoundaries[0] = lMinEst;
+
+                for( Long_t lB=1; lB<lNDesiredBoundaries; lB++) {
+                    Long64_t position = (Long64_t) ( 0.01 * ((Double_t)(ntot)* lDesiredBoundaries[lB] ) );
+
+                    if( lEst->GetUseAnchor() && ntot != 0 ){
+                        //Make sure index position lAnchorEst corresponds to lAnchorPercentile
+                        Double_t lAnchorPercentile = (Double_t) lEst->GetAnchorPercentile();
+                        Double_t lFractionAccepted = (((Double_t) lAcceptedEvents )/((Double_t) ntot));
+                        Double_t lScalingFactor    = lFractionAccepted/((0.01)*lAnchorPercentile);
+                        //Make sure: if AnchorPercentile requested, cut at AnchorPoint
+                        position = (Long64_t) ( ( 0.01 * ((Double_t)(ntot)* lDesiredBoundaries[lB] ) ) * lScalingFactor );
+                        if(position > ntot-1 ) position = ntot-1; //protection !
+                    }
+                    //position counts from the largest value (descending sort in Calibrate)
+                    lNrawBoundaries[lB] = lSketch.GetValueAtRank( ntot-1-position );
+                }
+                hCalib[iEst] = BuildCalibHistogram( lRunNumbers[iRun], lEst, ntot, lNrawBoundaries, lMiddleOfBins, lInsane );
+                //==== End Floating Point Calibration Engine ====
+            } else {
+                //==== Integer Value Calibration Engine ====
+                const Long_t lNBins    = lMaxEst-lMinEst+1;
+                Float_t lLowEdge = lMinEst-0.5;
+                Float_t lHighEdge= lMaxEst+0.5;
+                if( ntot < 1 ) {
+                    //Case of an empty run!
+                    hCalib[iEst] = new TH1F(Form("hCalib_%i_%s",lRunNumbers[iRun],lEst->GetName()),"",1,0,1);
+                    hCalib[iEst]->SetDirectory(0);
+                } else {
+                    TH1F *hTemporary = new TH1F("hTemporary", "", lNBins, lMinEst-0.5, lMaxEst+0.5 );
+                    hTemporary->SetDirectory(0);
+                    for( std::map<Float_t, Long64_t>::const_iterator lIt = lStats.fCounts[iEst].begin(); lIt != lStats.fCounts[iEst].end(); ++lIt){
+                        const Int_t lBin = hTemporary->FindBin( lIt->first );
+                        hTemporary->SetBinContent( lBin, hTemporary->GetBinContent( lBin ) + lIt->second );
+                    }
+                    lRunStats = ntot;
+                    hCalib[iEst] = BuildIntegerCalibHistogram( lRunNumbers[iRun], lEst, hTemporary, lRunStats, lNBins, lLowEdge, lHighEdge );
+                    delete hTemporary;
+                }
+            }
+        }
+        //Write OADB object
+        SaveCalibration( oadbContMS, iRun, lAutoDiscover, lRunNumbers[iRun], hCalib, lAvEst, lRunStats );
+        //The quantiles of this run are final: release its exact buffers (sketch values, value counts)
+        lMerged.erase( lRun );
+    }
+
+    if( fRunToUseAsDefault < 0 ) SaveLastAsDefault( oadbContMS, hCalib );
+    for(Int_t iEst=0; iEst<lNCalib; iEst++) delete hCalib[iEst];
+
+    cout<<"All done, will write OADB..."<<endl;
+    f->cd();
+    oadbContMS->Write();
+    cout<<" Done!"<<endl;
+    return kTRUE;
+}
+//________________________________________________________________
+TH1F* AliMultSelectionCalibrator::BuildCalibHistogram( Int_t lRunNumber, AliMultEstimator *lEst, Long64_t ntot,
+                                                      Double_t *lNrawBoundaries, Double_t *lMiddleOfBins, Bool_t lInsane ) {
+    // Floating point calibration engine: calibration histogram from the raw boundaries
+    TH1F *hCalib = 0x0;
+
+    //Cross-check correct rejection of anything beyond anchor point
+    if( lEst->GetUseAnchor() && ntot != 0 ){
+        for( Long_t lB=0; lB<lNDesiredBoundaries-1; lB++) {
+            if (lNrawBoundaries[lB+1]>lEst->GetAnchorPoint()){
+                if(lNrawBoundaries[lB]<lEst->GetAnchorPoint()){
+                    //This is the threshold, should actually be identical to anchor point please
+                    lNrawBoundaries[lB] = lEst->GetAnchorPoint();
+                }
             }
+        }
+    }
 
-            cout<<"=================================================================================="<<endl;
-            cout<<" Detected that this particular run / run range is special, will save it as default"<<endl;
-            cout<<" AliMultSelection Object to be saved (DEFAULT)"<<endl;
-            fsels->PrintInfo();
-            cout<<"=================================================================================="<<endl;
-
-            oadbMultSelection->SetEventCuts        ( cuts  );
-            oadbMultSelection->SetMultSelection    ( fsels );
-            for ( Int_t iEst=0; iEst<lNEstimatorsThis; iEst++) oadbMultSelection->AddCalibHisto( hDummy[iEst] );
-            oadbContMS->AddDefaultObject(oadbMultSelection);
-            //DEFAULT OADB Object saving procedure ENDS here
-            //========================================================================
+    if( lInsane == kFALSE) {
+        //Create a sane calibration histogram
+        //Should not be the source of excessive memory consumption...
+        //...but can be rearranged if needed!
+        hCalib = new TH1F(Form("hCalib_%i_%s",lRunNumber,lEst->GetName()),"",lNDesiredBoundaries-1,lNrawBoundaries);
+        hCalib->SetDirectory(0);
+        hCalib->SetBinContent(0,100.5); //Just in case correction functions screw up the values ...
+        for(Long_t ibin=1; ibin<hCalib->GetNbinsX()+1; ibin++){
+            hCalib -> SetBinContent(ibin, lMiddleOfBins[ibin-1]);
+
+            //override in case anchored!
+            if( lEst->GetUseAnchor() ){
+                if ( hCalib->GetBinCenter(ibin) < lEst->GetAnchorPoint() ){
+                    //Override, this is useless!
+                    //Alberica's recommendation: outside of user range to be sure!
+                    hCalib -> SetBinContent(ibin, 100.5);
+                }
+            }
+        }
+    }else{
+        hCalib = new TH1F(Form("hCalib_%i_%s",lRunNumber,lEst->GetName()),"",1,0,1);
+        hCalib->SetDirectory(0);
+        //There was insufficient information to generate a meaningful calibration for this estimator!
+        hCalib->SetBinContent(0,AliMultSelectionCuts::kNoCalib);
+        hCalib->SetBinContent(1,AliMultSelectionCuts::kNoCalib);
+        hCalib->SetBinContent(2,AliMultSelectionCuts::kNoCalib);
+    }
+    return hCalib;
+}
+//________________________________________________________________
+TH1F* AliMultSelectionCalibrator::BuildIntegerCalibHistogram( Int_t lRunNumber, AliMultEstimator *lEst, TH1F *hTemporary, Long64_t lEntries,
+                                                             Long_t lNBins, Float_t lLowEdge, Float_t lHighEdge ) {
+    // Integer calibration engine: calibration histogram from the value distribution
+    // (hTemporary, one bin per value, will be normalized to unity)
+    hTemporary->Scale(1./((double)(lEntries)));
+
+    Float_t lBoundaries[lNBins+1]; //to store cumulative function
+    lBoundaries[0] = 0;
+    for(Long_t iB=1; iB<hTemporary->GetNbinsX()+1; iB++) {
+        lBoundaries[iB] = lBoundaries[iB-1]+hTemporary->GetBinContent(iB);
+    }
+    //This won't follow what was requested (it cannot, mathematically)
+    TH1F *hCalib = new TH1F(Form("hCalib_%i_%s",lRunNumber,lEst->GetName()),"",lNBins,lLowEdge,lHighEdge);
+    hCalib->SetDirectory(0);
+    for(Long_t ibin=1; ibin<hCalib->GetNbinsX()+1; ibin++) hCalib -> SetBinContent(ibin, 100.0-50.0*(lBoundaries[ibin-1]+lBoundaries[ibin]));
+    //Enough info for calibration determined...
+    return hCalib;
+}
+//________________________________________________________________
+void AliMultSelectionCalibrator::SaveCalibration( AliOADBContainer *oadbContMS, Int_t iRun, Bool_t lAutoDiscover, Int_t lRunNumber,
+                                                 TH1F **hCalib, Double_t *lAvEst, Long_t lRunStats ) {
+    // Append the calibration of run (range) iRun (fSelection) to the OADB container,
+    // and save it as default as well if this is the reference run
+    if ( !lAutoDiscover ){
+        cout<<"--- Processing run range "<<fFirstRun[iRun]<<"-"<<fLastRun[iRun]<<" ("<<iRun<<"/"<<fNRunRanges<<")..."<<endl;
+    }else{
+        cout<<"--- Processing run "<<lRunNumber<<" ("<<iRun<<"/"<<fNRunRanges<<")..."<<endl;
+    }
+    const Int_t lNEstimatorsThis = fSelection->GetNEstimators();
+
+    AliOADBMultSelection * oadbMultSelection = new AliOADBMultSelection();
+    AliMultSelectionCuts * cuts              = fMultSelectionCuts;
+    AliMultSelection     * fsels             = new AliMultSelection( fSelection );
+
+    oadbMultSelection->SetEventCuts    (cuts );
+    oadbMultSelection->SetMultSelection(fsels);
+    for ( Int_t iEst=0; iEst<lNEstimatorsThis; iEst++) {
+        //Average values
+        fsels->GetEstimator(iEst)->SetMean( lAvEst[iEst] );
+
+        //Beware similar names! Will be saved ...
+        TH1F *hCalibData = (TH1F*) hCalib[iEst]->Clone( Form("hCalib_%s",fSelection->GetEstimator(iEst)->GetName()) );
+        oadbMultSelection->AddCalibHisto( hCalibData );
+        hCalibData->SetDirectory(0);
+    }
+    cout<<"=================================================================================="<<endl;
+    if ( !lAutoDiscover ){
+        cout<<"AliMultSelection Object to be saved for run range "<<fFirstRun[iRun]<<"-"<<fLastRun[iRun]<<")"<<endl;
+    }else{
+        cout<<"AliMultSelection Object to be saved for run "<<lRunNumber<<")"<<endl;
+    }
+    fsels->PrintInfo();
+    cuts->Print();
+    cout<<"=================================================================================="<<endl;
+    //Protection against saving a calibration object that has been acquired
+    //with insufficient statistics
+    if ( lRunStats > 1000){
+        if ( !lAutoDiscover ) {
+            oadbContMS->AppendObject(oadbMultSelection, fFirstRun[iRun], fLastRun[iRun] );
+        }else{
+            oadbContMS->AppendObject(oadbMultSelection, lRunNumber, lRunNumber );
         }
     }
 
-    if( fRunToUseAsDefault < 0 ){
+    Bool_t lThisIsReference = kFALSE;
+    if(!lAutoDiscover){
+        if ( fFirstRun[iRun] <= fRunToUseAsDefault && fRunToUseAsDefault <= fLastRun[iRun]) lThisIsReference = kTRUE;
+    }else{
+        if ( lRunNumber == fRunToUseAsDefault ) lThisIsReference = kTRUE;
+    }
+    if( lThisIsReference ){
         //========================================================================
         //DEFAULT OADB Object saving procedure STARTS here
         oadbMultSelection = new AliOADBMultSelection("Default");
-        cuts              = new AliMultSelectionCuts();
-        cuts = fMultSelectionCuts;
         fsels             = new AliMultSelection    ( fSelection         );
 
-        const Int_t lNEstimatorsThis = fSelection->GetNEstimators();
-
-        cout<<"=================================================================================="<<endl;
-        cout<<" AliMultSelection Object to be saved (DEFAULT)"<<endl;
-        cout<<" Warning: this corresponds to the last calibrated run!"<<endl;
-        fsels->PrintInfo();
-        cout<<"=================================================================================="<<endl;
-
         //Default Stuff
         TH1F * hDummy[lNEstimatorsThis];
         for ( Int_t iEst=0; iEst<lNEstimatorsThis; iEst++) {
+            //Get Meaningful means
+            fsels->GetEstimator(iEst)->SetMean( lAvEst[iEst] );
             //Clone last histogram ...
-            hDummy[iEst]= (TH1F*) hCalib[fNRunRanges-1][iEst]->Clone( Form("hCalib_%s",fSelection->GetEstimator(iEst)->GetName()) );
+            hDummy[iEst]= (TH1F*) hCalib[iEst]->Clone( Form("hCalib_%s",fSelection->GetEstimator(iEst)->GetName()) );
             hDummy[iEst]->SetDirectory(0);
         }
 
+        cout<<"=================================================================================="<<endl;
+        cout<<" Detected that this particular run / run range is special, will save it as default"<<endl;
+        cout<<" AliMultSelection Object to be saved (DEFAULT)"<<endl;
+        fsels->PrintInfo();
+        cout<<"=================================================================================="<<endl;
+
         oadbMultSelection->SetEventCuts        ( cuts  );
         oadbMultSelection->SetMultSelection    ( fsels );
         for ( Int_t iEst=0; iEst<lNEstimatorsThis; iEst++) oadbMultSelection->AddCalibHisto( hDummy[iEst] );
@@ -766,12 +1338,38 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
         //DEFAULT OADB Object saving procedure ENDS here
         //========================================================================
     }
+}
+//________________________________________________________________
+void AliMultSelectionCalibrator::SaveLastAsDefault( AliOADBContainer *oadbContMS, TH1F **hCalib ) {
+    // Save the calibration of the last run (range) (fSelection) as default
+    //========================================================================
+    //DEFAULT OADB Object saving procedure STARTS here
+    AliOADBMultSelection * oadbMultSelection = new AliOADBMultSelection("Default");
+    AliMultSelectionCuts * cuts              = fMultSelectionCuts;
+    AliMultSelection     * fsels             = new AliMultSelection    ( fSelection         );
+
+    const Int_t lNEstimatorsThis = fSelection->GetNEstimators();
+
+    cout<<"=================================================================================="<<endl;
+    cout<<" AliMultSelection Object to be saved (DEFAULT)"<<endl;
+    cout<<" Warning: this corresponds to the last calibrated run!"<<endl;
+    fsels->PrintInfo();
+    cout<<"=================================================================================="<<endl;
+
+    //Default Stuff
+    TH1F * hDummy[lNEstimatorsThis];
+    for ( Int_t iEst=0; iEst<lNEstimatorsThis; iEst++) {
+        //Clone last histogram ...
+        hDummy[iEst]= (TH1F*) hCalib[iEst]->Clone( Form("hCalib_%s",fSelection->GetEstimator(iEst)->GetName()) );
+        hDummy[iEst]->SetDirectory(0);
+    }
 
-    cout<<"All done, will write OADB..."<<endl;
-
-    oadbContMS->Write();
-    cout<<" Done!"<<endl;
-    return kTRUE;
+    oadbMultSelection->SetEventCuts        ( cuts  );
+    oadbMultSelection->SetMultSelection    ( fsels );
+    for ( Int_t iEst=0; iEst<lNEstimatorsThis; iEst++) oadbMultSelection->AddCalibHisto( hDummy[iEst] );
+    oadbContMS->AddDefaultObject(oadbMultSelection);
+    //DEFAULT OADB Object saving procedure ENDS here
+    //========================================================================
 }
 //________________________________________________________________
 Float_t AliMultSelectionCalibrator::MinVal( Float_t A, Float_t B ) {
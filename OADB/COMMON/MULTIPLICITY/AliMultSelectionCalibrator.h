@@ -9,6 +9,9 @@
 
 using namespace std;
 class AliESDEvent;
+class AliOADBContainer;
+class AliMultEstimator;
+class TH1F;
 class AliMultSelectionCalibrator : public TNamed {
     
 public:
@@ -76,11 +79,29 @@ public:
     
     //Master Function in this Class: To be called once filenames are set
     Bool_t Calibrate();
+
+    //Streaming calibration: same output as Calibrate(), but the input is read
+    //once by fNThreads workers without buffer trees. Quantiles are exact up to
+    //fStreamingExactLimit events per run (range), and have a bounded rank error
+    //beyond (mergeable sketch, see AliMultQuantileSketch)
+    Bool_t CalibrateStreaming();
+    void SetNThreads ( Int_t lNThreads ) { fNThreads = lNThreads; }
+    void SetStreamingExactLimit ( Long64_t lVal ) { fStreamingExactLimit = lVal; }
+    void SetStreamingSketchCapacity ( Int_t lVal ) { fStreamingSketchCapacity = lVal; }
     
     //Helper
     Float_t MinVal( Float_t A, Float_t B );
     
 private:
+    //Calibration histograms and OADB objects (shared by both calibration modes)
+    TH1F* BuildCalibHistogram( Int_t lRunNumber, AliMultEstimator *lEst, Long64_t ntot,
+                               Double_t *lNrawBoundaries, Double_t *lMiddleOfBins, Bool_t lInsane );
+    TH1F* BuildIntegerCalibHistogram( Int_t lRunNumber, AliMultEstimator *lEst, TH1F *hTemporary, Long64_t lEntries,
+                                      Long_t lNBins, Float_t lLowEdge, Float_t lHighEdge );
+    void  SaveCalibration( AliOADBContainer *oadbContMS, Int_t iRun, Bool_t lAutoDiscover, Int_t lRunNumber,
+                           TH1F **hCalib, Double_t *lAvEst, Long_t lRunStats );
+    void  SaveLastAsDefault( AliOADBContainer *oadbContMS, TH1F **hCalib );
+
     AliMultInput     *fInput;     //Object for all input
     AliMultSelection *fSelection; //(current) transient pointer object
 
@@ -96,6 +117,11 @@ private:
     AliVEvent::EOfflineTriggerTypes fTrigType; // trigger type to calibrate
     Bool_t fPrefilterOnly; //stop before calibrating stuff
     TString fFiredTrigString; //select on fired trigger string if desired
+
+    //Streaming calibration configuration
+    Int_t    fNThreads;                //number of workers
+    Long64_t fStreamingExactLimit;     //exact quantiles up to this many events per run
+    Int_t    fStreamingSketchCapacity; //sketch level capacity beyond the exact limit
     
     //Run Ranges map - master storage
     Long_t fNRunRanges;
@@ -115,10 +141,11 @@ private:
     // TList object for storing histograms
     TList *fCalibHists; 
 
-    ClassDef(AliMultSelectionCalibrator, 2);
+    ClassDef(AliMultSelectionCalibrator, 3);
     //(this classdef is only for bookkeeping, class will not usually
     // be streamed according to current workflow except in very specific
     // tests!) 
     //2 - Adjustments of extra event selections
+    //3 - Streaming calibration configuration
 };
 #endif
@@ -36,6 +36,7 @@
 #pragma link C++ class AliMultSelectionCuts+;
 #pragma link C++ class AliOADBMultSelection+;
 #pragma link C++ class AliMultSelectionTask+;
+#pragma link C++ class AliMultQuantileSketch+;
 #pragma link C++ class AliMultSelectionCalibrator+;
 #pragma link C++ class AliMultSelectionCalibratorMC+;
 #pragma link C++ class AliMultGlauberNBDFitter+;
@@ -369,6 +369,9 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  fReferenceMultiplicityEBE = anEvent->GetReferenceMultiplicity(); // reference multiplicity for current event
  //Printf("Reference multiplicity (QC): %.1f",fReferenceMultiplicityEBE);
  Double_t ptEta[2] = {0.,0.}; // 0 = dPt, 1 = dEta
+ Double_t dWeightPowk[9] = {0.}; // (wPhi*wPt*wEta*wTrack)^k, k = 0,1,...,8
+ Double_t dCosmnPhi[12] = {0.}; // cos(m*n*dPhi), m = 1,2,...,12
+ Double_t dSinmnPhi[12] = {0.}; // sin(m*n*dPhi), m = 1,2,...,12
   
  // c) Fill the common control histograms and call the method to fill fAvMultiplicity:
  this->FillCommonControlHistograms(anEvent);                                                               
@@ -409,13 +412,23 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     {
      wTrack = aftsTrack->Weight(); 
     }
+    // Powers of particle weight and cos(m*n*phi), sin(m*n*phi), needed for all e-b-e quantities of this particle:
+    for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+    {
+     dWeightPowk[k] = pow(wPhi*wPt*wEta*wTrack,k);
+    }
+    for(Int_t m=0;m<12;m++) // to be improved - hardwired 12
+    {
+     dCosmnPhi[m] = TMath::Cos((m+1)*n*dPhi);
+     dSinmnPhi[m] = TMath::Sin((m+1)*n*dPhi);
+    }
     // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
     for(Int_t m=0;m<12;m++) // to be improved - hardwired 6 
     {
      for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
      {
-      (*fReQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1)*n*dPhi); 
-      (*fImQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1)*n*dPhi); 
+      (*fReQ)(m,k)+=dWeightPowk[k]*dCosmnPhi[m]; 
+      (*fImQ)(m,k)+=dWeightPowk[k]*dSinmnPhi[m]; 
      } 
     }
     // Calculate S_{p,k} for this event (Remark: final calculation of S_{p,k} follows after the loop over data bellow):
@@ -423,7 +436,7 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     {
      for(Int_t k=0;k<9;k++)
      {     
-      (*fSpk)(p,k)+=pow(wPhi*wPt*wEta*wTrack,k);
+      (*fSpk)(p,k)+=dWeightPowk[k];
      }
     } 
     // Differential flow:
@@ -431,66 +444,41 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     {
      ptEta[0] = dPt; 
      ptEta[1] = dEta; 
-     // Calculate r_{m*n,k} and s_{p,k} (r_{m,k} is 'p-vector' for RPs): 
-     for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+     // Calculate r_{m*n,k} and s_{p,k} (r_{m,k} is 'p-vector' for RPs), and for particles which are also POIs
+     // q_{m*n,k} and s_{p,k} ('q-vector' and 's' for RPs && POIs): 
+     if(fCalculateDiffFlow)
      {
-      for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+      for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
       {
-       if(fCalculateDiffFlow)
-       {
-        for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-        {
-         fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-         if(m==0) // s_{p,k} does not depend on index m
-         {
-          fs1dEBE[0][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
-         } // end of if(m==0) // s_{p,k} does not depend on index m
-        } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-       } // end of if(fCalculateDiffFlow) 
-       if(fCalculate2DDiffFlow)
-       {
-        fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-        if(m==0) // s_{p,k} does not depend on index m
-        {
-         fs2dEBE[0][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
-        } // end of if(m==0) // s_{p,k} does not depend on index m
-       } // end of if(fCalculate2DDiffFlow)
-      } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-     } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-     // Checking if RP particle is also POI particle:      
-     if(aftsTrack->InPOISelection())
+       this->FillDiffFlowQvectorsEBE(0,pe,ptEta[pe],dWeightPowk,dCosmnPhi,dSinmnPhi);
+       if(aftsTrack->InPOISelection()){this->FillDiffFlowQvectorsEBE(2,pe,ptEta[pe],dWeightPowk,dCosmnPhi,dSinmnPhi);}
+      } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
+     } // end of if(fCalculateDiffFlow) 
+     if(fCalculate2DDiffFlow)
      {
-      // Calculate q_{m*n,k} and s_{p,k} ('q-vector' and 's' for RPs && POIs): 
       for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
       {
        for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
        {
-        if(fCalculateDiffFlow)
+        fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,dWeightPowk[k]*dCosmnPhi[m],1.);
+        fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,dWeightPowk[k]*dSinmnPhi[m],1.);      
+        if(m==0) // s_{p,k} does not depend on index m
         {
-         for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-         {
-          fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-          fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-          if(m==0) // s_{p,k} does not depend on index m
-          {
-           fs1dEBE[2][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
-          } // end of if(m==0) // s_{p,k} does not depend on index m
-         } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-        } // end of if(fCalculateDiffFlow) 
-        if(fCalculate2DDiffFlow)
+         fs2dEBE[0][k]->Fill(dPt,dEta,dWeightPowk[k],1.);
+        } // end of if(m==0) // s_{p,k} does not depend on index m
+        // Checking if RP particle is also POI particle:      
+        if(aftsTrack->InPOISelection())
         {
-         fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
+         fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,dWeightPowk[k]*dCosmnPhi[m],1.);
+         fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,dWeightPowk[k]*dSinmnPhi[m],1.);      
          if(m==0) // s_{p,k} does not depend on index m
          {
-          fs2dEBE[2][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
+          fs2dEBE[2][k]->Fill(dPt,dEta,dWeightPowk[k],1.);
          } // end of if(m==0) // s_{p,k} does not depend on index m
-        } // end of if(fCalculate2DDiffFlow)
+        } // end of if(aftsTrack->InPOISelection())  
        } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-      } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
-     } // end of if(aftsTrack->InPOISelection())  
+      } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+     } // end of if(fCalculate2DDiffFlow)
     } // end of if(fCalculateDiffFlow || fCalculate2DDiffFlow)         
    } // end of if(pTrack->InRPSelection())
    if(aftsTrack->InPOISelection())
@@ -521,26 +509,38 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     }
     ptEta[0] = dPt;
     ptEta[1] = dEta;
-    // Calculate p_{m*n,k} ('p-vector' for POIs): 
+    // Powers of particle weight (for POIs which are not RPs the weight is 1) and, for POIs which are not RPs, cos(m*n*phi), sin(m*n*phi):
     for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+    {
+     dWeightPowk[k] = pow(wPhi*wPt*wEta*wTrack,k);
+    }
+    if(!aftsTrack->InRPSelection())
     {
      for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
      {
-      if(fCalculateDiffFlow)
-      {
-       for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-       {
-        fReRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-       } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-      } // end of if(fCalculateDiffFlow) 
-      if(fCalculate2DDiffFlow)
+      dCosmnPhi[m] = TMath::Cos((m+1)*n*dPhi);
+      dSinmnPhi[m] = TMath::Sin((m+1)*n*dPhi);
+     }
+    }
+    // Calculate p_{m*n,k} ('p-vector' for POIs): 
+    if(fCalculateDiffFlow)
+    {
+     for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
+     {
+      this->FillDiffFlowQvectorsEBE(1,pe,ptEta[pe],dWeightPowk,dCosmnPhi,dSinmnPhi);
+     } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
+    } // end of if(fCalculateDiffFlow) 
+    if(fCalculate2DDiffFlow)
+    {
+     for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+     {
+      for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
       {
-       fReRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-       fImRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-      } // end of if(fCalculate2DDiffFlow)
-     } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-    } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
+       fReRPQ2dEBE[1][m][k]->Fill(dPt,dEta,dWeightPowk[k]*dCosmnPhi[m],1.);
+       fImRPQ2dEBE[1][m][k]->Fill(dPt,dEta,dWeightPowk[k]*dSinmnPhi[m],1.);      
+      } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+     } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
+    } // end of if(fCalculate2DDiffFlow)
    } // end of if(pTrack->InPOISelection())    
   } else // to if(aftsTrack)
     {
@@ -15338,22 +15338,8 @@ void AliFlowAnalysisWithQCumulants::InitializeArraysForDiffFlow()
  } // enf of for(Int_t t=0;t<2;t++) // type (RP, POI) 
  
  // c) Initialize event-by-event quantities:
- // 1D:
- for(Int_t t=0;t<3;t++) // type (RP, POI, POI&&RP)
- {
-  for(Int_t pe=0;pe<2;pe++) // pt or eta
-  { 
-   for(Int_t m=0;m<4;m++) // multiple of harmonic
-   {
-    for(Int_t k=0;k<9;k++) // power of weight
-    {
-     fReRPQ1dEBE[t][pe][m][k] = NULL;
-     fImRPQ1dEBE[t][pe][m][k] = NULL;
-     fs1dEBE[t][pe][k] = NULL; // to be improved (this doesn't need to be within loop over m)
-    }   
-   }
-  }
- }
+ // 1D (flat arrays are booked in BookEverythingForDifferentialFlow()):
+ fnBins1dEBE = 0;
  // 1D:
  for(Int_t t=0;t<2;t++) // type (RP or POI)
  {
@@ -16619,41 +16605,41 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelations(TString type,
   if(type == "POI")
   {
    // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[2][pe][0][0]->GetBinContent(fReRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[2][pe][0][0]->GetBinContent(fImRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][0][0]->GetBinEntries(fImRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[2][pe][1][0]->GetBinContent(fReRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][1][0]->GetBinEntries(fReRPQ1dEBE[2][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[2][pe][1][0]->GetBinContent(fImRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][1][0]->GetBinEntries(fImRPQ1dEBE[2][pe][1][0]->GetBin(b));         
+   q1n0kRe = GetReRPQ1dEBE(2,pe,0,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q1n0kIm = GetImRPQ1dEBE(2,pe,0,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q2n0kRe = GetReRPQ1dEBE(2,pe,1,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q2n0kIm = GetImRPQ1dEBE(2,pe,1,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);         
                  
-   mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   mq = GetRPQ1dEBEEntries(2,pe,b); // to be improved (cross-checked by accessing other profiles here)
   } 
   else if(type == "RP")
   {
    // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[0][pe][0][0]->GetBinContent(fImRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][0][0]->GetBinEntries(fImRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[0][pe][1][0]->GetBinContent(fReRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][1][0]->GetBinEntries(fReRPQ1dEBE[0][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[0][pe][1][0]->GetBinContent(fImRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][1][0]->GetBinEntries(fImRPQ1dEBE[0][pe][1][0]->GetBin(b));         
+   q1n0kRe = GetReRPQ1dEBE(0,pe,0,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);
+   q1n0kIm = GetImRPQ1dEBE(0,pe,0,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);
+   q2n0kRe = GetReRPQ1dEBE(0,pe,1,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);
+   q2n0kIm = GetImRPQ1dEBE(0,pe,1,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);         
                  
-   mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)  
+   mq = GetRPQ1dEBEEntries(0,pe,b); // to be improved (cross-checked by accessing other profiles here)  
   }
       
    if(type == "POI")
    {
     // p_{m*n,0}:
-    p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
-            * fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b));
-    p1n0kIm = fImRPQ1dEBE[1][pe][0][0]->GetBinContent(fImRPQ1dEBE[1][pe][0][0]->GetBin(b))  
-            * fImRPQ1dEBE[1][pe][0][0]->GetBinEntries(fImRPQ1dEBE[1][pe][0][0]->GetBin(b));
+    p1n0kRe = GetReRPQ1dEBE(1,pe,0,0,b)
+            * GetRPQ1dEBEEntries(1,pe,b);
+    p1n0kIm = GetImRPQ1dEBE(1,pe,0,0,b)  
+            * GetRPQ1dEBEEntries(1,pe,b);
             
-    mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+    mp = GetRPQ1dEBEEntries(1,pe,b); // to be improved (cross-checked by accessing other profiles here)
     
     //t = 1; // typeFlag = RP or POI
    }
@@ -16833,49 +16819,49 @@ void AliFlowAnalysisWithQCumulants::CalculateOtherDiffCorrelators(TString type,
   if(type == "POI")
   {
    // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[2][pe][0][0]->GetBinContent(fReRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[2][pe][0][0]->GetBinContent(fImRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][0][0]->GetBinEntries(fImRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[2][pe][1][0]->GetBinContent(fReRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][1][0]->GetBinEntries(fReRPQ1dEBE[2][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[2][pe][1][0]->GetBinContent(fImRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][1][0]->GetBinEntries(fImRPQ1dEBE[2][pe][1][0]->GetBin(b));                         
-   q3n0kRe = fReRPQ1dEBE[2][pe][2][0]->GetBinContent(fReRPQ1dEBE[2][pe][2][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][2][0]->GetBinEntries(fReRPQ1dEBE[2][pe][2][0]->GetBin(b));
-   q3n0kIm = fImRPQ1dEBE[2][pe][2][0]->GetBinContent(fImRPQ1dEBE[2][pe][2][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][2][0]->GetBinEntries(fImRPQ1dEBE[2][pe][2][0]->GetBin(b));         
-
-   mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   q1n0kRe = GetReRPQ1dEBE(2,pe,0,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q1n0kIm = GetImRPQ1dEBE(2,pe,0,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q2n0kRe = GetReRPQ1dEBE(2,pe,1,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q2n0kIm = GetImRPQ1dEBE(2,pe,1,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);                         
+   q3n0kRe = GetReRPQ1dEBE(2,pe,2,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q3n0kIm = GetImRPQ1dEBE(2,pe,2,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);         
+
+   mq = GetRPQ1dEBEEntries(2,pe,b); // to be improved (cross-checked by accessing other profiles here)
   } 
   else if(type == "RP")
   {
    // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[0][pe][0][0]->GetBinContent(fImRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][0][0]->GetBinEntries(fImRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[0][pe][1][0]->GetBinContent(fReRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][1][0]->GetBinEntries(fReRPQ1dEBE[0][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[0][pe][1][0]->GetBinContent(fImRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][1][0]->GetBinEntries(fImRPQ1dEBE[0][pe][1][0]->GetBin(b));         
-   q3n0kRe = fReRPQ1dEBE[0][pe][2][0]->GetBinContent(fReRPQ1dEBE[0][pe][2][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][2][0]->GetBinEntries(fReRPQ1dEBE[0][pe][2][0]->GetBin(b));
-   q3n0kIm = fImRPQ1dEBE[0][pe][2][0]->GetBinContent(fImRPQ1dEBE[0][pe][2][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][2][0]->GetBinEntries(fImRPQ1dEBE[0][pe][2][0]->GetBin(b));         
+   q1n0kRe = GetReRPQ1dEBE(0,pe,0,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);
+   q1n0kIm = GetImRPQ1dEBE(0,pe,0,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);
+   q2n0kRe = GetReRPQ1dEBE(0,pe,1,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);
+   q2n0kIm = GetImRPQ1dEBE(0,pe,1,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);         
+   q3n0kRe = GetReRPQ1dEBE(0,pe,2,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);
+   q3n0kIm = GetImRPQ1dEBE(0,pe,2,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);         
                  
-   mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)  
+   mq = GetRPQ1dEBEEntries(0,pe,b); // to be improved (cross-checked by accessing other profiles here)  
   }
       
    if(type == "POI")
    {
     // p_{m*n,0}:
-    p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
-            * fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b));
-    p1n0kIm = fImRPQ1dEBE[1][pe][0][0]->GetBinContent(fImRPQ1dEBE[1][pe][0][0]->GetBin(b))  
-            * fImRPQ1dEBE[1][pe][0][0]->GetBinEntries(fImRPQ1dEBE[1][pe][0][0]->GetBin(b));
+    p1n0kRe = GetReRPQ1dEBE(1,pe,0,0,b)
+            * GetRPQ1dEBEEntries(1,pe,b);
+    p1n0kIm = GetImRPQ1dEBE(1,pe,0,0,b)  
+            * GetRPQ1dEBEEntries(1,pe,b);
             
-    mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+    mp = GetRPQ1dEBEEntries(1,pe,b); // to be improved (cross-checked by accessing other profiles here)
     
     t = 1; // typeFlag = RP or POI
    }
@@ -17112,24 +17098,12 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfEventWeights(TString t
  //Double_t maxPtEta[2] = {fPtMax,fEtaMax};
  Double_t binWidthPtEta[2] = {fPtBinWidth,fEtaBinWidth};
  
- for(Int_t rpq=0;rpq<3;rpq++)
+ if(fRPQ1dEBEEntries.GetSize() == 0)
  {
-  for(Int_t m=0;m<4;m++)
-  {
-   for(Int_t k=0;k<9;k++)
-   {
-    if(!fReRPQ1dEBE[rpq][pe][m][k])
-    {
-     cout<<"WARNING: fReRPQ1dEBE[rpq][pe][m][k] is NULL in AFAWQC::CSAPOEWFDF() !!!!"<<endl;
-     cout<<"pe  = "<<pe<<endl;
-     cout<<"rpq = "<<rpq<<endl;
-     cout<<"m   = "<<m<<endl;
-     cout<<"k   = "<<k<<endl;
-     exit(0); 
-    }
-   }
-  }
- }  
+  cout<<"WARNING: fRPQ1dEBEEntries is not booked in AFAWQC::CSAPOEWFDF() !!!!"<<endl;
+  cout<<"pe  = "<<pe<<endl;
+  exit(0); 
+ }
 
  // multiplicities:
  Double_t dMult = (*fSpk)(0,0); // total event multiplicity
@@ -17148,12 +17122,12 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfEventWeights(TString t
  {
   if(type == "RP")
   {
-   mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(b);
+   mq = GetRPQ1dEBEEntries(0,pe,b);
    mp = mq; // trick to use the very same Eqs. bellow both for RP's and POI's diff. flow
   } else if(type == "POI")
     {
-     mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(b);
-     mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(b);    
+     mp = GetRPQ1dEBEEntries(1,pe,b);
+     mq = GetRPQ1dEBEEntries(2,pe,b);    
     }
   
   // event weight for <2'>:
@@ -17225,24 +17199,12 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfProductOfEventWeights(
  Double_t binWidthPtEta[2] = {fPtBinWidth,fEtaBinWidth};
  
  // protection:
- for(Int_t rpq=0;rpq<3;rpq++)
+ if(fRPQ1dEBEEntries.GetSize() == 0)
  {
-  for(Int_t m=0;m<4;m++)
-  {
-   for(Int_t k=0;k<9;k++)
-   {
-    if(!fReRPQ1dEBE[rpq][pe][m][k])
-    {
-     cout<<"WARNING: fReRPQ1dEBE[rpq][pe][m][k] is NULL in AFAWQC::CSAPOEWFDF() !!!!"<<endl;
-     cout<<"pe  = "<<pe<<endl;
-     cout<<"rpq = "<<rpq<<endl;
-     cout<<"m   = "<<m<<endl;
-     cout<<"k   = "<<k<<endl;
-     exit(0); 
-    }
-   }
-  }
- }  
+  cout<<"WARNING: fRPQ1dEBEEntries is not booked in AFAWQC::CSAPOEWFDF() !!!!"<<endl;
+  cout<<"pe  = "<<pe<<endl;
+  exit(0); 
+ }
  
  // multiplicities:
  Double_t dMult = (*fSpk)(0,0); // total event multiplicity
@@ -17267,12 +17229,12 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfProductOfEventWeights(
  {
   if(type == "RP")
   {
-   mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(b);
+   mq = GetRPQ1dEBEEntries(0,pe,b);
    mp = mq; // trick to use the very same Eqs. bellow both for RP's and POI's diff. flow
   } else if(type == "POI")
     {
-     mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(b);
-     mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(b);    
+     mp = GetRPQ1dEBEEntries(1,pe,b);
+     mq = GetRPQ1dEBEEntries(2,pe,b);    
     }
   
   // event weight for <2'>:
@@ -17513,12 +17475,12 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowProductOfCorrelations(TStri
   // to be improved (I should not do this here again)
   if(type == "RP")
   {
-   mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(b);
+   mq = GetRPQ1dEBEEntries(0,pe,b);
    mp = mq; // trick to use the very same Eqs. bellow both for RP's and POI's diff. flow
   } else if(type == "POI")
     {
-     mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(b);
-     mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(b);    
+     mp = GetRPQ1dEBEEntries(1,pe,b);
+     mq = GetRPQ1dEBEEntries(2,pe,b);    
     }
   
   // event weights for reduced correlations:
@@ -19485,35 +19447,14 @@ void AliFlowAnalysisWithQCumulants::BookEverythingForDifferentialFlow()
  //  5.) q_{m*n,k}(pt,eta) = Q-vector evaluated in harmonic m*n for particles which are both RPs and POIs in particular (pt,eta) bin 
  //                          (i-th RP&&POI is weighted with w_i^k)            
   
- // 1D:
- for(Int_t t=0;t<3;t++) // typeFlag (0 = RP, 1 = POI, 2 = RP && POI )
- { 
-  for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-  {
-   for(Int_t m=0;m<4;m++) // multiple of harmonic
-   {
-    for(Int_t k=0;k<9;k++) // power of particle weight
-    {
-     fReRPQ1dEBE[t][pe][m][k] = new TProfile(Form("TypeFlag%dpteta%dmultiple%dpower%dRe",t,pe,m,k),
-                                             Form("TypeFlag%dpteta%dmultiple%dpower%dRe",t,pe,m,k),nBinsPtEta[pe],minPtEta[pe],maxPtEta[pe]); 
-     fImRPQ1dEBE[t][pe][m][k] = new TProfile(Form("TypeFlag%dpteta%dmultiple%dpower%dIm",t,pe,m,k),
-                                             Form("TypeFlag%dpteta%dmultiple%dpower%dIm",t,pe,m,k),nBinsPtEta[pe],minPtEta[pe],maxPtEta[pe]); 
-    }
-   }
-  }
- } 
- // to be improved (add explanation of fs1dEBE[t][pe][k]):   
- for(Int_t t=0;t<3;t++) // typeFlag (0 = RP, 1 = POI, 2 = RP&&POI )
- { 
-  for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-  {
-   for(Int_t k=0;k<9;k++) // power of particle weight
-   {
-    fs1dEBE[t][pe][k] = new TProfile(Form("TypeFlag%dpteta%dmultiple%d",t,pe,k),
-                                     Form("TypeFlag%dpteta%dmultiple%d",t,pe,k),nBinsPtEta[pe],minPtEta[pe],maxPtEta[pe]); 
-   }
-  }
- }
+ // 1D: flat arrays indexed by [typeFlag (0 = RP, 1 = POI, 2 = RP && POI)][pt or eta][m][k][bin], where bin follows
+ // the binning of a TProfile with nBinsPtEta[pe] bins in [minPtEta[pe],maxPtEta[pe]] (0 = underflow, nBinsPtEta[pe]+1 = overflow).
+ // s_{p,k} is the sum of the particle weights to power k and doesn't depend on m:
+ fnBins1dEBE = TMath::Max(nBinsPtEta[0],nBinsPtEta[1])+2;
+ fReRPQ1dEBE.Set(3*2*4*9*fnBins1dEBE);
+ fImRPQ1dEBE.Set(3*2*4*9*fnBins1dEBE);
+ fs1dEBE.Set(3*2*9*fnBins1dEBE);
+ fRPQ1dEBEEntries.Set(3*2*fnBins1dEBE);
  // correction terms for nua:
  for(Int_t t=0;t<2;t++) // typeFlag (0 = RP, 1 = POI)
  { 
@@ -20829,29 +20770,29 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelationsUsingParticleWe
  
   if(type == "POI")
   {
-   p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b));
-   p1n0kIm = fImRPQ1dEBE[1][pe][0][0]->GetBinContent(fImRPQ1dEBE[1][pe][0][0]->GetBin(b))  
-           * fImRPQ1dEBE[1][pe][0][0]->GetBinEntries(fImRPQ1dEBE[1][pe][0][0]->GetBin(b));
+   p1n0kRe = GetReRPQ1dEBE(1,pe,0,0,b)
+           * GetRPQ1dEBEEntries(1,pe,b);
+   p1n0kIm = GetImRPQ1dEBE(1,pe,0,0,b)  
+           * GetRPQ1dEBEEntries(1,pe,b);
             
-   mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   mp = GetRPQ1dEBEEntries(1,pe,b); // to be improved (cross-checked by accessing other profiles here)
     
    t = 1; // typeFlag = RP or POI
     
    // q_{m*n,k}: (Remark: m=1 is 0, k=0 iz zero (to be improved!)) 
-   q1n2kRe = fReRPQ1dEBE[2][pe][0][2]->GetBinContent(fReRPQ1dEBE[2][pe][0][2]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][0][2]->GetBinEntries(fReRPQ1dEBE[2][pe][0][2]->GetBin(b));
-   q1n2kIm = fImRPQ1dEBE[2][pe][0][2]->GetBinContent(fImRPQ1dEBE[2][pe][0][2]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][0][2]->GetBinEntries(fImRPQ1dEBE[2][pe][0][2]->GetBin(b));
-   q2n1kRe = fReRPQ1dEBE[2][pe][1][1]->GetBinContent(fReRPQ1dEBE[2][pe][1][1]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][1][1]->GetBinEntries(fReRPQ1dEBE[2][pe][1][1]->GetBin(b));
-   q2n1kIm = fImRPQ1dEBE[2][pe][1][1]->GetBinContent(fImRPQ1dEBE[2][pe][1][1]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][1][1]->GetBinEntries(fImRPQ1dEBE[2][pe][1][1]->GetBin(b));
+   q1n2kRe = GetReRPQ1dEBE(2,pe,0,2,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q1n2kIm = GetImRPQ1dEBE(2,pe,0,2,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q2n1kRe = GetReRPQ1dEBE(2,pe,1,1,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q2n1kIm = GetImRPQ1dEBE(2,pe,1,1,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
        
    // s_{1,1}, s_{1,2} and s_{1,3} // to be improved (add explanation)  
-   s1p1k = pow(fs1dEBE[2][pe][1]->GetBinContent(b)*fs1dEBE[2][pe][1]->GetBinEntries(b),1.); 
-   s1p2k = pow(fs1dEBE[2][pe][2]->GetBinContent(b)*fs1dEBE[2][pe][2]->GetBinEntries(b),1.); 
-   s1p3k = pow(fs1dEBE[2][pe][3]->GetBinContent(b)*fs1dEBE[2][pe][3]->GetBinEntries(b),1.); 
+   s1p1k = pow(Gets1dEBE(2,pe,1,b)*GetRPQ1dEBEEntries(2,pe,b),1.); 
+   s1p2k = pow(Gets1dEBE(2,pe,2,b)*GetRPQ1dEBEEntries(2,pe,b),1.); 
+   s1p3k = pow(Gets1dEBE(2,pe,3,b)*GetRPQ1dEBEEntries(2,pe,b),1.); 
      
    // M0111 from Eq. (118) in QC2c (to be improved (notation)):
    dM0111 = mp*(dSM3p1k-3.*dSM1p1k*dSM1p2k+2.*dSM1p3k)
@@ -20861,27 +20802,27 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrelationsUsingParticleWe
    else if(type == "RP")
    {
     // q_{m*n,k}: (Remark: m=1 is 0, k=0 iz zero (to be improved!)) 
-    q1n2kRe = fReRPQ1dEBE[0][pe][0][2]->GetBinContent(fReRPQ1dEBE[0][pe][0][2]->GetBin(b))
-            * fReRPQ1dEBE[0][pe][0][2]->GetBinEntries(fReRPQ1dEBE[0][pe][0][2]->GetBin(b));
-    q1n2kIm = fImRPQ1dEBE[0][pe][0][2]->GetBinContent(fImRPQ1dEBE[0][pe][0][2]->GetBin(b))
-            * fImRPQ1dEBE[0][pe][0][2]->GetBinEntries(fImRPQ1dEBE[0][pe][0][2]->GetBin(b));
-    q2n1kRe = fReRPQ1dEBE[0][pe][1][1]->GetBinContent(fReRPQ1dEBE[0][pe][1][1]->GetBin(b))
-            * fReRPQ1dEBE[0][pe][1][1]->GetBinEntries(fReRPQ1dEBE[0][pe][1][1]->GetBin(b));
-    q2n1kIm = fImRPQ1dEBE[0][pe][1][1]->GetBinContent(fImRPQ1dEBE[0][pe][1][1]->GetBin(b))
-            * fImRPQ1dEBE[0][pe][1][1]->GetBinEntries(fImRPQ1dEBE[0][pe][1][1]->GetBin(b));
+    q1n2kRe = GetReRPQ1dEBE(0,pe,0,2,b)
+            * GetRPQ1dEBEEntries(0,pe,b);
+    q1n2kIm = GetImRPQ1dEBE(0,pe,0,2,b)
+            * GetRPQ1dEBEEntries(0,pe,b);
+    q2n1kRe = GetReRPQ1dEBE(0,pe,1,1,b)
+            * GetRPQ1dEBEEntries(0,pe,b);
+    q2n1kIm = GetImRPQ1dEBE(0,pe,1,1,b)
+            * GetRPQ1dEBEEntries(0,pe,b);
 
     // s_{1,1}, s_{1,2} and s_{1,3} // to be improved (add explanation)  
-    s1p1k = pow(fs1dEBE[0][pe][1]->GetBinContent(b)*fs1dEBE[0][pe][1]->GetBinEntries(b),1.); 
-    s1p2k = pow(fs1dEBE[0][pe][2]->GetBinContent(b)*fs1dEBE[0][pe][2]->GetBinEntries(b),1.); 
-    s1p3k = pow(fs1dEBE[0][pe][3]->GetBinContent(b)*fs1dEBE[0][pe][3]->GetBinEntries(b),1.); 
+    s1p1k = pow(Gets1dEBE(0,pe,1,b)*GetRPQ1dEBEEntries(0,pe,b),1.); 
+    s1p2k = pow(Gets1dEBE(0,pe,2,b)*GetRPQ1dEBEEntries(0,pe,b),1.); 
+    s1p3k = pow(Gets1dEBE(0,pe,3,b)*GetRPQ1dEBEEntries(0,pe,b),1.); 
     
     // to be improved (cross-checked):
-    p1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
-            * fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b));
-    p1n0kIm = fImRPQ1dEBE[0][pe][0][0]->GetBinContent(fImRPQ1dEBE[0][pe][0][0]->GetBin(b))  
-            * fImRPQ1dEBE[0][pe][0][0]->GetBinEntries(fImRPQ1dEBE[0][pe][0][0]->GetBin(b));
+    p1n0kRe = GetReRPQ1dEBE(0,pe,0,0,b)
+            * GetRPQ1dEBEEntries(0,pe,b);
+    p1n0kIm = GetImRPQ1dEBE(0,pe,0,0,b)  
+            * GetRPQ1dEBEEntries(0,pe,b);
             
-    mp = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+    mp = GetRPQ1dEBEEntries(0,pe,b); // to be improved (cross-checked by accessing other profiles here)
      
     t = 0; // typeFlag = RP or POI
     
@@ -21007,30 +20948,10 @@ void AliFlowAnalysisWithQCumulants::ResetEventByEventQuantities()
  // Differential flow:
  if(fCalculateDiffFlow)
  {
-  for(Int_t t=0;t<3;t++) // type (RP, POI, POI&&RP)
-  {
-   for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // 1D in pt or eta
-   {
-    for(Int_t m=0;m<4;m++) // multiple of harmonic
-    {
-     for(Int_t k=0;k<9;k++) // power of weight
-     {
-      if(fReRPQ1dEBE[t][pe][m][k]) fReRPQ1dEBE[t][pe][m][k]->Reset();
-      if(fImRPQ1dEBE[t][pe][m][k]) fImRPQ1dEBE[t][pe][m][k]->Reset();
-     }   
-    } 
-   }
-  } 
-  for(Int_t t=0;t<3;t++) // type (0 = RP, 1 = POI, 2 = RP&&POI )
-  { 
-   for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // 1D in pt or eta
-   {
-    for(Int_t k=0;k<9;k++)
-    {
-     if(fs1dEBE[t][pe][k]) fs1dEBE[t][pe][k]->Reset();
-    }
-   }
-  }
+  fReRPQ1dEBE.Reset();
+  fImRPQ1dEBE.Reset();
+  fs1dEBE.Reset();
+  fRPQ1dEBEEntries.Reset();
   // e-b-e reduced correlations:
   for(Int_t t=0;t<2;t++) // type (0 = RP, 1 = POI)
   {  
@@ -21086,6 +21007,49 @@ void AliFlowAnalysisWithQCumulants::ResetEventByEventQuantities()
 
 //=======================================================================================================================
 
+void AliFlowAnalysisWithQCumulants::FillDiffFlowQvectorsEBE(Int_t t, Int_t pe, Double_t dPtEta, const Double_t *dWeightPowk, const Double_t *dCosmnPhi, const Double_t *dSinmnPhi)
+{
+ // Add one particle to r_{m*n,k} (t = 0), p_{m*n,k} (t = 1) or q_{m*n,k} (t = 2) in its pt (pe = 0) or eta (pe = 1) bin, 
+ // and to s_{p,k} for t = 0 and t = 2. The bin is found as in TAxis::FindBin, and the sums are accumulated in the same
+ // order as in a TProfile filled with one entry per particle, so that GetReRPQ1dEBE() & Co. reproduce its bin contents.
+ 
+ Int_t nBinsPtEta = (pe == 0 ? fnBinsPt : fnBinsEta);
+ Double_t minPtEta = (pe == 0 ? fPtMin : fEtaMin);
+ Double_t maxPtEta = (pe == 0 ? fPtMax : fEtaMax);
+ Int_t b = 0;
+ if(dPtEta < minPtEta)
+ {
+  b = 0;
+ } else if(!(dPtEta < maxPtEta))
+   {
+    b = nBinsPtEta+1;
+   } else
+     {
+      b = 1 + (Int_t)(nBinsPtEta*(dPtEta-minPtEta)/(maxPtEta-minPtEta));
+     } 
+
+ fRPQ1dEBEEntries[(t*2+pe)*fnBins1dEBE+b] += 1.;
+ Double_t *reRPQ = fReRPQ1dEBE.GetArray()+((t*2+pe)*4*9)*fnBins1dEBE+b;
+ Double_t *imRPQ = fImRPQ1dEBE.GetArray()+((t*2+pe)*4*9)*fnBins1dEBE+b;
+ for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+ {
+  for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+  {
+   reRPQ[(m*9+k)*fnBins1dEBE] += dWeightPowk[k]*dCosmnPhi[m];
+   imRPQ[(m*9+k)*fnBins1dEBE] += dWeightPowk[k]*dSinmnPhi[m];
+  }
+ }
+ if(t == 1){return;} // s_{p,k} is not needed for POIs
+ Double_t *s = fs1dEBE.GetArray()+((t*2+pe)*9)*fnBins1dEBE+b;
+ for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+ {
+  s[k*fnBins1dEBE] += dWeightPowk[k];
+ }
+
+} // end of void AliFlowAnalysisWithQCumulants::FillDiffFlowQvectorsEBE(...)
+
+//=======================================================================================================================
+
 void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTerms(TString type, TString ptOrEta)
 {
  // Calculate correction terms for non-uniform acceptance for differential flow (sin terms).
@@ -21158,40 +21122,40 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTerms(T
   if(type == "POI")
   {
    // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[2][pe][0][0]->GetBinContent(fReRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[2][pe][0][0]->GetBinContent(fImRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][0][0]->GetBinEntries(fImRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[2][pe][1][0]->GetBinContent(fReRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][1][0]->GetBinEntries(fReRPQ1dEBE[2][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[2][pe][1][0]->GetBinContent(fImRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][1][0]->GetBinEntries(fImRPQ1dEBE[2][pe][1][0]->GetBin(b));         
+   q1n0kRe = GetReRPQ1dEBE(2,pe,0,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q1n0kIm = GetImRPQ1dEBE(2,pe,0,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q2n0kRe = GetReRPQ1dEBE(2,pe,1,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q2n0kIm = GetImRPQ1dEBE(2,pe,1,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);         
                  
-   mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   mq = GetRPQ1dEBEEntries(2,pe,b); // to be improved (cross-checked by accessing other profiles here)
   } 
   else if(type == "RP")
   {
    // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[0][pe][0][0]->GetBinContent(fImRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][0][0]->GetBinEntries(fImRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[0][pe][1][0]->GetBinContent(fReRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][1][0]->GetBinEntries(fReRPQ1dEBE[0][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[0][pe][1][0]->GetBinContent(fImRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][1][0]->GetBinEntries(fImRPQ1dEBE[0][pe][1][0]->GetBin(b));         
+   q1n0kRe = GetReRPQ1dEBE(0,pe,0,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);
+   q1n0kIm = GetImRPQ1dEBE(0,pe,0,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);
+   q2n0kRe = GetReRPQ1dEBE(0,pe,1,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);
+   q2n0kIm = GetImRPQ1dEBE(0,pe,1,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);         
                  
-   mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)  
+   mq = GetRPQ1dEBEEntries(0,pe,b); // to be improved (cross-checked by accessing other profiles here)  
   }    
   if(type == "POI")
   {
    // p_{m*n,0}:
-   p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b));
-   p1n0kIm = fImRPQ1dEBE[1][pe][0][0]->GetBinContent(fImRPQ1dEBE[1][pe][0][0]->GetBin(b))  
-           * fImRPQ1dEBE[1][pe][0][0]->GetBinEntries(fImRPQ1dEBE[1][pe][0][0]->GetBin(b));
+   p1n0kRe = GetReRPQ1dEBE(1,pe,0,0,b)
+           * GetRPQ1dEBEEntries(1,pe,b);
+   p1n0kIm = GetImRPQ1dEBE(1,pe,0,0,b)  
+           * GetRPQ1dEBEEntries(1,pe,b);
             
-   mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   mp = GetRPQ1dEBEEntries(1,pe,b); // to be improved (cross-checked by accessing other profiles here)
     
    t = 1; // typeFlag = RP or POI
   }
@@ -21335,40 +21299,40 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTerms(T
   if(type == "POI")
   {
    // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[2][pe][0][0]->GetBinContent(fReRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[2][pe][0][0]->GetBinContent(fImRPQ1dEBE[2][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][0][0]->GetBinEntries(fImRPQ1dEBE[2][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[2][pe][1][0]->GetBinContent(fReRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][1][0]->GetBinEntries(fReRPQ1dEBE[2][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[2][pe][1][0]->GetBinContent(fImRPQ1dEBE[2][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][1][0]->GetBinEntries(fImRPQ1dEBE[2][pe][1][0]->GetBin(b));         
+   q1n0kRe = GetReRPQ1dEBE(2,pe,0,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q1n0kIm = GetImRPQ1dEBE(2,pe,0,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q2n0kRe = GetReRPQ1dEBE(2,pe,1,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q2n0kIm = GetImRPQ1dEBE(2,pe,1,0,b)
+           * GetRPQ1dEBEEntries(2,pe,b);         
                  
-   mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   mq = GetRPQ1dEBEEntries(2,pe,b); // to be improved (cross-checked by accessing other profiles here)
   } 
   else if(type == "RP")
   {
    // q_{m*n,0}:
-   q1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q1n0kIm = fImRPQ1dEBE[0][pe][0][0]->GetBinContent(fImRPQ1dEBE[0][pe][0][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][0][0]->GetBinEntries(fImRPQ1dEBE[0][pe][0][0]->GetBin(b));
-   q2n0kRe = fReRPQ1dEBE[0][pe][1][0]->GetBinContent(fReRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fReRPQ1dEBE[0][pe][1][0]->GetBinEntries(fReRPQ1dEBE[0][pe][1][0]->GetBin(b));
-   q2n0kIm = fImRPQ1dEBE[0][pe][1][0]->GetBinContent(fImRPQ1dEBE[0][pe][1][0]->GetBin(b))
-           * fImRPQ1dEBE[0][pe][1][0]->GetBinEntries(fImRPQ1dEBE[0][pe][1][0]->GetBin(b));         
+   q1n0kRe = GetReRPQ1dEBE(0,pe,0,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);
+   q1n0kIm = GetImRPQ1dEBE(0,pe,0,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);
+   q2n0kRe = GetReRPQ1dEBE(0,pe,1,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);
+   q2n0kIm = GetImRPQ1dEBE(0,pe,1,0,b)
+           * GetRPQ1dEBEEntries(0,pe,b);         
                  
-   mq = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)  
+   mq = GetRPQ1dEBEEntries(0,pe,b); // to be improved (cross-checked by accessing other profiles here)  
   }    
   if(type == "POI")
   {
    // p_{m*n,0}:
-   p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b));
-   p1n0kIm = fImRPQ1dEBE[1][pe][0][0]->GetBinContent(fImRPQ1dEBE[1][pe][0][0]->GetBin(b))  
-           * fImRPQ1dEBE[1][pe][0][0]->GetBinEntries(fImRPQ1dEBE[1][pe][0][0]->GetBin(b));
+   p1n0kRe = GetReRPQ1dEBE(1,pe,0,0,b)
+           * GetRPQ1dEBEEntries(1,pe,b);
+   p1n0kIm = GetImRPQ1dEBE(1,pe,0,0,b)  
+           * GetRPQ1dEBEEntries(1,pe,b);
             
-   mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   mp = GetRPQ1dEBEEntries(1,pe,b); // to be improved (cross-checked by accessing other profiles here)
     
    t = 1; // typeFlag = RP or POI
   }
@@ -24095,45 +24059,45 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTermsUs
   if(type == "POI")
   {           
    // q_{m*n,k}:
-   q1n2kRe = fReRPQ1dEBE[2][pe][0][2]->GetBinContent(fReRPQ1dEBE[2][pe][0][2]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][0][2]->GetBinEntries(fReRPQ1dEBE[2][pe][0][2]->GetBin(b));
-   //q1n2kIm = fImRPQ1dEBE[2][pe][0][2]->GetBinContent(fImRPQ1dEBE[2][pe][0][2]->GetBin(b))
-   //        * fImRPQ1dEBE[2][pe][0][2]->GetBinEntries(fImRPQ1dEBE[2][pe][0][2]->GetBin(b));         
-   q2n1kRe = fReRPQ1dEBE[2][pe][1][1]->GetBinContent(fReRPQ1dEBE[2][pe][1][1]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][1][1]->GetBinEntries(fReRPQ1dEBE[2][pe][1][1]->GetBin(b));
-   q2n1kIm = fImRPQ1dEBE[2][pe][1][1]->GetBinContent(fImRPQ1dEBE[2][pe][1][1]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][1][1]->GetBinEntries(fImRPQ1dEBE[2][pe][1][1]->GetBin(b));         
-   //mq = fReRPQ1dEBE[2][pe][1][1]->GetBinEntries(fReRPQ1dEBE[2][pe][1][1]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   q1n2kRe = GetReRPQ1dEBE(2,pe,0,2,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   //q1n2kIm = GetImRPQ1dEBE(2,pe,0,2,b)
+   //        * GetRPQ1dEBEEntries(2,pe,b);         
+   q2n1kRe = GetReRPQ1dEBE(2,pe,1,1,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q2n1kIm = GetImRPQ1dEBE(2,pe,1,1,b)
+           * GetRPQ1dEBEEntries(2,pe,b);         
+   //mq = GetRPQ1dEBEEntries(2,pe,b); // to be improved (cross-checked by accessing other profiles here)
    
-   s1p1k = pow(fs1dEBE[2][pe][1]->GetBinContent(b)*fs1dEBE[2][pe][1]->GetBinEntries(b),1.); 
-   s1p2k = pow(fs1dEBE[2][pe][2]->GetBinContent(b)*fs1dEBE[2][pe][2]->GetBinEntries(b),1.); 
+   s1p1k = pow(Gets1dEBE(2,pe,1,b)*GetRPQ1dEBEEntries(2,pe,b),1.); 
+   s1p2k = pow(Gets1dEBE(2,pe,2,b)*GetRPQ1dEBEEntries(2,pe,b),1.); 
   }else if(type == "RP")
    {
     // q_{m*n,k}: (Remark: m=1 is 0, k=0 iz zero (to be improved!)) 
-    q1n2kRe = fReRPQ1dEBE[0][pe][0][2]->GetBinContent(fReRPQ1dEBE[0][pe][0][2]->GetBin(b))
-            * fReRPQ1dEBE[0][pe][0][2]->GetBinEntries(fReRPQ1dEBE[0][pe][0][2]->GetBin(b));
-    //q1n2kIm = fImRPQ1dEBE[0][pe][0][2]->GetBinContent(fImRPQ1dEBE[0][pe][0][2]->GetBin(b))
-    //        * fImRPQ1dEBE[0][pe][0][2]->GetBinEntries(fImRPQ1dEBE[0][pe][0][2]->GetBin(b));
-    q2n1kRe = fReRPQ1dEBE[0][pe][1][1]->GetBinContent(fReRPQ1dEBE[0][pe][1][1]->GetBin(b))
-            * fReRPQ1dEBE[0][pe][1][1]->GetBinEntries(fReRPQ1dEBE[0][pe][1][1]->GetBin(b));
-    q2n1kIm = fImRPQ1dEBE[0][pe][1][1]->GetBinContent(fImRPQ1dEBE[0][pe][1][1]->GetBin(b))
-            * fImRPQ1dEBE[0][pe][1][1]->GetBinEntries(fImRPQ1dEBE[0][pe][1][1]->GetBin(b));
+    q1n2kRe = GetReRPQ1dEBE(0,pe,0,2,b)
+            * GetRPQ1dEBEEntries(0,pe,b);
+    //q1n2kIm = GetImRPQ1dEBE(0,pe,0,2,b)
+    //        * GetRPQ1dEBEEntries(0,pe,b);
+    q2n1kRe = GetReRPQ1dEBE(0,pe,1,1,b)
+            * GetRPQ1dEBEEntries(0,pe,b);
+    q2n1kIm = GetImRPQ1dEBE(0,pe,1,1,b)
+            * GetRPQ1dEBEEntries(0,pe,b);
     // s_{1,1}, s_{1,2} and s_{1,3} // to be improved (add explanation)  
-    s1p1k = pow(fs1dEBE[0][pe][1]->GetBinContent(b)*fs1dEBE[0][pe][1]->GetBinEntries(b),1.); 
-    s1p2k = pow(fs1dEBE[0][pe][2]->GetBinContent(b)*fs1dEBE[0][pe][2]->GetBinEntries(b),1.); 
-    //s1p3k = pow(fs1dEBE[0][pe][3]->GetBinContent(b)*fs1dEBE[0][pe][3]->GetBinEntries(b),1.);  
+    s1p1k = pow(Gets1dEBE(0,pe,1,b)*GetRPQ1dEBEEntries(0,pe,b),1.); 
+    s1p2k = pow(Gets1dEBE(0,pe,2,b)*GetRPQ1dEBEEntries(0,pe,b),1.); 
+    //s1p3k = pow(Gets1dEBE(0,pe,3,b)*GetRPQ1dEBEEntries(0,pe,b),1.);  
     
-    //mq = fReRPQ1dEBE[0][pe][1][1]->GetBinEntries(fReRPQ1dEBE[0][pe][1][1]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here) 
+    //mq = GetRPQ1dEBEEntries(0,pe,b); // to be improved (cross-checked by accessing other profiles here) 
   }    
   
   if(type == "POI")
   {
    // p_{m*n,k}:   
-   p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b));
-   p1n0kIm = fImRPQ1dEBE[1][pe][0][0]->GetBinContent(fImRPQ1dEBE[1][pe][0][0]->GetBin(b))  
-           * fImRPQ1dEBE[1][pe][0][0]->GetBinEntries(fImRPQ1dEBE[1][pe][0][0]->GetBin(b));
-   mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here) 
+   p1n0kRe = GetReRPQ1dEBE(1,pe,0,0,b)
+           * GetRPQ1dEBEEntries(1,pe,b);
+   p1n0kIm = GetImRPQ1dEBE(1,pe,0,0,b)  
+           * GetRPQ1dEBEEntries(1,pe,b);
+   mp = GetRPQ1dEBEEntries(1,pe,b); // to be improved (cross-checked by accessing other profiles here) 
    // M01 from Eq. (118) in QC2c (to be improved (notation)):
    dM01 = mp*dSM1p1k-s1p1k;
    dM011 = mp*(dSM2p1k-dSM1p2k)
@@ -24144,11 +24108,11 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUACosTermsUs
   } else if(type == "RP")
     {  
      // to be improved (cross-checked):
-     p1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
-             * fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b));
-     p1n0kIm = fImRPQ1dEBE[0][pe][0][0]->GetBinContent(fImRPQ1dEBE[0][pe][0][0]->GetBin(b))  
-             * fImRPQ1dEBE[0][pe][0][0]->GetBinEntries(fImRPQ1dEBE[0][pe][0][0]->GetBin(b));
-     mp = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+     p1n0kRe = GetReRPQ1dEBE(0,pe,0,0,b)
+             * GetRPQ1dEBEEntries(0,pe,b);
+     p1n0kIm = GetImRPQ1dEBE(0,pe,0,0,b)  
+             * GetRPQ1dEBEEntries(0,pe,b);
+     mp = GetRPQ1dEBEEntries(0,pe,b); // to be improved (cross-checked by accessing other profiles here)
      // M01 from Eq. (118) in QC2c (to be improved (notation)):
      dM01 = mp*dSM1p1k-s1p1k;
      dM011 = mp*(dSM2p1k-dSM1p2k)
@@ -24301,43 +24265,43 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTermsUs
   if(type == "POI")
   {    
    // q_{m*n,k}:
-   //q1n2kRe = fReRPQ1dEBE[2][pe][0][2]->GetBinContent(fReRPQ1dEBE[2][pe][0][2]->GetBin(b))
-   //        * fReRPQ1dEBE[2][pe][0][2]->GetBinEntries(fReRPQ1dEBE[2][pe][0][2]->GetBin(b));
-   q1n2kIm = fImRPQ1dEBE[2][pe][0][2]->GetBinContent(fImRPQ1dEBE[2][pe][0][2]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][0][2]->GetBinEntries(fImRPQ1dEBE[2][pe][0][2]->GetBin(b));         
-   q2n1kRe = fReRPQ1dEBE[2][pe][1][1]->GetBinContent(fReRPQ1dEBE[2][pe][1][1]->GetBin(b))
-           * fReRPQ1dEBE[2][pe][1][1]->GetBinEntries(fReRPQ1dEBE[2][pe][1][1]->GetBin(b));
-   q2n1kIm = fImRPQ1dEBE[2][pe][1][1]->GetBinContent(fImRPQ1dEBE[2][pe][1][1]->GetBin(b))
-           * fImRPQ1dEBE[2][pe][1][1]->GetBinEntries(fImRPQ1dEBE[2][pe][1][1]->GetBin(b));         
-   //mq = fReRPQ1dEBE[2][pe][0][0]->GetBinEntries(fReRPQ1dEBE[2][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)
+   //q1n2kRe = GetReRPQ1dEBE(2,pe,0,2,b)
+   //        * GetRPQ1dEBEEntries(2,pe,b);
+   q1n2kIm = GetImRPQ1dEBE(2,pe,0,2,b)
+           * GetRPQ1dEBEEntries(2,pe,b);         
+   q2n1kRe = GetReRPQ1dEBE(2,pe,1,1,b)
+           * GetRPQ1dEBEEntries(2,pe,b);
+   q2n1kIm = GetImRPQ1dEBE(2,pe,1,1,b)
+           * GetRPQ1dEBEEntries(2,pe,b);         
+   //mq = GetRPQ1dEBEEntries(2,pe,b); // to be improved (cross-checked by accessing other profiles here)
    
-   s1p1k = pow(fs1dEBE[2][pe][1]->GetBinContent(b)*fs1dEBE[2][pe][1]->GetBinEntries(b),1.); 
-   s1p2k = pow(fs1dEBE[2][pe][2]->GetBinContent(b)*fs1dEBE[2][pe][2]->GetBinEntries(b),1.); 
+   s1p1k = pow(Gets1dEBE(2,pe,1,b)*GetRPQ1dEBEEntries(2,pe,b),1.); 
+   s1p2k = pow(Gets1dEBE(2,pe,2,b)*GetRPQ1dEBEEntries(2,pe,b),1.); 
   }else if(type == "RP")
    {
     // q_{m*n,k}: (Remark: m=1 is 0, k=0 iz zero (to be improved!)) 
-    //q1n2kRe = fReRPQ1dEBE[0][pe][0][2]->GetBinContent(fReRPQ1dEBE[0][pe][0][2]->GetBin(b))
-    //        * fReRPQ1dEBE[0][pe][0][2]->GetBinEntries(fReRPQ1dEBE[0][pe][0][2]->GetBin(b));
-    q1n2kIm = fImRPQ1dEBE[0][pe][0][2]->GetBinContent(fImRPQ1dEBE[0][pe][0][2]->GetBin(b))
-            * fImRPQ1dEBE[0][pe][0][2]->GetBinEntries(fImRPQ1dEBE[0][pe][0][2]->GetBin(b));
-    q2n1kRe = fReRPQ1dEBE[0][pe][1][1]->GetBinContent(fReRPQ1dEBE[0][pe][1][1]->GetBin(b))
-            * fReRPQ1dEBE[0][pe][1][1]->GetBinEntries(fReRPQ1dEBE[0][pe][1][1]->GetBin(b));
-    q2n1kIm = fImRPQ1dEBE[0][pe][1][1]->GetBinContent(fImRPQ1dEBE[0][pe][1][1]->GetBin(b))
-            * fImRPQ1dEBE[0][pe][1][1]->GetBinEntries(fImRPQ1dEBE[0][pe][1][1]->GetBin(b));
+    //q1n2kRe = GetReRPQ1dEBE(0,pe,0,2,b)
+    //        * GetRPQ1dEBEEntries(0,pe,b);
+    q1n2kIm = GetImRPQ1dEBE(0,pe,0,2,b)
+            * GetRPQ1dEBEEntries(0,pe,b);
+    q2n1kRe = GetReRPQ1dEBE(0,pe,1,1,b)
+            * GetRPQ1dEBEEntries(0,pe,b);
+    q2n1kIm = GetImRPQ1dEBE(0,pe,1,1,b)
+            * GetRPQ1dEBEEntries(0,pe,b);
     // s_{1,1}, s_{1,2} and s_{1,3} // to be improved (add explanation)  
-    s1p1k = pow(fs1dEBE[0][pe][1]->GetBinContent(b)*fs1dEBE[0][pe][1]->GetBinEntries(b),1.); 
-    s1p2k = pow(fs1dEBE[0][pe][2]->GetBinContent(b)*fs1dEBE[0][pe][2]->GetBinEntries(b),1.); 
-    //s1p3k = pow(fs1dEBE[0][pe][3]->GetBinContent(b)*fs1dEBE[0][pe][3]->GetBinEntries(b),1.); 
+    s1p1k = pow(Gets1dEBE(0,pe,1,b)*GetRPQ1dEBEEntries(0,pe,b),1.); 
+    s1p2k = pow(Gets1dEBE(0,pe,2,b)*GetRPQ1dEBEEntries(0,pe,b),1.); 
+    //s1p3k = pow(Gets1dEBE(0,pe,3,b)*GetRPQ1dEBEEntries(0,pe,b),1.); 
   }    
   
   if(type == "POI")
   {
    // p_{m*n,k}:   
-   p1n0kRe = fReRPQ1dEBE[1][pe][0][0]->GetBinContent(fReRPQ1dEBE[1][pe][0][0]->GetBin(b))
-           * fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b));
-   p1n0kIm = fImRPQ1dEBE[1][pe][0][0]->GetBinContent(fImRPQ1dEBE[1][pe][0][0]->GetBin(b))  
-           * fImRPQ1dEBE[1][pe][0][0]->GetBinEntries(fImRPQ1dEBE[1][pe][0][0]->GetBin(b));
-   mp = fReRPQ1dEBE[1][pe][0][0]->GetBinEntries(fReRPQ1dEBE[1][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here) 
+   p1n0kRe = GetReRPQ1dEBE(1,pe,0,0,b)
+           * GetRPQ1dEBEEntries(1,pe,b);
+   p1n0kIm = GetImRPQ1dEBE(1,pe,0,0,b)  
+           * GetRPQ1dEBEEntries(1,pe,b);
+   mp = GetRPQ1dEBEEntries(1,pe,b); // to be improved (cross-checked by accessing other profiles here) 
    // M01 from Eq. (118) in QC2c (to be improved (notation)):
    dM01 = mp*dSM1p1k-s1p1k;
    dM011 = mp*(dSM2p1k-dSM1p2k)
@@ -24347,11 +24311,11 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowCorrectionsForNUASinTermsUs
   } else if(type == "RP")
     { 
      // to be improved (cross-checked):
-     p1n0kRe = fReRPQ1dEBE[0][pe][0][0]->GetBinContent(fReRPQ1dEBE[0][pe][0][0]->GetBin(b))
-             * fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b));
-     p1n0kIm = fImRPQ1dEBE[0][pe][0][0]->GetBinContent(fImRPQ1dEBE[0][pe][0][0]->GetBin(b))  
-             * fImRPQ1dEBE[0][pe][0][0]->GetBinEntries(fImRPQ1dEBE[0][pe][0][0]->GetBin(b));
-     mp = fReRPQ1dEBE[0][pe][0][0]->GetBinEntries(fReRPQ1dEBE[0][pe][0][0]->GetBin(b)); // to be improved (cross-checked by accessing other profiles here)    
+     p1n0kRe = GetReRPQ1dEBE(0,pe,0,0,b)
+             * GetRPQ1dEBEEntries(0,pe,b);
+     p1n0kIm = GetImRPQ1dEBE(0,pe,0,0,b)  
+             * GetRPQ1dEBEEntries(0,pe,b);
+     mp = GetRPQ1dEBEEntries(0,pe,b); // to be improved (cross-checked by accessing other profiles here)    
      // M01 from Eq. (118) in QC2c (to be improved (notation)):
      dM01 = mp*dSM1p1k-s1p1k;
      dM011 = mp*(dSM2p1k-dSM1p2k)
@@ -15,6 +15,7 @@
 #define ALIFLOWANALYSISWITHQCUMULANTS_H
 
 #include "TMatrixD.h"
+#include "TArrayD.h"
 #include "TH2D.h"
 #include "TRandom3.h"
 #include "AliFlowCommonConstants.h"
@@ -82,6 +83,12 @@ class AliFlowAnalysisWithQCumulants{
     virtual void FillCommonControlHistograms(AliFlowEventSimple *anEvent);
     virtual void FillControlHistograms(AliFlowEventSimple *anEvent);
     virtual void ResetEventByEventQuantities();
+    virtual void FillDiffFlowQvectorsEBE(Int_t t, Int_t pe, Double_t dPtEta, const Double_t *dWeightPowk, const Double_t *dCosmnPhi, const Double_t *dSinmnPhi);
+    // e-b-e differential Q-vectors, bin content and entries as for a TProfile filled with one entry per particle:
+    Double_t GetRPQ1dEBEEntries(Int_t t, Int_t pe, Int_t b) const {return fRPQ1dEBEEntries[(t*2+pe)*fnBins1dEBE+b];}
+    Double_t GetReRPQ1dEBE(Int_t t, Int_t pe, Int_t m, Int_t k, Int_t b) const {Double_t n = GetRPQ1dEBEEntries(t,pe,b); return n ? fReRPQ1dEBE[(((t*2+pe)*4+m)*9+k)*fnBins1dEBE+b]/n : 0.;}
+    Double_t GetImRPQ1dEBE(Int_t t, Int_t pe, Int_t m, Int_t k, Int_t b) const {Double_t n = GetRPQ1dEBEEntries(t,pe,b); return n ? fImRPQ1dEBE[(((t*2+pe)*4+m)*9+k)*fnBins1dEBE+b]/n : 0.;}
+    Double_t Gets1dEBE(Int_t t, Int_t pe, Int_t k, Int_t b) const {Double_t n = GetRPQ1dEBEEntries(t,pe,b); return n ? fs1dEBE[((t*2+pe)*9+k)*fnBins1dEBE+b]/n : 0.;}
     // 2b.) Reference flow:
     virtual void CalculateIntFlowCorrelations(); 
     virtual void CalculateIntFlowCorrelationsUsingParticleWeights();
@@ -710,9 +717,11 @@ class AliFlowAnalysisWithQCumulants{
   Bool_t fCalculateDiffFlowVsEta; // if you set kFALSE only differential flow vs pt is calculated
   //  4c.) event-by-event quantities:
   //   1D:
-  TProfile *fReRPQ1dEBE[3][2][4][9]; //! real part [0=r,1=p,2=q][0=pt,1=eta][m][k]
-  TProfile *fImRPQ1dEBE[3][2][4][9]; //! imaginary part [0=r,1=p,2=q][0=pt,1=eta][m][k]
-  TProfile *fs1dEBE[3][2][9]; //! [0=r,1=p,2=q][0=pt,1=eta][k] // to be improved
+  Int_t fnBins1dEBE; //! number of pt or eta bins in the flat e-b-e arrays below, including underflow and overflow
+  TArrayD fReRPQ1dEBE; //! real part [0=r,1=p,2=q][0=pt,1=eta][m][k][bin], summed over particles
+  TArrayD fImRPQ1dEBE; //! imaginary part [0=r,1=p,2=q][0=pt,1=eta][m][k][bin], summed over particles
+  TArrayD fs1dEBE; //! [0=r,1=p,2=q][0=pt,1=eta][k][bin], summed over particles (filled only for r and q)
+  TArrayD fRPQ1dEBEEntries; //! number of particles [0=r,1=p,2=q][0=pt,1=eta][bin]
   TH1D *fDiffFlowCorrelationsEBE[2][2][4]; //! [0=RP,1=POI][0=pt,1=eta][reduced correlation index]
   TH1D *fDiffFlowEventWeightsForCorrelationsEBE[2][2][4]; //! [0=RP,1=POI][0=pt,1=eta][event weights for reduced correlation index]
   TH1D *fDiffFlowCorrectionTermsForNUAEBE[2][2][2][10]; //! [0=RP,1=POI][0=pt,1=eta][0=sin terms,1=cos terms][correction term index]
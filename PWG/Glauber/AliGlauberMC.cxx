@@ -32,6 +32,12 @@
 #include <TFile.h>
 #include <TTree.h>
 #include <TF1.h>
+#include <TRandom3.h>
+#include <RVersion.h>
+#if !defined(__CINT__) && !defined(__MAKECINT__) && (__cplusplus >= 201103L) && (ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0))
+#include <thread>
+#define ALIGLAUBERMC_THREADS
+#endif
 
 #include "AliGlauberNucleon.h"
 #include "AliGlauberNucleus.h"
@@ -40,6 +46,22 @@
 using std::flush;
 ClassImp(AliGlauberMC)
 
+namespace {
+  const Int_t kGlauberBlock = 1000; // events per random stream of RunParallel
+
+  UInt_t GlauberBlockSeed(UInt_t seed, Int_t block)
+  {
+    // seed of a block of RunParallel: splitmix64 of (seed, block), never 0
+    // (TRandom3 would take it from the clock)
+    ULong64_t z = (((ULong64_t)seed)<<32) + (ULong64_t)block + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z = z ^ (z >> 31);
+    UInt_t s = (UInt_t)(z ^ (z >> 32));
+    return s ? s : 1;
+  }
+}
+
 //______________________________________________________________________________
 AliGlauberMC::AliGlauberMC(Option_t* NA, Option_t* NB, Double_t xsect) :
   TNamed(),
@@ -172,7 +194,18 @@ AliGlauberMC::AliGlauberMC(Option_t* NA, Option_t* NB, Double_t xsect) :
   fOmega(0),
   fSig0(0),
   fLambda(0),
-  fSigFluc(0)
+  fSigFluc(0),
+  fRandom(0),
+  fXA(),
+  fYA(),
+  fZA(),
+  fXB(),
+  fYB(),
+  fZB(),
+  fNCollA(),
+  fNCollB(),
+  fCellFirst(),
+  fCellNucl()
 {
   //ctor
   for (UInt_t i=0; i<(sizeof(fdNdEtaParam)/sizeof(fdNdEtaParam[0])); i++)
@@ -322,7 +355,18 @@ AliGlauberMC::AliGlauberMC(const AliGlauberMC& in):
   fOmega(in.fOmega),
   fSig0(in.fSig0),
   fLambda(in.fLambda),
-  fSigFluc(in.fSigFluc)
+  fSigFluc(in.fSigFluc),
+  fRandom(0),
+  fXA(),
+  fYA(),
+  fZA(),
+  fXB(),
+  fYB(),
+  fZB(),
+  fNCollA(),
+  fNCollB(),
+  fCellFirst(),
+  fCellNucl()
 {
   //copy ctor
   memcpy(fdNdEtaParam,in.fdNdEtaParam,sizeof(fdNdEtaParam));
@@ -551,6 +595,27 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
     fBNN = bNN/Nco;
   else
     fBNN = 0.;
+
+  fXA.resize(fAN);
+  fYA.resize(fAN);
+  fNCollA.resize(fAN);
+  for (Int_t i = 0; i<fAN; i++)
+  {
+    AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(i));
+    fXA[i] = nucleonA->GetX();
+    fYA[i] = nucleonA->GetY();
+    fNCollA[i] = nucleonA->GetNColl();
+  }
+  fXB.resize(fBN);
+  fYB.resize(fBN);
+  fNCollB.resize(fBN);
+  for (Int_t i = 0; i<fBN; i++)
+  {
+    AliGlauberNucleon *nucleonB=(AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i));
+    fXB[i] = nucleonB->GetX();
+    fYB[i] = nucleonB->GetY();
+    fNCollB[i] = nucleonB->GetNColl();
+  }
   return CalcResults(bgen);
 }
 
@@ -571,6 +636,9 @@ Bool_t AliGlauberMC::CalcResults(Double_t bgen)
   fMeanXY=0.;
   fMeanXParts=0.;
   fMeanYParts=0.;
+  fMeanX2Parts=0.;
+  fMeanY2Parts=0.;
+  fMeanXYParts=0.;
   fMeanOXParts=0.;
   fMeanOYParts=0.;
   fMeanXColl=0.;
@@ -654,15 +722,14 @@ Bool_t AliGlauberMC::CalcResults(Double_t bgen)
 
   for (Int_t i = 0; i<fAN; i++)
   {
-    AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(i));
-    Double_t oXA = nucleonA->GetX();
-    Double_t oYA = nucleonA->GetY();
+    Double_t oXA = fXA[i];
+    Double_t oYA = fYA[i];
     //fMeanOXSystem  += oXA;
     //fMeanOYSystem  += oYA;
     fMeanOXA  += oXA;
     fMeanOYA  += oYA;
 
-    if(nucleonA->IsWounded())
+    if(fNCollA[i])
     {
       fONpart++;
       fMeanOXParts  += oXA;
@@ -676,13 +743,12 @@ Bool_t AliGlauberMC::CalcResults(Double_t bgen)
 
   for (Int_t i = 0; i<fBN; i++)
   {
-    AliGlauberNucleon *nucleonB=(AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i));
-    Double_t oXB=nucleonB->GetX();
-    Double_t oYB=nucleonB->GetY();
+    Double_t oXB=fXB[i];
+    Double_t oYB=fYB[i];
     
-    if(nucleonB->IsWounded())
+    if(fNCollB[i])
     {
-      Int_t oNcoll = nucleonB->GetNColl();
+      Int_t oNcoll = fNCollB[i];
       fONpart++;
       fMeanOXParts  += oXB;
       fMeanOXColl  += oXB*oNcoll;
@@ -731,9 +797,8 @@ Bool_t AliGlauberMC::CalcResults(Double_t bgen)
   //////////////////////////////////////////////////////////////////
   for (Int_t i = 0; i<fAN; i++)
   {
-    AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(i));
-    Double_t xAA = nucleonA->GetX(); // X
-    Double_t yAA = nucleonA->GetY(); // Y
+    Double_t xAA = fXA[i]; // X
+    Double_t yAA = fYA[i]; // Y
     Double_t xAPart = xAA - fMeanOXParts; // X'
     Double_t yAPart = yAA - fMeanOYParts; // Y'
     Double_t r2APart = xAPart *xAPart+yAPart*yAPart;     // r'^2
@@ -777,7 +842,7 @@ Bool_t AliGlauberMC::CalcResults(Double_t bgen)
     fMeanY2 += yAA * yAA;
     fMeanXY += xAA * yAA;
     
-    if(nucleonA->IsWounded())
+    if(fNCollA[i])
      {
        //Wounded
       fNpart++;
@@ -836,9 +901,8 @@ Bool_t AliGlauberMC::CalcResults(Double_t bgen)
   
   for (Int_t i = 0; i<fBN; i++)
     {
-      AliGlauberNucleon *nucleonB=(AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i));
-      Double_t xBB = nucleonB->GetX();
-      Double_t yBB = nucleonB->GetY();
+      Double_t xBB = fXB[i];
+      Double_t yBB = fYB[i];
       // for Wounded
       Double_t xBPart = xBB - fMeanOXParts; // X'
       Double_t yBPart = yBB - fMeanOYParts; // Y'
@@ -899,9 +963,9 @@ Bool_t AliGlauberMC::CalcResults(Double_t bgen)
       fMeanY2 += yBB*yBB;
       fMeanXY += xBB*yBB;
       
-      if(nucleonB->IsWounded())
+      if(fNCollB[i])
 	{
-	  Int_t ncoll = nucleonB->GetNColl();
+	  Int_t ncoll = fNCollB[i];
 	  fNpart++;
 	  fMeanXParts  += xBPart;
 	  fMeanXColl  += xBColl*ncoll;
@@ -1267,7 +1331,7 @@ Int_t AliGlauberMC::NegativeBinomialRandom(Int_t k, Double_t nmean) const
   {
     array[i] = NegativeBinomialDistribution(i,k,nmean) + array[i-1];
   }
-  Double_t r = gRandom->Uniform(0,1);
+  Double_t r = GetRandom()->Uniform(0,1);
   return TMath::BinarySearch(fMaxPlot,array,r)+2;
 
 }
@@ -1278,7 +1342,7 @@ Int_t AliGlauberMC::NegativeBinomialRandomSV(Double_t k, Double_t nbar) const
   // negative binomial distribution generator, S. Voloshin, 09-May-2007
   Double_t sum=0.;
   Int_t i=0;
-  Double_t ran=gRandom->Rndm();
+  Double_t ran=GetRandom()->Rndm();
   Double_t trm=1./pow(1.+nbar/k,k);
   if (trm==0.)
   {
@@ -1308,7 +1372,7 @@ Int_t AliGlauberMC::DoubleNegativeBinomialRandom( Int_t k,
   {
     array[i] = alpha*NegativeBinomialDistribution(i,k,nmean)+(1-alpha)*NegativeBinomialDistribution(i,k2,nmean2) + array[i-1];
   }
-  Double_t r = gRandom->Uniform(0,1);
+  Double_t r = GetRandom()->Uniform(0,1);
   return TMath::BinarySearch(fMaxPlot,array,r)+2;
 }
 
@@ -1506,7 +1570,7 @@ Bool_t AliGlauberMC::NextEvent(Double_t bgen)
   {
     if(bgen<0||!succes) //get impactparameter
     {
-      bgen = TMath::Sqrt((fBMax*fBMax-fBMin*fBMin)*gRandom->Rndm()+fBMin*fBMin);
+      bgen = TMath::Sqrt((fBMax*fBMax-fBMin*fBMin)*GetRandom()->Rndm()+fBMin*fBMin);
     }
     if ( (succes=CalcEvent(bgen)) ) break; //ends if we have particparts
   }
@@ -1686,14 +1750,7 @@ void AliGlauberMC::Run(Int_t nevents)
 {
   //example run
   cout << "Generating " << nevents << " events..." << endl;
-  TString name(Form("nt_%s_%s",fANucleus.GetName(),fBNucleus.GetName()));
-  TString title(Form("%s + %s (x-sect = %d mb)",fANucleus.GetName(),fBNucleus.GetName(),(Int_t) fXSect));
-  if (fnt == 0)
-  {
-    fnt = new TNtuple(name,title,
-                      "Npart:Ncoll:B:MeanX:MeanY:MeanX2:MeanY2:MeanXY:VarX:VarY:VarXY:MeanXSystem:MeanYSystem:MeanXA:MeanYA:MeanXB:MeanYB:VarE:Stoa:VarEColl:VarECom:VarEPart:VarEPartColl:VarEPartCom:dNdEta:dNdEtaGBW:dNdEtaTwoNBD:xsect:tAA:Epsl2:Epsl3:Epsl4:Epsl5:E2Coll:E3Coll:E4Coll:E5Coll:E2Com:E3Com:E4Com:E5Com:Psi2:Psi3:Psi4:Psi5:BNN:signn:Ncollw");
-    fnt->SetDirectory(0);
-  }
+  MakeNtuple();
   Int_t q = 0;
   Int_t u = 0;
   for (Int_t i = 0; i<nevents; i++)
@@ -1707,72 +1764,310 @@ void AliGlauberMC::Run(Int_t nevents)
 
     q++;
     Float_t v[48];
-    v[0]  = GetNpart();
-    v[1]  = GetNcoll();
-    v[2]  = fBMC;
-    v[3]  = fMeanXParts;
-    v[4]  = fMeanYParts;
-    v[5]  = fMeanX2Parts;
-    v[6]  = fMeanY2Parts;
-    v[7]  = fMeanXYParts;
-    v[8]  = fSx2Parts;
-    v[9]  = fSy2Parts;
-    v[10] = fSxyParts;
-    v[11] = fMeanXSystem;
-    v[12] = fMeanYSystem;
-    v[13] = fMeanXA;
-    v[14] = fMeanYA;
-    v[15] = fMeanXB;
-    v[16] = fMeanYB;
-    v[17] = GetEccentricity();
-    v[18] = GetStoa();
-    v[19] = GetEccentricityColl();
-    v[20] = GetEccentricityCom();
-    v[21] = GetEccentricityPart();
-    v[22] = GetEccentricityPartColl();
-    v[23] = GetEccentricityPartCom();
-    if (fDoPartProd)
+    FillNtupleValues(v);
+
+    //always at the end
+    fnt->Fill(v);
+
+    if ((i%100)==0) std::cout << "Generating Event # " << i << "... \r" << flush;
+  }
+  std::cout << "Generating Event # " << nevents << "... \r" << endl << "Done! Succesfull events:  " << q << "  discarded events:  " << u <<"."<< endl;
+}
+
+//______________________________________________________________________________
+void AliGlauberMC::MakeNtuple()
+{
+  //create the output ntuple if needed
+  TString name(Form("nt_%s_%s",fANucleus.GetName(),fBNucleus.GetName()));
+  TString title(Form("%s + %s (x-sect = %d mb)",fANucleus.GetName(),fBNucleus.GetName(),(Int_t) fXSect));
+  if (fnt == 0)
+  {
+    fnt = new TNtuple(name,title,
+                      "Npart:Ncoll:B:MeanX:MeanY:MeanX2:MeanY2:MeanXY:VarX:VarY:VarXY:MeanXSystem:MeanYSystem:MeanXA:MeanYA:MeanXB:MeanYB:VarE:Stoa:VarEColl:VarECom:VarEPart:VarEPartColl:VarEPartCom:dNdEta:dNdEtaGBW:dNdEtaTwoNBD:xsect:tAA:Epsl2:Epsl3:Epsl4:Epsl5:E2Coll:E3Coll:E4Coll:E5Coll:E2Com:E3Com:E4Com:E5Com:Psi2:Psi3:Psi4:Psi5:BNN:signn:Ncollw");
+    fnt->SetDirectory(0);
+  }
+}
+
+//______________________________________________________________________________
+void AliGlauberMC::FillNtupleValues(Float_t *v) const
+{
+  //ntuple values of the current event
+  v[0]  = GetNpart();
+  v[1]  = GetNcoll();
+  v[2]  = fBMC;
+  v[3]  = fMeanXParts;
+  v[4]  = fMeanYParts;
+  v[5]  = fMeanX2Parts;
+  v[6]  = fMeanY2Parts;
+  v[7]  = fMeanXYParts;
+  v[8]  = fSx2Parts;
+  v[9]  = fSy2Parts;
+  v[10] = fSxyParts;
+  v[11] = fMeanXSystem;
+  v[12] = fMeanYSystem;
+  v[13] = fMeanXA;
+  v[14] = fMeanYA;
+  v[15] = fMeanXB;
+  v[16] = fMeanYB;
+  v[17] = GetEccentricity();
+  v[18] = GetStoa();
+  v[19] = GetEccentricityColl();
+  v[20] = GetEccentricityCom();
+  v[21] = GetEccentricityPart();
+  v[22] = GetEccentricityPartColl();
+  v[23] = GetEccentricityPartCom();
+  if (fDoPartProd)
+  {
+    v[24] = GetdNdEta();
+    v[25] = GetdNdEta();
+    v[26] = v[24]+v[25];
+  }
+  else
+  {
+    v[24] = 0;
+    v[25] = 0;
+    v[26] = 0;
+  }
+  v[27]=fXSect;
+
+  Float_t mytAA=-999;
+  if (GetNcoll()>0) mytAA=GetNcoll()/fXSect;
+  v[28]=mytAA;
+  //_____________epsilon2,3,4,4_______
+  v[29] = GetEpsilon2Part();
+  v[30] = GetEpsilon3Part();
+  v[31] = GetEpsilon4Part();
+  v[32] = GetEpsilon5Part();
+  v[33] = GetEpsilon2Coll();
+  v[34] = GetEpsilon3Coll();
+  v[35] = GetEpsilon4Coll();
+  v[36] = GetEpsilon5Coll();
+  v[37] = GetEpsilon2Com();
+  v[38] = GetEpsilon3Com();
+  v[39] = GetEpsilon4Com();
+  v[40] = GetEpsilon5Com();
+  v[41] = GetPsi2();
+  v[42] = GetPsi3();
+  v[43] = GetPsi4();
+  v[44] = GetPsi5();
+  v[45] = fBNN;
+  v[46] = fXSect;
+  v[47] = fNcollw;
+}
+
+//______________________________________________________________________________
+TRandom *AliGlauberMC::GetRandom() const
+{
+  //generator of the current event
+  return fRandom ? fRandom : gRandom;
+}
+
+//______________________________________________________________________________
+Bool_t AliGlauberMC::CalcEventFast(Double_t bgen, const AliGlauberNucleus &nucA, const AliGlauberNucleus &nucB)
+{
+  // as CalcEvent without cross section fluctuations, on the coordinate arrays
+  fAN = nucA.GetN();
+  fQAN = fAN * 3;
+  fBN = nucB.GetN();
+  fQBN = fBN * 3;
+  fXA.resize(fAN);
+  fYA.resize(fAN);
+  fZA.resize(fAN);
+  fXB.resize(fBN);
+  fYB.resize(fBN);
+  fZB.resize(fBN);
+  fNCollA.assign(fAN,0);
+  fNCollB.assign(fBN,0);
+  nucA.ThrowNucleons(GetRandom(),-bgen/2.,&fXA[0],&fYA[0],&fZA[0]);
+  nucB.ThrowNucleons(GetRandom(),bgen/2.,&fXB[0],&fYB[0],&fZB[0]);
+
+  // "ball" diameter = distance at which two balls interact
+  Double_t d2 = (Double_t)fXSect/(TMath::Pi()*10); // in fm^2
+
+  // transverse grid of cells larger than the ball diameter filled with the
+  // nucleons of B: colliding nucleons are in the same or in adjacent cells
+  const Double_t cell = TMath::Sqrt(d2)*(1.+1e-9);
+  Double_t xmin = fXB[0], xmax = fXB[0], ymin = fYB[0], ymax = fYB[0];
+  for (Int_t i = 1; i<fBN; i++)
+  {
+    xmin = TMath::Min(xmin,fXB[i]);
+    xmax = TMath::Max(xmax,fXB[i]);
+    ymin = TMath::Min(ymin,fYB[i]);
+    ymax = TMath::Max(ymax,fYB[i]);
+  }
+  const Int_t nx = Int_t((xmax-xmin)/cell)+1;
+  const Int_t ny = Int_t((ymax-ymin)/cell)+1;
+  fCellFirst.assign(nx*ny+1,0);
+  fCellNucl.resize(fBN);
+  for (Int_t i = 0; i<fBN; i++)
+    fCellFirst[Int_t((fXB[i]-xmin)/cell)*ny+Int_t((fYB[i]-ymin)/cell)+1]++;
+  for (Int_t c = 0; c<nx*ny; c++)
+    fCellFirst[c+1] += fCellFirst[c];
+  for (Int_t i = 0; i<fBN; i++)
+    fCellNucl[fCellFirst[Int_t((fXB[i]-xmin)/cell)*ny+Int_t((fYB[i]-ymin)/cell)]++] = i;
+  for (Int_t c = nx*ny; c>0; c--)
+    fCellFirst[c] = fCellFirst[c-1];
+  fCellFirst[0] = 0;
+
+  Double_t bNN   = 0;
+  Double_t Nco   = 0;
+  Double_t Ncohc = 0; // hard core
+
+  for (Int_t j = 0 ; j < fAN ; j++)
+  {
+    const Int_t ix = TMath::FloorNint((fXA[j]-xmin)/cell);
+    const Int_t iy = TMath::FloorNint((fYA[j]-ymin)/cell);
+    for (Int_t cx = TMath::Max(ix-1,0); cx <= TMath::Min(ix+1,nx-1); cx++)
     {
-      v[24] = GetdNdEta();
-      v[25] = GetdNdEta();
-      v[26] = v[24]+v[25];
+      for (Int_t cy = TMath::Max(iy-1,0); cy <= TMath::Min(iy+1,ny-1); cy++)
+      {
+        const Int_t c = cx*ny+cy;
+        for (Int_t k = fCellFirst[c]; k < fCellFirst[c+1]; k++)
+        {
+          const Int_t i = fCellNucl[k];
+          Double_t dx = fXB[i]-fXA[j];
+          Double_t dy = fYB[i]-fYA[j];
+          Double_t dij = dx*dx+dy*dy;
+          if (dij < d2)
+          {
+            bNN += dij;
+            ++Nco;
+            ++fNCollB[i];
+            ++fNCollA[j];
+            if (dij<d2/4)
+              ++Ncohc;
+          }
+        }
+      }
     }
-    else
+  }
+
+  if (Nco>0) {
+    fNcollw = Ncohc;
+    fBNN = bNN/Nco;
+  } else {
+    fNcollw = 0;
+    fBNN    = 0.;
+  }
+  return CalcResults(bgen);
+}
+
+//______________________________________________________________________________
+Bool_t AliGlauberMC::NextEventFast(const AliGlauberNucleus &nucA, const AliGlauberNucleus &nucB)
+{
+  //as NextEvent(), with CalcEventFast
+  Int_t nAttempts = 10;
+  Bool_t succes = kFALSE;
+  for(Int_t j=0; j<nAttempts; j++)
+  {
+    Double_t bgen = TMath::Sqrt((fBMax*fBMax-fBMin*fBMin)*GetRandom()->Rndm()+fBMin*fBMin);
+    if ( (succes=CalcEventFast(bgen,nucA,nucB)) ) break; //ends if we have particparts
+  }
+  return succes;
+}
+
+//______________________________________________________________________________
+void AliGlauberMC::RunBlock(Int_t nevents, const AliGlauberNucleus *nucA, const AliGlauberNucleus *nucB,
+                            std::vector<Float_t> *values, Int_t *ndiscarded)
+{
+  //generate a block of events of RunParallel, ntuple values stored in values
+  values->clear();
+  *ndiscarded = 0;
+  Float_t v[48];
+  for (Int_t i = 0; i<nevents; i++)
+  {
+    if(!NextEventFast(*nucA,*nucB))
     {
-      v[24] = 0;
-      v[25] = 0;
-      v[26] = 0;
+      (*ndiscarded)++;
+      continue;
     }
-    v[27]=fXSect;
-
-    Float_t mytAA=-999;
-    if (GetNcoll()>0) mytAA=GetNcoll()/fXSect;
-    v[28]=mytAA;
-    //_____________epsilon2,3,4,4_______
-    v[29] = GetEpsilon2Part();
-    v[30] = GetEpsilon3Part();
-    v[31] = GetEpsilon4Part();
-    v[32] = GetEpsilon5Part();
-    v[33] = GetEpsilon2Coll();
-    v[34] = GetEpsilon3Coll();
-    v[35] = GetEpsilon4Coll();
-    v[36] = GetEpsilon5Coll();
-    v[37] = GetEpsilon2Com();
-    v[38] = GetEpsilon3Com();
-    v[39] = GetEpsilon4Com();
-    v[40] = GetEpsilon5Com();
-    v[41] = GetPsi2();
-    v[42] = GetPsi3();
-    v[43] = GetPsi4();
-    v[44] = GetPsi5();
-    v[45] = fBNN;
-    v[46] = fXSect;
-    v[47] = fNcollw;
+    FillNtupleValues(v);
+    values->insert(values->end(),v,v+48);
+  }
+}
 
-    //always at the end
-    fnt->Fill(v);
+//______________________________________________________________________________
+void AliGlauberMC::RunParallel(Int_t nevents, Int_t nthreads, UInt_t seed)
+{
+  //parallel run, see header
+  if (fDoFluc)
+  {
+    cout << "Cross section fluctuations are not supported by RunParallel, using Run" << endl;
+    Run(nevents);
+    return;
+  }
+  if (!fANucleus.PrepareSampling() || !fBNucleus.PrepareSampling())
+  {
+    cout << "No radial distribution for " << fANucleus.GetName() << " + " << fBNucleus.GetName() << endl;
+    return;
+  }
+  if (nthreads<1) nthreads = 1;
+#ifndef ALIGLAUBERMC_THREADS
+  if (nthreads>1) cout << "No thread support in this build, the blocks of events are generated sequentially" << endl;
+#endif
+  if (seed==0) seed = gRandom->Integer(kMaxUInt);
+  cout << "Generating " << nevents << " events on " << nthreads << " threads, seed " << seed << "..." << endl;
+  MakeNtuple();
+
+  //generators of the threads, set up here (TF1s of their nuclei); the nuclei
+  //of this object are shared for throwing the nucleons
+  std::vector<AliGlauberMC*> workers(nthreads);
+  for (Int_t t = 0; t<nthreads; t++)
+  {
+    AliGlauberMC *w = new AliGlauberMC(fANucleus.GetName(),fBNucleus.GetName(),fXSect);
+    w->fBMin = fBMin;
+    w->fBMax = fBMax;
+    w->fMultType = fMultType;
+    memcpy(w->fdNdEtaParam,fdNdEtaParam,sizeof(fdNdEtaParam));
+    w->fX = fX;
+    w->fNpp = fNpp;
+    w->fDoPartProd = fDoPartProd;
+    w->fRandom = new TRandom3(1);
+    workers[t] = w;
+  }
+  std::vector< std::vector<Float_t> > values(nthreads);
+  std::vector<Int_t> ndiscarded(nthreads,0);
 
-    if ((i%100)==0) std::cout << "Generating Event # " << i << "... \r" << flush;
+  const Int_t nblocks = (nevents+kGlauberBlock-1)/kGlauberBlock;
+  Int_t q = 0;
+  Int_t u = 0;
+  for (Int_t first = 0; first<nblocks; first+=nthreads)
+  {
+    const Int_t nrun = TMath::Min(nthreads,nblocks-first);
+    for (Int_t t = 0; t<nrun; t++)
+      workers[t]->fRandom->SetSeed(GlauberBlockSeed(seed,first+t));
+#ifdef ALIGLAUBERMC_THREADS
+    std::vector<std::thread> threads;
+    for (Int_t t = 0; t<nrun; t++)
+    {
+      const Int_t nev = TMath::Min(kGlauberBlock,nevents-(first+t)*kGlauberBlock);
+      threads.push_back(std::thread(&AliGlauberMC::RunBlock,workers[t],nev,&fANucleus,&fBNucleus,&values[t],&ndiscarded[t]));
+    }
+    for (Int_t t = 0; t<nrun; t++)
+      threads[t].join();
+#else
+    for (Int_t t = 0; t<nrun; t++)
+      workers[t]->RunBlock(TMath::Min(kGlauberBlock,nevents-(first+t)*kGlauberBlock),&fANucleus,&fBNucleus,&values[t],&ndiscarded[t]);
+#endif
+    //always filled in the order of the blocks
+    for (Int_t t = 0; t<nrun; t++)
+    {
+      const Int_t nev = values[t].size()/48;
+      for (Int_t i = 0; i<nev; i++)
+        fnt->Fill(&values[t][48*i]);
+      q += nev;
+      u += ndiscarded[t];
+    }
+    std::cout << "Generating Event # " << TMath::Min(nevents,(first+nrun)*kGlauberBlock) << "... \r" << flush;
+  }
+
+  for (Int_t t = 0; t<nthreads; t++)
+  {
+    fEvents += workers[t]->fEvents;
+    fTotalEvents += workers[t]->fTotalEvents;
+    if (workers[t]->fMaxNpartFound > fMaxNpartFound) fMaxNpartFound = workers[t]->fMaxNpartFound;
+    delete workers[t]->fRandom;
+    delete workers[t];
   }
   std::cout << "Generating Event # " << nevents << "... \r" << endl << "Done! Succesfull events:  " << q << "  discarded events:  " << u <<"."<< endl;
 }
@@ -1800,6 +2095,31 @@ void AliGlauberMC::RunAndSaveNtuple( Int_t n,
   out.Close();
 }
 
+//---------------------------------------------------------------------------------
+void AliGlauberMC::RunAndSaveNtupleParallel( Int_t n,
+                                             Int_t nthreads,
+                                             UInt_t seed,
+                                             const Option_t *sysA,
+                                             const Option_t *sysB,
+                                             Double_t signn,
+                                             Double_t mind,
+                                             Double_t r,
+                                             Double_t a,
+                                             const char *fname)
+{
+  //example run, parallel generation
+  AliGlauberMC mcg(sysA,sysB,signn);
+  mcg.SetMinDistance(mind);
+  mcg.Setr(r);
+  mcg.Seta(a);
+  mcg.RunParallel(n,nthreads,seed);
+  TNtuple  *nt=mcg.GetNtuple();
+  TFile out(fname,"recreate",fname,9);
+  if(nt) nt->Write();
+  printf("total cross section with a nucleon-nucleon cross section \t%f is \t%f",signn,mcg.GetTotXSect());
+  out.Close();
+}
+
 //---------------------------------------------------------------------------------
 void AliGlauberMC::RunAndSaveNucleons( Int_t n,
                                        const Option_t *sysA,
@@ -16,9 +16,11 @@
 #include "AliGlauberNucleus.h"
 #include <Riostream.h>
 #include <TNamed.h>
+#include <vector>
 
 class TObjArray;
 class TNtuple;
+class TRandom;
 
 using std::cout;
 using std::endl;
@@ -41,6 +43,12 @@ public:
    void         Run(Int_t nevents);
    Bool_t       NextEvent(Double_t bgen=-1);
    Bool_t       CalcEvent(Double_t bgen);
+   //Same ntuple as Run, generated in blocks of events on nthreads threads.
+   //Nucleons are kept in coordinate arrays only (no GetNucleons) and the
+   //collisions are searched on a grid. Each block has its own random
+   //stream derived from seed (from gRandom if 0), hence the ntuple does
+   //not depend on the number of threads. No cross section fluctuations.
+   void         RunParallel(Int_t nevents, Int_t nthreads=0, UInt_t seed=0);
 
    //various ways to calculate multiplicity
    Double_t     GetdNdEta() const;
@@ -110,6 +118,16 @@ public:
 				       Double_t r=6.62,
 				       Double_t a=0.546,
                                        const char *fname="glau_pbpb_ntuple.root");
+   static void       RunAndSaveNtupleParallel( Int_t n,
+                                               Int_t nthreads,
+                                               UInt_t seed=0,
+                                               const Option_t *sysA="Pb",
+                                               const Option_t *sysB="Pb",
+                                               Double_t signn=64,
+                                               Double_t mind=0.4,
+                                               Double_t r=6.62,
+                                               Double_t a=0.546,
+                                               const char *fname="glau_pbpb_ntuple.root");
    void RunAndSaveNucleons( Int_t n,
                             const Option_t *sysA,
                             const Option_t *sysB,
@@ -251,7 +269,25 @@ private:
    Double_t     fSig0;           //regularization parameter 
    Double_t     fLambda;         //lambda parameter
    TF1         *fSigFluc;        //!parameterization for fluctuating sigNN
+   TRandom     *fRandom;         //!random generator of RunParallel blocks (gRandom if 0)
+   std::vector<Double_t> fXA;    //!x of nucleons in nucleus A, input of CalcResults
+   std::vector<Double_t> fYA;    //!y of nucleons in nucleus A
+   std::vector<Double_t> fZA;    //!z of nucleons in nucleus A
+   std::vector<Double_t> fXB;    //!x of nucleons in nucleus B
+   std::vector<Double_t> fYB;    //!y of nucleons in nucleus B
+   std::vector<Double_t> fZB;    //!z of nucleons in nucleus B
+   std::vector<Int_t> fNCollA;   //!binary collisions of nucleons in nucleus A
+   std::vector<Int_t> fNCollB;   //!binary collisions of nucleons in nucleus B
+   std::vector<Int_t> fCellFirst;//!collision grid: first entry of each cell in fCellNucl
+   std::vector<Int_t> fCellNucl; //!collision grid: nucleons of B sorted by cell
    Bool_t       CalcResults(Double_t bgen);
+   TRandom     *GetRandom() const;
+   void         MakeNtuple();
+   void         FillNtupleValues(Float_t *v) const;
+   Bool_t       CalcEventFast(Double_t bgen, const AliGlauberNucleus &nucA, const AliGlauberNucleus &nucB);
+   Bool_t       NextEventFast(const AliGlauberNucleus &nucA, const AliGlauberNucleus &nucB);
+   void         RunBlock(Int_t nevents, const AliGlauberNucleus *nucA, const AliGlauberNucleus *nucB,
+                         std::vector<Float_t> *values, Int_t *ndiscarded);
 
    ClassDef(AliGlauberMC,4)
 };
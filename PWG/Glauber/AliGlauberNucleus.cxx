@@ -49,7 +49,11 @@ AliGlauberNucleus::AliGlauberNucleus(Option_t* iname, Int_t iN, Double_t iR, Dou
   fF(0),
   fTrials(0),
   fFunction(ifunc),
-  fNucleons(NULL)
+  fNucleons(NULL),
+  fCdf(),
+  fAlpha(),
+  fBeta(),
+  fGamma()
 {
    if (fN==0) {
       cout << "Setting up nucleus " << iname << endl;
@@ -77,7 +81,11 @@ AliGlauberNucleus::AliGlauberNucleus(const AliGlauberNucleus& in):
   fF(in.fF),
   fTrials(in.fTrials),
   fFunction(in.fFunction),
-  fNucleons(NULL)
+  fNucleons(NULL),
+  fCdf(in.fCdf),
+  fAlpha(in.fAlpha),
+  fBeta(in.fBeta),
+  fGamma(in.fGamma)
 {
   //copy ctor
   if (in.fNucleons)
@@ -97,6 +105,10 @@ AliGlauberNucleus& AliGlauberNucleus::operator=(const AliGlauberNucleus& in)
   fF=in.fF;
   fTrials=in.fTrials;
   fFunction=in.fFunction;
+  fCdf=in.fCdf;
+  fAlpha=in.fAlpha;
+  fBeta=in.fBeta;
+  fGamma=in.fGamma;
   delete fNucleons;
   fNucleons=static_cast<TObjArray*>((in.fNucleons)->Clone());
   fNucleons->SetOwner();
@@ -177,6 +189,7 @@ void AliGlauberNucleus::Lookup(Option_t* name)
 void AliGlauberNucleus::SetR(Double_t ir)
 {
    fR = ir;
+   fCdf.clear();
    switch (fF)
    {
       case 0: // Proton
@@ -195,6 +208,7 @@ void AliGlauberNucleus::SetR(Double_t ir)
 void AliGlauberNucleus::SetA(Double_t ia)
 {
    fA = ia;
+   fCdf.clear();
    switch (fF)
    {
       case 0: // Proton
@@ -212,6 +226,7 @@ void AliGlauberNucleus::SetA(Double_t ia)
 void AliGlauberNucleus::SetW(Double_t iw)
 {
    fW = iw;
+   fCdf.clear();
    switch (fF)
    {
       case 0: // Proton
@@ -315,3 +330,112 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
    }
 }
 
+
+//______________________________________________________________________________
+Bool_t AliGlauberNucleus::PrepareSampling()
+{
+   // tabulate the inverse of the cumulative radial distribution in the same
+   // way as TF1::GetRandom, such that GetRandomR samples the same distribution
+   if (!fCdf.empty()) return kTRUE;
+   if (!fFunction) return kFALSE;
+   const Int_t npx = fFunction->GetNpx();
+   const Double_t xmin = fFunction->GetXmin();
+   const Double_t dx = (fFunction->GetXmax()-xmin)/npx;
+   std::vector<Double_t> cdf(npx+1,0.);
+   for (Int_t i = 0; i<npx; i++)
+      cdf[i+1] = cdf[i] + TMath::Abs(fFunction->Integral(xmin+i*dx,xmin+(i+1)*dx));
+   const Double_t total = cdf[npx];
+   if (total<=0) {
+      cerr << "Integral of radial distribution of " << GetName() << " is zero" << endl;
+      return kFALSE;
+   }
+   for (Int_t i = 1; i<=npx; i++)
+      cdf[i] /= total;
+   //the integral r for each bin is approximated by a parabola x = alpha + beta*r + gamma*r^2
+   fAlpha.resize(npx);
+   fBeta.resize(npx);
+   fGamma.resize(npx);
+   for (Int_t i = 0; i<npx; i++) {
+      const Double_t x0 = xmin+i*dx;
+      const Double_t r2 = cdf[i+1]-cdf[i];
+      const Double_t r1 = fFunction->Integral(x0,x0+0.5*dx)/total;
+      const Double_t r3 = 2*r2-4*r1;
+      fGamma[i] = TMath::Abs(r3)>1e-8 ? r3/(dx*dx) : 0;
+      fBeta[i]  = r2/dx-fGamma[i]*dx;
+      fAlpha[i] = x0;
+      fGamma[i] *= 2;
+   }
+   fCdf.swap(cdf);
+   return kTRUE;
+}
+
+//______________________________________________________________________________
+Double_t AliGlauberNucleus::GetRandomR(TRandom *rnd) const
+{
+   // random radius from the tables of PrepareSampling
+   const Double_t r = rnd->Rndm();
+   const Int_t bin = TMath::BinarySearch((Long64_t)fAlpha.size(),&fCdf[0],r);
+   const Double_t rr = r-fCdf[bin];
+   if (fGamma[bin]!=0)
+      return fAlpha[bin] + (-fBeta[bin]+TMath::Sqrt(fBeta[bin]*fBeta[bin]+2*fGamma[bin]*rr))/fGamma[bin];
+   return fAlpha[bin] + rr/fBeta[bin];
+}
+
+//______________________________________________________________________________
+void AliGlauberNucleus::ThrowNucleons(TRandom *rnd, Double_t xshift, Double_t *x, Double_t *y, Double_t *z) const
+{
+   // same as ThrowNucleons(xshift), without nucleon objects: the minimum distance
+   // check runs over contiguous coordinates and compares squared distances
+   Bool_t hulthen = (TString(GetName())=="dh");
+   if (fN==2 && hulthen) { //special treatmeant for Hulten
+      Double_t r = GetRandomR(rnd)/2;
+      Double_t phi = rnd->Rndm() * 2 * TMath::Pi() ;
+      Double_t ctheta = 2*rnd->Rndm() - 1 ;
+      Double_t stheta = sqrt(1-ctheta*ctheta);
+      x[0] = r * stheta * cos(phi) + xshift;
+      y[0] = r * stheta * sin(phi);
+      z[0] = r * ctheta;
+      x[1] = -x[0] + 2*xshift;
+      y[1] = -y[0];
+      z[1] = -z[0];
+      return;
+   }
+
+   const Double_t mind2 = fMinDist*fMinDist;
+   Double_t sumx=0;
+   Double_t sumy=0;
+   Double_t sumz=0;
+   for (Int_t i = 0; i<fN; i++) {
+      while(1) {
+         Double_t r = GetRandomR(rnd);
+         Double_t phi = rnd->Rndm() * 2 * TMath::Pi() ;
+         Double_t ctheta = 2*rnd->Rndm() - 1 ;
+         Double_t stheta = TMath::Sqrt(1-ctheta*ctheta);
+         x[i] = r * stheta * cos(phi) + xshift;
+         y[i] = r * stheta * sin(phi);
+         z[i] = r * ctheta;
+         if(fMinDist<0) break;
+         Int_t nclose = 0;
+         for (Int_t j = 0; j<i; j++) {
+            const Double_t dx = x[i]-x[j];
+            const Double_t dy = y[i]-y[j];
+            const Double_t dz = z[i]-z[j];
+            nclose += (dx*dx+dy*dy+dz*dz < mind2);
+         }
+         if (!nclose) break; //found nucleuon outside of mindist
+      }
+      sumx += x[i];
+      sumy += y[i];
+      sumz += z[i];
+   }
+
+   // set the centre-of-mass to be at zero (+xshift)
+   sumx = sumx/fN;
+   sumy = sumy/fN;
+   sumz = sumz/fN;
+   for (Int_t i = 0; i<fN; i++) {
+      x[i] = x[i]-sumx-xshift;
+      y[i] = y[i]-sumy;
+      z[i] = z[i]-sumz;
+   }
+}
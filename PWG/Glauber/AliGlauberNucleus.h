@@ -15,9 +15,11 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 //class TNamed;
+#include <vector>
 #include <TNamed.h>
 class TObjArray;
 class TF1;
+class TRandom;
 
 class AliGlauberNucleus : public TNamed {
 private:
@@ -30,8 +32,13 @@ private:
    Int_t      fTrials;     //Store trials needed to complete nucleus
    TF1*       fFunction;   //Probability density function rho(r)
    TObjArray* fNucleons;   //Array of nucleons
+   std::vector<Double_t> fCdf;   //!cumulative rho(r) per bin (as TF1::GetRandom)
+   std::vector<Double_t> fAlpha; //!parabolic inverse of the cdf in each bin
+   std::vector<Double_t> fBeta;  //!
+   std::vector<Double_t> fGamma; //!
 
    void       Lookup(Option_t* name);
+   Double_t   GetRandomR(TRandom *rnd) const;
 
 public:
    AliGlauberNucleus(Option_t* iname="Au", Int_t iN=0, Double_t iR=0, Double_t ia=0, Double_t iw=0, TF1* ifunc=0);
@@ -53,6 +60,10 @@ public:
    void       SetW(Double_t iw);
    void       SetMinDist(Double_t min) {fMinDist=min;}
    void       ThrowNucleons(Double_t xshift=0.);
+   //same as ThrowNucleons, into coordinate arrays of size GetN() and with
+   //the given generator; thread safe once PrepareSampling has been called
+   Bool_t     PrepareSampling();
+   void       ThrowNucleons(TRandom *rnd, Double_t xshift, Double_t *x, Double_t *y, Double_t *z) const;
 
    ClassDef(AliGlauberNucleus,1)
 };
@@ -15,6 +15,7 @@
 #include <cfloat>
 #include <cstring>
 #include <iostream>   // for unit tests
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <exception>
@@ -42,14 +43,16 @@ ClassImp(THistManager)
 THistManager::THistManager():
 		TNamed(),
 		fHistos(NULL),
-		fIsOwner(true)
+		fIsOwner(true),
+		fHandleObjects()
 {
 }
 
 THistManager::THistManager(const char *name):
 		TNamed(name, Form("Histogram container %s", name)),
 		fHistos(NULL),
-		fIsOwner(true)
+		fIsOwner(true),
+		fHandleObjects()
 {
 	fHistos = new THashList();
 	fHistos->SetName(Form("histos%s", name));
@@ -420,13 +423,19 @@ void THistManager::FillTH1(const char *name, double x, double weight, Option_t *
 		Fatal("THistManager::FillTH1", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
-	TString optionstring(opt);
-	if(optionstring.Contains("w")){
-	  // use bin width as weight
-	  Int_t bin = hist->GetXaxis()->FindBin(x);
-	  // check if not overflow or underflow bin
-	  if(bin != 0 && bin != hist->GetXaxis()->GetNbins())
-	    weight = 1./hist->GetXaxis()->GetBinWidth(bin);
+	FillTH1Object(hist, x, weight, opt);
+}
+
+void THistManager::FillTH1Object(TH1 *hist, double x, double weight, Option_t *opt) {
+	if(opt && *opt){
+	  TString optionstring(opt);
+	  if(optionstring.Contains("w")){
+	    // use bin width as weight
+	    Int_t bin = hist->GetXaxis()->FindBin(x);
+	    // check if not overflow or underflow bin
+	    if(bin != 0 && bin != hist->GetXaxis()->GetNbins())
+	      weight = 1./hist->GetXaxis()->GetBinWidth(bin);
+	  }
 	}
 	hist->Fill(x, weight);
 }
@@ -467,6 +476,14 @@ void THistManager::FillTH2(const char *name, double x, double y, double weight,
 		Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
+	FillTH2Object(hist, x, y, weight, opt);
+}
+
+void THistManager::FillTH2Object(TH2 *hist, double x, double y, double weight, Option_t *opt) {
+	if(!(opt && *opt)){
+	  hist->Fill(x, y, weight);
+	  return;
+	}
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	if(optstring.Contains("wx")){
@@ -542,6 +559,14 @@ void THistManager::FillTH3(const char* name, double x, double y, double z, doubl
 		Fatal("THistManager::FillTH3", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
+	FillTH3Object(hist, x, y, z, weight, opt);
+}
+
+void THistManager::FillTH3Object(TH3 *hist, double x, double y, double z, double weight, Option_t *opt) {
+	if(!(opt && *opt)){
+	  hist->Fill(x, y, z, weight);
+	  return;
+	}
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	if(optstring.Contains("wx")){
@@ -600,6 +625,14 @@ void THistManager::FillTHnSparse(const char *name, const double *x, double weigh
 		Fatal("THistManager::FillTHnSparse", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
+	FillTHnSparseObject(hist, x, weight, opt);
+}
+
+void THistManager::FillTHnSparseObject(THnSparse *hist, const double *x, double weight, Option_t *opt) {
+	if(!(opt && *opt)){
+	  hist->Fill(x, weight);
+	  return;
+	}
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	for(Int_t iaxis = 0; iaxis < hist->GetNdimensions(); iaxis++){
@@ -625,6 +658,79 @@ void THistManager::FillProfile(const char* name, double x, double y, double weig
   hist->Fill(x, y, weight);
 }
 
+int THistManager::RegisterHandle(TObject *hist){
+  // same histogram - same handle
+  for(size_t index = 0; index < fHandleObjects.size(); index++)
+    if(fHandleObjects[index] == hist) return index;
+  fHandleObjects.push_back(hist);
+  return fHandleObjects.size() - 1;
+}
+
+THistManager::TH1Handle THistManager::GetTH1Handle(const char *name){
+  TH1 *hist = dynamic_cast<TH1 *>(FindObject(name));
+  if(!hist){
+    Fatal("THistManager::GetTH1Handle", "Histogram %s not found", name);
+    return TH1Handle();
+  }
+  return TH1Handle(RegisterHandle(hist));
+}
+
+THistManager::TH2Handle THistManager::GetTH2Handle(const char *name){
+  TH2 *hist = dynamic_cast<TH2 *>(FindObject(name));
+  if(!hist){
+    Fatal("THistManager::GetTH2Handle", "Histogram %s not found", name);
+    return TH2Handle();
+  }
+  return TH2Handle(RegisterHandle(hist));
+}
+
+THistManager::TH3Handle THistManager::GetTH3Handle(const char *name){
+  TH3 *hist = dynamic_cast<TH3 *>(FindObject(name));
+  if(!hist){
+    Fatal("THistManager::GetTH3Handle", "Histogram %s not found", name);
+    return TH3Handle();
+  }
+  return TH3Handle(RegisterHandle(hist));
+}
+
+THistManager::THnSparseHandle THistManager::GetTHnSparseHandle(const char *name){
+  THnSparse *hist = dynamic_cast<THnSparse *>(FindObject(name));
+  if(!hist){
+    Fatal("THistManager::GetTHnSparseHandle", "Histogram %s not found", name);
+    return THnSparseHandle();
+  }
+  return THnSparseHandle(RegisterHandle(hist));
+}
+
+THistManager::TProfileHandle THistManager::GetTProfileHandle(const char *name){
+  TProfile *hist = dynamic_cast<TProfile *>(FindObject(name));
+  if(!hist){
+    Fatal("THistManager::GetTProfileHandle", "Histogram %s not found", name);
+    return TProfileHandle();
+  }
+  return TProfileHandle(RegisterHandle(hist));
+}
+
+void THistManager::FillTH1(TH1Handle handle, double x, double weight, Option_t *opt){
+  FillTH1Object(static_cast<TH1 *>(GetHandleObject(handle.fIndex, "THistManager::FillTH1")), x, weight, opt);
+}
+
+void THistManager::FillTH2(TH2Handle handle, double x, double y, double weight, Option_t *opt){
+  FillTH2Object(static_cast<TH2 *>(GetHandleObject(handle.fIndex, "THistManager::FillTH2")), x, y, weight, opt);
+}
+
+void THistManager::FillTH3(TH3Handle handle, double x, double y, double z, double weight, Option_t *opt){
+  FillTH3Object(static_cast<TH3 *>(GetHandleObject(handle.fIndex, "THistManager::FillTH3")), x, y, z, weight, opt);
+}
+
+void THistManager::FillTHnSparse(THnSparseHandle handle, const double *x, double weight, Option_t *opt){
+  FillTHnSparseObject(static_cast<THnSparse *>(GetHandleObject(handle.fIndex, "THistManager::FillTHnSparse")), x, weight, opt);
+}
+
+void THistManager::FillProfile(TProfileHandle handle, double x, double y, double weight){
+  static_cast<TProfile *>(GetHandleObject(handle.fIndex, "THistManager::FillTProfile"))->Fill(x, y, weight);
+}
+
 TObject *THistManager::FindObject(const char *name) const {
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
@@ -728,6 +834,75 @@ TObject *THistManager::iterator::operator*() const{
 }
 
 
+//////////////////////////////////////////////////////////
+///                                                    ///
+/// Implementation of THistFillBuffer                  ///
+///                                                    ///
+//////////////////////////////////////////////////////////
+
+namespace {
+  // serializes the flushes of all fill buffers (buffers of different threads filling the same histograms)
+  std::mutex gFillBufferMutex;
+}
+
+THistFillBuffer::THistFillBuffer(THistManager *hmgr, int capacity):
+    fManager(hmgr),
+    fCapacity(capacity > 0 ? capacity : 1),
+    fEntries(),
+    fValues()
+{
+  fEntries.reserve(2 * fCapacity);
+  fValues.reserve(4 * fCapacity);
+}
+
+THistFillBuffer::~THistFillBuffer(){
+  Flush();
+}
+
+void THistFillBuffer::Fill(THistManager::THnSparseHandle handle, const double *x, double weight){
+  const THnSparse *hist = static_cast<THnSparse *>(fManager->GetHandleObject(handle.GetIndex(), "THistFillBuffer::Fill"));
+  AddEntry(kTHnSparse, handle.GetIndex());
+  fValues.insert(fValues.end(), x, x + hist->GetNdimensions());
+  fValues.push_back(weight);
+  if(static_cast<int>(fEntries.size()) >= 2 * fCapacity) Flush();
+}
+
+void THistFillBuffer::Flush(){
+  if(!fEntries.size()) return;
+  std::lock_guard<std::mutex> lock(gFillBufferMutex);
+  const double *values = &fValues[0];
+  for(size_t ientry = 0; ientry < fEntries.size(); ientry += 2){
+    TObject *hist = fManager->GetHandleObject(fEntries[ientry+1], "THistFillBuffer::Flush");
+    switch(fEntries[ientry]){
+    case kTH1:
+      static_cast<TH1 *>(hist)->Fill(values[0], values[1]);
+      values += 2;
+      break;
+    case kTH2:
+      static_cast<TH2 *>(hist)->Fill(values[0], values[1], values[2]);
+      values += 3;
+      break;
+    case kTH3:
+      static_cast<TH3 *>(hist)->Fill(values[0], values[1], values[2], values[3]);
+      values += 4;
+      break;
+    case kTHnSparse: {
+      THnSparse *hsparse = static_cast<THnSparse *>(hist);
+      const int ndim = hsparse->GetNdimensions();
+      hsparse->Fill(values, values[ndim]);
+      values += ndim + 1;
+      break;
+    }
+    case kTProfile:
+      static_cast<TProfile *>(hist)->Fill(values[0], values[1], values[2]);
+      values += 3;
+      break;
+    };
+  }
+  fEntries.clear();
+  fValues.clear();
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////
 ///
 ///  Unit tests
@@ -1030,6 +1205,82 @@ namespace TestTHistManager {
     return success ? 0 : 1;
   }
 
+  int THistManagerTestSuite::TestFillHandleHistograms(){
+    THistManager testmgr("testmgr");
+
+    testmgr.CreateTH1("Group1/Test1", "Test handle 1D histogram", 1, 0., 1.);
+    testmgr.CreateTH2("Group1/Test2", "Test handle 2D histogram", 1, 0., 1., 1, 0., 1.);
+    testmgr.CreateTH3("Group2/Test3", "Test handle 3D histogram", 1, 0., 1., 1, 0., 1., 1, 0., 1.);
+    int nbins[4] = {1,1,1,1}; double min[4] = {0.,0.,0.,0.}, max[4] = {1.,1.,1.,1.};
+    testmgr.CreateTHnSparse("Group2/TestN", "Test handle THnSparse", 4, nbins, min, max);
+    testmgr.CreateTProfile("Group3/Subgroup1/TestProfile", "Test handle Profile histogram", 1, 0., 1.);
+
+    THistManager::TH1Handle h1 = testmgr.GetTH1Handle("Group1/Test1");
+    THistManager::TH2Handle h2 = testmgr.GetTH2Handle("Group1/Test2");
+    THistManager::TH3Handle h3 = testmgr.GetTH3Handle("Group2/Test3");
+    THistManager::THnSparseHandle hN = testmgr.GetTHnSparseHandle("Group2/TestN");
+    THistManager::TProfileHandle hProfile = testmgr.GetTProfileHandle("Group3/Subgroup1/TestProfile");
+
+    // Evalutate test
+    // tell user why test has failed
+    bool success(true);
+    if(!(h1.IsValid() && h2.IsValid() && h3.IsValid() && hN.IsValid() && hProfile.IsValid())){
+      std::cout << "Invalid handle" << std::endl;
+      success = false;
+    }
+    if(testmgr.GetTH2Handle("Group1/Test2").GetIndex() != h2.GetIndex()){
+      std::cout << "Group1/Test2: Different handles for the same histogram" << std::endl;
+      success = false;
+    }
+
+    double point[4] = {0.5, 0.5, 0.5, 0.5};
+    for(int i = 0; i < 100; i++){
+      testmgr.FillTH1(h1, 0.5);
+      testmgr.FillTH2(h2, 0.5, 0.5);
+      testmgr.FillTH3(h3, 0.5, 0.5, 0.5);
+      testmgr.FillTHnSparse(hN, point);
+      testmgr.FillProfile(hProfile, 0.5, 1.);
+    }
+    {
+      THistFillBuffer buffer(&testmgr, 64);
+      for(int i = 0; i < 100; i++){
+        buffer.Fill(h1, 0.5);
+        buffer.Fill(h2, 0.5, 0.5);
+        buffer.Fill(h3, 0.5, 0.5, 0.5);
+        buffer.Fill(hN, point);
+        buffer.Fill(hProfile, 0.5, 1.);
+      }
+    } // remaining entries filled when the buffer goes out of scope
+
+    TH1 *test1 = dynamic_cast<TH1 *>(testmgr.FindObject("Group1/Test1"));
+    if(!test1 || TMath::Abs(test1->GetBinContent(1) - 200) > DBL_EPSILON){
+      std::cout << "Group1/Test1: Value mismatch: expected 200, found " << (test1 ? test1->GetBinContent(1) : -1) << std::endl;
+      success = false;
+    }
+    TH2 *test2 = dynamic_cast<TH2 *>(testmgr.FindObject("Group1/Test2"));
+    if(!test2 || TMath::Abs(test2->GetBinContent(1,1) - 200) > DBL_EPSILON){
+      std::cout << "Group1/Test2: Value mismatch: expected 200, found " << (test2 ? test2->GetBinContent(1,1) : -1) << std::endl;
+      success = false;
+    }
+    TH3 *test3 = dynamic_cast<TH3 *>(testmgr.FindObject("Group2/Test3"));
+    if(!test3 || TMath::Abs(test3->GetBinContent(1,1,1) - 200) > DBL_EPSILON){
+      std::cout << "Group2/Test3: Value mismatch: expected 200, found " << (test3 ? test3->GetBinContent(1,1,1) : -1) << std::endl;
+      success = false;
+    }
+    THnSparse *testN = dynamic_cast<THnSparse *>(testmgr.FindObject("Group2/TestN"));
+    int index[4] = {1,1,1,1};
+    if(!testN || TMath::Abs(testN->GetBinContent(index) - 200) > DBL_EPSILON){
+      std::cout << "Group2/TestN: Value mismatch: expected 200, found " << (testN ? testN->GetBinContent(index) : -1) << std::endl;
+      success = false;
+    }
+    TProfile *testProfile = dynamic_cast<TProfile *>(testmgr.FindObject("Group3/Subgroup1/TestProfile"));
+    if(!testProfile || TMath::Abs(testProfile->GetBinContent(1) - 1) > DBL_EPSILON || TMath::Abs(testProfile->GetBinEntries(1) - 200) > DBL_EPSILON){
+      std::cout << "Group3/Subgroup1/TestProfile: Value mismatch: expected 1 (200 entries), found " << (testProfile ? testProfile->GetBinContent(1) : -1) << std::endl;
+      success = false;
+    }
+    return success ? 0 : 1;
+  }
+
   int TestRunAll(){
     int testresult(0);
     THistManagerTestSuite testsuite;
@@ -1050,6 +1301,10 @@ namespace TestTHistManager {
     testresult += testsuite.TestFillGroupedHistograms();
     std::cout << "Result after test: " << testresult << std::endl;
 
+    std::cout << "Running test: Fill Handle" << std::endl;
+    testresult += testsuite.TestFillHandleHistograms();
+    std::cout << "Result after test: " << testresult << std::endl;
+
     return testresult;
   }
 
@@ -1072,4 +1327,9 @@ namespace TestTHistManager {
     THistManagerTestSuite testsuite;
     return testsuite.TestFillGroupedHistograms();
   }
+
+  int TestRunFillHandle(){
+    THistManagerTestSuite testsuite;
+    return testsuite.TestFillHandleHistograms();
+  }
 }
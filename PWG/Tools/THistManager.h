@@ -7,6 +7,7 @@
 #include <TIterator.h>
 #include <TNamed.h>
 #include <iterator>
+#include <vector>
 
 class TArrayD;
 class TAxis;
@@ -17,6 +18,7 @@ class TH2;
 class TH3;
 class THnSparse;
 class TProfile;
+class THistFillBuffer;
 
 /**
  * @defgroup Histmanager Histogram manager
@@ -95,6 +97,27 @@ class TProfile;
  * an argument for options. Automatic correction for the bin width is done when
  * specifying the argument *W*, followed by the direction. Adding multiple directions
  * the weight is calculated for all directions at the same time.
+ *
+ * # Filling histograms via handles
+ *
+ * Name-based Fill methods split the histogram path and search the group
+ * hierarchy for every entry. For histograms filled per track or per
+ * particle, a handle can be obtained once (i.e. in UserCreateOutputObjects)
+ * and used in the corresponding Fill method instead of the name. Handles
+ * are indices in a table of the histogram manager, filling via handle
+ * does neither string operations nor a lookup.
+ *
+ * ~~~{.cxx}
+ * THistManager::TH1Handle hPt = mgr.GetTH1Handle("hPt");
+ * for(auto en : ROOT::TSeqI(0, 10000) {
+ *   mgr.FillTH1(hPt, gRandom->Exp(-1));
+ * }
+ * ~~~
+ *
+ * Handles are not persistent: they are valid only for the histogram
+ * manager which created them, as long as the histograms exist.
+ * In addition, entries can be collected in a @ref THistFillBuffer and
+ * filled into the histograms in batches.
  */
 class THistManager : public TNamed {
 public:
@@ -229,6 +252,45 @@ public:
     iterator();
   };
 
+  /**
+   * @class THistHandle
+   * @brief Typed handle to a histogram inside the histogram manager
+   * @ingroup Histmanager
+   *
+   * Handles are created by the histogram manager (see GetTH1Handle and
+   * the corresponding methods for the other histogram types) and
+   * refer to the histogram by its position in the handle table of the
+   * histogram manager. Default constructed handles are invalid.
+   */
+  template<class T>
+  class THistHandle {
+  public:
+    THistHandle(): fIndex(-1) {}
+
+    /**
+     * @brief Check whether the handle refers to a histogram
+     * @return True if the handle was created by a histogram manager
+     */
+    bool IsValid() const { return fIndex >= 0; }
+
+    /**
+     * @brief Get the position of the histogram in the handle table
+     * @return Index in the handle table (-1 for invalid handles)
+     */
+    int GetIndex() const { return fIndex; }
+
+  private:
+    friend class THistManager;
+    explicit THistHandle(int index): fIndex(index) {}
+    int fIndex;                                   ///< Index in the handle table
+  };
+
+  typedef THistHandle<TH1> TH1Handle;              ///< Handle for TH1 histograms
+  typedef THistHandle<TH2> TH2Handle;              ///< Handle for TH2 histograms
+  typedef THistHandle<TH3> TH3Handle;              ///< Handle for TH3 histograms
+  typedef THistHandle<THnSparse> THnSparseHandle;  ///< Handle for THnSparse histograms
+  typedef THistHandle<TProfile> TProfileHandle;    ///< Handle for TProfile histograms
+
   /**
    * @brief Default constructor.
    *
@@ -634,6 +696,104 @@ public:
 	 */
   void FillProfile(const char *name, double x, double y, double weight = 1.);
 
+  /**
+   * @brief Get a handle for a 1D histogram within the container.
+   *
+   * The histogram name also contains the parent group(s)
+   * according to the common group notation. Requesting
+   * the handle of the same histogram several times returns
+   * the same handle.
+   * @param[in] name Name of the histogram
+   * @return Handle for the histogram
+   */
+  TH1Handle GetTH1Handle(const char *name);
+
+  /**
+   * @brief Get a handle for a 2D histogram within the container.
+   * @param[in] name Name of the histogram
+   * @return Handle for the histogram
+   */
+  TH2Handle GetTH2Handle(const char *name);
+
+  /**
+   * @brief Get a handle for a 3D histogram within the container.
+   * @param[in] name Name of the histogram
+   * @return Handle for the histogram
+   */
+  TH3Handle GetTH3Handle(const char *name);
+
+  /**
+   * @brief Get a handle for a THnSparse within the container.
+   * @param[in] name Name of the histogram
+   * @return Handle for the histogram
+   */
+  THnSparseHandle GetTHnSparseHandle(const char *name);
+
+  /**
+   * @brief Get a handle for a profile histogram within the container.
+   * @param[in] name Name of the profile histogram
+   * @return Handle for the profile histogram
+   */
+  TProfileHandle GetTProfileHandle(const char *name);
+
+  /**
+   * @brief Fill a 1D histogram via its handle.
+   *
+   * Same as FillTH1 with the histogram name.
+   * @param[in] handle Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH1(TH1Handle handle, double x, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 2D histogram via its handle.
+   *
+   * Same as FillTH2 with the histogram name.
+   * @param[in] handle Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH2(TH2Handle handle, double x, double y, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a 3D histogram via its handle.
+   *
+   * Same as FillTH3 with the histogram name.
+   * @param[in] handle Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] z z-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTH3(TH3Handle handle, double x, double y, double z, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a THnSparse via its handle.
+   *
+   * Same as FillTHnSparse with the histogram name.
+   * @param[in] handle Handle of the histogram
+   * @param[in] x coordinates of the data
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] option Optional filling arguments
+   */
+  void FillTHnSparse(THnSparseHandle handle, const double *x, double weight = 1., Option_t *opt = "");
+
+  /**
+   * @brief Fill a profile histogram via its handle.
+   *
+   * Same as FillProfile with the histogram name.
+   * @param[in] handle Handle of the profile histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillProfile(TProfileHandle handle, double x, double y, double weight = 1.);
+
   /**
    * @brief Create forward iterator starting at the beginning of the
    * container
@@ -692,9 +852,42 @@ public:
 	virtual TObject *FindObject(const TObject *obj) const;
 
 private:
+  friend class THistFillBuffer;
+
 	THistManager(const THistManager &);
 	THistManager &operator=(const THistManager &);
 
+	/**
+	 * @brief Add a histogram to the handle table.
+	 * @param[in] hist Histogram (already in the container)
+	 * @return Index of the histogram in the handle table
+	 */
+	int RegisterHandle(TObject *hist);
+
+	/**
+	 * @brief Get the histogram connected to a handle index.
+	 *
+	 * Raises a fatal error for invalid handles.
+	 * @param[in] index Index of the handle
+	 * @param[in] method Name of the calling method, for the error message
+	 * @return Histogram connected to the handle
+	 */
+	TObject *GetHandleObject(int index, const char *method) const {
+	  if(index < 0 || index >= static_cast<int>(fHandleObjects.size())) Fatal(method, "Invalid histogram handle %d", index);
+	  return fHandleObjects[index];
+	}
+
+	/**
+	 * @brief Fill functions for the histogram found by name or handle
+	 *
+	 * Implementing bin width correction and filling, see
+	 * the public Fill methods
+	 */
+	static void FillTH1Object(TH1 *hist, double x, double weight, Option_t *opt);
+	static void FillTH2Object(TH2 *hist, double x, double y, double weight, Option_t *opt);
+	static void FillTH3Object(TH3 *hist, double x, double y, double z, double weight, Option_t *opt);
+	static void FillTHnSparseObject(THnSparse *hist, const double *x, double weight, Option_t *opt);
+
 
 	/**
 	 * @brief Find histogram group.
@@ -721,6 +914,7 @@ private:
 
 	THashList *fHistos;                   ///< List of histograms
 	bool fIsOwner;                        ///< Set the ownership
+	std::vector<TObject *> fHandleObjects;  //!<! Histograms connected to handles (position = handle index)
 
   /// \cond CLASSIMP
 	ClassDef(THistManager, 1);  // Container for histograms
@@ -743,6 +937,150 @@ THistManager::iterator THistManager::rend() const {
   return iterator(this, -1, iterator::kTHMIbackward);
 }
 
+/**
+ * @class THistFillBuffer
+ * @brief Staging buffer for fills via handles of a histogram manager
+ * @ingroup Histmanager
+ *
+ * Entries are stored in the buffer (no histogram access) and filled into
+ * the histograms of the histogram manager in the order in which they
+ * were added when the buffer is flushed: on Flush, when the capacity
+ * is reached, and on destruction. Flushes of different buffers are
+ * serialized, hence several threads with a buffer each can fill the
+ * same histogram manager. Fill options (bin width correction) are
+ * not supported by the buffer.
+ *
+ * ~~~{.cxx}
+ * THistFillBuffer buffer(&mgr);
+ * for(auto en : ROOT::TSeqI(0, 10000) {
+ *   buffer.Fill(hPt, gRandom->Exp(-1));
+ * }
+ * buffer.Flush();
+ * ~~~
+ */
+class THistFillBuffer {
+public:
+
+  /**
+   * @brief Constructor.
+   * @param[in] hmgr Histogram manager the handles belong to
+   * @param[in] capacity Number of entries after which the buffer is flushed
+   */
+  THistFillBuffer(THistManager *hmgr, int capacity = 1024);
+
+  /**
+   * @brief Destructor.
+   *
+   * Flushes the remaining entries
+   */
+  ~THistFillBuffer();
+
+  /**
+   * @brief Add entry for a 1D histogram
+   * @param[in] handle Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(THistManager::TH1Handle handle, double x, double weight = 1.) {
+    AddEntry(kTH1, handle.GetIndex());
+    fValues.push_back(x);
+    fValues.push_back(weight);
+    if(static_cast<int>(fEntries.size()) >= 2 * fCapacity) Flush();
+  }
+
+  /**
+   * @brief Add entry for a 2D histogram
+   * @param[in] handle Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(THistManager::TH2Handle handle, double x, double y, double weight = 1.) {
+    AddEntry(kTH2, handle.GetIndex());
+    fValues.push_back(x);
+    fValues.push_back(y);
+    fValues.push_back(weight);
+    if(static_cast<int>(fEntries.size()) >= 2 * fCapacity) Flush();
+  }
+
+  /**
+   * @brief Add entry for a 3D histogram
+   * @param[in] handle Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] z z-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(THistManager::TH3Handle handle, double x, double y, double z, double weight = 1.) {
+    AddEntry(kTH3, handle.GetIndex());
+    fValues.push_back(x);
+    fValues.push_back(y);
+    fValues.push_back(z);
+    fValues.push_back(weight);
+    if(static_cast<int>(fEntries.size()) >= 2 * fCapacity) Flush();
+  }
+
+  /**
+   * @brief Add entry for a THnSparse
+   * @param[in] handle Handle of the histogram
+   * @param[in] x coordinates of the data
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(THistManager::THnSparseHandle handle, const double *x, double weight = 1.);
+
+  /**
+   * @brief Add entry for a profile histogram
+   * @param[in] handle Handle of the profile histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(THistManager::TProfileHandle handle, double x, double y, double weight = 1.) {
+    AddEntry(kTProfile, handle.GetIndex());
+    fValues.push_back(x);
+    fValues.push_back(y);
+    fValues.push_back(weight);
+    if(static_cast<int>(fEntries.size()) >= 2 * fCapacity) Flush();
+  }
+
+  /**
+   * @brief Fill all entries into the histograms and clear the buffer
+   */
+  void Flush();
+
+  /**
+   * @brief Get the number of entries not yet filled into the histograms
+   * @return Number of entries in the buffer
+   */
+  int GetNumberOfEntries() const { return fEntries.size() / 2; }
+
+private:
+  /**
+   * @enum EntryType_t
+   * @brief Histogram type of an entry
+   */
+  enum EntryType_t {
+    kTH1 = 0,         //!< TH1 entry (x, weight)
+    kTH2 = 1,         //!< TH2 entry (x, y, weight)
+    kTH3 = 2,         //!< TH3 entry (x, y, z, weight)
+    kTHnSparse = 3,   //!< THnSparse entry (coordinates, weight)
+    kTProfile = 4     //!< TProfile entry (x, y, weight)
+  };
+
+  THistFillBuffer(const THistFillBuffer &);
+  THistFillBuffer &operator=(const THistFillBuffer &);
+
+  void AddEntry(EntryType_t type, int index) {
+    fEntries.push_back(type);
+    fEntries.push_back(index);
+  }
+
+  THistManager                *fManager;      ///< Histogram manager of the handles
+  int                         fCapacity;      ///< Max. number of entries before flush
+  std::vector<int>            fEntries;       ///< Type and handle index of the entries
+  std::vector<double>         fValues;        ///< Coordinates and weights of the entries
+};
+
 /**
  * @namespace TestTHistManager
  * @brief Collection of simple test for the THistManager
@@ -845,6 +1183,23 @@ public:
    * @return 0 if test is passed, 1 if it failed
    */
   int TestFillGroupedHistograms();
+
+  /**
+   * Purpose of the test: Check whether histograms are filled correctly via handles, directly
+   * and via a fill buffer
+   * Relies on: TestFillSimpleHistograms, TestFillGroupedHistograms
+   *
+   * Creating histograms of all types in groups, with 1 bin per dimension, and
+   * - filling each 100 times via the handle
+   * - filling each 100 times via a fill buffer with a capacity smaller than 100
+   * Requesting a handle twice must give the same handle.
+   *
+   * Test passed:
+   * - All histograms need to have in its 1 bin the bin content 200 (profile: 1)
+   * - Handles of the same histogram are equal
+   * @return 0 if test is passed, 1 if it failed
+   */
+  int TestFillHandleHistograms();
 };
 
 /**
@@ -882,5 +1237,12 @@ int TestRunFillSimple();
  */
 int TestRunFillGrouped();
 
+/**
+ * Run the test for filling histograms via handles. See @ref THistManagerTestSuite
+ * for details.
+ * @return 0 if test is passed, 1 if failed
+ */
+int TestRunFillHandle();
+
 }
 #endif
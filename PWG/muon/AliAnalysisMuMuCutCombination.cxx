@@ -28,7 +28,8 @@ AliAnalysisMuMuCutCombination::AliAnalysisMuMuCutCombination()
 : TObject(), fCuts(0x0), fName(""),
 fIsEventCutter(kFALSE), fIsEventHandlerCutter(kFALSE),
 fIsTrackCutter(kFALSE), fIsTrackPairCutter(kFALSE),
-fIsTriggerClassCutter(kFALSE)
+fIsTriggerClassCutter(kFALSE),
+fTrackMask(0), fTrackPairMask(0), fHasMasks(kFALSE)
 {
   /// Default ctor.
 }
@@ -136,6 +137,48 @@ Bool_t AliAnalysisMuMuCutCombination::IsEqualForTrackCutter(const AliAnalysisMuM
   return kTRUE;
 }
 
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuCutCombination::ComputeMasks(const TObjArray& trackCuts,
+                                                   const TObjArray& trackPairCuts) const
+{
+  /** Compute the bits of the track (pair) cuts of this combination within the
+   * trackCuts (trackPairCuts) arrays, so that, once each cut of those arrays has
+   * been evaluated once for a track (pair), the result of this combination is given
+   * by PassTrackMask (PassTrackPairMask) instead of calling again its cuts.
+   *
+   * \return kFALSE if one of the cuts is not found in the arrays (or is beyond the
+   * 64th position), in which case the Pass methods must be used
+   */
+
+  fTrackMask = 0;
+  fTrackPairMask = 0;
+  fHasMasks = kFALSE;
+
+  if (!fCuts) return kFALSE;
+
+  for ( Int_t i = 0; i <= fCuts->GetLast(); ++i )
+  {
+    AliAnalysisMuMuCutElement* ce = static_cast<AliAnalysisMuMuCutElement*>(fCuts->At(i));
+
+    if ( ce->IsTrackCutter() )
+    {
+      Int_t index = trackCuts.IndexOf(ce);
+      if ( index < 0 || index >= 64 ) return kFALSE;
+      fTrackMask |= ( static_cast<ULong64_t>(1) << index );
+    }
+    else if ( ce->IsTrackPairCutter() )
+    {
+      Int_t index = trackPairCuts.IndexOf(ce);
+      if ( index < 0 || index >= 64 ) return kFALSE;
+      fTrackPairMask |= ( static_cast<ULong64_t>(1) << index );
+    }
+  }
+
+  fHasMasks = kTRUE;
+
+  return kTRUE;
+}
+
 //_____________________________________________________________________________
 Bool_t AliAnalysisMuMuCutCombination::IsEqual(const TObject* obj) const
 {
@@ -49,6 +49,21 @@ public:
 
   Bool_t IsEqualForTrackCutter(const AliAnalysisMuMuCutCombination& other) const;
 
+  Bool_t ComputeMasks(const TObjArray& trackCuts, const TObjArray& trackPairCuts) const;
+
+  /// Whether the masks of ComputeMasks can be used instead of the Pass methods for tracks and track pairs
+  Bool_t HasMasks() const { return fHasMasks; }
+
+  /// Bits (in the array of track cuts given to ComputeMasks) of the track cuts of this combination
+  ULong64_t GetTrackMask() const { return fTrackMask; }
+  /// Bits (in the array of track pair cuts given to ComputeMasks) of the track pair cuts of this combination
+  ULong64_t GetTrackPairMask() const { return fTrackPairMask; }
+
+  /// Same as Pass(particle), given the results of all the track cuts (see AliAnalysisMuMuCutRegistry::GetTrackMask)
+  Bool_t PassTrackMask(ULong64_t trackMask) const { return ( trackMask & fTrackMask ) == fTrackMask; }
+  /// Same as Pass(p1,p2), given the results of all the track pair cuts (see AliAnalysisMuMuCutRegistry::GetTrackPairMask)
+  Bool_t PassTrackPairMask(ULong64_t trackPairMask) const { return ( trackPairMask & fTrackPairMask ) == fTrackPairMask; }
+
 private:
   /// not implemented on purpose
   AliAnalysisMuMuCutCombination(const AliAnalysisMuMuCutCombination& rhs);
@@ -63,6 +78,9 @@ private:
   Bool_t fIsTrackCutter; // whether or not the combination cuts on track
   Bool_t fIsTrackPairCutter; // whether or not the combination cuts on track pairs
   Bool_t fIsTriggerClassCutter; // whether or not the combination cuts on trigger class
+  mutable ULong64_t fTrackMask; //! bits of the track cuts of this combination (see ComputeMasks)
+  mutable ULong64_t fTrackPairMask; //! bits of the track pair cuts of this combination (see ComputeMasks)
+  mutable Bool_t fHasMasks; //! whether fTrackMask and fTrackPairMask are usable
 
   ClassDef(AliAnalysisMuMuCutCombination,1) // combination of 1 or more individual cuts
 };
@@ -16,6 +16,9 @@
  */
 
 #include "TMethodCall.h"
+#include "TFunction.h"
+#include "TInterpreter.h"
+#include "RVersion.h"
 #include "AliLog.h"
 #include "Riostream.h"
 #include "AliVParticle.h"
@@ -23,12 +26,15 @@
 ClassImp(AliAnalysisMuMuCutElement)
 ClassImp(AliAnalysisMuMuCutElementBar)
 
+Bool_t AliAnalysisMuMuCutElement::fgUseCompiledCutMethods = kTRUE;
+
 //_____________________________________________________________________________
 AliAnalysisMuMuCutElement::AliAnalysisMuMuCutElement()
 : TObject(), fName(""), fIsEventCutter(kFALSE), fIsEventHandlerCutter(kFALSE),
 fIsTrackCutter(kFALSE), fIsTrackPairCutter(kFALSE), fIsTriggerClassCutter(kFALSE),
 fCutObject(0x0), fCutMethodName(""), fCutMethodPrototype(""),
-fDefaultParameters(""), fNofParams(0), fCutMethod(0x0), fCallParams(), fDoubleParams()
+fDefaultParameters(""), fNofParams(0), fCutMethod(0x0), fCallParams(), fDoubleParams(),
+fIntParams(), fCompiledCutMethod(0x0), fCompiledArgs()
 {
   /// Default ctor, leading to an invalid cut object
 }
@@ -43,7 +49,8 @@ AliAnalysisMuMuCutElement::AliAnalysisMuMuCutElement(ECutType expectedType,
 fIsTrackCutter(kFALSE), fIsTrackPairCutter(kFALSE), fIsTriggerClassCutter(kFALSE),
 fCutObject(&cutObject), fCutMethodName(cutMethodName),
 fCutMethodPrototype(cutMethodPrototype),fDefaultParameters(defaultParameters),
-fNofParams(0), fCutMethod(0x0), fCallParams(), fDoubleParams()
+fNofParams(0), fCutMethod(0x0), fCallParams(), fDoubleParams(),
+fIntParams(), fCompiledCutMethod(0x0), fCompiledArgs()
 {
   /**
    * Construct a cut, which is a proxy to another method of (most probably) another object
@@ -78,6 +85,14 @@ Bool_t AliAnalysisMuMuCutElement::CallCutMethod(Long_t p) const
     if (!fCutMethod) return kFALSE;
   }
 
+  if ( fCompiledCutMethod && fgUseCompiledCutMethods )
+  {
+    fCompiledArgs[0] = reinterpret_cast<void*>(p);
+    Bool_t result(kFALSE);
+    (*fCompiledCutMethod)(fCutObject,fCompiledArgs.size(),&fCompiledArgs[0],&result);
+    return result;
+  }
+
   fCallParams[0] = p;
 
   fCutMethod->SetParamPtrs(&fCallParams[0],fCallParams.size());
@@ -97,6 +112,15 @@ Bool_t AliAnalysisMuMuCutElement::CallCutMethod(Long_t p1, Long_t p2) const
     if (!fCutMethod) return kFALSE;
   }
 
+  if ( fCompiledCutMethod && fgUseCompiledCutMethods )
+  {
+    fCompiledArgs[0] = reinterpret_cast<void*>(p1);
+    fCompiledArgs[1] = reinterpret_cast<void*>(p2);
+    Bool_t result(kFALSE);
+    (*fCompiledCutMethod)(fCutObject,fCompiledArgs.size(),&fCompiledArgs[0],&result);
+    return result;
+  }
+
   fCallParams[0] = p1;
   fCallParams[1] = p2;
 
@@ -107,6 +131,34 @@ Bool_t AliAnalysisMuMuCutElement::CallCutMethod(Long_t p1, Long_t p2) const
   return (result!=0);
 }
 
+//_____________________________________________________________________________
+void AliAnalysisMuMuCutElement::CompileCutMethod() const
+{
+  /** Get the wrapper the interpreter compiles to call fCutMethod, so that the Pass methods
+   * call the cut method directly with the addresses of its arguments (fCompiledArgs, bound
+   * once in Init), instead of going through TMethodCall::SetParamPtrs and
+   * TMethodCall::Execute for every event, track or pair.
+   *
+   * Only done for cut methods returning a Bool_t, the other ones keep using the TMethodCall.
+   * See SetUseCompiledCutMethods to switch back to the TMethodCalls.
+   */
+
+  fCompiledCutMethod = 0x0;
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0)
+  TFunction* method = fCutMethod->GetMethod();
+
+  if ( !method || method->GetReturnTypeNormalizedName() != "bool" ) return;
+
+  TInterpreter::CallFuncIFacePtr_t iface = gInterpreter->CallFunc_IFacePtr(fCutMethod->GetCallFunc());
+
+  if ( iface.fKind == TInterpreter::CallFuncIFacePtr_t::kGeneric )
+  {
+    fCompiledCutMethod = iface.fGeneric;
+  }
+#endif
+}
+
 //_____________________________________________________________________________
 Int_t AliAnalysisMuMuCutElement::CountOccurences(const TString& prototype, const char* search) const
 {
@@ -211,6 +263,11 @@ void AliAnalysisMuMuCutElement::Init(ECutType expectedType) const
 
   TString scutMethodPrototype(fCutMethodPrototype);
 
+  fCompiledCutMethod = 0x0;
+
+  // whether all the parameters can be bound to fCompiledArgs
+  Bool_t compilable(kTRUE);
+
   // some basic checks first
 
   TObjArray* tmp = fCutMethodPrototype.Tokenize(",");
@@ -360,6 +417,8 @@ void AliAnalysisMuMuCutElement::Init(ECutType expectedType) const
     // method
 
     fCallParams.resize(nparams+nMainPar);
+    fIntParams.resize(nparams);
+    fCompiledArgs.assign(nparams+nMainPar,0x0);
 
     if ( nMainPar == 2 )
     {
@@ -380,15 +439,19 @@ void AliAnalysisMuMuCutElement::Init(ECutType expectedType) const
       {
         fDoubleParams[i] = pValue.Atof();
         fCallParams[i+nMainPar] = reinterpret_cast<Long_t>(&fDoubleParams[i]);
+        fCompiledArgs[i+nMainPar] = &fDoubleParams[i];
       }
       else if ( pType.Contains("Int_t") )
       {
-        fCallParams[i+nMainPar] = pValue.Atoi();
+        fIntParams[i] = pValue.Atoi();
+        fCallParams[i+nMainPar] = fIntParams[i];
+        fCompiledArgs[i+nMainPar] = &fIntParams[i];
       }
       else
       {
         AliError(Form("Got a parameter of type %s which I don't exactly know how to deal with. Expect something bad to happen...",pType.Data()));
         fCallParams[i+nMainPar] = reinterpret_cast<Long_t>(&pValue);
+        compilable = kFALSE;
       }
     }
 
@@ -446,6 +509,11 @@ void AliAnalysisMuMuCutElement::Init(ECutType expectedType) const
     delete fCutMethod;
     fCutMethod=0x0;
   }
+
+  if ( fCutMethod && compilable )
+  {
+    CompileCutMethod();
+  }
 }
 
 //_____________________________________________________________________________
@@ -519,6 +587,14 @@ Bool_t AliAnalysisMuMuCutElement::Pass(const TString& firedTriggerClasses,
 
   acceptedTriggerClasses = "";
 
+  if ( fCompiledCutMethod && fgUseCompiledCutMethods )
+  {
+    void* args[] = { const_cast<TString*>(&firedTriggerClasses), &acceptedTriggerClasses, &L0, &L1, &L2 };
+    Bool_t result(kFALSE);
+    (*fCompiledCutMethod)(fCutObject,fNofParams,args,&result);
+    return result;
+  }
+
   Long_t result;
   Long_t params[] = { reinterpret_cast<Long_t>(&firedTriggerClasses),
     reinterpret_cast<Long_t>(&acceptedTriggerClasses),
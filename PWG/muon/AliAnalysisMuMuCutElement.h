@@ -76,10 +76,21 @@ public:
 
   Bool_t IsEqual(const TObject* obj) const;
 
+  /// Whether the cut method is called through its compiled wrapper (see CompileCutMethod)
+  Bool_t IsCompiled() const { return (fCompiledCutMethod != 0x0); }
+
+  static void SetUseCompiledCutMethods(Bool_t flag) { fgUseCompiledCutMethods = flag; }
+  static Bool_t UseCompiledCutMethods() { return fgUseCompiledCutMethods; }
+
 private:
 
+  /// signature of the interpreter wrapper of a method : object, number of arguments, addresses of the arguments, address of the return value
+  typedef void (*CompiledCutMethod_t)(void*, int, void**, void*);
+
   void Init(ECutType type=kAny) const;
 
+  void CompileCutMethod() const;
+
   Bool_t CallCutMethod(Long_t p) const;
   Bool_t CallCutMethod(Long_t p1, Long_t p2) const;
 
@@ -108,6 +119,11 @@ private:
 
   mutable std::vector<Long_t> fCallParams; //! vector of parameters for the fCutMethod
   mutable std::vector<Double_t> fDoubleParams; //! temporary vector to hold the references
+  mutable std::vector<Int_t> fIntParams; //! values of the Int_t parameters (for fCompiledArgs)
+  mutable CompiledCutMethod_t fCompiledCutMethod; //! compiled wrapper of fCutMethod (0x0 if not available)
+  mutable std::vector<void*> fCompiledArgs; //! addresses of the arguments of fCompiledCutMethod
+
+  static Bool_t fgUseCompiledCutMethods; // whether the compiled wrappers are used (kTRUE by default), kFALSE to use the TMethodCalls
 
   ClassDef(AliAnalysisMuMuCutElement,1) // One piece of a cut combination
 };
@@ -42,7 +42,10 @@ ClassImp(AliAnalysisMuMuCutRegistry)
 AliAnalysisMuMuCutRegistry::AliAnalysisMuMuCutRegistry()
 : TObject(),
 fCutElements(0x0),
-fCutCombinations(0x0)
+fCutCombinations(0x0),
+fMasksComputed(kFALSE),
+fUsedTrackCuts(0),
+fUsedTrackPairCuts(0)
 {
   /// ctor
 }
@@ -65,6 +68,8 @@ Int_t AliAnalysisMuMuCutRegistry::AddCutCombination(const TObjArray& cutElements
 
   if ( cutElements.IsEmpty() ) return -1;
 
+  fMasksComputed = kFALSE;
+
   AliAnalysisMuMuCutCombination* cutCombination = new AliAnalysisMuMuCutCombination;
 
   TIter next(&cutElements);
@@ -198,6 +203,37 @@ Int_t AliAnalysisMuMuCutRegistry::AddCutCombination(AliAnalysisMuMuCutElement* c
   return AddCutCombination(cutElements);
 }
 
+//_____________________________________________________________________________
+void AliAnalysisMuMuCutRegistry::ComputeMasks() const
+{
+  /// Compute the masks of all the cut combinations (see AliAnalysisMuMuCutCombination::ComputeMasks),
+  /// and from them the list of the track (pair) cut elements GetTrackMask (GetTrackPairMask) have to evaluate
+
+  fUsedTrackCuts = 0;
+  fUsedTrackPairCuts = 0;
+  fMasksComputed = kTRUE;
+
+  const TObjArray* combinations = GetCutCombinations(AliAnalysisMuMuCutElement::kAny);
+
+  if (!combinations) return;
+
+  TObjArray empty;
+  const TObjArray* trackCuts = GetCutElements(AliAnalysisMuMuCutElement::kTrack);
+  const TObjArray* trackPairCuts = GetCutElements(AliAnalysisMuMuCutElement::kTrackPair);
+
+  TIter next(combinations);
+  AliAnalysisMuMuCutCombination* cutCombination;
+
+  while ( ( cutCombination = static_cast<AliAnalysisMuMuCutCombination*>(next()) ) )
+  {
+    if ( cutCombination->ComputeMasks(trackCuts ? *trackCuts : empty,trackPairCuts ? *trackPairCuts : empty) )
+    {
+      fUsedTrackCuts |= cutCombination->GetTrackMask();
+      fUsedTrackPairCuts |= cutCombination->GetTrackPairMask();
+    }
+  }
+}
+
 //_____________________________________________________________________________
 AliAnalysisMuMuCutElement*
 AliAnalysisMuMuCutRegistry::CreateCutElement(AliAnalysisMuMuCutElement::ECutType type,
@@ -230,6 +266,8 @@ AliAnalysisMuMuCutRegistry::AddCutElement(AliAnalysisMuMuCutElement* ce)
 
   if ( ce && ce->IsValid() )
   {
+    fMasksComputed = kFALSE;
+
     if (!GetCutElements(AliAnalysisMuMuCutElement::kAny)->FindObject(ce))
     {
       GetCutElements(AliAnalysisMuMuCutElement::kAny)->Add(ce);
@@ -378,6 +416,66 @@ TObjArray* AliAnalysisMuMuCutRegistry::GetCutElements(AliAnalysisMuMuCutElement:
   return static_cast<TObjArray*>(fCutElements->At(type));
 }
 
+//_____________________________________________________________________________
+ULong64_t AliAnalysisMuMuCutRegistry::GetTrackMask(const AliVParticle& particle) const
+{
+  /** Evaluate once each track cut element (used by a combination) for this particle.
+   * Bit i of the returned mask is set if the i-th element of GetCutElements(kTrack)
+   * is passed, to be given to AliAnalysisMuMuCutCombination::PassTrackMask
+   * for the combinations which HasMasks.
+   */
+
+  if (!fMasksComputed) ComputeMasks();
+
+  ULong64_t mask(0);
+
+  const TObjArray* trackCuts = GetCutElements(AliAnalysisMuMuCutElement::kTrack);
+
+  if (!trackCuts) return mask;
+
+  for ( Int_t i = 0; i <= trackCuts->GetLast() && i < 64; ++i )
+  {
+    ULong64_t bit = ( static_cast<ULong64_t>(1) << i );
+
+    if ( ( fUsedTrackCuts & bit ) && static_cast<AliAnalysisMuMuCutElement*>(trackCuts->UncheckedAt(i))->Pass(particle) )
+    {
+      mask |= bit;
+    }
+  }
+
+  return mask;
+}
+
+//_____________________________________________________________________________
+ULong64_t AliAnalysisMuMuCutRegistry::GetTrackPairMask(const AliVParticle& p1, const AliVParticle& p2) const
+{
+  /** Evaluate once each track pair cut element (used by a combination) for this pair.
+   * Bit i of the returned mask is set if the i-th element of GetCutElements(kTrackPair)
+   * is passed, to be given to AliAnalysisMuMuCutCombination::PassTrackPairMask
+   * for the combinations which HasMasks.
+   */
+
+  if (!fMasksComputed) ComputeMasks();
+
+  ULong64_t mask(0);
+
+  const TObjArray* trackPairCuts = GetCutElements(AliAnalysisMuMuCutElement::kTrackPair);
+
+  if (!trackPairCuts) return mask;
+
+  for ( Int_t i = 0; i <= trackPairCuts->GetLast() && i < 64; ++i )
+  {
+    ULong64_t bit = ( static_cast<ULong64_t>(1) << i );
+
+    if ( ( fUsedTrackPairCuts & bit ) && static_cast<AliAnalysisMuMuCutElement*>(trackPairCuts->UncheckedAt(i))->Pass(p1,p2) )
+    {
+      mask |= bit;
+    }
+  }
+
+  return mask;
+}
+
 //_____________________________________________________________________________
 AliAnalysisMuMuCutElement* AliAnalysisMuMuCutRegistry::Not(const AliAnalysisMuMuCutElement& cutElement)
 {
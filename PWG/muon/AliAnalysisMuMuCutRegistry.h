@@ -72,6 +72,12 @@ public:
   const TObjArray* GetCutElements(AliAnalysisMuMuCutElement::ECutType type) const;
   TObjArray* GetCutElements(AliAnalysisMuMuCutElement::ECutType type);
 
+  /// Results of the track cut elements for one particle, one bit per element
+  ULong64_t GetTrackMask(const AliVParticle& particle) const;
+
+  /// Results of the track pair cut elements for one pair, one bit per element
+  ULong64_t GetTrackPairMask(const AliVParticle& p1, const AliVParticle& p2) const;
+
   virtual void Print(Option_t* opt="") const;
 
   Bool_t AlwaysTrue(const AliVEvent& /*event*/) const { return kTRUE; }
@@ -93,10 +99,15 @@ private:
                                               const char* cutMethodPrototype,
                                               const char* defaultParameters);
 
+  void ComputeMasks() const;
+
 private:
 
   mutable TObjArray* fCutElements; // cut elements
   mutable TObjArray* fCutCombinations; // cut combinations
+  mutable Bool_t fMasksComputed; //! whether the masks of the cut combinations are up-to-date
+  mutable ULong64_t fUsedTrackCuts; //! track cut elements used by (at least) one combination with masks
+  mutable ULong64_t fUsedTrackPairCuts; //! track pair cut elements used by (at least) one combination with masks
 
   ClassDef(AliAnalysisMuMuCutRegistry,1) // storage for cut pointers
 };
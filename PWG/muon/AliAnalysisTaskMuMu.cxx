@@ -45,6 +45,7 @@
 #include <algorithm>
 #include <cassert>
 #include <set>
+#include <vector>
 ///
 /// \ class AliAnalysisTaskMuMu
 ///
@@ -389,6 +390,28 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
   // The main part, loop over subanalysis and fill histo
   if ( !IsHistogrammingDisabled() && !fDisableHistoLoop ){
 
+    // Evaluate each track (pair) cut element only once per muon track (pair) for all the
+    // subanalysis and cut combinations, which then just have to check the resulting bits
+    // (see AliAnalysisMuMuCutRegistry::GetTrackMask and GetTrackPairMask)
+    std::vector<AliVParticle*> muons;
+    std::vector<ULong64_t> muonMasks;
+
+    for (Int_t i = 0; i < nTracks; ++i){
+      AliVParticle* track = AliAnalysisMuonUtility::GetTrack(i,Event());
+      if (!AliAnalysisMuonUtility::IsMuonTrack(track) ) continue;
+      muons.push_back(track);
+      muonMasks.push_back(fCutRegistry->GetTrackMask(*track));
+    }
+
+    Int_t nMuons = muons.size();
+    std::vector<ULong64_t> muonPairMasks(nMuons*nMuons,0);
+
+    for (Int_t i = 0; i < nMuons; ++i){
+      for (Int_t j = i+1; j < nMuons; ++j){
+        muonPairMasks[i*nMuons+j] = fCutRegistry->GetTrackPairMask(*muons[i],*muons[j]);
+      }
+    }
+
     while ( ( analysis = static_cast<AliAnalysisMuMuBase*>(nextAnalysis()) ) )
     {
 
@@ -404,12 +427,11 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
       AliCodeTimerAuto(Form("%s (FillHistosForEvent)",analysis->ClassName()),1);
       analysis->FillHistosForEvent(eventSelection,triggerClassName,centrality); // Implemented in AliAnalysisMuMuNch at the moment
 
-      // --- Loop on all event tracks ---
-      for (Int_t i = 0; i < nTracks; ++i){
+      // --- Loop on all event muon tracks ---
+      for (Int_t i = 0; i < nMuons; ++i){
 
         // Get track
-        AliVParticle* tracki = AliAnalysisMuonUtility::GetTrack(i,Event());
-       if (!AliAnalysisMuonUtility::IsMuonTrack(tracki) ) continue;
+        AliVParticle* tracki = muons[i];
 
         nextTrackCut.Reset();
         AliAnalysisMuMuCutCombination* trackCut;
@@ -417,7 +439,7 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
         // Loop on all track selections and fill histos for track that pass it
         while ( ( trackCut = static_cast<AliAnalysisMuMuCutCombination*>(nextTrackCut()) ) )
         {
-          if ( trackCut->Pass(*tracki) )
+          if ( trackCut->HasMasks() ? trackCut->PassTrackMask(muonMasks[i]) : trackCut->Pass(*tracki) )
           {
             AliCodeTimerAuto(Form("%s (FillHistosForTrack)",analysis->ClassName()),2);
             analysis->FillHistosForTrack(eventSelection,triggerClassName,centrality,trackCut->GetName(),*tracki);
@@ -426,12 +448,9 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
 
         // --- loop on muon track pairs (no mix) ---
 
-        for (Int_t j = i+1; j < nTracks; ++j){
+        for (Int_t j = i+1; j < nMuons; ++j){
           // Get track
-          AliVParticle    * trackj = 0x0;
-          trackj = AliAnalysisMuonUtility::GetTrack(j,Event());
-
-          if (!AliAnalysisMuonUtility::IsMuonTrack(trackj) ) continue;
+          AliVParticle* trackj = muons[j];
 
           nextPairCut.Reset();
           AliAnalysisMuMuCutCombination* pairCut;
@@ -440,9 +459,20 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
           while ( ( pairCut = static_cast<AliAnalysisMuMuCutCombination*>(nextPairCut()) ) )
           {
             // Weither or not the pairs pass the tests
-            Bool_t testi  = (pairCut->IsTrackCutter()) ? pairCut->Pass(*tracki) : kTRUE;
-            Bool_t testj  = (pairCut->IsTrackCutter()) ? pairCut->Pass(*trackj) : kTRUE;
-            Bool_t testij = pairCut->Pass(*tracki,*trackj);
+            Bool_t testi(kTRUE), testj(kTRUE), testij(kFALSE);
+
+            if ( pairCut->HasMasks() )
+            {
+              testi  = pairCut->PassTrackMask(muonMasks[i]);
+              testj  = pairCut->PassTrackMask(muonMasks[j]);
+              testij = pairCut->PassTrackPairMask(muonPairMasks[i*nMuons+j]);
+            }
+            else
+            {
+              testi  = (pairCut->IsTrackCutter()) ? pairCut->Pass(*tracki) : kTRUE;
+              testj  = (pairCut->IsTrackCutter()) ? pairCut->Pass(*trackj) : kTRUE;
+              testij = pairCut->Pass(*tracki,*trackj);
+            }
 
             if ( ( testi && testj ) && testij )
             {
@@ -478,7 +508,7 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
               trackj = static_cast<AliVParticle*>(currentPool->At(iTrack2));
 
               // Weither or not the pairs pass the tests
-              Bool_t testi  = trackCut->Pass(*tracki);
+              Bool_t testi  = trackCut->HasMasks() ? trackCut->PassTrackMask(muonMasks[i]) : trackCut->Pass(*tracki);
               Bool_t testj  = trackCut->Pass(*trackj);
               Bool_t testij = pairCut->Pass(*tracki,*trackj);
 
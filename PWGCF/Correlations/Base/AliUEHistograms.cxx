@@ -26,6 +26,7 @@
 
 #include "AliCFContainer.h"
 #include "AliBasicParticle.h"
+#include "AliCFParticle.h"
 #include "AliVParticle.h"
 #include "AliAODTrack.h"
 
@@ -37,10 +38,99 @@
 #include "TMath.h"
 #include "TLorentzVector.h"
 
+#include <vector>
+
 ClassImp(AliUEHistograms)
 
 const Int_t AliUEHistograms::fgkUEHists = 3;
 
+//____________________________________________________________________
+class AliUEParticleArrays
+{
+  // structure-of-arrays copy of a list of particles for the loops in AliUEHistograms::FillCorrelations
+  
+ public:
+  enum { kResonanceDaughter = BIT(0) };
+  
+  AliUEParticleArrays() : fN(0), fList(0), fDerivedFromBasicParticle(kTRUE), fUniqueIDIsEqual(kTRUE) {}
+  
+  void Fill(TObjArray* list, Bool_t eventIndex);
+  void ReadFlag(UInt_t bit, UChar_t flag);
+  
+  Int_t fN;                         // number of particles
+  TObjArray* fList;                 // list the arrays have been filled from
+  std::vector<Double_t> fPt;        // pT
+  std::vector<Double_t> fPhi;       // phi
+  std::vector<Float_t> fEta;        // eta
+  std::vector<Short_t> fCharge;     // charge
+  std::vector<UChar_t> fFlags;      // kResonanceDaughter
+  std::vector<Long64_t> fEventIndex;// event index (only for AliBasicParticles and if requested in Fill)
+  std::vector<UInt_t> fUniqueID;    // unique ID (IsEqual of AliBasicParticle and AliCFParticle)
+  std::vector<Double_t> fWeight;    // weight of the associated particle in FillCorrelations
+  Bool_t fDerivedFromBasicParticle; // all particles are derived from AliBasicParticle (fEventIndex is valid)
+  Bool_t fUniqueIDIsEqual;          // all particles are AliBasicParticle or AliCFParticle (IsEqual compares the unique IDs)
+};
+
+void AliUEParticleArrays::Fill(TObjArray* list, Bool_t eventIndex)
+{
+  // copies the particles in list
+  
+  fList = list;
+  fN = list->GetEntriesFast();
+  fPt.resize(fN);
+  fPhi.resize(fN);
+  fEta.resize(fN);
+  fCharge.resize(fN);
+  fFlags.assign(fN, 0);
+  fEventIndex.assign(fN, 0);
+  fUniqueID.resize(fN);
+  fWeight.resize(fN);
+  fDerivedFromBasicParticle = kTRUE;
+  fUniqueIDIsEqual = kTRUE;
+  
+  for (Int_t i=0; i<fN; i++)
+  {
+    AliVParticle* particle = (AliVParticle*) list->UncheckedAt(i);
+    fPt[i] = particle->Pt();
+    fPhi[i] = particle->Phi();
+    fEta[i] = particle->Eta();
+    fCharge[i] = particle->Charge();
+    fUniqueID[i] = particle->GetUniqueID();
+    
+    if (eventIndex)
+    {
+      AliBasicParticle* particleBasic = dynamic_cast<AliBasicParticle*>(particle);
+      if (particleBasic)
+	fEventIndex[i] = particleBasic->GetEventIndex();
+      else
+	fDerivedFromBasicParticle = kFALSE;
+    }
+    
+    if (particle->IsA() != AliBasicParticle::Class() && particle->IsA() != AliCFParticle::Class())
+      fUniqueIDIsEqual = kFALSE;
+  }
+}
+
+void AliUEParticleArrays::ReadFlag(UInt_t bit, UChar_t flag)
+{
+  // sets flag for the particles which have the TObject bit set
+  
+  for (Int_t i=0; i<fN; i++)
+    if (fList->UncheckedAt(i)->TestBit(bit))
+      fFlags[i] |= flag;
+}
+
+//____________________________________________________________________
+class AliUECorrelationArrays
+{
+  // buffers of AliUEHistograms::FillCorrelations, kept between the calls to avoid reallocations
+  
+ public:
+  AliUEParticleArrays fTriggers;     // trigger particles
+  AliUEParticleArrays fAssociated;   // associated particles (only for mixed events, otherwise fTriggers are used)
+  std::vector<UChar_t> fPairMask;    // pairs of one trigger particle selected by FillPairMask
+};
+
 AliUEHistograms::AliUEHistograms(const char* name, const char* histograms, const char* binning) : 
   TNamed(name, name),
   fNumberDensitypT(0),
@@ -86,7 +176,8 @@ AliUEHistograms::AliUEHistograms(const char* name, const char* histograms, const
   fTwoTrackCutMinRadius(0.8),
   fCheckEventNumberInCorrelation(kFALSE),
   fRunNumber(0),
-  fMergeCount(1)
+  fMergeCount(1),
+  fCorrelationArrays(0)
 {
   // Constructor
   //
@@ -267,7 +358,8 @@ AliUEHistograms::AliUEHistograms(const AliUEHistograms &c) :
   fTwoTrackCutMinRadius(0.8),
   fCheckEventNumberInCorrelation(kFALSE),
   fRunNumber(0),
-  fMergeCount(1)
+  fMergeCount(1),
+  fCorrelationArrays(0)
 {
   //
   // AliUEHistograms copy constructor
@@ -285,6 +377,9 @@ AliUEHistograms::~AliUEHistograms()
   // Destructor
   
   DeleteContainers();
+  
+  delete fCorrelationArrays;
+  fCorrelationArrays = 0;
 }
 
 void AliUEHistograms::DeleteContainers()
@@ -574,6 +669,13 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
   //
   // if mixed is non-0, mixed events are filled, the trigger particle is from particles, the associated from mixed
   // if weight < 0, then the pt of the associated particle is filled as weight
+  //
+  // the particles are copied once into structure-of-arrays buffers (AliUEParticleArrays), the selections which only 
+  // depend on pt, eta, charge, flags and event index are evaluated for all associated particles of a trigger as a mask 
+  // (FillPairMask), the remaining pair cuts which fill control histograms are applied to the selected pairs only 
+  // (PassesPairCuts). The accepted pairs are filled directly, one by one: AliCFContainer has no bulk fill, and
+  // filling the pairs in the order of the trigger/associated loops is what keeps the output bit-identical
+  // (the summation order of the weights and errors in each bin is unchanged)
   
   Bool_t fillpT = kFALSE;
   if (weight < 0)
@@ -591,18 +693,24 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
     TH1::AddDirectory(oldStatus);
   }
 
-  // Eta() is extremely time consuming, therefore cache it for the inner loop here:
-  TObjArray* input = (mixed) ? mixed : particles;
-  TArrayF eta(input->GetEntriesFast());
-  for (Int_t i=0; i<input->GetEntriesFast(); i++)
-    eta[i] = ((AliVParticle*) input->UncheckedAt(i))->Eta();
+  if (!fCorrelationArrays)
+    fCorrelationArrays = new AliUECorrelationArrays;
   
   // if particles is not set, just fill event statistics
   if (particles)
   {
-    Int_t jMax = particles->GetEntriesFast();
+    // Eta() and the other getters are virtual and (depending on the track class) time consuming, therefore the 
+    // particles are copied once here for the loops below
+    AliUEParticleArrays& triggers = fCorrelationArrays->fTriggers;
+    triggers.Fill(particles, fCheckEventNumberInCorrelation);
+    AliUEParticleArrays& associated = (mixed) ? fCorrelationArrays->fAssociated : triggers;
     if (mixed)
-      jMax = mixed->GetEntriesFast();
+      associated.Fill(mixed, fCheckEventNumberInCorrelation);
+    
+    Int_t jMax = associated.fN;
+    
+    if (fCheckEventNumberInCorrelation && triggers.fN > 0 && jMax > 0 && (!triggers.fDerivedFromBasicParticle || !associated.fDerivedFromBasicParticle))
+      AliFatal("If fCheckEventNumberInCorrelation is set, particle must be derived from AliBasicParticle");
     
     TH1* triggerWeighting = 0;
     if (fWeightPerEvent)
@@ -610,27 +718,12 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
       TAxis* axis = fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->GetGrid(0)->GetGrid()->GetAxis(2);
       triggerWeighting = new TH1F("triggerWeighting", "", axis->GetNbins(), axis->GetXbins()->GetArray());
     
-      for (Int_t i=0; i<particles->GetEntriesFast(); i++)
+      for (Int_t i=0; i<triggers.fN; i++)
       {
-	AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
-	
-	// some optimization
-	Float_t triggerEta = triggerParticle->Eta();
-
-	if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta) > fTriggerRestrictEta)
+	if (!AcceptTrigger(triggers, i))
 	  continue;
-
-	if (fOnlyOneEtaSide != 0)
-	{
-	  if (fOnlyOneEtaSide * triggerEta < 0)
-	    continue;
-	}
-	
-	if (fTriggerSelectCharge != 0)
-	  if (triggerParticle->Charge() * fTriggerSelectCharge < 0)
-	    continue;
 	
-	triggerWeighting->Fill(triggerParticle->Pt());
+	triggerWeighting->Fill(triggers.fPt[i]);
       }
     }
     
@@ -658,413 +751,172 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	for (Int_t i=0; i<jMax; i++)
 	  mixed->UncheckedAt(i)->ResetBit(kResonanceDaughterFlag);
       
-      for (Int_t i=0; i<particles->GetEntriesFast(); i++)
+      for (Int_t i=0; i<triggers.fN; i++)
       {
-	AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
-	
 	for (Int_t j=0; j<jMax; j++)
 	{
 	  if (!mixed && i == j)
 	    continue;
 	
-	  AliVParticle* particle = 0;
-	  if (!mixed)
-	    particle = (AliVParticle*) particles->UncheckedAt(j);
-	  else
-	    particle = (AliVParticle*) mixed->UncheckedAt(j);
-	  
 	  // check if both particles point to the same element (does not occur for mixed events, but if subsets are mixed within the same event)
-	  if (fCheckEventNumberInCorrelation)
-	  {
-	    AliBasicParticle* triggerParticleBasic = dynamic_cast<AliBasicParticle*>(triggerParticle);
-	    AliBasicParticle* particleBasic        = dynamic_cast<AliBasicParticle*>(particle);
-	    if(!triggerParticleBasic || !particleBasic)
-	    {
-	      AliFatal("If fCheckEventNumberInCorrelation is set, particle must be derived from AliBasicParticle");
-	      continue;
-	    }
-	
-	    if(triggerParticleBasic->IsInSameEvent(particleBasic))
-	      continue;
-	  }
-	  else if (mixed && triggerParticle->IsEqual(particle))
+	  if (IsSameParticle(triggers, i, associated, j, mixed != 0))
 	    continue;
 	  
-	  if (triggerParticle->Charge() * particle->Charge() > 0)
+	  if (triggers.fCharge[i] * associated.fCharge[j] > 0)
 	    continue;
       
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerParticle->Eta(), triggerParticle->Phi(), particle->Pt(), particle->Eta(), particle->Phi(), massDaughter1, massDaughter2);
+	  Float_t mass = GetInvMassSquaredCheap(triggers.fPt[i], triggers.fEta[i], triggers.fPhi[i], associated.fPt[j], associated.fEta[j], associated.fPhi[j], massDaughter1, massDaughter2);
 	      
 	  if (TMath::Abs(mass - resonanceMass*resonanceMass) < interval*5)
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerParticle->Eta(), triggerParticle->Phi(), particle->Pt(), particle->Eta(), particle->Phi(), massDaughter1, massDaughter2);
+	    mass = GetInvMassSquared(triggers.fPt[i], triggers.fEta[i], triggers.fPhi[i], associated.fPt[j], associated.fEta[j], associated.fPhi[j], massDaughter1, massDaughter2);
 
 	    if (mass > (resonanceMass-interval)*(resonanceMass-interval) && mass < (resonanceMass+interval)*(resonanceMass+interval))
 	    {
-	      triggerParticle->SetBit(kResonanceDaughterFlag);
-	      particle->SetBit(kResonanceDaughterFlag);
+	      particles->UncheckedAt(i)->SetBit(kResonanceDaughterFlag);
+	      associated.fList->UncheckedAt(j)->SetBit(kResonanceDaughterFlag);
 	      
 // 	      Printf("Flagged %d %d %f", i, j, TMath::Sqrt(mass));
 	    }
 	  }
 	}
       }
+      
+      // the bits are read back (and not set in the arrays directly) as the same object may be in both lists
+      triggers.ReadFlag(kResonanceDaughterFlag, AliUEParticleArrays::kResonanceDaughter);
+      if (mixed)
+	associated.ReadFlag(kResonanceDaughterFlag, AliUEParticleArrays::kResonanceDaughter);
     }
     
-    for (Int_t i=0; i<particles->GetEntriesFast(); i++)
+    // associated particle part of the weight, which does not depend on the trigger particle
+    for (Int_t j=0; j<jMax; j++)
     {
-      AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
-      
-      // some optimization
-      Float_t triggerEta = triggerParticle->Eta();
+      Float_t pairWeight = (fillpT) ? associated.fPt[j] : weight;
       
-      if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta) > fTriggerRestrictEta)
-	continue;
-
-      if (fOnlyOneEtaSide != 0)
+      Double_t useWeight = pairWeight;
+      if (applyEfficiency && fEfficiencyCorrectionAssociated)
       {
-	if (fOnlyOneEtaSide * triggerEta < 0)
-	  continue;
+	Int_t effVars[4];
+	// associated particle
+	effVars[0] = fEfficiencyCorrectionAssociated->GetAxis(0)->FindBin(associated.fEta[j]);
+	effVars[1] = fEfficiencyCorrectionAssociated->GetAxis(1)->FindBin(associated.fPt[j]); //pt
+	effVars[2] = fEfficiencyCorrectionAssociated->GetAxis(2)->FindBin(centrality); //centrality
+	effVars[3] = fEfficiencyCorrectionAssociated->GetAxis(3)->FindBin(zVtx); //zVtx
+	
+	// 	  Printf("%d %d %d %d %f", effVars[0], effVars[1], effVars[2], effVars[3], fEfficiencyCorrectionAssociated->GetBinContent(effVars));
+      
+	useWeight *= fEfficiencyCorrectionAssociated->GetBinContent(effVars);
       }
+      associated.fWeight[j] = useWeight;
+    }
+    
+    // the pairs are only filled into the toward region (the other regions are not used)
+    AliCFContainer* trackHist = fNumberDensityPhi->GetTrackHist(AliUEHist::kToward);
+    
+    for (Int_t i=0; i<triggers.fN; i++)
+    {
+      // some optimization
+      Float_t triggerEta = triggers.fEta[i];
       
-      if (fTriggerSelectCharge != 0)
-	if (triggerParticle->Charge() * fTriggerSelectCharge < 0)
-	  continue;
+      if (!AcceptTrigger(triggers, i))
+	continue;
 	
       if (fRejectResonanceDaughters > 0)
-	if (triggerParticle->TestBit(kResonanceDaughterFlag))
+	if (triggers.fFlags[i] & AliUEParticleArrays::kResonanceDaughter)
 	{
 // 	  Printf("Skipped i=%d", i);
 	  continue;
 	}
 	
-      for (Int_t j=0; j<jMax; j++)
+      // trigger particle part of the weight
+      Double_t triggerEfficiency = 1;
+      if (applyEfficiency && fEfficiencyCorrectionTriggers)
       {
-        if (!mixed && i == j)
-          continue;
+	Int_t effVars[4];
+
+	effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(triggerEta);
+	effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(triggers.fPt[i]); //pt
+	effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(centrality); //centrality
+	effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin(zVtx); //zVtx
+	triggerEfficiency = fEfficiencyCorrectionTriggers->GetBinContent(effVars);
+      }
       
-        AliVParticle* particle = 0;
-        if (!mixed)
-          particle = (AliVParticle*) particles->UncheckedAt(j);
-        else
-          particle = (AliVParticle*) mixed->UncheckedAt(j);
-        
-        // check if both particles point to the same element (does not occur for mixed events, but if subsets are mixed within the same event)
-        if (fCheckEventNumberInCorrelation)
-        {
-          AliBasicParticle* triggerParticleBasic = dynamic_cast<AliBasicParticle*>(triggerParticle);
-          AliBasicParticle* particleBasic        = dynamic_cast<AliBasicParticle*>(particle);
-          if(!triggerParticleBasic || !particleBasic)
-            AliFatal("If fCheckEventNumberInCorrelation is set, particle must be derived from AliBasicParticle");
+      Double_t triggerWeight = 1;
+      if (fWeightPerEvent)
+      {
+	Int_t weightBin = triggerWeighting->GetXaxis()->FindBin(triggers.fPt[i]);
+// 	Printf("Using weight %f", triggerWeighting->GetBinContent(weightBin));
+	triggerWeight = triggerWeighting->GetBinContent(weightBin);
+      }
       
-          if(triggerParticleBasic->IsInSameEvent(particleBasic))
-            continue;
-        }
-        else if (mixed && triggerParticle->IsEqual(particle))
-          continue;
-        
-        if (fPtOrder)
-	  if (particle->Pt() >= triggerParticle->Pt())
-	    continue;
-	
-	if (fAssociatedSelectCharge != 0)
-	  if (particle->Charge() * fAssociatedSelectCharge < 0)
-	    continue;
-
-        if (fSelectCharge > 0)
-        {
-          // skip like sign
-          if (fSelectCharge == 1 && particle->Charge() * triggerParticle->Charge() > 0)
-            continue;
-            
-          // skip unlike sign
-          if (fSelectCharge == 2 && particle->Charge() * triggerParticle->Charge() < 0)
-            continue;
-        }
-        
-        if (fOnlyOneAssocEtaSide != 0)
-          if (fOnlyOneAssocEtaSide * eta[j] < 0)
-            continue;
-
-	if (fEtaOrdering)
-	{
-	  if (triggerEta < 0 && eta[j] < triggerEta)
-	    continue;
-	  if (triggerEta > 0 && eta[j] > triggerEta)
-	    continue;
-	}
-
-	if (fRejectResonanceDaughters > 0)
-	  if (particle->TestBit(kResonanceDaughterFlag))
-	  {
-// 	    Printf("Skipped j=%d", j);
-	    continue;
-	  }
-
-	// conversions
-	if (fCutConversionsV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
-	  
-	  if (mass < fCutConversionsV * 5)
-	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
-	    
-	    fControlConvResoncances->Fill(0.0, mass);
-
-	    if (mass < fCutConversionsV*fCutConversionsV) 
-	      continue;
-	  }
-	}
+      const UChar_t* pairMask = FillPairMask(triggers, i, associated, mixed != 0);
+      
+      // IsEqual is only evaluated per pair if it cannot be replaced by the comparison of the unique IDs
+      Bool_t checkIsEqual = (mixed && !fCheckEventNumberInCorrelation && (!triggers.fUniqueIDIsEqual || !associated.fUniqueIDIsEqual));
+      
+      for (Int_t j=0; j<jMax; j++)
+      {
+	if (!pairMask[j])
+	  continue;
 	
-	// K0s
-	if (fCutK0sV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
-	  
-	  const Float_t kK0smass = 0.4976;
-	  
-	  if (TMath::Abs(mass - kK0smass*kK0smass) < fCutK0sV * 5)
-	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
-	    
-	    fControlConvResoncances->Fill(1, mass - kK0smass*kK0smass);
-
-	    if (mass > (kK0smass-fCutK0sV)*(kK0smass-fCutK0sV) && mass < (kK0smass+fCutK0sV)*(kK0smass+fCutK0sV))
-	      continue;
-	  }
-	}
-
-	// Lambda
-	if (fCutLambdaV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-	{
-	  Float_t mass1 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
-	  Float_t mass2 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
-	  
-	  const Float_t kLambdaMass = 1.115;
-
-	  if (TMath::Abs(mass1 - kLambdaMass*kLambdaMass) < fCutLambdaV * 5)
-	  {
-	    mass1 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
-
-	    fControlConvResoncances->Fill(2, mass1 - kLambdaMass*kLambdaMass);
-	    
-	    if (mass1 > (kLambdaMass-fCutLambdaV)*(kLambdaMass-fCutLambdaV) && mass1 < (kLambdaMass+fCutLambdaV)*(kLambdaMass+fCutLambdaV))
-	      continue;
-	  }
-	  if (TMath::Abs(mass2 - kLambdaMass*kLambdaMass) < fCutLambdaV * 5)
-	  {
-	    mass2 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
-
-	    fControlConvResoncances->Fill(2, mass2 - kLambdaMass*kLambdaMass);
-
-	    if (mass2 > (kLambdaMass-fCutLambdaV)*(kLambdaMass-fCutLambdaV) && mass2 < (kLambdaMass+fCutLambdaV)*(kLambdaMass+fCutLambdaV))
-	      continue;
-	  }
-	}
-
-        // Phi
-	if (fCutPhiV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.4937, 0.4937);
-	  
-	  const Float_t kPhimass = 1.019;
-	  
-	  if (TMath::Abs(mass - kPhimass*kPhimass) < fCutPhiV * 5)
-	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.4937, 0.4937);
-	    
-	    fControlConvResoncances->Fill(3, mass - kPhimass*kPhimass);
-	    
-	    if (mass > (kPhimass-fCutPhiV)*(kPhimass-fCutPhiV) && mass < (kPhimass+fCutPhiV)*(kPhimass+fCutPhiV))
-	      continue;
-	  }
-	}	
-
-        // Rho
-	if (fCutRhoV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-        {
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
-	  
-	  const Float_t kRhomass = 0.770;
-	  
-	  if (TMath::Abs(mass - kRhomass*kRhomass) < fCutRhoV * 5)
-          {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
-	    
-	    fControlConvResoncances->Fill(4, mass - kRhomass*kRhomass);
-	    
-	    if (mass > (kRhomass-fCutRhoV)*(kRhomass-fCutRhoV) && mass < (kRhomass+fCutRhoV)*(kRhomass+fCutRhoV))
-	      continue;
-	  }
-	}
-
-        // User-defined cut
-	if (fCutCustomMass > 0 && fCutCustomFirst > 0 && fCutCustomSecond > 0 && fCutCustomV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
-        {
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), fCutCustomFirst, fCutCustomSecond);
-	  
-	  if (TMath::Abs(mass - fCutCustomMass*fCutCustomMass) < fCutCustomV * 5)
-          {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), fCutCustomFirst, fCutCustomSecond);
-	    
-	    fControlConvResoncances->Fill(5, mass - fCutCustomMass*fCutCustomMass);
-	    
-	    if (mass > (fCutCustomMass-fCutCustomV)*(fCutCustomMass-fCutCustomV) && mass < (fCutCustomMass+fCutCustomV)*(fCutCustomMass+fCutCustomV))
-	      continue;
-	  }
-	}
-
-	if (twoTrackEfficiencyCut)
-	{
-	  // the variables & cuthave been developed by the HBT group 
-	  // see e.g. https://indico.cern.ch/materialDisplay.py?contribId=36&sessionId=6&materialId=slides&confId=142700
-
-	  Float_t phi1 = triggerParticle->Phi();
-	  Float_t pt1 = triggerParticle->Pt();
-	  Float_t charge1 = triggerParticle->Charge();
-	    
-	  Float_t phi2 = particle->Phi();
-	  Float_t pt2 = particle->Pt();
-	  Float_t charge2 = particle->Charge();
-	      
-	  Float_t deta = triggerEta - eta[j];
-	      
-	  // optimization
-	  if (TMath::Abs(deta) < twoTrackEfficiencyCutValue * 2.5 * 3)
-	  {
-	    // check first boundaries to see if is worth to loop and find the minimum
-	    Float_t dphistar1 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, fTwoTrackCutMinRadius, bSign);
-	    Float_t dphistar2 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, 2.5, bSign);
-	    
-	    const Float_t kLimit = twoTrackEfficiencyCutValue * 3;
-
-	    Float_t dphistarminabs = 1e5;
-	    Float_t dphistarmin = 1e5;
-	    if (TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0)
-	    {
-	      for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01) 
-	      {
-		Float_t dphistar = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, rad, bSign);
-
-		Float_t dphistarabs = TMath::Abs(dphistar);
-		
-		if (dphistarabs < dphistarminabs)
-		{
-		  dphistarmin = dphistar;
-		  dphistarminabs = dphistarabs;
-		}
-	      }
-	      
-	      fTwoTrackDistancePt[0]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
-	      
-	      if (dphistarminabs < twoTrackEfficiencyCutValue && TMath::Abs(deta) < twoTrackEfficiencyCutValue)
-	      {
-// 		Printf("Removed track pair %d %d with %f %f %f %f %f %f %f %f %f", i, j, deta, dphistarminabs, phi1, pt1, charge1, phi2, pt2, charge2, bSign);
-		continue;
-	      }
-
-    	      fTwoTrackDistancePt[1]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
-	    }
-	  }
-	}
-        
-        Double_t vars[6];
-        vars[0] = triggerEta - eta[j];
-        vars[1] = particle->Pt();
-        vars[2] = triggerParticle->Pt();
-        vars[3] = centrality;
-        vars[4] = triggerParticle->Phi() - particle->Phi();
-        if (vars[4] > 1.5 * TMath::Pi()) 
-          vars[4] -= TMath::TwoPi();
-        if (vars[4] < -0.5 * TMath::Pi())
-          vars[4] += TMath::TwoPi();
-	vars[5] = zVtx;
+	if (checkIsEqual && particles->UncheckedAt(i)->IsEqual(associated.fList->UncheckedAt(j)))
+	  continue;
 	
-	if (fillpT)
-	  weight = particle->Pt();
+	if (!PassesPairCuts(triggers, i, associated, j, twoTrackEfficiencyCut, bSign, twoTrackEfficiencyCutValue))
+	  continue;
 	
-	Double_t useWeight = weight;
-	if (applyEfficiency)
-	{
-	  if (fEfficiencyCorrectionAssociated)
-	  {
-	    Int_t effVars[4];
-	    // associated particle
-	    effVars[0] = fEfficiencyCorrectionAssociated->GetAxis(0)->FindBin(eta[j]);
-	    effVars[1] = fEfficiencyCorrectionAssociated->GetAxis(1)->FindBin(vars[1]); //pt
-	    effVars[2] = fEfficiencyCorrectionAssociated->GetAxis(2)->FindBin(vars[3]); //centrality
-	    effVars[3] = fEfficiencyCorrectionAssociated->GetAxis(3)->FindBin(vars[5]); //zVtx
-	    
-	    // 	  Printf("%d %d %d %d %f", effVars[0], effVars[1], effVars[2], effVars[3], fEfficiencyCorrectionAssociated->GetBinContent(effVars));
-	  
-	    useWeight *= fEfficiencyCorrectionAssociated->GetBinContent(effVars);
-	  }
-	  if (fEfficiencyCorrectionTriggers)
-	  {
-	    Int_t effVars[4];
-
-	    effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(triggerEta);
-	    effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(vars[2]); //pt
-	    effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(vars[3]); //centrality
-	    effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin(vars[5]); //zVtx
-	    useWeight *= fEfficiencyCorrectionTriggers->GetBinContent(effVars);
-	  }
-	}
-
+	Double_t useWeight = associated.fWeight[j];
+	if (applyEfficiency && fEfficiencyCorrectionTriggers)
+	  useWeight *= triggerEfficiency;
 	if (fWeightPerEvent)
-	{
-	  Int_t weightBin = triggerWeighting->GetXaxis()->FindBin(vars[2]);
-// 	  Printf("Using weight %f", triggerWeighting->GetBinContent(weightBin));
-	  useWeight /= triggerWeighting->GetBinContent(weightBin);
-	}
-    
-        // fill all in toward region and do not use the other regions
-	fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->Fill(vars, step, useWeight);
+	  useWeight /= triggerWeight;
+	
+	Double_t vars[6];
+	vars[0] = triggerEta - associated.fEta[j];
+	vars[1] = associated.fPt[j];
+	vars[2] = triggers.fPt[i];
+	vars[3] = centrality;
+	vars[4] = triggers.fPhi[i] - associated.fPhi[j];
+	if (vars[4] > 1.5 * TMath::Pi()) 
+	  vars[4] -= TMath::TwoPi();
+	if (vars[4] < -0.5 * TMath::Pi())
+	  vars[4] += TMath::TwoPi();
+	vars[5] = zVtx;
+	
+	trackHist->Fill(vars, step, useWeight);
 
-// 	Printf("%.2f %.2f --> %.2f", triggerEta, eta[j], vars[0]);
+// 	Printf("%.2f %.2f --> %.2f", triggerEta, associated.fEta[j], vars[0]);
       }
  
       if (firstTime)
       {
         // once per trigger particle
         Double_t vars[3];
-        vars[0] = triggerParticle->Pt();
+        vars[0] = triggers.fPt[i];
         vars[1] = centrality;
 	vars[2] = zVtx;
 
 	Double_t useWeight = 1;
 	if (fEfficiencyCorrectionTriggers && applyEfficiency)
-	{
-	  Int_t effVars[4];
-	  
-	  // trigger particle
-	  effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(triggerEta);
-	  effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(vars[0]); //pt
-	  effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(vars[1]); //centrality
-	  effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin(vars[2]); //zVtx
-	  useWeight *= fEfficiencyCorrectionTriggers->GetBinContent(effVars);
-	}
+	  useWeight *= triggerEfficiency;
 
-	if (TMath::Abs(triggerEta) < 0.8 && triggerParticle->Pt() > 0)
-	  fInvYield2->Fill(centrality, triggerParticle->Pt(), useWeight / triggerParticle->Pt());
+	if (TMath::Abs(triggerEta) < 0.8 && triggers.fPt[i] > 0)
+	  fInvYield2->Fill(centrality, triggers.fPt[i], useWeight / triggers.fPt[i]);
 
 	if (fWeightPerEvent)
 	{
 	  // leads effectively to a filling of one entry per filled trigger particle pT bin
-	  Int_t weightBin = triggerWeighting->GetXaxis()->FindBin(vars[0]);
-// 	  Printf("Using weight %f", triggerWeighting->GetBinContent(weightBin));
-	  useWeight /= triggerWeighting->GetBinContent(weightBin);
+	  useWeight /= triggerWeight;
 	}
 	
         fNumberDensityPhi->GetEventHist()->Fill(vars, step, useWeight);
 
 	// QA
-        fCorrelationpT->Fill(centrality, triggerParticle->Pt());
+        fCorrelationpT->Fill(centrality, triggers.fPt[i]);
         fCorrelationEta->Fill(centrality, triggerEta);
-        fCorrelationPhi->Fill(centrality, triggerParticle->Phi());
-	fYields->Fill(centrality, triggerParticle->Pt(), triggerEta);
-	fYieldsEtaPhiPT->Fill(triggerParticle->Pt(), triggerEta, triggerParticle->Phi());
+        fCorrelationPhi->Fill(centrality, triggers.fPhi[i]);
+	fYields->Fill(centrality, triggers.fPt[i], triggerEta);
+	fYieldsEtaPhiPT->Fill(triggers.fPt[i], triggerEta, triggers.fPhi[i]);
 	
 /*        if (dynamic_cast<AliAODTrack*>(triggerParticle))
           fITSClusterMap->Fill(((AliAODTrack*) triggerParticle)->GetITSClusterMap(), centrality, triggerParticle->Pt());*/
@@ -1082,7 +934,288 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
   fCentralityCorrelation->Fill(centrality, particles->GetEntriesFast());
   FillEvent(centrality, step);
 }
+
+//____________________________________________________________________
+Bool_t AliUEHistograms::AcceptTrigger(const AliUEParticleArrays& triggers, Int_t i) const
+{
+  // selections of the trigger particle i which do not depend on the associated particle
+  
+  Float_t triggerEta = triggers.fEta[i];
+
+  if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta) > fTriggerRestrictEta)
+    return kFALSE;
+
+  if (fOnlyOneEtaSide != 0)
+  {
+    if (fOnlyOneEtaSide * triggerEta < 0)
+      return kFALSE;
+  }
+  
+  if (fTriggerSelectCharge != 0)
+    if (triggers.fCharge[i] * fTriggerSelectCharge < 0)
+      return kFALSE;
+  
+  return kTRUE;
+}
+
+//____________________________________________________________________
+Bool_t AliUEHistograms::IsSameParticle(const AliUEParticleArrays& triggers, Int_t i, const AliUEParticleArrays& associated, Int_t j, Bool_t mixed) const
+{
+  // check if both particles point to the same element (does not occur for mixed events, but if subsets are mixed within the same event)
+  
+  if (fCheckEventNumberInCorrelation)
+    return (triggers.fEventIndex[i] == associated.fEventIndex[j]);
+  
+  if (!mixed)
+    return kFALSE;
+  
+  if (triggers.fUniqueIDIsEqual && associated.fUniqueIDIsEqual)
+    return (triggers.fUniqueID[i] == associated.fUniqueID[j]);
+  
+  return triggers.fList->UncheckedAt(i)->IsEqual(associated.fList->UncheckedAt(j));
+}
+
+//____________________________________________________________________
+const UChar_t* AliUEHistograms::FillPairMask(const AliUEParticleArrays& triggers, Int_t i, const AliUEParticleArrays& associated, Bool_t mixed)
+{
+  // evaluates the pair selections which only depend on the arrays for the trigger particle i and all associated particles
+  // the loop has no branches and no calls so that it can be vectorized by the compiler
+  // 1 in the returned mask means that the pair is selected
+  // the IsEqual check of mixed events for other classes than AliBasicParticle and AliCFParticle is not included (see FillCorrelations)
+  
+  const Int_t nAssociated = associated.fN;
+  fCorrelationArrays->fPairMask.resize(nAssociated);
+  UChar_t* mask = fCorrelationArrays->fPairMask.data();
+  
+  const Int_t triggerIndex = (mixed) ? -1 : i;
+  const Double_t triggerPt = triggers.fPt[i];
+  const Float_t triggerEta = triggers.fEta[i];
+  const Int_t triggerCharge = triggers.fCharge[i];
+  const Long64_t triggerEventIndex = (fCheckEventNumberInCorrelation) ? triggers.fEventIndex[i] : 0;
+  const UInt_t triggerUniqueID = triggers.fUniqueID[i];
+  const Bool_t checkUniqueID = (mixed && !fCheckEventNumberInCorrelation && triggers.fUniqueIDIsEqual && associated.fUniqueIDIsEqual);
+  const Bool_t checkEventIndex = fCheckEventNumberInCorrelation;
+  const Bool_t ptOrder = fPtOrder;
+  const Int_t associatedSelectCharge = fAssociatedSelectCharge;
+  const Int_t selectCharge = fSelectCharge;
+  const Int_t onlyOneAssocEtaSide = fOnlyOneAssocEtaSide;
+  const Bool_t etaOrdering = fEtaOrdering;
+  const UChar_t rejectFlags = (fRejectResonanceDaughters > 0) ? AliUEParticleArrays::kResonanceDaughter : 0;
+  
+  const Double_t* pt = associated.fPt.data();
+  const Float_t* eta = associated.fEta.data();
+  const Short_t* charge = associated.fCharge.data();
+  const UChar_t* flags = associated.fFlags.data();
+  const Long64_t* eventIndex = associated.fEventIndex.data();
+  const UInt_t* uniqueID = associated.fUniqueID.data();
+  
+  for (Int_t j=0; j<nAssociated; j++)
+  {
+    const Int_t chargeProduct = charge[j] * triggerCharge;
+    
+    Bool_t reject = (j == triggerIndex);
+    reject |= (checkEventIndex & (eventIndex[j] == triggerEventIndex));
+    reject |= (checkUniqueID & (uniqueID[j] == triggerUniqueID));
+    reject |= (ptOrder & (pt[j] >= triggerPt));
+    reject |= (charge[j] * associatedSelectCharge < 0);
+    // skip like sign / skip unlike sign
+    reject |= ((selectCharge == 1) & (chargeProduct > 0));
+    reject |= ((selectCharge == 2) & (chargeProduct < 0));
+    reject |= (onlyOneAssocEtaSide * eta[j] < 0);
+    reject |= (etaOrdering & (((triggerEta < 0) & (eta[j] < triggerEta)) | ((triggerEta > 0) & (eta[j] > triggerEta))));
+    reject |= ((flags[j] & rejectFlags) != 0);
+    
+    mask[j] = !reject;
+  }
+  
+  return mask;
+}
+
+//____________________________________________________________________
+Bool_t AliUEHistograms::PassesPairCuts(const AliUEParticleArrays& triggers, Int_t i, const AliUEParticleArrays& associated, Int_t j, Bool_t twoTrackEfficiencyCut, Float_t bSign, Float_t twoTrackEfficiencyCutValue)
+{
+  // pair cuts on conversions, resonances and the two-track efficiency, which fill control histograms for the pairs 
+  // close to the cut and are therefore applied to the pairs selected by FillPairMask one by one
+  
+  const Double_t triggerPt = triggers.fPt[i];
+  const Float_t triggerEta = triggers.fEta[i];
+  const Double_t triggerPhi = triggers.fPhi[i];
+  const Double_t pt = associated.fPt[j];
+  const Float_t eta = associated.fEta[j];
+  const Double_t phi = associated.fPhi[j];
+  const Bool_t unlikeSign = (triggers.fCharge[i] * associated.fCharge[j] < 0);
+  
+  // conversions
+  if (fCutConversionsV > 0 && unlikeSign)
+  {
+    Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, pt, eta, phi, 0.510e-3, 0.510e-3);
+    
+    if (mass < fCutConversionsV * 5)
+    {
+      mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, pt, eta, phi, 0.510e-3, 0.510e-3);
+      
+      fControlConvResoncances->Fill(0.0, mass);
+
+      if (mass < fCutConversionsV*fCutConversionsV) 
+	return kFALSE;
+    }
+  }
+  
+  // K0s
+  if (fCutK0sV > 0 && unlikeSign)
+  {
+    Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, pt, eta, phi, 0.1396, 0.1396);
+    
+    const Float_t kK0smass = 0.4976;
+    
+    if (TMath::Abs(mass - kK0smass*kK0smass) < fCutK0sV * 5)
+    {
+      mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, pt, eta, phi, 0.1396, 0.1396);
+      
+      fControlConvResoncances->Fill(1, mass - kK0smass*kK0smass);
+
+      if (mass > (kK0smass-fCutK0sV)*(kK0smass-fCutK0sV) && mass < (kK0smass+fCutK0sV)*(kK0smass+fCutK0sV))
+	return kFALSE;
+    }
+  }
+
+  // Lambda
+  if (fCutLambdaV > 0 && unlikeSign)
+  {
+    Float_t mass1 = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, pt, eta, phi, 0.1396, 0.9383);
+    Float_t mass2 = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, pt, eta, phi, 0.9383, 0.1396);
+    
+    const Float_t kLambdaMass = 1.115;
+
+    if (TMath::Abs(mass1 - kLambdaMass*kLambdaMass) < fCutLambdaV * 5)
+    {
+      mass1 = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, pt, eta, phi, 0.1396, 0.9383);
+
+      fControlConvResoncances->Fill(2, mass1 - kLambdaMass*kLambdaMass);
+      
+      if (mass1 > (kLambdaMass-fCutLambdaV)*(kLambdaMass-fCutLambdaV) && mass1 < (kLambdaMass+fCutLambdaV)*(kLambdaMass+fCutLambdaV))
+	return kFALSE;
+    }
+    if (TMath::Abs(mass2 - kLambdaMass*kLambdaMass) < fCutLambdaV * 5)
+    {
+      mass2 = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, pt, eta, phi, 0.9383, 0.1396);
+
+      fControlConvResoncances->Fill(2, mass2 - kLambdaMass*kLambdaMass);
+
+      if (mass2 > (kLambdaMass-fCutLambdaV)*(kLambdaMass-fCutLambdaV) && mass2 < (kLambdaMass+fCutLambdaV)*(kLambdaMass+fCutLambdaV))
+	return kFALSE;
+    }
+  }
+
+  // Phi
+  if (fCutPhiV > 0 && unlikeSign)
+  {
+    Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, pt, eta, phi, 0.4937, 0.4937);
+    
+    const Float_t kPhimass = 1.019;
+    
+    if (TMath::Abs(mass - kPhimass*kPhimass) < fCutPhiV * 5)
+    {
+      mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, pt, eta, phi, 0.4937, 0.4937);
+      
+      fControlConvResoncances->Fill(3, mass - kPhimass*kPhimass);
+      
+      if (mass > (kPhimass-fCutPhiV)*(kPhimass-fCutPhiV) && mass < (kPhimass+fCutPhiV)*(kPhimass+fCutPhiV))
+	return kFALSE;
+    }
+  }	
+
+  // Rho
+  if (fCutRhoV > 0 && unlikeSign)
+  {
+    Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, pt, eta, phi, 0.1396, 0.1396);
+    
+    const Float_t kRhomass = 0.770;
+    
+    if (TMath::Abs(mass - kRhomass*kRhomass) < fCutRhoV * 5)
+    {
+      mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, pt, eta, phi, 0.1396, 0.1396);
+      
+      fControlConvResoncances->Fill(4, mass - kRhomass*kRhomass);
+      
+      if (mass > (kRhomass-fCutRhoV)*(kRhomass-fCutRhoV) && mass < (kRhomass+fCutRhoV)*(kRhomass+fCutRhoV))
+	return kFALSE;
+    }
+  }
+
+  // User-defined cut
+  if (fCutCustomMass > 0 && fCutCustomFirst > 0 && fCutCustomSecond > 0 && fCutCustomV > 0 && unlikeSign)
+  {
+    Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, pt, eta, phi, fCutCustomFirst, fCutCustomSecond);
+    
+    if (TMath::Abs(mass - fCutCustomMass*fCutCustomMass) < fCutCustomV * 5)
+    {
+      mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, pt, eta, phi, fCutCustomFirst, fCutCustomSecond);
+      
+      fControlConvResoncances->Fill(5, mass - fCutCustomMass*fCutCustomMass);
+      
+      if (mass > (fCutCustomMass-fCutCustomV)*(fCutCustomMass-fCutCustomV) && mass < (fCutCustomMass+fCutCustomV)*(fCutCustomMass+fCutCustomV))
+	return kFALSE;
+    }
+  }
+
+  if (twoTrackEfficiencyCut)
+  {
+    // the variables & cuthave been developed by the HBT group 
+    // see e.g. https://indico.cern.ch/materialDisplay.py?contribId=36&sessionId=6&materialId=slides&confId=142700
+
+    Float_t phi1 = triggerPhi;
+    Float_t pt1 = triggerPt;
+    Float_t charge1 = triggers.fCharge[i];
+      
+    Float_t phi2 = phi;
+    Float_t pt2 = pt;
+    Float_t charge2 = associated.fCharge[j];
+	
+    Float_t deta = triggerEta - eta;
+	
+    // optimization
+    if (TMath::Abs(deta) < twoTrackEfficiencyCutValue * 2.5 * 3)
+    {
+      // check first boundaries to see if is worth to loop and find the minimum
+      Float_t dphistar1 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, fTwoTrackCutMinRadius, bSign);
+      Float_t dphistar2 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, 2.5, bSign);
+      
+      const Float_t kLimit = twoTrackEfficiencyCutValue * 3;
+
+      Float_t dphistarminabs = 1e5;
+      Float_t dphistarmin = 1e5;
+      if (TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0)
+      {
+	for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01) 
+	{
+	  Float_t dphistar = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, rad, bSign);
+
+	  Float_t dphistarabs = TMath::Abs(dphistar);
+	  
+	  if (dphistarabs < dphistarminabs)
+	  {
+	    dphistarmin = dphistar;
+	    dphistarminabs = dphistarabs;
+	  }
+	}
+	
+	fTwoTrackDistancePt[0]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
+	
+	if (dphistarminabs < twoTrackEfficiencyCutValue && TMath::Abs(deta) < twoTrackEfficiencyCutValue)
+	{
+// 	  Printf("Removed track pair %d %d with %f %f %f %f %f %f %f %f %f", i, j, deta, dphistarminabs, phi1, pt1, charge1, phi2, pt2, charge2, bSign);
+	  return kFALSE;
+	}
+
+	fTwoTrackDistancePt[1]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
+      }
+    }
+  }
   
+  return kTRUE;
+}
+
 //____________________________________________________________________
 void AliUEHistograms::FillTrackingEfficiency(TObjArray* mc, TObjArray* recoPrim, TObjArray* recoAll, TObjArray* recoPrimPID, TObjArray* recoAllPID, TObjArray* fake, Int_t particleType, Double_t centrality, Double_t zVtx)
 {
@@ -21,6 +21,8 @@ class TObjArray;
 class TH1F;
 class TH2F;
 class TH3F;
+class AliUEParticleArrays;
+class AliUECorrelationArrays;
 
 class AliUEHistograms : public TNamed
 {
@@ -123,6 +125,10 @@ protected:
   inline Float_t GetInvMassSquared(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   inline Float_t GetInvMassSquaredCheap(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   inline Float_t GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign);
+  Bool_t AcceptTrigger(const AliUEParticleArrays& triggers, Int_t i) const;
+  Bool_t IsSameParticle(const AliUEParticleArrays& triggers, Int_t i, const AliUEParticleArrays& associated, Int_t j, Bool_t mixed) const;
+  const UChar_t* FillPairMask(const AliUEParticleArrays& triggers, Int_t i, const AliUEParticleArrays& associated, Bool_t mixed);
+  Bool_t PassesPairCuts(const AliUEParticleArrays& triggers, Int_t i, const AliUEParticleArrays& associated, Int_t j, Bool_t twoTrackEfficiencyCut, Float_t bSign, Float_t twoTrackEfficiencyCutValue);
   
   static const Int_t fgkUEHists; // number of histograms
 
@@ -182,6 +188,8 @@ protected:
   
   Int_t fMergeCount;		// counts how many objects have been merged together
   
+  AliUECorrelationArrays* fCorrelationArrays; //! particle arrays and pair buffers of FillCorrelations
+  
   ClassDef(AliUEHistograms, 33)  // underlying event histogram container
 };
 
@@ -5,6 +5,7 @@
 #include <TMath.h>
 #include <TComplex.h>
 #include <TClonesArray.h>
+#include <cmath>
 #include "AliJBaseTrack.h"
 #include "AliJFFlucAnalysis.h"
 #include "AliJEfficiency.h"
@@ -396,26 +397,30 @@ AliJFFlucAnalysis::~AliJFFlucAnalysis() {
 
 #define A i
 #define B (1-i)
-#define C(u) TComplex::Conjugate(u)
+#define C(u) std::conj(u)
 //TODO: conjugate macro
-inline TComplex TwoGap(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b){
-	return pQq[A][a][1]*C(pQq[B][b][1]);
+inline TComplex ToTComplex(const std::complex<double> &z){
+	return TComplex(z.real(),z.imag());
 }
 
-inline TComplex ThreeGap(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c){
-	return pQq[A][a][1]*C(pQq[B][b][1]*pQq[B][c][1]-pQq[B][b+c][2]);
+inline TComplex TwoGap(const std::complex<double> (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b){
+	return ToTComplex(pQq[A][a][1]*C(pQq[B][b][1]));
 }
 
-inline TComplex FourGap22(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c, uint d){
-	return pQq[A][a][1]*pQq[A][b][1]*C(pQq[B][c][1]*pQq[B][d][1])-pQq[A][a+b][2]*C(pQq[B][c][1]*pQq[B][d][1])-pQq[A][a][1]*pQq[A][b][1]*C(pQq[B][c+d][2])+pQq[A][a+b][2]*C(pQq[B][c+d][2]);
+inline TComplex ThreeGap(const std::complex<double> (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c){
+	return ToTComplex(pQq[A][a][1]*C(pQq[B][b][1]*pQq[B][c][1]-pQq[B][b+c][2]));
 }
 
-inline TComplex FourGap13(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c, uint d){
-	return pQq[A][a][1]*C(pQq[B][b][1]*pQq[B][c][1]*pQq[B][d][1]-pQq[B][b+c][2]*pQq[B][d][1]-pQq[B][b+d][2]*pQq[B][c][1]-pQq[B][c+d][2]*pQq[B][b][1]+2.0*pQq[B][b+c+d][3]);
+inline TComplex FourGap22(const std::complex<double> (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c, uint d){
+	return ToTComplex(pQq[A][a][1]*pQq[A][b][1]*C(pQq[B][c][1]*pQq[B][d][1])-pQq[A][a+b][2]*C(pQq[B][c][1]*pQq[B][d][1])-pQq[A][a][1]*pQq[A][b][1]*C(pQq[B][c+d][2])+pQq[A][a+b][2]*C(pQq[B][c+d][2]));
 }
 
-inline TComplex SixGap33(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint n1, uint n2, uint n3, uint n4, uint n5, uint n6){
-	return pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])-pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])-pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])-pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])+2.0*pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4+n5+n6][3])-pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])+pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])+pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])+pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])-2.0*pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4+n5+n6][3])-pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])+pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])+pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])+pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])-2.0*pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4+n5+n6][3])-pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])+pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])+pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])+pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])-2.0*pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4+n5+n6][3])+2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])-2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])-2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])-2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])+4.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4+n5+n6][3]);
+inline TComplex FourGap13(const std::complex<double> (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c, uint d){
+	return ToTComplex(pQq[A][a][1]*C(pQq[B][b][1]*pQq[B][c][1]*pQq[B][d][1]-pQq[B][b+c][2]*pQq[B][d][1]-pQq[B][b+d][2]*pQq[B][c][1]-pQq[B][c+d][2]*pQq[B][b][1]+2.0*pQq[B][b+c+d][3]));
+}
+
+inline TComplex SixGap33(const std::complex<double> (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint n1, uint n2, uint n3, uint n4, uint n5, uint n6){
+	return ToTComplex(pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])-pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])-pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])-pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])+2.0*pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4+n5+n6][3])-pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])+pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])+pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])+pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])-2.0*pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4+n5+n6][3])-pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])+pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])+pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])+pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])-2.0*pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4+n5+n6][3])-pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])+pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])+pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])+pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])-2.0*pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4+n5+n6][3])+2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])-2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])-2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])-2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])+4.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4+n5+n6][3]));
 }
 #undef C
 
@@ -462,11 +467,11 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 	CalculateQvectorsQC(fEta_min,fEta_max);
 
 	for(int ih=2; ih<kNH; ih++){
-		fh_cos_n_phi[ih][fCBin]->Fill(QvectorQC[ih][1].Re()/QvectorQC[0][1].Re());
-		fh_sin_n_phi[ih][fCBin]->Fill(QvectorQC[ih][1].Im()/QvectorQC[0][1].Re());
+		fh_cos_n_phi[ih][fCBin]->Fill(QvectorQC[ih][1].real()/QvectorQC[0][1].real());
+		fh_sin_n_phi[ih][fCBin]->Fill(QvectorQC[ih][1].imag()/QvectorQC[0][1].real());
 		//
 		//
-		Double_t psi = QvectorQC[ih][1].Theta();
+		Double_t psi = std::arg(QvectorQC[ih][1]);
 		fh_psi_n[ih][fCBin]->Fill(psi);
 		fh_cos_n_psi_n[ih][fCBin]->Fill(TMath::Cos((Double_t)ih*psi));
 		fh_sin_n_psi_n[ih][fCBin]->Fill(TMath::Sin((Double_t)ih*psi));
@@ -481,7 +486,7 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 	TComplex ncorr[kNH][nKL];
 	TComplex ncorr2[kNH][nKL][kcNH][nKL];
 
-	const TComplex (*pQq)[kNH][nKL] = QvectorQCeta10;
+	const std::complex<double> (*pQq)[kNH][nKL] = QvectorQCeta10;
 
 	for(int i = 0; i < 2; ++i){
 		if((subeventMask & (1<<i)) == 0)
@@ -647,7 +652,7 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 	if(flags & FLUC_EBE_WEIGHTING){
 		event_weight_four = Four(0,0,0,0).Re();
 		event_weight_two = Two(0,0).Re();
-		event_weight_two_eta10 = (QvectorQCeta10[kSubA][0][1]*QvectorQCeta10[kSubB][0][1]).Re();
+		event_weight_two_eta10 = (QvectorQCeta10[kSubA][0][1]*QvectorQCeta10[kSubB][0][1]).real();
 	}
 
 	for(int ih=2; ih < kNH; ih++){
@@ -670,7 +675,7 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 		// fill single vn  with QC without EtaGap as method 2
 		fSingleVn[ih][2] = TMath::Sqrt(sctwo.Re());
 		
-		TComplex sctwo10 = (QvectorQCeta10[kSubA][ih][1]*TComplex::Conjugate(QvectorQCeta10[kSubB][ih][1])) / (QvectorQCeta10[kSubA][0][1]*QvectorQCeta10[kSubB][0][1]).Re();
+		TComplex sctwo10 = ToTComplex((QvectorQCeta10[kSubA][ih][1]*std::conj(QvectorQCeta10[kSubB][ih][1])) / (QvectorQCeta10[kSubA][0][1]*QvectorQCeta10[kSubB][0][1]).real());
 		fh_SC_with_QC_2corr_eta10[ih][fCBin]->Fill( sctwo10.Re(), event_weight_two_eta10 );
 		// fill single vn with QC method with Eta Gap as method 1
 		fSingleVn[ih][1] = TMath::Sqrt(sctwo10.Re());
@@ -877,16 +882,10 @@ TComplex AliJFFlucAnalysis::Get_Qn_pt(Double_t eta1, Double_t eta2, int harmonic
 //________________________________________________________________________
 void AliJFFlucAnalysis::CalculateQvectorsQC(double etamin, double etamax){
 	// calcualte Q-vector for QC method ( no subgroup )
-	//init
-	for(int ih=0; ih<kNH; ih++){
-		for(int ik=0; ik<nKL; ++ik){
-			QvectorQC[ih][ik] = TComplex(0,0);
-			for(int isub=0; isub<2; isub++){
-				QvectorQCeta10[isub][ih][ik] = TComplex(0,0);
-			}
-		}
-	} // for max harmonics
-	//Calculate Q-vector with particle loop
+	// collect the accepted tracks and their weights, the Q-vectors are then summed in AccumulateQvectorsQC
+	fQCTrackPhi.clear();
+	fQCTrackEta.clear();
+	fQCTrackWeight.clear();
 	Long64_t ntracks = fInputList->GetEntriesFast(); // all tracks from Task input
 	for( Long64_t it=0; it<ntracks; it++){
 		AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
@@ -903,7 +902,6 @@ void AliJFFlucAnalysis::CalculateQvectorsQC(double etamin, double etamax){
 			continue;
 		/////////////////////////////////////////////////
 
-		int isub = (int)(eta > 0.0);
 		Double_t phi = itrack->Phi();
 		Double_t pt = itrack->Pt();
 
@@ -923,29 +921,91 @@ void AliJFFlucAnalysis::CalculateQvectorsQC(double etamin, double etamax){
 		}
 		Double_t effCorr = fEfficiency->GetCorrection( pt, fEffFilterBit, fCent);
 
-		for(int ih=0; ih<kNH; ih++){
-			Double_t tf = 1.0;
-			TComplex q[nKL];
-			for(int ik=0; ik<nKL; ik++){
-				q[ik] = TComplex(tf*TMath::Cos(ih*phi),tf*TMath::Sin(ih*phi));
-				QvectorQC[ih][ik] += q[ik];
+		fQCTrackPhi.push_back(phi);
+		fQCTrackEta.push_back(eta);
+		fQCTrackWeight.push_back(1.0/(phi_module_corr*effCorr));
+	} // track loop done.
 
-				//this is for normalized SC ( denominator needs an eta gap )
-				if(TMath::Abs(eta) > etamin)//fQC_eta_gap_half)
-					QvectorQCeta10[isub][ih][ik] += q[ik];
+	AccumulateQvectorsQC(etamin);
+}
+//________________________________________________________________________
+void AliJFFlucAnalysis::AccumulateQvectorsQC(double etamin){
+	// Q_{n,k} = sum_i w_i^k exp(i*n*phi_i) of the collected tracks, for all tracks and
+	// for the two sub-events (eta < 0, eta > 0) with |eta| > etamin (eta gap).
+	// The tracks are processed in blocks of kLanes with independent partial sums per lane,
+	// so that the loops over the lanes vectorise. exp(i*n*phi) is obtained from exp(i*phi)
+	// by the recurrence exp(i*(n+1)*phi) = exp(i*n*phi)*exp(i*phi).
+	enum{kLanes = 8};
+	enum{kAll, kSub0, kSub1, kNSum};
+	double sumRe[kNSum][kNH][nKL][kLanes] = {};
+	double sumIm[kNSum][kNH][nKL][kLanes] = {};
+
+	const UInt_t ntracks = fQCTrackPhi.size();
+	for(UInt_t i0 = 0; i0 < ntracks; i0 += kLanes){
+		double c1[kLanes], s1[kLanes]; // exp(i*phi)
+		double cn[kLanes], sn[kLanes]; // exp(i*n*phi)
+		double wk[nKL][kLanes]; // w^k, 0 for the lanes beyond the last track
+		double msub[2][kLanes]; // 1 if in sub-event
+		for(UInt_t l = 0; l < kLanes; l++){
+			const UInt_t it = i0+l;
+			const bool active = it < ntracks;
+			const double phi = active?fQCTrackPhi[it]:0.0;
+			const double eta = active?fQCTrackEta[it]:0.0;
+			const double w = active?fQCTrackWeight[it]:0.0;
+			c1[l] = std::cos(phi);
+			s1[l] = std::sin(phi);
+			cn[l] = 1.0;
+			sn[l] = 0.0;
+			wk[0][l] = active?1.0:0.0;
+			for(int ik = 1; ik < nKL; ik++)
+				wk[ik][l] = wk[ik-1][l]*w;
+			const bool gap = active && std::abs(eta) > etamin;
+			msub[0][l] = (gap && !(eta > 0.0))?1.0:0.0;
+			msub[1][l] = (gap && eta > 0.0)?1.0:0.0;
+		}
+		for(int ih = 0; ih < kNH; ih++){
+			for(int ik = 0; ik < nKL; ik++){
+				for(UInt_t l = 0; l < kLanes; l++){
+					const double re = wk[ik][l]*cn[l];
+					const double im = wk[ik][l]*sn[l];
+					sumRe[kAll][ih][ik][l] += re;
+					sumIm[kAll][ih][ik][l] += im;
+					sumRe[kSub0][ih][ik][l] += msub[0][l]*re;
+					sumIm[kSub0][ih][ik][l] += msub[0][l]*im;
+					sumRe[kSub1][ih][ik][l] += msub[1][l]*re;
+					sumIm[kSub1][ih][ik][l] += msub[1][l]*im;
+				}
+			}
+			for(UInt_t l = 0; l < kLanes; l++){
+				const double c = cn[l]*c1[l]-sn[l]*s1[l];
+				sn[l] = sn[l]*c1[l]+cn[l]*s1[l];
+				cn[l] = c;
+			}
+		}
+	}
 
-				tf *= 1.0/(phi_module_corr*effCorr);
+	for(int ih = 0; ih < kNH; ih++){
+		for(int ik = 0; ik < nKL; ik++){
+			double re[kNSum] = {}, im[kNSum] = {};
+			for(int isum = 0; isum < kNSum; isum++){
+				for(UInt_t l = 0; l < kLanes; l++){
+					re[isum] += sumRe[isum][ih][ik][l];
+					im[isum] += sumIm[isum][ih][ik][l];
+				}
 			}
+			QvectorQC[ih][ik] = std::complex<double>(re[kAll],im[kAll]);
+			QvectorQCeta10[0][ih][ik] = std::complex<double>(re[kSub0],im[kSub0]);
+			QvectorQCeta10[1][ih][ik] = std::complex<double>(re[kSub1],im[kSub1]);
 		}
-	} // track loop done.
+	}
 }
 //________________________________________________________________________
 TComplex AliJFFlucAnalysis::Q(int n, int p){
 	// Return QvectorQC
 	// Q{-n, p} = Q{n, p}*
 	if(n >= 0)
-		return QvectorQC[n][p];
-	return TComplex::Conjugate(QvectorQC[-n][p]);
+		return ToTComplex(QvectorQC[n][p]);
+	return ToTComplex(std::conj(QvectorQC[-n][p]));
 }
 //________________________________________________________________________
 TComplex AliJFFlucAnalysis::Two(int n1, int n2 ){
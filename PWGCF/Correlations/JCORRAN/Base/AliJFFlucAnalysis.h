@@ -6,6 +6,8 @@
 #include "AliJHistManager.h"
 #include <TComplex.h>
 #include <TF3.h>
+#include <complex>
+#include <vector>
 
 class TClonesArray;
 class AliJEfficiency;
@@ -113,6 +115,7 @@ public:
 	enum{kK0, kK1, kK2, kK3, kK4, nKL}; // order
 #define kcNH kH6 //max second dimension + 1
 private:
+	void AccumulateQvectorsQC(double etamin);
 
 	TClonesArray *fInputList;
 	AliJEfficiency *fEfficiency;
@@ -141,8 +144,11 @@ private:
 	Double_t fQC_eta_cut_max;
 	Double_t fQC_eta_gap_half;
 
-	TComplex QvectorQC[kNH][nKL];
-	TComplex QvectorQCeta10[2][kNH][nKL]; // ksub
+	std::complex<double> QvectorQC[kNH][nKL];
+	std::complex<double> QvectorQCeta10[2][kNH][nKL]; // ksub
+	std::vector<double> fQCTrackPhi;//! // tracks accepted for the QC Q-vectors (structure of arrays)
+	std::vector<double> fQCTrackEta;//!
+	std::vector<double> fQCTrackWeight;//!
 
 	AliJHistManager * fHMG;//!
 
@@ -8,6 +8,7 @@
 #include <AliFemtoDreamHigherPairMath.h>
 #include "TMath.h"
 #include "TDatabasePDG.h"
+#include <cmath>
 static const float piHi = TMath::Pi();
 
 AliFemtoDreamHigherPairMath::AliFemtoDreamHigherPairMath(
@@ -83,6 +84,108 @@ bool AliFemtoDreamHigherPairMath::PassesPairSelection(
   return pass;
 }
 
+bool AliFemtoDreamHigherPairMath::PairSelectionBlock(
+    int iHC, const AliFemtoDreamPartKinematics &kin1, unsigned int iPart1,
+    const AliFemtoDreamPartKinematics &kin2, unsigned int iFirst,
+    unsigned int iLast, float *RelativeK, float *kT, float *mT,
+    unsigned char *pass) {
+  //Batched version of RelativePairMomentum, RelativePairkT, RelativePairmT
+  //and PassesPairSelection for particle iPart1 of kin1 with the partners
+  //[iFirst, iLast) of kin2. The results are stored at index iPart2 - iFirst.
+  //k* is obtained from the invariants instead of boosting the pair,
+  //k*^2 = ((m1^2 - m2^2)^2 / s - q^2) / 4, which agrees with the boost
+  //within float precision. The return value is false, if the close pair
+  //rejection fills histograms or the particles do not carry enough
+  //daughters, in which case PassesPairSelection has to be called per pair.
+  const unsigned int nPairs = iLast - iFirst;
+  const double m1 = kin1.GetMass();
+  const double m2 = kin2.GetMass();
+  const double m1Sq = m1 * m1;
+  const double m2Sq = m2 * m2;
+  const double dmSq = (m1Sq - m2Sq) * (m1Sq - m2Sq);
+  const double averageMassSq = 0.25 * (m1 + m2) * (m1 + m2);
+  const double px1 = kin1.GetPx()[iPart1];
+  const double py1 = kin1.GetPy()[iPart1];
+  const double pz1 = kin1.GetPz()[iPart1];
+  const double e1 = std::sqrt(px1 * px1 + py1 * py1 + pz1 * pz1 + m1Sq);
+  const double *px2 = kin2.GetPx() + iFirst;
+  const double *py2 = kin2.GetPy() + iFirst;
+  const double *pz2 = kin2.GetPz() + iFirst;
+  for (unsigned int iPair = 0; iPair < nPairs; ++iPair) {
+    const double e2 = std::sqrt(
+        px2[iPair] * px2[iPair] + py2[iPair] * py2[iPair]
+            + pz2[iPair] * pz2[iPair] + m2Sq);
+    const double sumX = px1 + px2[iPair];
+    const double sumY = py1 + py2[iPair];
+    const double sumZ = pz1 + pz2[iPair];
+    const double sumE = e1 + e2;
+    const double qX = px1 - px2[iPair];
+    const double qY = py1 - py2[iPair];
+    const double qZ = pz1 - pz2[iPair];
+    const double qE = e1 - e2;
+    const double s = sumE * sumE - sumX * sumX - sumY * sumY - sumZ * sumZ;
+    const double qSq = qE * qE - qX * qX - qY * qY - qZ * qZ;
+    const double kStarSq = 0.25 * (dmSq / s - qSq);
+    const double kTSq = 0.25 * (sumX * sumX + sumY * sumY);
+    RelativeK[iPair] = std::sqrt(kStarSq > 0 ? kStarSq : 0.);
+    kT[iPair] = std::sqrt(kTSq);
+    mT[iPair] = std::sqrt(kTSq + averageMassSq);
+    pass[iPair] = 1;
+  }
+
+  if (fHists->GetEtaPhiPlots()) {
+    return false;
+  }
+  if (!(fRejPairs.at(iHC) && fDoDeltaEtaDeltaPhiCut)) {
+    return true;
+  }
+  const unsigned int nDaug1 = fWhichPairs.at(iHC) / 10;
+  const unsigned int nDaug2 = fWhichPairs.at(iHC) % 10;
+  const unsigned int *firstDaug1 = kin1.GetFirstDaughter();
+  const unsigned int *firstDaug2 = kin2.GetFirstDaughter();
+  if (firstDaug1[iPart1 + 1] - firstDaug1[iPart1] < nDaug1) {
+    return false;
+  }
+  for (unsigned int iPart2 = iFirst; iPart2 < iLast; ++iPart2) {
+    if (firstDaug2[iPart2 + 1] - firstDaug2[iPart2] < nDaug2) {
+      return false;
+    }
+  }
+  const unsigned int nRadMax = AliFemtoDreamPartKinematics::kNRadii;
+  const float twoPi = 2.f * piHi;
+  for (unsigned int iDaug1 = 0; iDaug1 < nDaug1; ++iDaug1) {
+    const unsigned int daug1 = firstDaug1[iPart1] + iDaug1;
+    const float eta1 =
+        (nDaug1 == 1) ? kin1.GetEta()[iPart1] : kin1.GetDaughterEta()[daug1];
+    const float *phiAtRad1 = kin1.GetPhiAtRadius() + daug1 * nRadMax;
+    const unsigned int nRad1 = kin1.GetNRadii()[daug1];
+    for (unsigned int iDaug2 = 0; iDaug2 < nDaug2; ++iDaug2) {
+      for (unsigned int iPair = 0; iPair < nPairs; ++iPair) {
+        const unsigned int daug2 = firstDaug2[iFirst + iPair] + iDaug2;
+        const float eta2 =
+            (nDaug2 == 1) ?
+                kin2.GetEta()[iFirst + iPair] : kin2.GetDaughterEta()[daug2];
+        const float *phiAtRad2 = kin2.GetPhiAtRadius() + daug2 * nRadMax;
+        const unsigned int nRad2 = kin2.GetNRadii()[daug2];
+        const unsigned int size = (nRad1 > nRad2) ? nRad2 : nRad1;
+        float dphiAvg = 0;
+        for (unsigned int iRad = 0; iRad < size; ++iRad) {
+          float dphi = phiAtRad1[iRad] - phiAtRad2[iRad];
+          dphi -= twoPi * std::floor((dphi + piHi) / twoPi);
+          dphiAvg += dphi;
+        }
+        dphiAvg /= (float) size;
+        const float deta = eta1 - eta2;
+        if (dphiAvg * dphiAvg / fDeltaPhiSqMax + deta * deta / fDeltaEtaSqMax
+            < 1.) {
+          pass[iPair] = 0;
+        }
+      }
+    }
+  }
+  return true;
+}
+
 bool AliFemtoDreamHigherPairMath::CommonAncestors(AliFemtoDreamBasePart& part1, AliFemtoDreamBasePart& part2) {
     bool IsCommon = false;
     if(part1.GetMotherID() == part2.GetMotherID()){
@@ -141,7 +244,6 @@ float AliFemtoDreamHigherPairMath::FillSameEvent(int iHC, int Mult, float cent,
   if (PDGPart1 == 0 || PDGPart2 == 0) {
     AliError("Invalid PDG Code");
   }
-  bool fillHists = fWhichPairs.at(iHC);
   TLorentzVector PartOne, PartTwo;
   TVector3 Part1Momentum = part1.GetMomentum();
   TVector3 Part2Momentum = part2.GetMomentum();
@@ -154,6 +256,17 @@ float AliFemtoDreamHigherPairMath::FillSameEvent(int iHC, int Mult, float cent,
                   TDatabasePDG::Instance()->GetParticle(PDGPart2)->Mass());
 
   float RelativeK = RelativePairMomentum(PartOne, PartTwo);
+  return FillSameEvent(iHC, Mult, cent, part1, part2, RelativeK,
+                       RelativePairkT(PartOne, PartTwo),
+                       RelativePairmT(PartOne, PartTwo));
+}
+
+float AliFemtoDreamHigherPairMath::FillSameEvent(int iHC, int Mult, float cent,
+                                                 AliFemtoDreamBasePart &part1,
+                                                 AliFemtoDreamBasePart &part2,
+                                                 float RelativeK, float kT,
+                                                 float mT) {
+  bool fillHists = fWhichPairs.at(iHC);
   fHists->FillSameEventDist(iHC, RelativeK);
   if (fHists->GetDoMultBinning()) {
     fHists->FillSameEventMultDist(iHC, Mult + 1, RelativeK);
@@ -162,29 +275,26 @@ float AliFemtoDreamHigherPairMath::FillSameEvent(int iHC, int Mult, float cent,
     fHists->FillSameEventCentDist(iHC, cent, RelativeK);
   }
   if (fillHists && fHists->GetDokTBinning()) {
-    fHists->FillSameEventkTDist(iHC, RelativePairkT(PartOne, PartTwo),
-                                RelativeK, cent);
+    fHists->FillSameEventkTDist(iHC, kT, RelativeK, cent);
   }
   if (fillHists && fHists->GetDomTBinning()) {
-    fHists->FillSameEventmTDist(iHC, RelativePairmT(PartOne, PartTwo),
-                                RelativeK);
+    fHists->FillSameEventmTDist(iHC, mT, RelativeK);
   }
   if (fillHists && fHists->GetDokTandMultBinning()) {
-    fHists->FillSameEventkTandMultDist(iHC, RelativePairkT(PartOne, PartTwo),
-                                       RelativeK, Mult + 1);
+    fHists->FillSameEventkTandMultDist(iHC, kT, RelativeK, Mult + 1);
   }
   if (fillHists && fHists->GetDomTMultPlots()) {
-    fHists->FillSameEventmTMultDist(iHC, RelativePairmT(PartOne, PartTwo), Mult + 1, 
-				   RelativeK); 
+    fHists->FillSameEventmTMultDist(iHC, mT, Mult + 1, RelativeK);
   }   
   if (fillHists && fHists->GetDoPtQA()) {
-    fHists->FillPtQADist(iHC, RelativeK, Part1Momentum.Pt(),
-                         Part2Momentum.Pt());
-    fHists->FillPtSEOneQADist(iHC, Part1Momentum.Pt(), Mult + 1);
-    fHists->FillPtSETwoQADist(iHC, Part2Momentum.Pt(), Mult + 1);
+    const float Part1Pt = part1.GetMomentum().Pt();
+    const float Part2Pt = part2.GetMomentum().Pt();
+    fHists->FillPtQADist(iHC, RelativeK, Part1Pt, Part2Pt);
+    fHists->FillPtSEOneQADist(iHC, Part1Pt, Mult + 1);
+    fHists->FillPtSETwoQADist(iHC, Part2Pt, Mult + 1);
     
-    fHists->FillKstarPtSEOneQADist(iHC, RelativeK, Part1Momentum.Pt());
-    fHists->FillKstarPtSETwoQADist(iHC, RelativeK, Part2Momentum.Pt());
+    fHists->FillKstarPtSEOneQADist(iHC, RelativeK, Part1Pt);
+    fHists->FillKstarPtSETwoQADist(iHC, RelativeK, Part2Pt);
   }
   if (fillHists && fHists->GetDoAncestorsPlots()) {
     bool isAlabama = CommonAncestors(part1,part2);
@@ -194,7 +304,7 @@ float AliFemtoDreamHigherPairMath::FillSameEvent(int iHC, int Mult, float cent,
 	fHists->FillSameEventMultDistCommon(iHC, Mult + 1, RelativeK);
       }
       if (fHists->GetDomTBinning()) {
-	fHists->FillSameEventmTDistCommon(iHC, RelativePairmT(PartOne, PartTwo), RelativeK);
+	fHists->FillSameEventmTDistCommon(iHC, mT, RelativeK);
       }
     } else {
       fHists->FillSameEventDistNonCommon(iHC, RelativeK);
@@ -202,7 +312,7 @@ float AliFemtoDreamHigherPairMath::FillSameEvent(int iHC, int Mult, float cent,
 	fHists->FillSameEventMultDistNonCommon(iHC, Mult + 1, RelativeK);
       }
       if (fHists->GetDomTBinning()) {
-	fHists->FillSameEventmTDistNonCommon(iHC, RelativePairmT(PartOne, PartTwo), RelativeK);
+	fHists->FillSameEventmTDistNonCommon(iHC, mT, RelativeK);
       }
     }
   }
@@ -233,7 +343,6 @@ float AliFemtoDreamHigherPairMath::FillMixedEvent(
   if (PDGPart1 == 0 || PDGPart2 == 0) {
     AliError("Invalid PDG Code");
   }
-  bool fillHists = fWhichPairs.at(iHC);
   TLorentzVector PartOne, PartTwo;
   TVector3 Part1Momentum = part1.GetMomentum();
   TVector3 Part2Momentum = part2.GetMomentum();
@@ -256,6 +365,17 @@ float AliFemtoDreamHigherPairMath::FillMixedEvent(
     PartTwo.SetPhi(PartTwo.Phi() + fRandom.Uniform(2 * fPi));
   }
   float RelativeK = RelativePairMomentum(PartOne, PartTwo);
+  return FillMixedEvent(iHC, Mult, cent, part1, part2, RelativeK,
+                        RelativePairkT(PartOne, PartTwo),
+                        RelativePairmT(PartOne, PartTwo));
+}
+
+float AliFemtoDreamHigherPairMath::FillMixedEvent(int iHC, int Mult, float cent,
+                                                  AliFemtoDreamBasePart &part1,
+                                                  AliFemtoDreamBasePart &part2,
+                                                  float RelativeK, float kT,
+                                                  float mT) {
+  bool fillHists = fWhichPairs.at(iHC);
   fHists->FillMixedEventDist(iHC, RelativeK);
   if (fHists->GetDoMultBinning()) {
     fHists->FillMixedEventMultDist(iHC, Mult + 1, RelativeK);
@@ -264,27 +384,25 @@ float AliFemtoDreamHigherPairMath::FillMixedEvent(
     fHists->FillMixedEventCentDist(iHC, cent, RelativeK);
   }
   if (fillHists && fHists->GetDokTBinning()) {
-    fHists->FillMixedEventkTDist(iHC, RelativePairkT(PartOne, PartTwo),
-                                 RelativeK, cent);
+    fHists->FillMixedEventkTDist(iHC, kT, RelativeK, cent);
   }
   if (fillHists && fHists->GetDomTBinning()) {
-    fHists->FillMixedEventmTDist(iHC, RelativePairmT(PartOne, PartTwo),
-                                 RelativeK);
+    fHists->FillMixedEventmTDist(iHC, mT, RelativeK);
   }
   if (fillHists && fHists->GetDokTandMultBinning()) {
-    fHists->FillMixedEventkTandMultDist(iHC, RelativePairkT(PartOne, PartTwo),
-                                        RelativeK, Mult + 1);
+    fHists->FillMixedEventkTandMultDist(iHC, kT, RelativeK, Mult + 1);
   }
   if (fillHists && fHists->GetDomTMultPlots()) {
-    fHists->FillMixedEventmTMultDist(iHC, RelativePairmT(PartOne, PartTwo), Mult + 1, 
-				   RelativeK); 
+    fHists->FillMixedEventmTMultDist(iHC, mT, Mult + 1, RelativeK);
   }   
   if (fillHists && fHists->GetDoPtQA()) {
-    fHists->FillPtMEOneQADist(iHC, Part1Momentum.Pt(), Mult + 1);
-    fHists->FillPtMETwoQADist(iHC, Part2Momentum.Pt(), Mult + 1);
+    const float Part1Pt = part1.GetMomentum().Pt();
+    const float Part2Pt = part2.GetMomentum().Pt();
+    fHists->FillPtMEOneQADist(iHC, Part1Pt, Mult + 1);
+    fHists->FillPtMETwoQADist(iHC, Part2Pt, Mult + 1);
     
-    fHists->FillKstarPtMEOneQADist(iHC, RelativeK, Part1Momentum.Pt());
-    fHists->FillKstarPtMETwoQADist(iHC, RelativeK, Part2Momentum.Pt());
+    fHists->FillKstarPtMEOneQADist(iHC, RelativeK, Part1Pt);
+    fHists->FillKstarPtMETwoQADist(iHC, RelativeK, Part2Pt);
   }
   return RelativeK;
 }
@@ -13,6 +13,7 @@
 #include "AliFemtoDreamBasePart.h"
 #include "AliFemtoDreamCollConfig.h"
 #include "AliFemtoDreamCorrHists.h"
+#include "AliFemtoDreamPartContainer.h"
 #include <vector>
 class AliFemtoDreamHigherPairMath {
  public:
@@ -34,10 +35,19 @@ class AliFemtoDreamHigherPairMath {
   bool PassesPairSelection(int iHC, AliFemtoDreamBasePart& part1,
                            AliFemtoDreamBasePart& part2, float RelativeK,
                            bool SEorME, bool Recalculate);
+  bool PairSelectionBlock(int iHC, const AliFemtoDreamPartKinematics &kin1,
+                          unsigned int iPart1,
+                          const AliFemtoDreamPartKinematics &kin2,
+                          unsigned int iFirst, unsigned int iLast,
+                          float *RelativeK, float *kT, float *mT,
+                          unsigned char *pass);
   bool CommonAncestors(AliFemtoDreamBasePart& part1, AliFemtoDreamBasePart& part2);
   void RecalculatePhiStar(AliFemtoDreamBasePart &part);
   float FillSameEvent(int iHC, int Mult, float cent, AliFemtoDreamBasePart& part1,
                       int PDGPart1, AliFemtoDreamBasePart& part2, int PDGPart2);
+  float FillSameEvent(int iHC, int Mult, float cent, AliFemtoDreamBasePart& part1,
+                      AliFemtoDreamBasePart& part2, float RelativeK, float kT,
+                      float mT);
   void MassQA(int iHC, float RelK, AliFemtoDreamBasePart &part1,
               AliFemtoDreamBasePart &part2);
   void MEMassQA(int iHC, float RelK, AliFemtoDreamBasePart &part1,
@@ -55,6 +65,9 @@ class AliFemtoDreamHigherPairMath {
   float FillMixedEvent(int iHC, int Mult, float cent, AliFemtoDreamBasePart& part1,
                        int PDGPart1, AliFemtoDreamBasePart& part2, int PDGPart2,
                        AliFemtoDreamCollConfig::UncorrelatedMode mode);
+  float FillMixedEvent(int iHC, int Mult, float cent, AliFemtoDreamBasePart& part1,
+                       AliFemtoDreamBasePart& part2, float RelativeK, float kT,
+                       float mT);
   void MEMomentumResolution(int iHC, AliFemtoDreamBasePart* part1, int PDGPart1,
                             AliFemtoDreamBasePart* part2, int PDGPart2,
                             float RelativeK);
@@ -70,6 +70,7 @@ void AliFemtoDreamPartCollection::SetEvent(
     itZVtx += bins[0];
     auto itMult = itZVtx->begin();
     itMult += bins[1];
+    itMult->FillEventKinematics(Particles);
     itMult->PairParticlesSE(Particles, fHigherMath, bins[1], cent);
     itMult->PairParticlesME(Particles, fHigherMath, bins[1], cent);
     itMult->SetEvent(Particles);
@@ -96,6 +97,7 @@ void AliFemtoDreamPartCollection::SetEvent(
     itZVtx += bins[0];
     auto itMult = itZVtx->begin();
     itMult += bins[1];
+    itMult->FillEventKinematics(Particles);
     itMult->PairParticlesSE(Particles, fHigherMath, bins[1], cent);
     itMult->PairParticlesME(Particles, fHigherMath, bins[1], cent);
     itMult->SetEvent(Particles);
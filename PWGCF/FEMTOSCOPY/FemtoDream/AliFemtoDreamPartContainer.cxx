@@ -6,18 +6,71 @@
  */
 
 #include <iostream>
+#include <utility>
 #include "AliFemtoDreamPartContainer.h"
 #include "TLorentzVector.h"
 #include "TVector3.h"
+AliFemtoDreamPartKinematics::AliFemtoDreamPartKinematics()
+    : fMass(0),
+      fPx(),
+      fPy(),
+      fPz(),
+      fEta(),
+      fFirstDaughter(),
+      fDaughterEta(),
+      fNRadii(),
+      fPhiAtRadius() {
+}
+
+AliFemtoDreamPartKinematics::~AliFemtoDreamPartKinematics() {
+}
+
+void AliFemtoDreamPartKinematics::Fill(
+    const std::vector<AliFemtoDreamBasePart> &Particles, double Mass) {
+  //the vectors keep their capacity, the buffers are recycled by the
+  //container once the mixing depth is reached
+  fMass = Mass;
+  fPx.clear();
+  fPy.clear();
+  fPz.clear();
+  fEta.clear();
+  fFirstDaughter.assign(1, 0);
+  fDaughterEta.clear();
+  fNRadii.clear();
+  fPhiAtRadius.clear();
+  for (const auto &itPart : Particles) {
+    const TVector3 mom = itPart.GetMomentum();
+    fPx.push_back(mom.X());
+    fPy.push_back(mom.Y());
+    fPz.push_back(mom.Z());
+    const std::vector<float> eta = itPart.GetEta();
+    fEta.push_back(eta.empty() ? 0.f : eta[0]);
+    const std::vector<std::vector<float>> phiAtRad = itPart.GetPhiAtRaidius();
+    for (unsigned int iDaug = 0; iDaug < phiAtRad.size(); ++iDaug) {
+      fDaughterEta.push_back(
+          eta.size() > iDaug + 1 ? eta[iDaug + 1] : fEta.back());
+      const unsigned int nRad =
+          (phiAtRad[iDaug].size() < kNRadii) ? phiAtRad[iDaug].size() : kNRadii;
+      fNRadii.push_back(nRad);
+      for (unsigned int iRad = 0; iRad < kNRadii; ++iRad) {
+        fPhiAtRadius.push_back(iRad < nRad ? phiAtRad[iDaug][iRad] : 0.f);
+      }
+    }
+    fFirstDaughter.push_back(fDaughterEta.size());
+  }
+}
+
 ClassImp(AliFemtoDreamPartContainer)
 AliFemtoDreamPartContainer::AliFemtoDreamPartContainer()
     : fPartBuffer(),
+      fKinematicsBuffer(),
       fMixingDepth(0) {
 
 }
 
 AliFemtoDreamPartContainer::AliFemtoDreamPartContainer(int MixingDepth)
     : fPartBuffer(),
+      fKinematicsBuffer(),
       fMixingDepth(MixingDepth) {
 
 }
@@ -36,6 +89,7 @@ AliFemtoDreamPartContainer& AliFemtoDreamPartContainer::operator=(
 //  }
   this->fMixingDepth = obj.fMixingDepth;
   this->fPartBuffer = obj.fPartBuffer;
+  this->fKinematicsBuffer = obj.fKinematicsBuffer;
   return (*this);
 }
 
@@ -54,6 +108,20 @@ void AliFemtoDreamPartContainer::SetEvent(
   return;
 }
 
+void AliFemtoDreamPartContainer::SetEvent(
+    std::vector<AliFemtoDreamBasePart> &Particles,
+    const AliFemtoDreamPartKinematics &Kinematics) {
+  AliFemtoDreamPartKinematics kinematics;
+  if (!(fKinematicsBuffer.size() < fMixingDepth)) {
+    //recycle the memory of the oldest kinematics record
+    std::swap(kinematics, fKinematicsBuffer.front());
+    fKinematicsBuffer.pop_front();
+  }
+  kinematics = Kinematics;
+  fKinematicsBuffer.push_back(std::move(kinematics));
+  SetEvent(Particles);
+}
+
 void AliFemtoDreamPartContainer::PrintLastEvent() {
   for (std::deque<std::vector<AliFemtoDreamBasePart>>::iterator itEvt =
       fPartBuffer.begin(); itEvt != fPartBuffer.end(); ++itEvt) {
@@ -13,6 +13,66 @@
 
 #include "AliFemtoDreamBasePart.h"
 
+//Slim structure of arrays with the pair kinematics of the particles of one
+//event and one species. It is stored next to the particles in the mixing
+//buffer, such that the pair loops do not need to touch the (heavy) particle
+//objects for the relative momentum and the close pair rejection.
+class AliFemtoDreamPartKinematics {
+ public:
+  AliFemtoDreamPartKinematics();
+  AliFemtoDreamPartKinematics(const AliFemtoDreamPartKinematics &) = default;
+  //moves hand the buffers over, the records are recycled in the mixing buffer
+  AliFemtoDreamPartKinematics(AliFemtoDreamPartKinematics &&) = default;
+  AliFemtoDreamPartKinematics &operator=(const AliFemtoDreamPartKinematics &) = default;
+  AliFemtoDreamPartKinematics &operator=(AliFemtoDreamPartKinematics &&) = default;
+  virtual ~AliFemtoDreamPartKinematics();
+  void Fill(const std::vector<AliFemtoDreamBasePart> &Particles, double Mass);
+  unsigned int GetSize() const {
+    return fPx.size();
+  }
+  double GetMass() const {
+    return fMass;
+  }
+  const double *GetPx() const {
+    return fPx.data();
+  }
+  const double *GetPy() const {
+    return fPy.data();
+  }
+  const double *GetPz() const {
+    return fPz.data();
+  }
+  //eta of the particle itself, used for the pairs of single tracks
+  const float *GetEta() const {
+    return fEta.data();
+  }
+  //first entry of the daughters of particle iPart (n+1 entries)
+  const unsigned int *GetFirstDaughter() const {
+    return fFirstDaughter.data();
+  }
+  //eta of the daughters and their phi* at the kNRadii TPC radii
+  const float *GetDaughterEta() const {
+    return fDaughterEta.data();
+  }
+  const unsigned int *GetNRadii() const {
+    return fNRadii.data();
+  }
+  const float *GetPhiAtRadius() const {
+    return fPhiAtRadius.data();
+  }
+  static const unsigned int kNRadii = 9;
+ private:
+  double fMass;
+  std::vector<double> fPx;
+  std::vector<double> fPy;
+  std::vector<double> fPz;
+  std::vector<float> fEta;
+  std::vector<unsigned int> fFirstDaughter;
+  std::vector<float> fDaughterEta;
+  std::vector<unsigned int> fNRadii;
+  std::vector<float> fPhiAtRadius;
+};
+
 //Class Containing the Particles from previous Events up to a certain mixing
 //depth for one Particle Species and Mult/ZVtx Bin
 //ZVtx bin.
@@ -24,18 +84,26 @@ class AliFemtoDreamPartContainer {
   virtual ~AliFemtoDreamPartContainer();
   void PrintLastEvent();
   void SetEvent(std::vector<AliFemtoDreamBasePart> &Particles);
-  std::deque<std::vector<AliFemtoDreamBasePart>> GetEventBuffer() const {
+  //Also stores a copy of the kinematics of the particles, for the pair loops
+  void SetEvent(std::vector<AliFemtoDreamBasePart> &Particles,
+                const AliFemtoDreamPartKinematics &Kinematics);
+  const std::deque<std::vector<AliFemtoDreamBasePart>> &GetEventBuffer() const {
     return fPartBuffer;
   }
   ;
   std::vector<AliFemtoDreamBasePart> &GetEvent(int Depth);
+  //only for the containers filled with the kinematics
+  const AliFemtoDreamPartKinematics &GetKinematics(int Depth) const {
+    return fKinematicsBuffer[Depth];
+  }
   unsigned int GetMixingDepth() const {
     return fPartBuffer.size();
   }
   ;
  private:
   std::deque<std::vector<AliFemtoDreamBasePart>> fPartBuffer;
-  unsigned int fMixingDepth;ClassDef(AliFemtoDreamPartContainer,2)
+  std::deque<AliFemtoDreamPartKinematics> fKinematicsBuffer;  //!
+  unsigned int fMixingDepth;ClassDef(AliFemtoDreamPartContainer,3)
   ;
 };
 
@@ -9,12 +9,19 @@
 #include "AliFemtoDreamZVtxMultContainer.h"
 #include "TLorentzVector.h"
 #include "TDatabasePDG.h"
+#include "TParticlePDG.h"
 #include "TVector2.h"
 
 ClassImp(AliFemtoDreamPartContainer)
 AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer()
     : fPartContainer(0),
       fPDGParticleSpecies(0),
+      fMasses(0),
+      fEventKinematics(0),
+      fRelativeK(),
+      fkT(),
+      fmT(),
+      fPass(),
       fWhichPairs(){
 }
 
@@ -23,10 +30,21 @@ AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer(
     : fPartContainer(conf->GetNParticles(),
                      AliFemtoDreamPartContainer(conf->GetMixingDepth())),
       fPDGParticleSpecies(conf->GetPDGCodes()),
+      fMasses(),
+      fEventKinematics(conf->GetNParticles()),
+      fRelativeK(),
+      fkT(),
+      fmT(),
+      fPass(),
       fWhichPairs(conf->GetWhichPairs()){
   TDatabasePDG::Instance()->AddParticle("deuteron", "deuteron", 1.8756134,
                                         kTRUE, 0.0, 1, "Nucleus", 1000010020);
   TDatabasePDG::Instance()->AddAntiParticle("anti-deuteron", -1000010020);
+  //the masses are looked up once per species instead of once per pair
+  for (auto itPDG : fPDGParticleSpecies) {
+    TParticlePDG *pdgPart = TDatabasePDG::Instance()->GetParticle(itPDG);
+    fMasses.push_back(pdgPart ? pdgPart->Mass() : 0.);
+  }
 }
 
 AliFemtoDreamZVtxMultContainer::~AliFemtoDreamZVtxMultContainer() {
@@ -47,12 +65,14 @@ void AliFemtoDreamZVtxMultContainer::SetEvent(
       .begin();
   std::vector<AliFemtoDreamPartContainer>::iterator itContainer = fPartContainer
       .begin();
+  auto itKinematics = fEventKinematics.begin();
   while (itContainer != fPartContainer.end()) {
     if (itInput->size() > 0) {
-      itContainer->SetEvent(*itInput);
+      itContainer->SetEvent(*itInput, *itKinematics);
     }
     ++itInput;
     ++itContainer;
+    ++itKinematics;
   }
   //  }
 }
@@ -60,53 +80,53 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesSE(
     std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
     AliFemtoDreamHigherPairMath *HigherMath, int iMult, float cent) {
   int HistCounter = 0;
+  //The pair kinematics and the close pair rejection are evaluated for one
+  //particle against all its partners at once, the particles are only
+  //accessed for the pairs which are filled.
   //First loop over all the different Species
   auto itPDGPar1 = fPDGParticleSpecies.begin();
   for (auto itSpec1 = Particles.begin(); itSpec1 != Particles.end();
       ++itSpec1) {
     auto itPDGPar2 = fPDGParticleSpecies.begin();
     itPDGPar2 += itSpec1 - Particles.begin();
+    const AliFemtoDreamPartKinematics &kin1 = fEventKinematics[itSpec1
+        - Particles.begin()];
     for (auto itSpec2 = itSpec1; itSpec2 != Particles.end(); ++itSpec2) {
+      const AliFemtoDreamPartKinematics &kin2 = fEventKinematics[itSpec2
+          - Particles.begin()];
       HigherMath->FillPairCounterSE(HistCounter, itSpec1->size(),
                                     itSpec2->size());
+      ResizePairBuffers(itSpec2->size());
       //Now loop over the actual Particles and correlate them
-      for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
-          ++itPart1) {
-        AliFemtoDreamBasePart part1 = *itPart1;
-        std::vector<AliFemtoDreamBasePart>::iterator itPart2;
-        if (itSpec1 == itSpec2) {
-          itPart2 = itPart1 + 1;
-        } else {
-          itPart2 = itSpec2->begin();
+      for (unsigned int iPart1 = 0; iPart1 < itSpec1->size(); ++iPart1) {
+        AliFemtoDreamBasePart &part1 = (*itSpec1)[iPart1];
+        const unsigned int iFirst = (itSpec1 == itSpec2) ? iPart1 + 1 : 0;
+        const unsigned int iLast = itSpec2->size();
+        if (iFirst >= iLast) {
+          continue;
         }
-        while (itPart2 != itSpec2->end()) {
-          AliFemtoDreamBasePart part2 = *itPart2;
-          TLorentzVector PartOne, PartTwo;
-          PartOne.SetXYZM(
-              itPart1->GetMomentum().X(), itPart1->GetMomentum().Y(),
-              itPart1->GetMomentum().Z(),
-              TDatabasePDG::Instance()->GetParticle(*itPDGPar1)->Mass());
-          PartTwo.SetXYZM(
-              itPart2->GetMomentum().X(), itPart2->GetMomentum().Y(),
-              itPart2->GetMomentum().Z(),
-              TDatabasePDG::Instance()->GetParticle(*itPDGPar2)->Mass());
-          float RelativeK = HigherMath->RelativePairMomentum(PartOne, PartTwo);
-          if (!HigherMath->PassesPairSelection(HistCounter, *itPart1, *itPart2,
-                                               RelativeK, true, false)) {
-            ++itPart2;
+        const bool selected = HigherMath->PairSelectionBlock(
+            HistCounter, kin1, iPart1, kin2, iFirst, iLast, &fRelativeK[0],
+            &fkT[0], &fmT[0], &fPass[0]);
+        for (unsigned int iPart2 = iFirst; iPart2 < iLast; ++iPart2) {
+          const unsigned int iPair = iPart2 - iFirst;
+          AliFemtoDreamBasePart &part2 = (*itSpec2)[iPart2];
+          if (selected ?
+              !fPass[iPair] :
+              !HigherMath->PassesPairSelection(HistCounter, part1, part2,
+                                               fRelativeK[iPair], true,
+                                               false)) {
             continue;
           }
-          RelativeK = HigherMath->FillSameEvent(HistCounter, iMult, cent,
-                                                part1,
-                                                *itPDGPar1,
-                                                part2,
-                                                *itPDGPar2);
-          HigherMath->MassQA(HistCounter, RelativeK, *itPart1, *itPart2);
-          HigherMath->SEDetaDPhiPlots(HistCounter, *itPart1, *itPDGPar1,
-                                      *itPart2, *itPDGPar2, RelativeK, false);
-          HigherMath->SEMomentumResolution(HistCounter, &(*itPart1), *itPDGPar1,
-                                           &(*itPart2), *itPDGPar2, RelativeK);
-          ++itPart2;
+          float RelativeK = HigherMath->FillSameEvent(HistCounter, iMult,
+                                                      cent, part1, part2,
+                                                      fRelativeK[iPair],
+                                                      fkT[iPair], fmT[iPair]);
+          HigherMath->MassQA(HistCounter, RelativeK, part1, part2);
+          HigherMath->SEDetaDPhiPlots(HistCounter, part1, *itPDGPar1, part2,
+                                      *itPDGPar2, RelativeK, false);
+          HigherMath->SEMomentumResolution(HistCounter, &part1, *itPDGPar1,
+                                           &part2, *itPDGPar2, RelativeK);
         }
       }
       ++HistCounter;
@@ -121,12 +141,17 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
     AliFemtoDreamHigherPairMath *HigherMath, int iMult, float cent) {
   int HistCounter = 0;
   auto itPDGPar1 = fPDGParticleSpecies.begin();
+  //The kinematics of the current event are filled once per event (see
+  //FillEventKinematics), the ones of the previous events are stored in the
+  //mixing buffer. The particles of the buffer are accessed by reference and
+  //only for pairs which are filled.
   //First loop over all the different Species
   for (auto itSpec1 = Particles.begin(); itSpec1 != Particles.end();
       ++itSpec1) {
     //We dont want to correlate the particles twice. Mixed Event Dist. of
     //Particle1 + Particle2 == Particle2 + Particle 1
     int SkipPart = itSpec1 - Particles.begin();
+    const AliFemtoDreamPartKinematics &kin1 = fEventKinematics[SkipPart];
     auto itPDGPar2 = fPDGParticleSpecies.begin() + SkipPart;
     for (auto itSpec2 = fPartContainer.begin() + SkipPart;
         itSpec2 != fPartContainer.end(); ++itSpec2) {
@@ -135,39 +160,40 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
                                              (int) itSpec2->GetMixingDepth());
       }
       for (int iDepth = 0; iDepth < (int) itSpec2->GetMixingDepth(); ++iDepth) {
-        std::vector<AliFemtoDreamBasePart> ParticlesOfEvent = itSpec2->GetEvent(
+        std::vector<AliFemtoDreamBasePart> &ParticlesOfEvent = itSpec2->GetEvent(
+            iDepth);
+        const AliFemtoDreamPartKinematics &kin2 = itSpec2->GetKinematics(
             iDepth);
+        const unsigned int nPart2 = kin2.GetSize();
         HigherMath->FillPairCounterME(HistCounter, itSpec1->size(),
                                       ParticlesOfEvent.size());
-        for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
-            ++itPart1) {
-          for (auto itPart2 = ParticlesOfEvent.begin();
-              itPart2 != ParticlesOfEvent.end(); ++itPart2) {
-
-            TLorentzVector PartOne, PartTwo;
-            PartOne.SetXYZM(
-                itPart1->GetMomentum().X(), itPart1->GetMomentum().Y(),
-                itPart1->GetMomentum().Z(),
-                TDatabasePDG::Instance()->GetParticle(*itPDGPar1)->Mass());
-            PartTwo.SetXYZM(
-                itPart2->GetMomentum().X(), itPart2->GetMomentum().Y(),
-                itPart2->GetMomentum().Z(),
-                TDatabasePDG::Instance()->GetParticle(*itPDGPar2)->Mass());
-            float RelativeK = HigherMath->RelativePairMomentum(PartOne, PartTwo);
-            if (!HigherMath->PassesPairSelection(HistCounter, *itPart1, *itPart2,
-                                                 RelativeK, false, false)) {
+        if (nPart2 == 0) {
+          continue;
+        }
+        ResizePairBuffers(nPart2);
+        for (unsigned int iPart1 = 0; iPart1 < itSpec1->size(); ++iPart1) {
+          AliFemtoDreamBasePart &part1 = (*itSpec1)[iPart1];
+          const bool selected = HigherMath->PairSelectionBlock(
+              HistCounter, kin1, iPart1, kin2, 0, nPart2, &fRelativeK[0],
+              &fkT[0], &fmT[0], &fPass[0]);
+          for (unsigned int iPart2 = 0; iPart2 < nPart2; ++iPart2) {
+            AliFemtoDreamBasePart &part2 = ParticlesOfEvent[iPart2];
+            if (selected ?
+                !fPass[iPart2] :
+                !HigherMath->PassesPairSelection(HistCounter, part1, part2,
+                                                 fRelativeK[iPart2], false,
+                                                 false)) {
               continue;
             }
-            RelativeK = HigherMath->FillMixedEvent(
-                HistCounter, iMult, cent, *itPart1, *itPDGPar1,
-                *itPart2, *itPDGPar2,
-                AliFemtoDreamCollConfig::kNone);
-			
-			HigherMath->MEMassQA(HistCounter, RelativeK, *itPart1, *itPart2);
-            HigherMath->MEDetaDPhiPlots(HistCounter, *itPart1, *itPDGPar1,
-                                        *itPart2, *itPDGPar2, RelativeK, false);
-            HigherMath->MEMomentumResolution(HistCounter, &(*itPart1),
-                                             *itPDGPar1, &(*itPart2),
+            float RelativeK = HigherMath->FillMixedEvent(
+                HistCounter, iMult, cent, part1, part2, fRelativeK[iPart2],
+                fkT[iPart2], fmT[iPart2]);
+
+            HigherMath->MEMassQA(HistCounter, RelativeK, part1, part2);
+            HigherMath->MEDetaDPhiPlots(HistCounter, part1, *itPDGPar1,
+                                        part2, *itPDGPar2, RelativeK, false);
+            HigherMath->MEMomentumResolution(HistCounter, &part1,
+                                             *itPDGPar1, &part2,
                                              *itPDGPar2, RelativeK);
           }
         }
@@ -178,3 +204,19 @@ void AliFemtoDreamZVtxMultContainer::PairParticlesME(
     ++itPDGPar1;
   }
 }
+
+void AliFemtoDreamZVtxMultContainer::FillEventKinematics(
+    std::vector<std::vector<AliFemtoDreamBasePart>> &Particles) {
+  for (unsigned int iSpec = 0; iSpec < Particles.size(); ++iSpec) {
+    fEventKinematics[iSpec].Fill(Particles[iSpec], fMasses[iSpec]);
+  }
+}
+
+void AliFemtoDreamZVtxMultContainer::ResizePairBuffers(unsigned int nPairs) {
+  if (fPass.size() < nPairs) {
+    fRelativeK.resize(nPairs);
+    fkT.resize(nPairs);
+    fmT.resize(nPairs);
+    fPass.resize(nPairs);
+  }
+}
@@ -22,6 +22,10 @@ class AliFemtoDreamZVtxMultContainer {
   AliFemtoDreamZVtxMultContainer();
   AliFemtoDreamZVtxMultContainer(AliFemtoDreamCollConfig *conf);
   virtual ~AliFemtoDreamZVtxMultContainer();
+  //Kinematics of the particles of the current event, to be filled once per
+  //event before PairParticlesSE, PairParticlesME and SetEvent
+  void FillEventKinematics(
+      std::vector<std::vector<AliFemtoDreamBasePart>> &Particles);
   void PairParticlesSE(
       std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
       AliFemtoDreamHigherPairMath *HigherMath, int iMult, float cent);
@@ -41,8 +45,15 @@ class AliFemtoDreamZVtxMultContainer {
   }
   ;
  private:
+  void ResizePairBuffers(unsigned int nPairs);
   std::vector<AliFemtoDreamPartContainer> fPartContainer;
   std::vector<int> fPDGParticleSpecies;
+  std::vector<double> fMasses;  //! PDG mass of each species
+  std::vector<AliFemtoDreamPartKinematics> fEventKinematics;  //! kinematics of the current event
+  std::vector<float> fRelativeK;    //! k* of the pairs of one particle
+  std::vector<float> fkT;           //! kT of the pairs of one particle
+  std::vector<float> fmT;           //! mT of the pairs of one particle
+  std::vector<unsigned char> fPass; //! pair selection of the pairs of one particle
   std::vector<unsigned int> fWhichPairs;
 //  std::vector<bool> fRejPairs;
 //  bool fDoDeltaEtaDeltaPhiCut;
@@ -50,7 +61,7 @@ class AliFemtoDreamZVtxMultContainer {
 //  float fDeltaPhiMax;
 //  float fDeltaPhiEtaMax;
 
-ClassDef(AliFemtoDreamZVtxMultContainer, 4)
+ClassDef(AliFemtoDreamZVtxMultContainer, 6)
   ;
 };
 
@@ -375,7 +375,7 @@ void AliAnalysisTaskGFWFlow::UserExec(Option_t*) {
     };
     Bool_t filled;
     for(Int_t l_ind=0; l_ind<corrconfigs.size(); l_ind++) {
-      filled = FillFCs(corrconfigs.at(l_ind),l_Cent,0);//,DisableOL);
+      filled = FillFCs(corrconfigs.at(l_ind),fFCIndices.at(l_ind),l_Cent,0);//,DisableOL);
     };
     PostData(1,fFC);
     PostData(2,fMultiDist);
@@ -505,7 +505,7 @@ void AliAnalysisTaskGFWFlow::UserExec(Option_t*) {
     Double_t rndmn=rndm.Rndm();
     Bool_t filled;
     for(Int_t l_ind=0; l_ind<corrconfigs.size(); l_ind++) {
-      filled = FillFCs(corrconfigs.at(l_ind),cent,rndmn);//,DisableOL);
+      filled = FillFCs(corrconfigs.at(l_ind),fFCIndices.at(l_ind),cent,rndmn);//,DisableOL);
     };
     PostData(1,fFC);
     PostData(2,fMultiDist);
@@ -698,14 +698,14 @@ Bool_t AliAnalysisTaskGFWFlow::FillFCs(TString head, TString hn, Double_t cent,
   };
   return kTRUE;
 };
-Bool_t AliAnalysisTaskGFWFlow::FillFCs(AliGFW::CorrConfig corconf, Double_t cent, Double_t rndmn, Bool_t DisableOverlap) {
+Bool_t AliAnalysisTaskGFWFlow::FillFCs(AliGFW::CorrConfig corconf, const vector<Int_t> &fcIndices, Double_t cent, Double_t rndmn, Bool_t DisableOverlap) {
   Double_t dnx, val;
   dnx = fGFW->Calculate(corconf,0,kTRUE).Re();
   if(dnx==0) return kFALSE;
   if(!corconf.pTDif) {
     val = fGFW->Calculate(corconf,0,kFALSE).Re()/dnx;
     if(TMath::Abs(val)<1)
-      fFC->FillProfile(corconf.Head.Data(),cent,val,dnx,rndmn);
+      fFC->FillProfile(fcIndices[0],cent,val,dnx,rndmn);
     return kTRUE;
   };
   /*Int_t binDisableOLFrom = fPtAxis->GetNbins()+1;
@@ -718,7 +718,7 @@ Bool_t AliAnalysisTaskGFWFlow::FillFCs(AliGFW::CorrConfig corconf, Double_t cent
     if(dnx==0) continue;
     val = fGFW->Calculate(corconf,i-1,kFALSE,NeedToDisable).Re()/dnx;
     if(TMath::Abs(val)<1)
-      fFC->FillProfile(Form("%s_pt_%i",corconf.Head.Data(),i),cent,val,dnx,rndmn);
+      fFC->FillProfile(fcIndices[i],cent,val,dnx,rndmn);
   };
   return kTRUE;
 };
@@ -796,5 +796,13 @@ void AliAnalysisTaskGFWFlow::CreateCorrConfigs() {
   corrconfigs.push_back(GetConf("MidGapNV52","poiGapNeg refGapNeg | olGapNeg {5} refGapPos {-5}", kTRUE));
   corrconfigs.push_back(GetConf("MidGapPV52","refGapPos {5} refGapNeg {-5}", kFALSE));
   corrconfigs.push_back(GetConf("MidGapPV52","poiGapPos refGapPos | olGapPos {5} refGapNeg {-5}", kTRUE));
-
+  //Resolve the profile indices once, such that the profiles are not looked up by name per event
+  fFCIndices.clear();
+  for(Int_t l_ind=0; l_ind<corrconfigs.size(); l_ind++) {
+    vector<Int_t> l_indices(1,fFC->GetProfileIndex(corrconfigs[l_ind].Head.Data()));
+    if(corrconfigs[l_ind].pTDif)
+      for(Int_t i=1;i<=fPtAxis->GetNbins();i++)
+        l_indices.push_back(fFC->GetProfileIndex(Form("%s_pt_%i",corrconfigs[l_ind].Head.Data(),i)));
+    fFCIndices.push_back(l_indices);
+  };
 }
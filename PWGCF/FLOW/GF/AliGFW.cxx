@@ -105,14 +105,16 @@ TComplex AliGFW::TwoRec(Int_t n1, Int_t n2, Int_t p1, Int_t p2, Int_t ptbin, Ali
   TComplex formula = part1*part2-part3;
   return formula;
 };
-TComplex AliGFW::RecursiveCorr(AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGFWCumulant *qol, Int_t ptbin, vector<Int_t> hars, vector<Int_t> pows) {
+TComplex AliGFW::RecursiveCorr(AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGFWCumulant *qol, Int_t ptbin, const vector<Int_t> &inhars, const vector<Int_t> &inpows) {
+  vector<Int_t> pows = inpows;
   if(pows.size()==0) //if powers are not initialized, initialize them to 1
-    for(Int_t i=0; i<(Int_t)hars.size(); i++)
+    for(Int_t i=0; i<(Int_t)inhars.size(); i++)
       pows.push_back(1);
   if((pows.at(0)!=1) && qol) qpoi=qol; //if the power of POI is not unity, then always use overlap (if defined).
   //Only valid for 1 particle of interest though!
-  if(hars.size()<2) return qpoi->Vec(hars.at(0),pows.at(0),ptbin);
-  if(hars.size()<3) return TwoRec(hars.at(0), hars.at(1),pows.at(0),pows.at(1), ptbin, qpoi, qref, qol);
+  if(inhars.size()<2) return qpoi->Vec(inhars.at(0),pows.at(0),ptbin);
+  if(inhars.size()<3) return TwoRec(inhars.at(0), inhars.at(1),pows.at(0),pows.at(1), ptbin, qpoi, qref, qol);
+  vector<Int_t> hars = inhars;
   Int_t harlast=hars.at(hars.size()-1);
   Int_t powlast=pows.at(pows.size()-1);
   hars.erase(hars.end()-1);
@@ -153,8 +155,6 @@ TComplex AliGFW::Calculate(TString config, Bool_t SetHarmsToZero) {
     };*/
     TComplex val=CalculateSingle(tmp);
     ret*=val;
-    fCalculatedQs.push_back(val);
-    fCalculatedNames.push_back(tmp);
   };
   return ret;
 };
@@ -260,6 +260,7 @@ AliGFW::CorrConfig AliGFW::GetCorrelatorConfig(TString config, TString head, Boo
   };
   ReturnConfig.Head = head;
   ReturnConfig.pTDif = ptdif;
+  Compile(ReturnConfig);
   return ReturnConfig;
 };
 
@@ -269,7 +270,17 @@ TComplex AliGFW::Calculate(Int_t poi, Int_t ref, vector<Int_t> hars, Int_t ptbin
   AliGFWCumulant *qovl = qpoi;
   return RecursiveCorr(qpoi, qref, qovl, ptbin, hars);
 };
-TComplex AliGFW::Calculate(CorrConfig corconf, Int_t ptbin, Bool_t SetHarmsToZero, Bool_t DisableOverlap) {
+TComplex AliGFW::Calculate(const CorrConfig &corconf, Int_t ptbin, Bool_t SetHarmsToZero, Bool_t DisableOverlap) {
+  if(corconf.Index>-1 && corconf.Index<(Int_t)fCompiled.size()) {
+    //Compiled correlator: no parsing and no allocation
+    const CompiledCorrConfig &lCompiled = fCompiled[corconf.Index];
+    if(!fCumulants.at(lCompiled.Poi).IsPtBinFilled(ptbin)) return TComplex(0,0);
+    Int_t lVariant = 2*(SetHarmsToZero?1:0) + (DisableOverlap?1:0);
+    TComplex retval = EvaluatePlan(lCompiled.Plans[lVariant], ptbin);
+    if(lCompiled.Plans2[lVariant].Steps.size()==0) return retval;
+    retval*=EvaluatePlan(lCompiled.Plans2[lVariant], 0);
+    return retval;
+  };
   if(corconf.Regs.size()==0) return TComplex(0,0);
   Int_t poi = corconf.Regs.at(0);
   Int_t ref = (corconf.Regs.size()>1)?corconf.Regs.at(1):corconf.Regs.at(0);
@@ -281,8 +292,9 @@ TComplex AliGFW::Calculate(CorrConfig corconf, Int_t ptbin, Bool_t SetHarmsToZer
   else if(ref==poi) qovl = qref; //If ref and poi are the same, then the same is for overlap. Only, when OL not explicitly defined
   if(!qpoi->IsPtBinFilled(ptbin)) return TComplex(0,0);
   //if(!qref->IsPtBinFilled(ptbin)) return TComplex(0,0);
-  if(SetHarmsToZero) for(Int_t i=0;i<(Int_t)corconf.Hars.size();i++) corconf.Hars.at(i) = 0;
-  TComplex retval = RecursiveCorr(qpoi, qref, qovl, ptbin, corconf.Hars);
+  vector<Int_t> hars = corconf.Hars;
+  if(SetHarmsToZero) for(Int_t i=0;i<(Int_t)hars.size();i++) hars.at(i) = 0;
+  TComplex retval = RecursiveCorr(qpoi, qref, qovl, ptbin, hars);
   if(corconf.Regs2.size()==0) return retval;
   poi = corconf.Regs2.at(0);
   ref = (corconf.Regs2.size()>1)?corconf.Regs2.at(1):corconf.Regs2.at(0);
@@ -291,11 +303,119 @@ TComplex AliGFW::Calculate(CorrConfig corconf, Int_t ptbin, Bool_t SetHarmsToZer
   if(corconf.Overlap2 > -1)
     qovl = DisableOverlap?0:(&fCumulants.at(corconf.Overlap2));//;DisableOverlap?0:qpoi;
   else if(ref==poi) qovl = qref; //Only when OL is not explicitly defined, then set it to ref/POI if they are the same
-  if(SetHarmsToZero) for(Int_t i=0;i<(Int_t)corconf.Hars2.size();i++) corconf.Hars2.at(i) = 0;
-  retval*=RecursiveCorr(qpoi, qref, qovl, 0, corconf.Hars2);
+  hars = corconf.Hars2;
+  if(SetHarmsToZero) for(Int_t i=0;i<(Int_t)hars.size();i++) hars.at(i) = 0;
+  retval*=RecursiveCorr(qpoi, qref, qovl, 0, hars);
   return retval;
 };
 
+Int_t AliGFW::Compile(CorrConfig &corconf) {
+  //Translates the correlator into flat recursion plans (one for each combination
+  //of SetHarmsToZero and DisableOverlap), such that Calculate does not need to
+  //go through the recursion. Common sub-terms of the recursion are evaluated once.
+  corconf.Index=-1;
+  if(corconf.Regs.size()==0 || corconf.Hars.size()==0) return -1;
+  if(corconf.Regs2.size()>0 && corconf.Hars2.size()==0) return -1;
+  CompiledCorrConfig lCompiled;
+  lCompiled.Poi = corconf.Regs.at(0);
+  Int_t lMaxSteps = fPlanValues.size();
+  for(Int_t lVariant=0; lVariant<4; lVariant++) {
+    Bool_t SetHarmsToZero = lVariant/2;
+    Bool_t DisableOverlap = lVariant%2;
+    vector<Int_t> hars = corconf.Hars;
+    if(SetHarmsToZero) for(Int_t i=0;i<(Int_t)hars.size();i++) hars.at(i) = 0;
+    Int_t lOverlap=-1;
+    CompileTerm(lCompiled.Plans[lVariant], corconf.Regs, corconf.Overlap1, hars, DisableOverlap, lOverlap);
+    lMaxSteps = TMath::Max(lMaxSteps,(Int_t)lCompiled.Plans[lVariant].Steps.size());
+    if(corconf.Regs2.size()==0) continue;
+    hars = corconf.Hars2;
+    if(SetHarmsToZero) for(Int_t i=0;i<(Int_t)hars.size();i++) hars.at(i) = 0;
+    CompileTerm(lCompiled.Plans2[lVariant], corconf.Regs2, corconf.Overlap2, hars, DisableOverlap, lOverlap);
+    lMaxSteps = TMath::Max(lMaxSteps,(Int_t)lCompiled.Plans2[lVariant].Steps.size());
+  };
+  fCompiled.push_back(lCompiled);
+  fPlanValues.resize(lMaxSteps);
+  corconf.Index = fCompiled.size()-1;
+  return corconf.Index;
+};
+void AliGFW::CompileTerm(CorrPlan &plan, const vector<Int_t> &regs, Int_t overlap, vector<Int_t> hars, Bool_t DisableOverlap, Int_t &ol) {
+  //Same choice of the regions as in Calculate(CorrConfig...). If the overlap is not defined, it is kept from the previous term
+  Int_t poi = regs.at(0);
+  Int_t ref = (regs.size()>1)?regs.at(1):regs.at(0);
+  if(overlap > -1)
+    ol = DisableOverlap?-1:overlap;
+  else if(ref==poi) ol = ref;
+  std::map<vector<Int_t>,Int_t> cache;
+  CompileRecursion(plan, cache, poi, ref, ol, hars, vector<Int_t>{});
+};
+Int_t AliGFW::CompileRecursion(CorrPlan &plan, std::map<vector<Int_t>,Int_t> &cache, Int_t poi, Int_t ref, Int_t ol, vector<Int_t> hars, vector<Int_t> pows) {
+  //Mirrors RecursiveCorr, but adds the steps to the plan instead of evaluating them
+  if(pows.size()==0)
+    for(Int_t i=0; i<(Int_t)hars.size(); i++)
+      pows.push_back(1);
+  if((pows.at(0)!=1) && ol>-1) poi=ol;
+  vector<Int_t> key {0, poi};
+  key.insert(key.end(), hars.begin(), hars.end());
+  key.insert(key.end(), pows.begin(), pows.end());
+  auto lCached = cache.find(key);
+  if(lCached!=cache.end()) return lCached->second;
+  if(hars.size()<2) {
+    Int_t lIndex = CompileLoad(plan, cache, poi, hars.at(0), pows.at(0), kTRUE);
+    cache[key] = lIndex;
+    return lIndex;
+  };
+  PlanStep lStep {-1, 0, 0, kFALSE, -1, -1, 0, 0};
+  vector<Int_t> lSubs;
+  if(hars.size()<3) {
+    lStep.A = CompileLoad(plan, cache, poi, hars.at(0), pows.at(0), kTRUE);
+    lStep.B = CompileLoad(plan, cache, ref, hars.at(1), pows.at(1), kTRUE);
+    if(ol>-1) lSubs.push_back(CompileLoad(plan, cache, ol, hars.at(0)+hars.at(1), pows.at(0)+pows.at(1), kTRUE));
+  } else {
+    Int_t harlast=hars.at(hars.size()-1);
+    Int_t powlast=pows.at(pows.size()-1);
+    hars.erase(hars.end()-1);
+    pows.erase(pows.end()-1);
+    lStep.A = CompileRecursion(plan, cache, poi, ref, ol, hars, pows);
+    lStep.B = CompileLoad(plan, cache, ref, harlast, powlast, kFALSE);
+    for(Int_t i=0;i<(Int_t)hars.size();i++) {
+      vector<Int_t> lhars = hars;
+      vector<Int_t> lpows = pows;
+      lhars.at(i)+=harlast;
+      lpows.at(i)+=powlast;
+      lSubs.push_back(CompileRecursion(plan, cache, poi, ref, ol, lhars, lpows));
+    };
+  };
+  lStep.FirstSub = plan.Subs.size();
+  lStep.NSub = lSubs.size();
+  plan.Subs.insert(plan.Subs.end(), lSubs.begin(), lSubs.end());
+  plan.Steps.push_back(lStep);
+  Int_t lIndex = plan.Steps.size()-1;
+  cache[key] = lIndex;
+  return lIndex;
+};
+Int_t AliGFW::CompileLoad(CorrPlan &plan, std::map<vector<Int_t>,Int_t> &cache, Int_t cumulant, Int_t har, Int_t pow, Bool_t ptdif) {
+  vector<Int_t> key {1, cumulant, har, pow, ptdif?1:0};
+  auto lCached = cache.find(key);
+  if(lCached!=cache.end()) return lCached->second;
+  PlanStep lStep {cumulant, har, pow, ptdif, -1, -1, 0, 0};
+  plan.Steps.push_back(lStep);
+  Int_t lIndex = plan.Steps.size()-1;
+  cache[key] = lIndex;
+  return lIndex;
+};
+TComplex AliGFW::EvaluatePlan(const CorrPlan &plan, Int_t ptbin) {
+  for(Int_t i=0;i<(Int_t)plan.Steps.size();i++) {
+    const PlanStep &lStep = plan.Steps[i];
+    if(lStep.Cumulant>-1) {
+      fPlanValues[i] = fCumulants[lStep.Cumulant].Vec(lStep.Har, lStep.Pow, lStep.PtDif?ptbin:0);
+      continue;
+    };
+    TComplex lValue = fPlanValues[lStep.A]*fPlanValues[lStep.B];
+    for(Int_t j=0;j<lStep.NSub;j++) lValue-=fPlanValues[plan.Subs[lStep.FirstSub+j]];
+    fPlanValues[i] = lValue;
+  };
+  return fPlanValues[plan.Steps.size()-1];
+};
 TComplex AliGFW::Calculate(Int_t poi, vector<Int_t> hars) {
   AliGFWCumulant *qpoi = &fCumulants.at(poi);
   return RecursiveCorr(qpoi, qpoi, qpoi, 0, hars);
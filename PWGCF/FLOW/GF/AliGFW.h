@@ -8,6 +8,7 @@ Extention of Generic Flow (https://arxiv.org/abs/1312.3572)
 #include <vector>
 #include <utility>
 #include <algorithm>
+#include <map>
 #include "TString.h"
 #include "TObjArray.h"
 using std::vector;
@@ -46,6 +47,26 @@ class AliGFW {
     Int_t Overlap2=-1;
     Bool_t pTDif=kFALSE;
     TString Head="";
+    Int_t Index=-1; //Index of the compiled plan, -1 if not compiled
+  };
+  //Flat recursion plan of one correlator term. Each step either loads a
+  //Q-vector or combines previous steps: A*B - sum(Subs). Steps are ordered
+  //such that the operands are evaluated first; the last step is the result.
+  struct PlanStep {
+    Int_t Cumulant; //>=0: index of the cumulant to load from; -1: combination
+    Int_t Har, Pow; //harmonic and power of the Q-vector
+    Bool_t PtDif;   //if false, the Q-vector is taken from the first pt bin
+    Int_t A, B;     //operands of the product
+    Int_t FirstSub, NSub; //subtracted steps, stored in CorrPlan::Subs
+  };
+  struct CorrPlan {
+    vector<PlanStep> Steps {};
+    vector<Int_t> Subs {};
+  };
+  struct CompiledCorrConfig {
+    Int_t Poi=-1; //cumulant of which the pt bin has to be filled
+    CorrPlan Plans[4];  //first term, [SetHarmsToZero*2 + DisableOverlap]
+    CorrPlan Plans2[4]; //second term, empty if not defined
   };
   AliGFW();
   ~AliGFW();
@@ -60,13 +81,21 @@ class AliGFW {
   AliGFWCumulant GetCumulant(Int_t index) { return fCumulants.at(index); };
   TComplex Calculate(TString config, Bool_t SetHarmsToZero=kFALSE);
   CorrConfig GetCorrelatorConfig(TString config, TString head = "", Bool_t ptdif=kFALSE);
-  TComplex Calculate(CorrConfig corconf, Int_t ptbin, Bool_t SetHarmsToZero, Bool_t DisableOverlap=kFALSE);
+  TComplex Calculate(const CorrConfig &corconf, Int_t ptbin, Bool_t SetHarmsToZero, Bool_t DisableOverlap=kFALSE);
+  Int_t Compile(CorrConfig &corconf);
  private:
   Bool_t fInitialized;
   void SplitRegions();
   AliGFWCumulant fEmptyCumulant;
   TComplex TwoRec(Int_t n1, Int_t n2, Int_t p1, Int_t p2, Int_t ptbin, AliGFWCumulant*, AliGFWCumulant*, AliGFWCumulant*);
-  TComplex RecursiveCorr(AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGFWCumulant *qol, Int_t ptbin, vector<Int_t> hars, vector<Int_t> pows={}); //POI, Ref. flow, overlapping region
+  TComplex RecursiveCorr(AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGFWCumulant *qol, Int_t ptbin, const vector<Int_t> &hars, const vector<Int_t> &pows={}); //POI, Ref. flow, overlapping region
+  //Compiled correlators:
+  vector<CompiledCorrConfig> fCompiled;
+  vector<TComplex> fPlanValues; //! values of the plan steps, sized at compilation
+  void CompileTerm(CorrPlan &plan, const vector<Int_t> &regs, Int_t overlap, vector<Int_t> hars, Bool_t DisableOverlap, Int_t &ol);
+  Int_t CompileRecursion(CorrPlan &plan, std::map<vector<Int_t>,Int_t> &cache, Int_t poi, Int_t ref, Int_t ol, vector<Int_t> hars, vector<Int_t> pows);
+  Int_t CompileLoad(CorrPlan &plan, std::map<vector<Int_t>,Int_t> &cache, Int_t cumulant, Int_t har, Int_t pow, Bool_t ptdif);
+  TComplex EvaluatePlan(const CorrPlan &plan, Int_t ptbin);
   //Deprecated and not used (for now):
   void AddRegion(Region inreg) { fRegions.push_back(inreg); };
   Region GetRegion(Int_t index) { return fRegions.at(index); };
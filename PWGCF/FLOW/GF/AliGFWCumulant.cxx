@@ -3,15 +3,19 @@ Author: Vytautas Vislavicius
 Extention of Generic Flow (https://arxiv.org/abs/1312.3572)
 */
 #include "AliGFWCumulant.h"
+#include <algorithm>
 
 AliGFWCumulant::AliGFWCumulant():
-  fQvector(0),
+  fQvector(),
+  fPowOffsets(),
+  fNQs(0),
+  fPrefactors(),
   fUsed(kBlank),
   fNEntries(-1),
   fN(1),
   fPow(1),
   fPt(1),
-  fFilledPts(0),
+  fFilledPts(),
   fInitialized(kFALSE)
 {
 };
@@ -27,47 +31,37 @@ void AliGFWCumulant::FillArray(Double_t eta, Int_t ptin, Double_t phi, Double_t
   if(fPt==1) ptin=0; //If one bin, then just fill it straight; otherwise, if ptin is out-of-range, do not fill
   else if(ptin<0 || ptin>=fPt) return;
   fFilledPts[ptin] = kTRUE;
+  //Dont calculate it for each harmonic; multiplication is cheaper that power
+  //Also, if second weight is specified, then keep the first weight with power no more than 1, and us the other weight otherwise
+  //this is important when POIs are a subset of REFs and have different weights than REFs
+  for(Int_t lPow=0; lPow<(Int_t)fPrefactors.size(); lPow++) {
+    if(SecondWeight>0 && lPow>1) fPrefactors[lPow] = TMath::Power(SecondWeight, lPow-1)*weight;
+    else fPrefactors[lPow] = TMath::Power(weight,lPow);
+  };
+  Double_t *lQ = &fQvector[2*ptin*fNQs];
   for(Int_t lN = 0; lN<fN; lN++) {
     Double_t lSin = TMath::Sin(lN*phi); //No need to recalculate for each power
     Double_t lCos = TMath::Cos(lN*phi); //No need to recalculate for each power
     for(Int_t lPow=0; lPow<PW(lN); lPow++) {
-      Double_t lPrefactor = 0;
-      //Dont calculate it twice; multiplication is cheaper that power
-      //Also, if second weight is specified, then keep the first weight with power no more than 1, and us the other weight otherwise
-      //this is important when POIs are a subset of REFs and have different weights than REFs
-      if(SecondWeight>0 && lPow>1) lPrefactor = TMath::Power(SecondWeight, lPow-1)*weight;
-      else lPrefactor = TMath::Power(weight,lPow);
-      Double_t qsin = lPrefactor * lSin;
-      Double_t qcos = lPrefactor * lCos;
-      fQvector[ptin][lN][lPow](fQvector[ptin][lN][lPow].Re()+qcos,fQvector[ptin][lN][lPow].Im()+qsin);//+=TComplex(qcos,qsin);
+      *lQ++ += fPrefactors[lPow] * lCos;
+      *lQ++ += fPrefactors[lPow] * lSin;
     };
   };
   Inc();
 };
 void AliGFWCumulant::ResetQs() {
   if(!fNEntries) return; //If 0 entries, then no need to reset. Otherwise, if -1, then just initialized and need to set to 0.
-  for(Int_t i=0; i<fPt; i++) {
-    fFilledPts[i] = kFALSE;
-    for(Int_t lN=0;lN<fN;lN++) {
-      for(Int_t lPow=0;lPow<PW(lN);lPow++) {
-  	       fQvector[i][lN][lPow](0.,0.);
-      };
-    };
-  };
+  std::fill(fFilledPts.begin(),fFilledPts.end(),kFALSE);
+  std::fill(fQvector.begin(),fQvector.end(),0.);
   fNEntries=0;
 };
 void AliGFWCumulant::DestroyComplexVectorArray() {
   if(!fInitialized) return;
-  for(Int_t l_n = 0; l_n<fN; l_n++) {
-    for(Int_t i=0;i<fPt;i++) {
-      delete [] fQvector[i][l_n];
-    };
-  };
-  for(Int_t i=0;i<fPt;i++) {
-    delete [] fQvector[i];
-  };
-  delete [] fQvector;
-  delete [] fFilledPts;
+  fQvector.clear();
+  fPowOffsets.clear();
+  fPrefactors.clear();
+  fFilledPts.clear();
+  fNQs=0;
   fInitialized=kFALSE;
   fNEntries=-1;
 };
@@ -83,23 +77,24 @@ void AliGFWCumulant::CreateComplexVectorArrayVarPower(Int_t N, vector<Int_t> Pow
   fN=N;
   fPow=0;
   fPt=Pt;
-  fFilledPts = new Bool_t[Pt];
   fPowVec = PowVec;
-  fQvector = new TComplex**[fPt];
-  for(Int_t i=0;i<fPt;i++) {
-    fQvector[i] = new TComplex*[fN];
-  };
+  fPowOffsets.resize(fN+1,0);
+  Int_t lMaxPow=0;
   for(Int_t l_n=0;l_n<fN;l_n++) {
-    for(Int_t i=0;i<fPt;i++) {
-      fQvector[i][l_n] = new TComplex[PW(l_n)];
-    };
+    fPowOffsets[l_n+1] = fPowOffsets[l_n]+PW(l_n);
+    if(PW(l_n)>lMaxPow) lMaxPow=PW(l_n);
   };
+  fNQs = fPowOffsets[fN];
+  fPrefactors.resize(lMaxPow,0.);
+  fFilledPts.resize(fPt,kFALSE);
+  fQvector.resize(2*fPt*fNQs,0.);
   ResetQs();
   fInitialized=kTRUE;
 };
 TComplex AliGFWCumulant::Vec(Int_t n, Int_t p, Int_t ptbin) {
   if(!fInitialized) return 0;
   if(ptbin>=fPt || ptbin<0) ptbin=0;
-  if(n>=0) return fQvector[ptbin][n][p];
-  return TComplex::Conjugate(fQvector[ptbin][-n][p]);
+  const Double_t *lQ = QAddress(n>=0?n:-n,p,ptbin);
+  if(n>=0) return TComplex(lQ[0],lQ[1]);
+  return TComplex(lQ[0],-lQ[1]);
 };
@@ -8,6 +8,7 @@ Extention of Generic Flow (https://arxiv.org/abs/1312.3572)
 #include "TNamed.h"
 #include "TMath.h"
 #include "TAxis.h"
+#include <vector>
 using std::vector;
 class AliGFWCumulant {
  public:
@@ -20,7 +21,12 @@ class AliGFWCumulant {
   void Inc() { fNEntries++; };
   Int_t GetN() { return fNEntries; };
   // protected:
-  TComplex ***fQvector;
+  //Q-vectors of all pt bins, harmonics and powers in one contiguous buffer of
+  //(re, im) pairs. Index of Q(n,p) in pt bin b: 2*(b*fNQs + fPowOffsets[n] + p)
+  vector<Double_t> fQvector;
+  vector<Int_t> fPowOffsets; //! offset of each harmonic within one pt bin
+  Int_t fNQs; //! number of Q-vectors per pt bin
+  vector<Double_t> fPrefactors; //! weight powers of the particle being filled
   UInt_t fUsed;
   Int_t fNEntries;
   //Q-vectors. Could be done recursively, but maybe defining each one of them explicitly is easier to read
@@ -29,13 +35,14 @@ class AliGFWCumulant {
   Int_t fPow; //! Power
   vector<Int_t> fPowVec; //! Powers array
   Int_t fPt; //!fPt bins
-  Bool_t *fFilledPts;
+  vector<Bool_t> fFilledPts;
   Bool_t fInitialized; //Arrays are initialized
   void CreateComplexVectorArray(Int_t N=1, Int_t P=1, Int_t Pt=1);
   void CreateComplexVectorArrayVarPower(Int_t N=1, vector<Int_t> Pvec={1}, Int_t Pt=1);
   Int_t PW(Int_t ind) { return fPowVec.at(ind); }; //No checks to speed up, be carefull!!!
   void DestroyComplexVectorArray();
-  Bool_t IsPtBinFilled(Int_t ptb) { if(!fFilledPts) return kFALSE; return fFilledPts[ptb]; };
+  Bool_t IsPtBinFilled(Int_t ptb) { if(!fInitialized) return kFALSE; return fFilledPts[ptb]; };
+  const Double_t *QAddress(Int_t n, Int_t p, Int_t ptbin) const { return &fQvector[2*(ptbin*fNQs + fPowOffsets[n] + p)]; };
 };
 
 #endif
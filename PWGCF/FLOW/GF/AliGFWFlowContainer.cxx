@@ -15,7 +15,9 @@ AliGFWFlowContainer::AliGFWFlowContainer():
   fXAxis(0),
   fNbinsPt(0),
   fbinsPt(0),
-  fPropagateErrors(kFALSE)
+  fPropagateErrors(kFALSE),
+  fRandSums(),
+  fRandStats()
 {
 };
 AliGFWFlowContainer::AliGFWFlowContainer(const char *name):
@@ -29,7 +31,9 @@ AliGFWFlowContainer::AliGFWFlowContainer(const char *name):
   fXAxis(0),
   fNbinsPt(0),
   fbinsPt(0),
-  fPropagateErrors(kFALSE)
+  fPropagateErrors(kFALSE),
+  fRandSums(),
+  fRandStats()
 {
 };
 AliGFWFlowContainer::~AliGFWFlowContainer() {
@@ -49,15 +53,7 @@ void AliGFWFlowContainer::Initialize(TObjArray *inputList, Int_t nMultiBins, Dou
   for(Int_t i=0;i<inputList->GetEntries();i++)
     fProf->GetYaxis()->SetBinLabel(i+1,inputList->At(i)->GetName());
   fProf->Sumw2();
-  if(nRandom) {
-    fNRandom=nRandom;
-    fProfRand = new TObjArray();
-    fProfRand->SetOwner(kTRUE);
-    for(Int_t i=0;i<nRandom;i++) {
-      fProfRand->Add((TProfile2D*)fProf->Clone(Form("%s_Rand_%i",fProf->GetName(),i)));
-      ((TProfile2D*)fProfRand->At(i))->Sumw2();
-    };
-  };
+  if(nRandom) InitializeSubsamples(nRandom);
 };
 void AliGFWFlowContainer::Initialize(TObjArray *inputList, Int_t nMultiBins, Double_t MultiMin, Double_t MultiMax, Int_t nRandom) {
   if(!inputList) {
@@ -73,15 +69,7 @@ void AliGFWFlowContainer::Initialize(TObjArray *inputList, Int_t nMultiBins, Dou
   fProf->Sumw2();
   for(Int_t i=0;i<inputList->GetEntries();i++)
     fProf->GetYaxis()->SetBinLabel(i+1,inputList->At(i)->GetName());
-  if(nRandom) {
-    fNRandom=nRandom;
-    fProfRand = new TObjArray();
-    fProfRand->SetOwner(kTRUE);
-    for(Int_t i=0;i<nRandom;i++) {
-      fProfRand->Add((TProfile2D*)fProf->Clone(Form("%s_Rand_%i",fProf->GetName(),i)));
-      ((TProfile2D*)fProfRand->At(i))->Sumw2();
-    };
-  };
+  if(nRandom) InitializeSubsamples(nRandom);
 };
 Bool_t AliGFWFlowContainer::CreateBinsFromAxis(TAxis *inax) {
   if(!inax) return kFALSE;
@@ -110,20 +98,108 @@ void AliGFWFlowContainer::SetXAxis() {
       delete tempax;
     }
 }
-Int_t AliGFWFlowContainer::FillProfile(const char *hname, Double_t multi, Double_t corr, Double_t w, Double_t rn) {
+void AliGFWFlowContainer::InitializeSubsamples(Int_t nRandom) {
+  //Subsamples are accumulated in flat arrays with the bin layout of fProf
+  //and only converted to TProfile2Ds when needed (see MaterializeSubProfiles)
+  fNRandom=nRandom;
+  fRandSums.assign(4*nRandom*fProf->GetNcells(),0.);
+  fRandStats.assign(10*nRandom,0.);
+};
+Int_t AliGFWFlowContainer::GetProfileIndex(const char *hname) {
   if(!fProf) return -1;
   Int_t yin = fProf->GetYaxis()->FindBin(hname);
   if(!yin) {
     printf("Could not find bin %s\n",hname);
     return -1;
   };
+  return yin;
+};
+Int_t AliGFWFlowContainer::FillProfile(const char *hname, Double_t multi, Double_t corr, Double_t w, Double_t rn) {
+  Int_t yin = GetProfileIndex(hname);
+  if(yin<1) return -1;
+  return FillProfile(yin,multi,corr,w,rn);
+};
+Int_t AliGFWFlowContainer::FillProfile(Int_t yin, Double_t multi, Double_t corr, Double_t w, Double_t rn) {
+  if(!fProf || yin<1) return -1;
   fProf->Fill(multi,yin,corr,w);
-  if(fNRandom) {
-    Double_t rnind = rn*fNRandom;
-    ((TProfile2D*)fProfRand->At((Int_t)rnind))->Fill(multi,yin,corr,w);
+  if(!fNRandom) return 0;
+  Int_t rInd = (Int_t)(rn*fNRandom);
+  if(fRandSums.empty()) { //Subsamples already converted to profiles
+    if(fProfRand) ((TProfile2D*)fProfRand->At(rInd))->Fill(multi,yin,corr,w);
+    return 0;
   };
+  Int_t xin = fProf->GetXaxis()->FindFixBin(multi);
+  Double_t *lSums = &fRandSums[4*(rInd*fProf->GetNcells()+fProf->GetBin(xin,yin))];
+  lSums[0]+=w;
+  lSums[1]+=w*corr;
+  lSums[2]+=w*corr*corr;
+  lSums[3]+=w*w;
+  Double_t *lStats = &fRandStats[10*rInd];
+  lStats[9]+=1;
+  if(xin<1 || xin>fProf->GetNbinsX()) return 0; //As in TProfile2D::Fill, no statistics from under/overflows
+  lStats[0]+=w;
+  lStats[1]+=w*w;
+  lStats[2]+=w*multi;
+  lStats[3]+=w*multi*multi;
+  lStats[4]+=w*yin;
+  lStats[5]+=w*yin*yin;
+  lStats[6]+=w*multi*yin;
+  lStats[7]+=w*corr;
+  lStats[8]+=w*corr*corr;
   return 0;
 };
+void AliGFWFlowContainer::MaterializeSubProfiles() {
+  if(fRandSums.empty() || !fProf) return;
+  Int_t nCells = fProf->GetNcells();
+  if(fRandSums.size()!=(size_t)4*fNRandom*nCells) {
+    printf("Subsample accumulators do not match the main profile binning, not converting them\n");
+    return;
+  };
+  if(!fProfRand) {
+    fProfRand = new TObjArray();
+    fProfRand->SetOwner(kTRUE);
+  };
+  for(Int_t i=0;i<fNRandom;i++) {
+    TString ts(Form("%s_Rand_%i",fProf->GetName(),i));
+    TProfile2D *tpro = (TProfile2D*)fProf->Clone(ts.Data());
+    tpro->Reset();
+    tpro->SetDirectory(0);
+    const Double_t *lSums = &fRandSums[4*i*nCells];
+    Double_t *sumwy2 = tpro->GetSumw2()->fArray;
+    Double_t *binsw2 = tpro->GetBinSumw2()->fArray;
+    for(Int_t bin=0;bin<nCells;bin++) {
+      tpro->SetBinEntries(bin,lSums[4*bin]);
+      tpro->fArray[bin] = lSums[4*bin+1];
+      sumwy2[bin] = lSums[4*bin+2];
+      binsw2[bin] = lSums[4*bin+3];
+    };
+    tpro->PutStats(&fRandStats[10*i]);
+    tpro->SetEntries(fRandStats[10*i+9]);
+    TProfile2D *existing = (TProfile2D*)fProfRand->FindObject(ts.Data());
+    if(existing) {
+      existing->Add(tpro);
+      delete tpro;
+    } else fProfRand->Add(tpro);
+  };
+  std::vector<Double_t>().swap(fRandSums);
+  std::vector<Double_t>().swap(fRandStats);
+};
+Bool_t AliGFWFlowContainer::MergeSubsamples(AliGFWFlowContainer *source) {
+  //Adds up the subsample accumulators directly if both sides still have them,
+  //such that the merged object stays compact
+  if(source->fRandSums.empty() || fProfRand) return kFALSE;
+  if(fRandSums.empty()) {
+    if(fNRandom) return kFALSE; //Target has no subsamples at all
+    fNRandom = source->fNRandom;
+    fRandSums = source->fRandSums;
+    fRandStats = source->fRandStats;
+    return kTRUE;
+  };
+  if(fRandSums.size()!=source->fRandSums.size()) return kFALSE;
+  for(size_t i=0;i<fRandSums.size();i++) fRandSums[i]+=source->fRandSums[i];
+  for(size_t i=0;i<fRandStats.size();i++) fRandStats[i]+=source->fRandStats[i];
+  return kTRUE;
+};
 void AliGFWFlowContainer::OverrideProfileErrors(TProfile2D *inpf) {
   Int_t nBinsX = fProf->GetNbinsX();
   Int_t nBinsY = fProf->GetNbinsY();
@@ -176,6 +252,9 @@ Long64_t AliGFWFlowContainer::Merge(TCollection *collist) {
     } else
       tpro->Add(spro);
     nmerged++;
+    if(MergeSubsamples(l_FC))
+      continue;
+    MaterializeSubProfiles();
     TObjArray *tarr = l_FC->GetSubProfiles();
     if(!tarr)
       continue;
@@ -229,6 +308,9 @@ void AliGFWFlowContainer::PickAndMerge(TFile *tfi) {
     fProf->SetDirectory(0);
   } else
     tpro->Add(spro);
+  if(MergeSubsamples(lfc))
+    return;
+  MaterializeSubProfiles();
   TObjArray *tarr = lfc->GetSubProfiles();
   if(!tarr) {
     //printf("Target %s does not have subprofiles!\n",lfc->GetName());
@@ -250,6 +332,7 @@ void AliGFWFlowContainer::PickAndMerge(TFile *tfi) {
   //printf("After merge: %i in target, %i in source\n",fProfRand->GetEntries(),tarr->GetEntries());
 };
 Bool_t AliGFWFlowContainer::OverrideMainWithSub(Int_t ind, Bool_t ExcludeChosen) {
+  MaterializeSubProfiles();
   if(!fProfRand) {
     printf("Cannot override main profile with a randomized one. Random profile array does not exist.\n");
     return kFALSE;
@@ -280,6 +363,7 @@ Bool_t AliGFWFlowContainer::OverrideMainWithSub(Int_t ind, Bool_t ExcludeChosen)
   };
 };
 Bool_t AliGFWFlowContainer::RandomizeProfile(Int_t nSubsets) {
+  MaterializeSubProfiles();
   if(!fProfRand) {
     printf("Cannot randomize profile, random array does not exist.\n");
     return kFALSE;
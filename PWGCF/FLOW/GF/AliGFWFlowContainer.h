@@ -19,6 +19,7 @@ Extention of Generic Flow (https://arxiv.org/abs/1312.3572)
 #include "TString.h"
 #include "TCollection.h"
 #include "TAxis.h"
+#include <vector>
 
 class AliGFWFlowContainer:public TNamed {
  public:
@@ -31,10 +32,13 @@ class AliGFWFlowContainer:public TNamed {
   Bool_t CreateBinsFromAxis(TAxis *inax);
   void SetXAxis(TAxis *inax);
   void SetXAxis();
-  void RebinMulti(Int_t rN) { if(fProf) fProf->RebinX(rN); };
+  void RebinMulti(Int_t rN) { if(fProf) { MaterializeSubProfiles(); fProf->RebinX(rN); }; };
   Int_t GetNMultiBins() { return fProf->GetNbinsX(); };
   Double_t GetMultiAtBin(Int_t bin) { return fProf->GetXaxis()->GetBinCenter(bin); };
+  Int_t GetProfileIndex(const char *hname); //Index to be passed to FillProfile; resolve once, not per event
   Int_t FillProfile(const char *hname, Double_t multi, Double_t y, Double_t w, Double_t rn);
+  Int_t FillProfile(Int_t yin, Double_t multi, Double_t y, Double_t w, Double_t rn);
+  void MaterializeSubProfiles(); //Convert the subsample accumulators to TProfile2Ds in fProfRand
   TProfile2D *GetProfile() { return fProf; };
   void OverrideProfileErrors(TProfile2D *inpf);
   void ReadAndMerge(const char *infile);
@@ -42,7 +46,7 @@ class AliGFWFlowContainer:public TNamed {
   Bool_t OverrideMainWithSub(Int_t subind, Bool_t ExcludeChosen);
   Bool_t RandomizeProfile(Int_t nSubsets=0);
   Bool_t CreateStatisticsProfile(StatisticsType StatType, Int_t arg);
-  TObjArray *GetSubProfiles() { return fProfRand; };
+  TObjArray *GetSubProfiles() { MaterializeSubProfiles(); return fProfRand; };
   Long64_t Merge(TCollection *collist);
   void SetIDName(TString newname); //! do not store
   void SetPtRebin(Int_t newval) { fPtRebin=newval; };
@@ -143,8 +147,12 @@ class AliGFWFlowContainer:public TNamed {
   Int_t fNbinsPt; //! Do not store; stored in the fXAxis
   Double_t *fbinsPt; //! Do not store; stored in fXAxis
   Bool_t fPropagateErrors; //! do not store
+  std::vector<Double_t> fRandSums; //Subsample accumulators, [subsample][bin][sumw, sumwy, sumwy2, sumw2]
+  std::vector<Double_t> fRandStats; //Subsample global statistics, [subsample][TProfile2D stats, entries]
+  void InitializeSubsamples(Int_t nRandom);
+  Bool_t MergeSubsamples(AliGFWFlowContainer *source);
   TProfile *GetRefFlowProfile(const char *order, Double_t m1=-1, Double_t m2=-1);
-  ClassDef(AliGFWFlowContainer, 2);
+  ClassDef(AliGFWFlowContainer, 3);
 };
 
 
@@ -724,15 +724,8 @@ const char* AliDielectronVarManager::fgkParticleNames[AliDielectronVarManager::k
   {"LegSource",              "Leg source",                                         ""}
 };
 
-AliPIDResponse* AliDielectronVarManager::fgPIDResponse      = 0x0;
-AliVEvent*      AliDielectronVarManager::fgEvent            = 0x0;
-AliEventplane*  AliDielectronVarManager::fgTPCEventPlane    = 0x0;
-AliKFVertex*    AliDielectronVarManager::fgKFVertex         = 0x0;
 TProfile*       AliDielectronVarManager::fgMultEstimatorAvg[7][9] = {{0x0}};
 TH3D*           AliDielectronVarManager::fgTRDpidEff[10][4] = {{0x0}};
-TObject*        AliDielectronVarManager::fgLegEffMap           = 0x0;
-TObject*        AliDielectronVarManager::fgPairEffMap          = 0x0;
-TBits*          AliDielectronVarManager::fgFillMap          = 0x0;
 Double_t        AliDielectronVarManager::fgTRDpidEffCentRanges[10][4] = {{0.0}};
 TString         AliDielectronVarManager::fgQnCalibrationFilePath = "";
 Bool_t          AliDielectronVarManager::fgDoQnV0GainEqualization = kFALSE;
@@ -749,7 +742,78 @@ AliDielectronQnEPcorrection* AliDielectronVarManager::fgQnEPacRemoval = 0x0;
 Bool_t          AliDielectronVarManager::fgEventPlaneACremoval = kFALSE;
 TString         AliDielectronVarManager::fgQnVectorNorm = "";
 Int_t           AliDielectronVarManager::fgCurrentRun = -1;
-Double_t        AliDielectronVarManager::fgData[AliDielectronVarManager::kNMaxValues] = {0.};
+AliDielectronVarManager::Context AliDielectronVarManager::fgDefaultContext;
+thread_local AliDielectronVarManager::Context* AliDielectronVarManager::fgContext = &AliDielectronVarManager::fgDefaultContext;
+
+//________________________________________________________________
+AliDielectronVarManager::Context::Context() :
+  fPIDResponse(0x0),
+  fEvent(0x0),
+  fTPCEventPlane(0x0),
+  fKFVertex(0x0),
+  fLegEffMap(0x0),
+  fPairEffMap(0x0),
+  fFillMap(),
+  fHasFillMap(kFALSE),
+  fAllRequired(kFALSE)
+{
+  //
+  // Default constructor, all variables are filled
+  //
+  RequireAll();
+  for (Int_t i=0; i<kNMaxValues; ++i) fData[i]=0.;
+}
+
+//________________________________________________________________
+AliDielectronVarManager::Context::~Context()
+{
+  //
+  // Destructor
+  //
+  delete fKFVertex;
+}
+
+//________________________________________________________________
+void AliDielectronVarManager::Context::SetFillMap(const TBits *map)
+{
+  //
+  // Translate a fill map into the list of required variables. No map means all variables.
+  // A map with more bits than variables is treated as empty (guard against corrupted maps)
+  // The translation is skipped if the map did not change since the last call (it is set per pair
+  // and per MC signal). The content is compared since the callers keep modifying the same TBits
+  //
+  if (!map) { if (!fAllRequired) RequireAll(); return; }
+  if (fHasFillMap && *map==fFillMap) return;
+  const Bool_t valid=(map->GetNbits()<=kNMaxValues);
+  for (Int_t i=0; i<kNMaxValues; ++i) fRequired[i]=(valid && map->TestBitNumber(i));
+  fFillMap=*map;
+  fHasFillMap=kTRUE;
+  fAllRequired=kFALSE;
+}
+
+//________________________________________________________________
+void AliDielectronVarManager::Context::RequireAll()
+{
+  //
+  // Require all the variables
+  //
+  for (Int_t i=0; i<kNMaxValues; ++i) fRequired[i]=kTRUE;
+  fHasFillMap=kFALSE;
+  fAllRequired=kTRUE;
+}
+
+//________________________________________________________________
+void AliDielectronVarManager::Context::SetRequired(const Int_t *vars, Int_t nVars)
+{
+  //
+  // Set the list of required variables
+  //
+  for (Int_t i=0; i<kNMaxValues; ++i) fRequired[i]=kFALSE;
+  for (Int_t i=0; i<nVars; ++i) if (vars[i]>=0 && vars[i]<kNMaxValues) fRequired[vars[i]]=kTRUE;
+  fHasFillMap=kFALSE;
+  fAllRequired=kFALSE;
+}
+
 //________________________________________________________________
 AliDielectronVarManager::AliDielectronVarManager() :
   TNamed("AliDielectronVarManager","AliDielectronVarManager")
@@ -49,7 +49,12 @@ AliHistogramManager::AliHistogramManager() :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(0)
+  fNVars(0),
+  fFillPlan(),
+  fFillPlanVars(),
+  fFillPlanFirst(),
+  fFillPlanClassIndex(),
+  fFillPlansBuilt(kFALSE)
 {
   //
   // Constructor
@@ -71,7 +76,12 @@ AliHistogramManager::AliHistogramManager(const Char_t* name, Int_t nvars) :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(nvars)
+  fNVars(nvars),
+  fFillPlan(),
+  fFillPlanVars(),
+  fFillPlanFirst(),
+  fFillPlanClassIndex(),
+  fFillPlansBuilt(kFALSE)
 {
   //
   // Constructor
@@ -131,6 +141,7 @@ void AliHistogramManager::AddHistClass(const Char_t* histClass) {
   hList->SetOwner(kTRUE);
   hList->SetName(histClass);
   fMainList.Add(hList);
+  fFillPlansBuilt = kFALSE;
 }
 
 //_________________________________________________________________
@@ -154,6 +165,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram " << name << " already exists" << endl;
     return;
   }
+  fFillPlansBuilt = kFALSE;
   TString hname = name;
   
   Int_t dimension = 1;
@@ -296,6 +308,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram " << name << " already exists" << endl;
     return;
   }
+  fFillPlansBuilt = kFALSE;
   TString hname = name;
   
   Int_t dimension = 1;
@@ -441,6 +454,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram " << name << " already exists" << endl;
     return;
   }
+  fFillPlansBuilt = kFALSE;
   TString hname = name;
   
   TString titleStr(title);
@@ -494,6 +508,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram " << name << " already exists" << endl;
     return;
   }
+  fFillPlansBuilt = kFALSE;
   TString hname = name;
   
   TString titleStr(title);
@@ -620,150 +635,156 @@ THnF* AliHistogramManager::CreateHistogram( const Char_t* name, const Char_t* ti
 
 
 //__________________________________________________________________
-void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values) {
+Int_t AliHistogramManager::GetHistClassIndex(const Char_t* className) {
   //
-  //  fill a class of histograms
+  //  get the handle of a histogram class, to be used in FillHistClass(Int_t, Float_t*)
+  //  The handle stays valid if further histograms or classes are added
   //
   THashList* hList = (THashList*)fMainList.FindObject(className);
-  if(!hList) {
-    /*cout << "Warning in AliHistogramManager::FillHistClass(): Histogram list " << className << " not found!" << endl;
-    cout << "         Histogram list not filled" << endl; */
-    return;
-  }
-  if(!hList) {
-    return;
-  }
+  if(!hList) return -1;
+  if(!fFillPlansBuilt) BuildFillPlans();
+  return fFillPlanClassIndex[hList];
+}
+
+//__________________________________________________________________
+void AliHistogramManager::BuildFillPlans() {
+  //
+  //  decode the histogram kind and the variables from the unique IDs of the histograms and of their axes
+  //  Histograms using a variable which is not flagged in fUsedVars are not filled and left out of the plans
+  //
+  fFillPlan.clear();
+  fFillPlanVars.clear();
+  fFillPlanFirst.clear();
+  fFillPlanClassIndex.clear();
+  for(Int_t iclass=0; iclass<fMainList.GetEntries(); ++iclass) {
+    THashList* hList = (THashList*)fMainList.At(iclass);
+    fFillPlanClassIndex[hList] = iclass;
+    fFillPlanFirst.push_back(fFillPlan.size());
     
-  TIter next(hList);
-  TObject* h=0x0;
-  Bool_t isProfile;
-  Bool_t isTHn;
-  Int_t thnDim=0;
-  Bool_t isSparse=kFALSE;
-  Double_t fillValues[20]={0.0};
-  Int_t uid = 0;
-  Int_t varX=-1, varY=-1, varZ=-1, varT=-1, varW=-1;
-  Int_t dimension=0;
-  while((h=next())) {
-    Bool_t allVarsGood = kTRUE;
-    uid = h->GetUniqueID();
-    isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
-    isTHn = ((uid%100)>10 ? kTRUE : kFALSE);      
-    if(isTHn) thnDim = (uid%100)-10;        // the excess over 10 from the last 2 digits give the dimension of the THn
-    if(isTHn && ((TString)h->ClassName()).Contains("Sparse")) isSparse = kTRUE;
-    dimension = 0;
-    if(!isTHn) dimension = ((TH1*)h)->GetDimension();
-        
-    uid = (uid-(uid%100))/100;
-    varX = -1;
-    varY = -1;
-    varZ = -1;
-    varT = -1;
-    varW = -1;
-    if(uid>0) {
-      varW = uid%(fNVars+1)-1;
-      if(varW==0) varW=AliReducedVarManager::kNothing;
-      uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
-      if(uid>0) varT = uid - 1;
-      //cout << "Filling " << h->GetName() << " with varT " << varT << endl;
-    }
-        
-    if(!isTHn) {
-      varX = ((TH1*)h)->GetXaxis()->GetUniqueID();
-      if(fUsedVars[varX]) {
+    TIter next(hList);
+    TObject* h=0x0;
+    while((h=next())) {
+      Int_t uid = h->GetUniqueID();
+      Bool_t isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
+      Bool_t isTHn = ((uid%100)>10 ? kTRUE : kFALSE);
+      Int_t thnDim = (isTHn ? (uid%100)-10 : 0);   // the excess over 10 from the last 2 digits give the dimension of the THn
+      Int_t dimension = (isTHn ? 0 : ((TH1*)h)->GetDimension());
+      
+      uid = (uid-(uid%100))/100;
+      Int_t varT = -1, varW = -1;
+      if(uid>0) {
+        varW = uid%(fNVars+1)-1;
+        if(varW==0) varW=AliReducedVarManager::kNothing;
+        uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
+        if(uid>0) varT = uid - 1;
+      }
+      if(varW>AliReducedVarManager::kNothing && !fUsedVars[varW]) continue;
+      
+      FillPlanEntry entry;
+      entry.fHist = h;
+      entry.fFirstVar = fFillPlanVars.size();
+      entry.fVarW = varW;
+      if(isTHn) {
+        entry.fKind = kFillTHn;
+        for(Int_t idim=0;idim<thnDim;++idim) fFillPlanVars.push_back(((THnBase*)h)->GetAxis(idim)->GetUniqueID());
+      }
+      else {
+        fFillPlanVars.push_back(((TH1*)h)->GetXaxis()->GetUniqueID());
+        if(dimension>1 || isProfile) fFillPlanVars.push_back(((TH1*)h)->GetYaxis()->GetUniqueID());
+        if(dimension>2 || (dimension==2 && isProfile)) fFillPlanVars.push_back(((TH1*)h)->GetZaxis()->GetUniqueID());
+        if(dimension==3 && isProfile) fFillPlanVars.push_back(varT);
         switch(dimension) {
           case 1:
-            if(isProfile) {
-              varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-              if(!fUsedVars[varY]) break;
-              if(varW>AliReducedVarManager::kNothing) { 
-                if(!fUsedVars[varW]) break;
-                ((TProfile*)h)->Fill(values[varX],values[varY],values[varW]);
-              }
-              else 
-                ((TProfile*)h)->Fill(values[varX],values[varY]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH1F*)h)->Fill(values[varX],values[varW]);
-              }
-              else
-                ((TH1F*)h)->Fill(values[varX]);
-            }
-          break;
+            entry.fKind = (isProfile ? kFillTProfile : kFillTH1);
+            break;
           case 2:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            if(isProfile) {
-              varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-              if(!fUsedVars[varZ]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ]);        
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH2F*)h)->Fill(values[varX],values[varY], values[varW]);
-              }
-              else
-                ((TH2F*)h)->Fill(values[varX],values[varY]);
-            }
-          break;
+            entry.fKind = (isProfile ? kFillTProfile2D : kFillTH2);
+            break;
           case 3:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-            if(!fUsedVars[varZ]) break;
-            if(isProfile) {
-              if(!fUsedVars[varT]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT],values[varW]);
-              }
-              else
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ]);
-            }
-          break;
+            entry.fKind = (isProfile ? kFillTProfile3D : kFillTH3);
+            break;
           default:
-          break;
-        }  // end switch
-      }
-    }  // end if(!isTHn)
-    else {
-      for(Int_t idim=0;idim<thnDim;++idim) {
-        if (isSparse) {
-          allVarsGood &= fUsedVars[((THnSparseF*)h)->GetAxis(idim)->GetUniqueID()];
-          fillValues[idim] = values[((THnSparseF*)h)->GetAxis(idim)->GetUniqueID()];
-        } else {
-          allVarsGood &= fUsedVars[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-          fillValues[idim] = values[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
+            fFillPlanVars.resize(entry.fFirstVar);
+            continue;
         }
       }
-      if(allVarsGood) {
-        if(varW>AliReducedVarManager::kNothing) {
-          if(fUsedVars[varW]) {
-            if (isSparse) ((THnSparseF*)h)->Fill(fillValues,values[varW]);
-            else          ((THnF*)h)->Fill(fillValues,values[varW]);
-          }
-        }
-        else {
-          if (isSparse) ((THnSparseF*)h)->Fill(fillValues);
-          else          ((THnF*)h)->Fill(fillValues);
-        }
+      entry.fNVars = fFillPlanVars.size()-entry.fFirstVar;
+      Bool_t allVarsGood = kTRUE;
+      for(Int_t ivar=entry.fFirstVar; ivar<(Int_t)fFillPlanVars.size(); ++ivar)
+        allVarsGood &= (fFillPlanVars[ivar]>=0 && fUsedVars[fFillPlanVars[ivar]]);
+      if(!allVarsGood) {
+        fFillPlanVars.resize(entry.fFirstVar);
+        continue;
       }
+      fFillPlan.push_back(entry);
+    }
+  }
+  fFillPlanFirst.push_back(fFillPlan.size());
+  fFillPlansBuilt = kTRUE;
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values) {
+  //
+  //  fill a class of histograms
+  //
+  THashList* hList = (THashList*)fMainList.FindObject(className);
+  if(!hList) {
+    /*cout << "Warning in AliHistogramManager::FillHistClass(): Histogram list " << className << " not found!" << endl;
+    cout << "         Histogram list not filled" << endl; */
+    return;
+  }
+  if(!fFillPlansBuilt) BuildFillPlans();
+  FillHistClass(fFillPlanClassIndex[hList], values);
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(Int_t classIndex, Float_t* values) {
+  //
+  //  fill a class of histograms, using the handle from GetHistClassIndex()
+  //
+  if(!fFillPlansBuilt) BuildFillPlans();
+  if(classIndex<0 || classIndex>=(Int_t)fFillPlanFirst.size()-1) return;
+  
+  Double_t fillValues[20]={0.0};
+  const Int_t lastEntry = fFillPlanFirst[classIndex+1];
+  for(Int_t ientry=fFillPlanFirst[classIndex]; ientry<lastEntry; ++ientry) {
+    const FillPlanEntry& entry = fFillPlan[ientry];
+    const Int_t* vars = &fFillPlanVars[entry.fFirstVar];
+    TObject* h = entry.fHist;
+    Bool_t weighted = (entry.fVarW>AliReducedVarManager::kNothing);
+    switch(entry.fKind) {
+      case kFillTH1:
+        if(weighted) ((TH1F*)h)->Fill(values[vars[0]],values[entry.fVarW]);
+        else         ((TH1F*)h)->Fill(values[vars[0]]);
+        break;
+      case kFillTProfile:
+        if(weighted) ((TProfile*)h)->Fill(values[vars[0]],values[vars[1]],values[entry.fVarW]);
+        else         ((TProfile*)h)->Fill(values[vars[0]],values[vars[1]]);
+        break;
+      case kFillTH2:
+        if(weighted) ((TH2F*)h)->Fill(values[vars[0]],values[vars[1]],values[entry.fVarW]);
+        else         ((TH2F*)h)->Fill(values[vars[0]],values[vars[1]]);
+        break;
+      case kFillTProfile2D:
+        if(weighted) ((TProfile2D*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[entry.fVarW]);
+        else         ((TProfile2D*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]]);
+        break;
+      case kFillTH3:
+        if(weighted) ((TH3F*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[entry.fVarW]);
+        else         ((TH3F*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]]);
+        break;
+      case kFillTProfile3D:
+        if(weighted) ((TProfile3D*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[vars[3]],values[entry.fVarW]);
+        else         ((TProfile3D*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[vars[3]]);
+        break;
+      case kFillTHn:
+        for(Int_t idim=0;idim<entry.fNVars;++idim) fillValues[idim] = values[vars[idim]];
+        if(weighted) ((THnBase*)h)->Fill(fillValues,values[entry.fVarW]);
+        else         ((THnBase*)h)->Fill(fillValues);
+        break;
+      default:
+        break;
     }
   }
 }
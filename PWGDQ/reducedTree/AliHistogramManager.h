@@ -14,6 +14,9 @@
 #include <TList.h>
 #include <THashList.h>
 
+#include <map>
+#include <vector>
+
 #include "AliReducedVarManager.h"
 
 class TAxis;
@@ -69,6 +72,8 @@ class AliHistogramManager : public TObject {
                         TAxis* axis);
   
   void FillHistClass(const Char_t* className, Float_t* values);
+  void FillHistClass(Int_t classIndex, Float_t* values);
+  Int_t GetHistClassIndex(const Char_t* className);     // handle of a histogram class to be used in FillHistClass(Int_t, Float_t*); -1 if not found
   
   void SetUseDefaultVariableNames(Bool_t flag) {fUseDefaultVariableNames = flag;};
   void SetDefaultVarNames(TString* vars, TString* units);
@@ -106,9 +111,27 @@ class AliHistogramManager : public TObject {
   TString fVariableUnits[AliReducedVarManager::kNVars];               //! variable units
   Int_t fNVars;                          // maximum number of variables
   
+  // Fill plans: the histogram type and variables of each histogram are decoded once and stored per histogram class
+  enum EFillKind {
+    kFillTH1=0, kFillTProfile, kFillTH2, kFillTProfile2D, kFillTH3, kFillTProfile3D, kFillTHn
+  };
+  struct FillPlanEntry {
+    TObject* fHist;       // histogram
+    Int_t fKind;          // one of EFillKind
+    Int_t fFirstVar;      // index of the first variable in fFillPlanVars
+    Int_t fNVars;         // number of variables
+    Int_t fVarW;          // weight variable, kNothing if not weighted
+  };
+  std::vector<FillPlanEntry> fFillPlan;                 //! fill plan entries of all histogram classes, in the order of fMainList
+  std::vector<Int_t> fFillPlanVars;                     //! variables used by the fill plan entries
+  std::vector<Int_t> fFillPlanFirst;                    //! first entry in fFillPlan of each histogram class (plus one past the last)
+  std::map<const TObject*, Int_t> fFillPlanClassIndex;  //! handle of each histogram class list
+  Bool_t fFillPlansBuilt;                               //! toggled off each time histograms are added
+  
+  void BuildFillPlans();
   void MakeAxisLabels(TAxis* ax, const Char_t* labels);
   
-  ClassDef(AliHistogramManager, 4)
+  ClassDef(AliHistogramManager, 5)
 };
 
 #endif
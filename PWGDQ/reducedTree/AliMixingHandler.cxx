@@ -11,6 +11,7 @@
 #endif
 
 #include <iostream>
+#include <vector>
 using std::cout;
 using std::endl;
 using std::flush;
@@ -454,6 +455,10 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
   if(entries<2) return;
   
   TObjArray* histClassArr = fHistClassNames.Tokenize(";");
+  // resolve the histogram classes once, such that no lookup by name is done for each pair
+  std::vector<Int_t> histClassIdx(histClassArr->GetEntries());
+  for(Int_t iclass=0; iclass<histClassArr->GetEntries(); ++iclass)
+    histClassIdx[iclass] = fHistos->GetHistClassIndex(histClassArr->At(iclass)->GetName());
   
   TIter iterEv1Leg1Pool(leg1Pool);
   TIter iterEv1Leg2Pool(leg2Pool);
@@ -499,10 +504,10 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
                 if (fNParallelPairCuts>1) {
                   for (Int_t jbit=0; jbit<fNParallelPairCuts; jbit++) {
                     if (!((pairCutMask)&(ULong_t(1)<<jbit))) continue;
-                    fHistos->FillHistClass(histClassArr->At(ibit*3+jbit*3*fNParallelCuts+1)->GetName(), values);
+                    fHistos->FillHistClass(histClassIdx[ibit*3+jbit*3*fNParallelCuts+1], values);
                   }
                 } else {
-                  fHistos->FillHistClass(histClassArr->At(ibit*3+1)->GetName(), values);
+                  fHistos->FillHistClass(histClassIdx[ibit*3+1], values);
                 }
               }
               if(fMixingSetup==kMixCorrelation) {
@@ -511,12 +516,12 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
                   ULong_t pairCutMaskCorr = (reinterpret_cast<AliReducedPairInfo*>(ev1Leg1))->GetQualityFlags();
                   for (Int_t jbit=0; jbit<fNParallelPairCuts; jbit++) {
                     if (!((pairCutMaskCorr)&(ULong_t(1)<<jbit))) continue;
-                    if (fMixLikeSign) fHistos->FillHistClass(histClassArr->At(ibit*3+jbit*fNParallelCuts+pairType)->GetName(), values);
-                    else              fHistos->FillHistClass(histClassArr->At(ibit+jbit*fNParallelCuts)->GetName(), values);
+                    if (fMixLikeSign) fHistos->FillHistClass(histClassIdx[ibit*3+jbit*fNParallelCuts+pairType], values);
+                    else              fHistos->FillHistClass(histClassIdx[ibit+jbit*fNParallelCuts], values);
                   }
                 } else {
-                  if (fMixLikeSign) fHistos->FillHistClass(histClassArr->At(ibit*3+pairType)->GetName(), values);
-                  else              fHistos->FillHistClass(histClassArr->At(ibit)->GetName(), values);
+                  if (fMixLikeSign) fHistos->FillHistClass(histClassIdx[ibit*3+pairType], values);
+                  else              fHistos->FillHistClass(histClassIdx[ibit], values);
                 }
               }
             }
@@ -543,10 +548,10 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
             if (fNParallelPairCuts>1) {
                 for (Int_t jbit=0; jbit<fNParallelPairCuts; jbit++) {
                     if (!((pairCutMask)&(ULong_t(1)<<jbit))) continue;
-                    fHistos->FillHistClass(histClassArr->At(ibit*3+jbit*3*fNParallelCuts+0)->GetName(), values);
+                    fHistos->FillHistClass(histClassIdx[ibit*3+jbit*3*fNParallelCuts+0], values);
                 }
             } else {
-                fHistos->FillHistClass(histClassArr->At(ibit*3+0)->GetName(), values);
+                fHistos->FillHistClass(histClassIdx[ibit*3+0], values);
             }
         }
       }
@@ -581,10 +586,10 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
                     if (fNParallelPairCuts>1) {
                         for (Int_t jbit=0; jbit<fNParallelPairCuts; jbit++) {
                             if (!((pairCutMask)&(ULong_t(1)<<jbit))) continue;
-                            fHistos->FillHistClass(histClassArr->At(ibit*3+jbit*3*fNParallelCuts+2)->GetName(), values);
+                            fHistos->FillHistClass(histClassIdx[ibit*3+jbit*3*fNParallelCuts+2], values);
                         }
                     } else {
-                        fHistos->FillHistClass(histClassArr->At(ibit*3+2)->GetName(), values);
+                        fHistos->FillHistClass(histClassIdx[ibit*3+2], values);
                     }
                 }
             }
@@ -142,9 +142,8 @@ const Double_t AliReducedVarManager::fgkSPDEtaCutsVsVtxZ[20][2] = {
 Int_t                           AliReducedVarManager::fgCurrentRunNumber = -1;
 TString                         AliReducedVarManager::fgVariableNames[AliReducedVarManager::kNVars] = {""};
 TString                         AliReducedVarManager::fgVariableUnits[AliReducedVarManager::kNVars] = {""};
-AliReducedBaseEvent*            AliReducedVarManager::fgEvent = 0x0;
-AliReducedEventPlaneInfo*       AliReducedVarManager::fgEventPlane = 0x0;
-Bool_t                          AliReducedVarManager::fgUsedVars[AliReducedVarManager::kNVars] = {kFALSE};
+AliReducedVarManager::Context   AliReducedVarManager::fgDefaultContext;
+thread_local AliReducedVarManager::Context* AliReducedVarManager::fgContext = &AliReducedVarManager::fgDefaultContext;
 TH2F*                           AliReducedVarManager::fgTPCelectronCentroidMap = 0x0;
 TH2F*                           AliReducedVarManager::fgTPCelectronWidthMap = 0x0;
 AliReducedVarManager::Variables AliReducedVarManager::fgVarDependencyX = kNothing;
@@ -223,177 +222,179 @@ AliReducedVarManager::~AliReducedVarManager() {
 
 //__________________________________________________________________
 void AliReducedVarManager::SetVariableDependencies() {
+  Context& ctx = *fgContext;
   //
   // Set as used those variables on which other variables calculation depends
   //
-  if(fgUsedVars[kDeltaVtxZ]) {
-    fgUsedVars[kVtxZ] = kTRUE;
-    fgUsedVars[kVtxZtpc] = kTRUE;
+  if(ctx.fUsedVars[kDeltaVtxZ]) {
+    ctx.fUsedVars[kVtxZ] = kTRUE;
+    ctx.fUsedVars[kVtxZtpc] = kTRUE;
   }
-  if(fgUsedVars[kRap] || fgUsedVars[kRapAbs]) {
-    fgUsedVars[kMass] = kTRUE;
-    fgUsedVars[kP] = kTRUE;
-    fgUsedVars[kEta] = kTRUE;
+  if(ctx.fUsedVars[kRap] || ctx.fUsedVars[kRapAbs]) {
+    ctx.fUsedVars[kMass] = kTRUE;
+    ctx.fUsedVars[kP] = kTRUE;
+    ctx.fUsedVars[kEta] = kTRUE;
   }
-  if(fgUsedVars[kTriggerRap] || fgUsedVars[kTriggerRapAbs]) {
-	  fgUsedVars[kMass] = kTRUE;
-	  fgUsedVars[kP] = kTRUE;
-	  fgUsedVars[kEta] = kTRUE;
+  if(ctx.fUsedVars[kTriggerRap] || ctx.fUsedVars[kTriggerRapAbs]) {
+	  ctx.fUsedVars[kMass] = kTRUE;
+	  ctx.fUsedVars[kP] = kTRUE;
+	  ctx.fUsedVars[kEta] = kTRUE;
   }
 
-  if(fgUsedVars[kEta]) fgUsedVars[kP] = kTRUE;
+  if(ctx.fUsedVars[kEta]) ctx.fUsedVars[kP] = kTRUE;
   
   for(Int_t ih=0; ih<6; ++ih) {
-    if(fgUsedVars[kVZEROQvecX+2*6+ih]) {
-      fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
+    if(ctx.fUsedVars[kVZEROQvecX+2*6+ih]) {
+      ctx.fUsedVars[kVZEROQvecX+0*6+ih] = kTRUE;
+      ctx.fUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
     }
-    if(fgUsedVars[kVZEROQvecY+2*6+ih]) {
-      fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
+    if(ctx.fUsedVars[kVZEROQvecY+2*6+ih]) {
+      ctx.fUsedVars[kVZEROQvecY+0*6+ih] = kTRUE;
+      ctx.fUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
     }
-    if(fgUsedVars[kVZERORP+2*6+ih]) {
-      fgUsedVars[kVZEROQvecX+2*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+2*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
+    if(ctx.fUsedVars[kVZERORP+2*6+ih]) {
+      ctx.fUsedVars[kVZEROQvecX+2*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+2*6+ih] = kTRUE;
+      ctx.fUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
+      ctx.fUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
     }
-    if(fgUsedVars[kVZEROQaQcSP+ih] || fgUsedVars[kVZEROQaQcSPsine+ih]) {
-      fgUsedVars[kVZERORP+0*6+ih]    = kTRUE; fgUsedVars[kVZERORP+1*6+ih]    = kTRUE;
-      fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
+    if(ctx.fUsedVars[kVZEROQaQcSP+ih] || ctx.fUsedVars[kVZEROQaQcSPsine+ih]) {
+      ctx.fUsedVars[kVZERORP+0*6+ih]    = kTRUE; ctx.fUsedVars[kVZERORP+1*6+ih]    = kTRUE;
+      ctx.fUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
+      ctx.fUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
     }
-    if(fgUsedVars[kRPXtpcXvzeroa+ih]) {
-      fgUsedVars[kTPCQvecX+ih] = kTRUE; fgUsedVars[kVZEROQvecX+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPXtpcXvzeroa+ih]) {
+      ctx.fUsedVars[kTPCQvecX+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecX+ih] = kTRUE;
     }
-    if(fgUsedVars[kRPXtpcXvzeroc+ih]) {
-      fgUsedVars[kTPCQvecX+ih] = kTRUE; fgUsedVars[kVZEROQvecX+6+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPXtpcXvzeroc+ih]) {
+      ctx.fUsedVars[kTPCQvecX+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecX+6+ih] = kTRUE;
     }
-    if(fgUsedVars[kRPYtpcYvzeroa+ih]) {
-      fgUsedVars[kTPCQvecY+ih] = kTRUE; fgUsedVars[kVZEROQvecY+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPYtpcYvzeroa+ih]) {
+      ctx.fUsedVars[kTPCQvecY+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+ih] = kTRUE;
     }
-    if(fgUsedVars[kRPYtpcYvzeroc+ih]) {
-      fgUsedVars[kTPCQvecY+ih] = kTRUE; fgUsedVars[kVZEROQvecY+6+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPYtpcYvzeroc+ih]) {
+      ctx.fUsedVars[kTPCQvecY+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+6+ih] = kTRUE;
     }  
-    if(fgUsedVars[kRPXtpcYvzeroa+ih]) {
-      fgUsedVars[kTPCQvecX+ih] = kTRUE; fgUsedVars[kVZEROQvecY+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPXtpcYvzeroa+ih]) {
+      ctx.fUsedVars[kTPCQvecX+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+ih] = kTRUE;
     }  
-    if(fgUsedVars[kRPXtpcYvzeroc+ih]) {
-      fgUsedVars[kTPCQvecX+ih] = kTRUE; fgUsedVars[kVZEROQvecY+6+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPXtpcYvzeroc+ih]) {
+      ctx.fUsedVars[kTPCQvecX+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+6+ih] = kTRUE;
     }  
-    if(fgUsedVars[kRPYtpcXvzeroa+ih]) {
-      fgUsedVars[kTPCQvecY+ih] = kTRUE; fgUsedVars[kVZEROQvecX+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPYtpcXvzeroa+ih]) {
+      ctx.fUsedVars[kTPCQvecY+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecX+ih] = kTRUE;
     }  
-    if(fgUsedVars[kRPYtpcXvzeroc+ih]) {
-      fgUsedVars[kTPCQvecY+ih] = kTRUE; fgUsedVars[kVZEROQvecX+6+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPYtpcXvzeroc+ih]) {
+      ctx.fUsedVars[kTPCQvecY+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecX+6+ih] = kTRUE;
     }  
-    if(fgUsedVars[kRPdeltaVZEROAtpc+ih]) {
-      fgUsedVars[kVZERORP+0*6+ih] = kTRUE; fgUsedVars[kTPCRP+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPdeltaVZEROAtpc+ih]) {
+      ctx.fUsedVars[kVZERORP+0*6+ih] = kTRUE; ctx.fUsedVars[kTPCRP+ih] = kTRUE;
     }
-    if(fgUsedVars[kRPdeltaVZEROCtpc+ih]) {
-      fgUsedVars[kVZERORP+1*6+ih] = kTRUE; fgUsedVars[kTPCRP+ih] = kTRUE;
+    if(ctx.fUsedVars[kRPdeltaVZEROCtpc+ih]) {
+      ctx.fUsedVars[kVZERORP+1*6+ih] = kTRUE; ctx.fUsedVars[kTPCRP+ih] = kTRUE;
     }
-    if(fgUsedVars[kTPCsubResCos+ih]) {
-      fgUsedVars[kTPCRPleft+ih] = kTRUE; fgUsedVars[kTPCRPright+ih] = kTRUE;
+    if(ctx.fUsedVars[kTPCsubResCos+ih]) {
+      ctx.fUsedVars[kTPCRPleft+ih] = kTRUE; ctx.fUsedVars[kTPCRPright+ih] = kTRUE;
     }
     for(Int_t iVZEROside=0; iVZEROside<3; ++iVZEROside) {
-      if(fgUsedVars[kVZEROFlowVn+iVZEROside*6+ih] || fgUsedVars[kVZEROFlowSine+iVZEROside*6+ih] ||
-         fgUsedVars[kVZEROuQ+iVZEROside*6+ih] || fgUsedVars[kVZEROuQsine+iVZEROside*6+ih] ||
-         fgUsedVars[kVZERODeltaPhiPsiN+iVZEROside*6+ih]) {
-        fgUsedVars[kPhi] = kTRUE; fgUsedVars[kVZERORP+iVZEROside*6+ih] = kTRUE;
-        if(iVZEROside<2 && (fgUsedVars[kVZEROuQ+iVZEROside*6+ih] || fgUsedVars[kVZEROuQsine+iVZEROside*6+ih])) {
-          fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-          fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
+      if(ctx.fUsedVars[kVZEROFlowVn+iVZEROside*6+ih] || ctx.fUsedVars[kVZEROFlowSine+iVZEROside*6+ih] ||
+         ctx.fUsedVars[kVZEROuQ+iVZEROside*6+ih] || ctx.fUsedVars[kVZEROuQsine+iVZEROside*6+ih] ||
+         ctx.fUsedVars[kVZERODeltaPhiPsiN+iVZEROside*6+ih]) {
+        ctx.fUsedVars[kPhi] = kTRUE; ctx.fUsedVars[kVZERORP+iVZEROside*6+ih] = kTRUE;
+        if(iVZEROside<2 && (ctx.fUsedVars[kVZEROuQ+iVZEROside*6+ih] || ctx.fUsedVars[kVZEROuQsine+iVZEROside*6+ih])) {
+          ctx.fUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
+          ctx.fUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
         }
         if(iVZEROside==2) {
-          fgUsedVars[kVZEROQvecX+2*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+2*6+ih] = kTRUE;
-          fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-          fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
+          ctx.fUsedVars[kVZEROQvecX+2*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+2*6+ih] = kTRUE;
+          ctx.fUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
+          ctx.fUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; ctx.fUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
         }
       }
     }
-    if(fgUsedVars[kTPCFlowVn+ih] || fgUsedVars[kTPCFlowSine+ih] || fgUsedVars[kTPCuQ+ih] || fgUsedVars[kTPCuQsine+ih] ||
-       fgUsedVars[kTPCDeltaPhiPsiN+ih]) {
-      fgUsedVars[kPhi] = kTRUE;
-      fgUsedVars[kTPCQvecXtotal+ih] = kTRUE;
-      fgUsedVars[kTPCQvecYtotal+ih] = kTRUE;
+    if(ctx.fUsedVars[kTPCFlowVn+ih] || ctx.fUsedVars[kTPCFlowSine+ih] || ctx.fUsedVars[kTPCuQ+ih] || ctx.fUsedVars[kTPCuQsine+ih] ||
+       ctx.fUsedVars[kTPCDeltaPhiPsiN+ih]) {
+      ctx.fUsedVars[kPhi] = kTRUE;
+      ctx.fUsedVars[kTPCQvecXtotal+ih] = kTRUE;
+      ctx.fUsedVars[kTPCQvecYtotal+ih] = kTRUE;
     }
    
   } // end loop over harmonics
   for(Int_t ich=0; ich<64; ++ich) {
-    if(fgUsedVars[kVZEROflowV2TPC+ich]) {
-      fgUsedVars[kVZEROChannelMult+ich] = kTRUE; fgUsedVars[kTPCRP+1] = kTRUE;
+    if(ctx.fUsedVars[kVZEROflowV2TPC+ich]) {
+      ctx.fUsedVars[kVZEROChannelMult+ich] = kTRUE; ctx.fUsedVars[kTPCRP+1] = kTRUE;
     }
   }
-  if(fgUsedVars[kPtSquared]) fgUsedVars[kPt]=kTRUE;  
-  if(fgUsedVars[kTPCnSigCorrected+kElectron]) fgUsedVars[kTPCnSig+kElectron] = kTRUE; 
-  if(fgUsedVars[kTPCnSigCorrected+kPion])     fgUsedVars[kTPCnSig+kPion] = kTRUE; 
-  if(fgUsedVars[kTPCnSigCorrected+kProton])   fgUsedVars[kTPCnSig+kProton] = kTRUE;
-  if(fgUsedVars[kTPCnSigCorrected+kElectron] || fgUsedVars[kTPCnSigCorrected+kPion] || fgUsedVars[kTPCnSigCorrected+kProton]) {
-     fgUsedVars[fgVarDependencyX] = kTRUE; 
-     fgUsedVars[fgVarDependencyY] = kTRUE;
-     for(Int_t i=0;i<4;++i) fgUsedVars[fgTPCpidCalibVars[i]] = kTRUE;
+  if(ctx.fUsedVars[kPtSquared]) ctx.fUsedVars[kPt]=kTRUE;  
+  if(ctx.fUsedVars[kTPCnSigCorrected+kElectron]) ctx.fUsedVars[kTPCnSig+kElectron] = kTRUE; 
+  if(ctx.fUsedVars[kTPCnSigCorrected+kPion])     ctx.fUsedVars[kTPCnSig+kPion] = kTRUE; 
+  if(ctx.fUsedVars[kTPCnSigCorrected+kProton])   ctx.fUsedVars[kTPCnSig+kProton] = kTRUE;
+  if(ctx.fUsedVars[kTPCnSigCorrected+kElectron] || ctx.fUsedVars[kTPCnSigCorrected+kPion] || ctx.fUsedVars[kTPCnSigCorrected+kProton]) {
+     ctx.fUsedVars[fgVarDependencyX] = kTRUE; 
+     ctx.fUsedVars[fgVarDependencyY] = kTRUE;
+     for(Int_t i=0;i<4;++i) ctx.fUsedVars[fgTPCpidCalibVars[i]] = kTRUE;
   }
   
   
-  if (fgUsedVars[kTriggerEffTimesAssocHadronEff]) {
-    fgUsedVars[kTriggerEff]             = kTRUE;
-    fgUsedVars[kAssocHadronEff]         = kTRUE;
+  if (ctx.fUsedVars[kTriggerEffTimesAssocHadronEff]) {
+    ctx.fUsedVars[kTriggerEff]             = kTRUE;
+    ctx.fUsedVars[kAssocHadronEff]         = kTRUE;
   }
-  if (fgUsedVars[kOneOverTriggerEffTimesAssocHadronEff]) {
-    fgUsedVars[kOneOverTriggerEff]      = kTRUE;
-    fgUsedVars[kOneOverAssocHadronEff]  = kTRUE;
+  if (ctx.fUsedVars[kOneOverTriggerEffTimesAssocHadronEff]) {
+    ctx.fUsedVars[kOneOverTriggerEff]      = kTRUE;
+    ctx.fUsedVars[kOneOverAssocHadronEff]  = kTRUE;
   }
-  if(fgUsedVars[kPairEff] || fgUsedVars[kOneOverPairEff] || fgUsedVars[kOneOverPairEffSq]){
-    fgUsedVars[fgEffMapVarDependencyX] = kTRUE;
-    fgUsedVars[fgEffMapVarDependencyY] = kTRUE;
-    fgUsedVars[fgEffMapVarDependencyZ] = kTRUE;
+  if(ctx.fUsedVars[kPairEff] || ctx.fUsedVars[kOneOverPairEff] || ctx.fUsedVars[kOneOverPairEffSq]){
+    ctx.fUsedVars[fgEffMapVarDependencyX] = kTRUE;
+    ctx.fUsedVars[fgEffMapVarDependencyY] = kTRUE;
+    ctx.fUsedVars[fgEffMapVarDependencyZ] = kTRUE;
   }
-  if (fgUsedVars[kTriggerEff] || fgUsedVars[kOneOverTriggerEff]) {
-    fgUsedVars[fgEffMapVarDependencyXCorr] = kTRUE;
-    fgUsedVars[fgEffMapVarDependencyYCorr] = kTRUE;
-    fgUsedVars[fgEffMapVarDependencyZCorr] = kTRUE;
+  if (ctx.fUsedVars[kTriggerEff] || ctx.fUsedVars[kOneOverTriggerEff]) {
+    ctx.fUsedVars[fgEffMapVarDependencyXCorr] = kTRUE;
+    ctx.fUsedVars[fgEffMapVarDependencyYCorr] = kTRUE;
+    ctx.fUsedVars[fgEffMapVarDependencyZCorr] = kTRUE;
   }
-  if(fgUsedVars[kAssocHadronEff] || fgUsedVars[kOneOverAssocHadronEff]){
-    fgUsedVars[fgAssocHadronEffMapVarDependencyX] = kTRUE;
-    fgUsedVars[fgAssocHadronEffMapVarDependencyY] = kTRUE;
-    fgUsedVars[fgAssocHadronEffMapVarDependencyZ] = kTRUE;
+  if(ctx.fUsedVars[kAssocHadronEff] || ctx.fUsedVars[kOneOverAssocHadronEff]){
+    ctx.fUsedVars[fgAssocHadronEffMapVarDependencyX] = kTRUE;
+    ctx.fUsedVars[fgAssocHadronEffMapVarDependencyY] = kTRUE;
+    ctx.fUsedVars[fgAssocHadronEffMapVarDependencyZ] = kTRUE;
   }
-  if(fgUsedVars[kNTracksITSoutVsSPDtracklets] || fgUsedVars[kNTracksTPCoutVsSPDtracklets] ||
-     fgUsedVars[kNTracksTOFoutVsSPDtracklets] || fgUsedVars[kNTracksTRDoutVsSPDtracklets])
-     fgUsedVars[kSPDntracklets] = kTRUE;
+  if(ctx.fUsedVars[kNTracksITSoutVsSPDtracklets] || ctx.fUsedVars[kNTracksTPCoutVsSPDtracklets] ||
+     ctx.fUsedVars[kNTracksTOFoutVsSPDtracklets] || ctx.fUsedVars[kNTracksTRDoutVsSPDtracklets])
+     ctx.fUsedVars[kSPDntracklets] = kTRUE;
   
-  if(fgUsedVars[kRapMC] || fgUsedVars[kRapMCAbs]) fgUsedVars[kMassMC] = kTRUE;
+  if(ctx.fUsedVars[kRapMC] || ctx.fUsedVars[kRapMCAbs]) ctx.fUsedVars[kMassMC] = kTRUE;
 
-  if(fgUsedVars[kPairPhiV]){
-    fgUsedVars[kL3Polarity] = kTRUE;
+  if(ctx.fUsedVars[kPairPhiV]){
+    ctx.fUsedVars[kL3Polarity] = kTRUE;
   }
-  if(fgUsedVars[kMassDcaPtCorr] ) {
-    fgUsedVars[kMass]          = kTRUE;
-    fgUsedVars[kPt]            = kTRUE;
-    fgUsedVars[kPairDcaXYSqrt] = kTRUE;
+  if(ctx.fUsedVars[kMassDcaPtCorr] ) {
+    ctx.fUsedVars[kMass]          = kTRUE;
+    ctx.fUsedVars[kPt]            = kTRUE;
+    ctx.fUsedVars[kPairDcaXYSqrt] = kTRUE;
   }
-  if(fgUsedVars[kOpAngDcaPtCorr] ) {
-    fgUsedVars[kPairOpeningAngle] = kTRUE;
-    fgUsedVars[kOneOverSqrtPt]    = kTRUE;
-    fgUsedVars[kPt]               = kTRUE;
-    fgUsedVars[kPairDcaXYSqrt]    = kTRUE;
+  if(ctx.fUsedVars[kOpAngDcaPtCorr] ) {
+    ctx.fUsedVars[kPairOpeningAngle] = kTRUE;
+    ctx.fUsedVars[kOneOverSqrtPt]    = kTRUE;
+    ctx.fUsedVars[kPt]               = kTRUE;
+    ctx.fUsedVars[kPairDcaXYSqrt]    = kTRUE;
   }
-  if(fgUsedVars[kNTPCclustersFromPileupRelative]) {
-    fgUsedVars[kNTPCclusters] = kTRUE;
-    fgUsedVars[kNTPCclustersFromPileup] = kTRUE;
+  if(ctx.fUsedVars[kNTPCclustersFromPileupRelative]) {
+    ctx.fUsedVars[kNTPCclusters] = kTRUE;
+    ctx.fUsedVars[kNTPCclustersFromPileup] = kTRUE;
   }
-  if(fgUsedVars[kNTracksTPCoutFromPileup]) {
-    fgUsedVars[kNTracksTPCoutBeforeClean] = kTRUE;
-    fgUsedVars[kVZEROTotalMultFromChannels] = kTRUE;
+  if(ctx.fUsedVars[kNTracksTPCoutFromPileup]) {
+    ctx.fUsedVars[kNTracksTPCoutBeforeClean] = kTRUE;
+    ctx.fUsedVars[kVZEROTotalMultFromChannels] = kTRUE;
   }
 }
 
 //__________________________________________________________________
 void AliReducedVarManager::FillEventInfo(Float_t* values) {
+  Context& ctx = *fgContext;
   //
   // Fill event information
   //
-  FillEventInfo(fgEvent, values, fgEventPlane);
+  FillEventInfo(ctx.fEvent, values, ctx.fEventPlane);
 }
 
 void AliReducedVarManager::FillMCEventInfo(AliReducedEventInfo* event, Float_t* values) {
@@ -405,6 +406,7 @@ void AliReducedVarManager::FillMCEventInfo(AliReducedEventInfo* event, Float_t*
 
 //__________________________________________________________________
 void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values, EVENTPLANE* eventF/*=0x0*/) {
+  Context& ctx = *fgContext;
   //
   // fill event wise info
   //
@@ -493,7 +495,7 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
       calibFile->Close();
     }
 
-    if(fgUsedVars[kRunID] && fgRunNumbers.size() && fgRunID < 0  ){
+    if(ctx.fUsedVars[kRunID] && fgRunNumbers.size() && fgRunID < 0  ){
       for( fgRunID = 0; fgRunNumbers[ fgRunID ] != fgCurrentRunNumber && fgRunID< (Int_t) fgRunNumbers.size() ; ++fgRunID );
     }
     for( int iEstimator =0 ; iEstimator < kNMultiplicityEstimators ; ++iEstimator ){
@@ -552,14 +554,14 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
   values[kBC]                   = event->BC();
   values[kTimeStamp]            = event->TimeStamp();
   Int_t timeSOR = 0; Int_t timeEOR = 0;
-  if(fgUsedVars[kTimeRelativeSOR] || fgUsedVars[kTimeRelativeSORfraction]) {
+  if(ctx.fUsedVars[kTimeRelativeSOR] || ctx.fUsedVars[kTimeRelativeSORfraction]) {
      timeSOR = (fgRunTimeStart ? fgRunTimeStart->GetBinContent(fgRunTimeStart->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber))) : 0);
      timeEOR = (fgRunTimeEnd ? fgRunTimeEnd->GetBinContent(fgRunTimeEnd->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber))) : 0);
   }
-  if(fgUsedVars[kTimeRelativeSOR]) {
+  if(ctx.fUsedVars[kTimeRelativeSOR]) {
      values[kTimeRelativeSOR] = Double_t(event->TimeStamp() - timeSOR) / 60.;     // in minutes
   }
-  if(fgUsedVars[kTimeRelativeSORfraction] && 
+  if(ctx.fUsedVars[kTimeRelativeSORfraction] && 
      (values[kRunTimeEnd]-values[kRunTimeStart])>1.)   // the run should be longer than 1 second ... 
      values[kTimeRelativeSORfraction] = (event->TimeStamp() - timeSOR) / (timeEOR - timeSOR);
   if(fgRunInstLumi) {
@@ -601,8 +603,8 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
   values[kVtxYspd]              = event->VertexSPD(1);
   values[kVtxZspd]              = event->VertexSPD(2);
   values[kNVtxSPDContributors]  = event->VertexSPDContributors();
-  if(fgUsedVars[kDeltaVtxZ]) values[kDeltaVtxZ] = values[kVtxZ] - values[kVtxZtpc];
-  if(fgUsedVars[kDeltaVtxZspd]) values[kDeltaVtxZspd] = values[kVtxZ] - values[kVtxZspd];
+  if(ctx.fUsedVars[kDeltaVtxZ]) values[kDeltaVtxZ] = values[kVtxZ] - values[kVtxZtpc];
+  if(ctx.fUsedVars[kDeltaVtxZspd]) values[kDeltaVtxZspd] = values[kVtxZ] - values[kVtxZspd];
   values[kTPCpileupZAC]         = event->TPCpileupZ();
   values[kTPCpileupZA]          = event->TPCpileupZ(1);
   values[kTPCpileupZC]          = event->TPCpileupZ(2);
@@ -620,21 +622,21 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
     values[kNTracksPerTrackingStatus+iflag] = event->TracksPerTrackingFlag(iflag);
   values[kNTracksTPCoutBeforeClean] = event->TracksWithTPCout();
   
-  // set the fgUsedVars to true as these might have been set to false in the previous event
-  fgUsedVars[kNTracksTPCoutVsITSout] = kTRUE;
-  fgUsedVars[kNTracksTRDoutVsITSout] = kTRUE;
-  fgUsedVars[kNTracksTOFoutVsITSout] = kTRUE;
-  fgUsedVars[kNTracksTRDoutVsTPCout] = kTRUE;
-  fgUsedVars[kNTracksTOFoutVsTPCout] = kTRUE;
-  fgUsedVars[kNTracksTOFoutVsTRDout] = kTRUE;
+  // set the ctx.fUsedVars to true as these might have been set to false in the previous event
+  ctx.fUsedVars[kNTracksTPCoutVsITSout] = kTRUE;
+  ctx.fUsedVars[kNTracksTRDoutVsITSout] = kTRUE;
+  ctx.fUsedVars[kNTracksTOFoutVsITSout] = kTRUE;
+  ctx.fUsedVars[kNTracksTRDoutVsTPCout] = kTRUE;
+  ctx.fUsedVars[kNTracksTOFoutVsTPCout] = kTRUE;
+  ctx.fUsedVars[kNTracksTOFoutVsTRDout] = kTRUE;
   if(TMath::Abs(values[kNTracksPerTrackingStatus+kITSout])>0.01) {
     values[kNTracksTPCoutVsITSout] = values[kNTracksPerTrackingStatus+kTPCout]/values[kNTracksPerTrackingStatus+kITSout];
     values[kNTracksTRDoutVsITSout] = values[kNTracksPerTrackingStatus+kTRDout]/values[kNTracksPerTrackingStatus+kITSout]; 
     values[kNTracksTOFoutVsITSout] = values[kNTracksPerTrackingStatus+kTOFout]/values[kNTracksPerTrackingStatus+kITSout];
   }
   else {
-     // if these values are undefined, set fgUsedVars as false such that the values are not filled in histograms
-     fgUsedVars[kNTracksTPCoutVsITSout] = kFALSE; fgUsedVars[kNTracksTRDoutVsITSout] = kFALSE; fgUsedVars[kNTracksTOFoutVsITSout] = kFALSE;
+     // if these values are undefined, set ctx.fUsedVars as false such that the values are not filled in histograms
+     ctx.fUsedVars[kNTracksTPCoutVsITSout] = kFALSE; ctx.fUsedVars[kNTracksTRDoutVsITSout] = kFALSE; ctx.fUsedVars[kNTracksTOFoutVsITSout] = kFALSE;
   }
   
   if(TMath::Abs(values[kNTracksPerTrackingStatus+kTPCout])>0.01) {
@@ -642,13 +644,13 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
     values[kNTracksTOFoutVsTPCout] = values[kNTracksPerTrackingStatus+kTOFout]/values[kNTracksPerTrackingStatus+kTPCout];
   }
   else {
-     fgUsedVars[kNTracksTRDoutVsTPCout] = kFALSE; fgUsedVars[kNTracksTOFoutVsTPCout] = kFALSE; 
+     ctx.fUsedVars[kNTracksTRDoutVsTPCout] = kFALSE; ctx.fUsedVars[kNTracksTOFoutVsTPCout] = kFALSE; 
   }
   
   if(TMath::Abs(values[kNTracksPerTrackingStatus+kTRDout])>0.01)
     values[kNTracksTOFoutVsTRDout] = values[kNTracksPerTrackingStatus+kTOFout]/values[kNTracksPerTrackingStatus+kTRDout];
   else
-     fgUsedVars[kNTracksTOFoutVsTRDout] = kFALSE;
+     ctx.fUsedVars[kNTracksTOFoutVsTRDout] = kFALSE;
 
   // Multiplicity estimators
 
@@ -736,8 +738,8 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
           }
           values[ indexNotSmeared ] = multCorr;
           values[ indexSmeared ]    = multCorrSmeared;
-          fgUsedVars [indexNotSmeared] = kTRUE;
-          fgUsedVars [indexSmeared] = kTRUE;
+          ctx.fUsedVars [indexNotSmeared] = kTRUE;
+          ctx.fUsedVars [indexSmeared] = kTRUE;
         }
       }
     }
@@ -755,8 +757,8 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
               if( fgAvgMultVsVtxGlobal[kSPDntrackletsEtaBin+ieta-kMultiplicity]->GetBinContent( vtxBin ) > .3 ){
                 Int_t indexBinNotSmeared = GetCorrectedMultiplicity( kSPDntrackletsEtaBin+ieta, iCorrection, iReference, kNoSmearing );
                 Int_t indexBinSmeared    = GetCorrectedMultiplicity( kSPDntrackletsEtaBin+ieta, iCorrection, iReference, kPoissonSmearing );
-                if( fgUsedVars[indexBinNotSmeared]) values[ indexNotSmeared ] += values[ indexBinNotSmeared ];
-                if( fgUsedVars[indexBinSmeared]) values[ indexSmeared ] += values[ indexBinSmeared ];
+                if( ctx.fUsedVars[indexBinNotSmeared]) values[ indexNotSmeared ] += values[ indexBinNotSmeared ];
+                if( ctx.fUsedVars[indexBinSmeared]) values[ indexSmeared ] += values[ indexBinSmeared ];
               }
             }
           }
@@ -775,10 +777,10 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
     }
   }
 
-  fgUsedVars[kNTracksITSoutVsSPDtracklets] = kTRUE;  
-  fgUsedVars[kNTracksTPCoutVsSPDtracklets] = kTRUE;
-  fgUsedVars[kNTracksTRDoutVsSPDtracklets] = kTRUE;
-  fgUsedVars[kNTracksTOFoutVsSPDtracklets] = kTRUE;
+  ctx.fUsedVars[kNTracksITSoutVsSPDtracklets] = kTRUE;  
+  ctx.fUsedVars[kNTracksTPCoutVsSPDtracklets] = kTRUE;
+  ctx.fUsedVars[kNTracksTRDoutVsSPDtracklets] = kTRUE;
+  ctx.fUsedVars[kNTracksTOFoutVsSPDtracklets] = kTRUE;
   if(values[kSPDntracklets]>0.01) {
     values[kNTracksITSoutVsSPDtracklets] = values[kNTracksPerTrackingStatus+kITSout] / values[kSPDntracklets];
     values[kNTracksTPCoutVsSPDtracklets] = values[kNTracksPerTrackingStatus+kTPCout] / values[kSPDntracklets];
@@ -786,10 +788,10 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
     values[kNTracksTOFoutVsSPDtracklets] = values[kNTracksPerTrackingStatus+kTOFout] / values[kSPDntracklets];
   }
   else {
-     fgUsedVars[kNTracksITSoutVsSPDtracklets] = kFALSE;  
-     fgUsedVars[kNTracksTPCoutVsSPDtracklets] = kFALSE;
-     fgUsedVars[kNTracksTRDoutVsSPDtracklets] = kFALSE;
-     fgUsedVars[kNTracksTOFoutVsSPDtracklets] = kFALSE;
+     ctx.fUsedVars[kNTracksITSoutVsSPDtracklets] = kFALSE;  
+     ctx.fUsedVars[kNTracksTPCoutVsSPDtracklets] = kFALSE;
+     ctx.fUsedVars[kNTracksTRDoutVsSPDtracklets] = kFALSE;
+     ctx.fUsedVars[kNTracksTOFoutVsSPDtracklets] = kFALSE;
   }
     
   values[kNCaloClusters]   = event->GetNCaloClusters();
@@ -800,32 +802,32 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
   for(Int_t i=0;i<2;++i) values[kSPDFiredChips+i] = event->SPDFiredChips(i+1);
   for(Int_t i=0;i<6;++i) values[kITSnClusters+i] = event->ITSClusters(i+1);
   values[kSPDnSingleClusters] = event->SPDnSingleClusters();
-  if(fgUsedVars[kSDDandSSDclusters]) {
+  if(ctx.fUsedVars[kSDDandSSDclusters]) {
      values[kSDDandSSDclusters] = 0.0;
      for(Int_t i=2;i<6;++i) values[kSDDandSSDclusters] += event->ITSClusters(i+1);  
   }
   
   //VZERO detector information
-  fgUsedVars[kNTracksTPCoutVsVZEROTotalMult] = kTRUE;
+  ctx.fUsedVars[kNTracksTPCoutVsVZEROTotalMult] = kTRUE;
   if(values[kVZEROTotalMult]>1.0e-5)
      values[kNTracksTPCoutVsVZEROTotalMult] = values[kNTracksPerTrackingStatus+kTPCout] / values[kVZEROTotalMult];
   else
-     fgUsedVars[kNTracksTPCoutVsVZEROTotalMult] = kFALSE;
+     ctx.fUsedVars[kNTracksTPCoutVsVZEROTotalMult] = kFALSE;
   
   values[kVZEROAemptyChannels] = 0;
   values[kVZEROCemptyChannels] = 0;
-  for(Int_t ich=0;ich<64;++ich) fgUsedVars[kVZEROChannelMult+ich] = kTRUE; 
+  for(Int_t ich=0;ich<64;++ich) ctx.fUsedVars[kVZEROChannelMult+ich] = kTRUE; 
   Float_t theta=0.0;
   for(Int_t ich=0;ich<64;++ich) {
-    if(fgUsedVars[kVZEROChannelMult+ich]) {
+    if(ctx.fUsedVars[kVZEROChannelMult+ich]) {
       values[kVZEROChannelMult+ich] = event->MultChannelVZERO(ich);
       if(values[kVZEROChannelMult+ich]<fgkVZEROminMult) {
-        fgUsedVars[kVZEROChannelMult+ich] = kFALSE;   // will not be filled in histograms by the histogram manager
+        ctx.fUsedVars[kVZEROChannelMult+ich] = kFALSE;   // will not be filled in histograms by the histogram manager
         if(ich<32) values[kVZEROCemptyChannels] += 1;
         else values[kVZEROAemptyChannels] += 1;
       }
     }
-    if(fgUsedVars[kVZEROChannelEta+ich]) {
+    if(ctx.fUsedVars[kVZEROChannelEta+ich]) {
       if(ich<32) theta = TMath::ATan(fgkVZEROChannelRadii[ich]/(fgkVZEROCz-values[kVtxZ]));
       else theta = TMath::Pi()-TMath::ATan(fgkVZEROChannelRadii[ich]/(fgkVZEROAz-values[kVtxZ]));
       values[kVZEROChannelEta+ich] = -1.0*TMath::Log(TMath::Tan(theta/2.0));
@@ -836,23 +838,23 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
      values[kNTracksTPCoutFromPileup] = values[kNTracksTPCoutBeforeClean] - (-3.2+TMath::Sqrt(3.2*3.2+4.0*1.6e-5*values[kVZEROTotalMultFromChannels]))/(2.0*1.6e-5);
   
   Float_t tpcClustersExpectationWOpileup = 0.001;
-  if(fgUsedVars[kNTPCclustersFromPileup] && values[kVZEROTotalMultFromChannels]>0.0) {
+  if(ctx.fUsedVars[kNTPCclustersFromPileup] && values[kVZEROTotalMultFromChannels]>0.0) {
      tpcClustersExpectationWOpileup = (-0.0132+TMath::Sqrt(0.0132*0.0132-4.0*(-200.0-values[kVZEROTotalMultFromChannels])*1.4e-9))/2.0/1.4e-9;
      values[kNTPCclustersFromPileup] = values[kNTPCclusters] - tpcClustersExpectationWOpileup;
   }
   else 
      values[kNTPCclustersFromPileup] = 0.0;
   
-  if(fgUsedVars[kNTPCclustersFromPileupRelative] && values[kNTPCclusters]>0.0)
+  if(ctx.fUsedVars[kNTPCclustersFromPileupRelative] && values[kNTPCclusters]>0.0)
      values[kNTPCclustersFromPileupRelative] = values[kNTPCclustersFromPileup] / tpcClustersExpectationWOpileup;
   
-  if(fgUsedVars[kVZEROQvecX+0*6+1] || fgUsedVars[kVZEROQvecY+0*6+1] || fgUsedVars[kVZERORP+0*6+1]) {
+  if(ctx.fUsedVars[kVZEROQvecX+0*6+1] || ctx.fUsedVars[kVZEROQvecY+0*6+1] || ctx.fUsedVars[kVZERORP+0*6+1]) {
     Double_t qvecVZEROA[EVENTPLANE::fgkNMaxHarmonics][2] = {{0.0}};
     Double_t qvecVZEROC[EVENTPLANE::fgkNMaxHarmonics][2] = {{0.0}};
     if(fgOptionCalibrateVZEROqVec && fgAvgVZEROChannelMult[0]) {
        Float_t calibVZEROMult[64] = {0.};
        Float_t refMult=0;
-      for(Int_t ich=0;ich<64;++ich) fgUsedVars[kVZEROChannelMultCalib+ich] = kTRUE; 
+      for(Int_t ich=0;ich<64;++ich) ctx.fUsedVars[kVZEROChannelMultCalib+ich] = kTRUE; 
        
       for(Int_t iCh=0; iCh<64; ++iCh) {
          if(event->MultChannelVZERO(iCh)>=fgkVZEROminMult) {
@@ -869,7 +871,7 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
             
          }
          else
-             fgUsedVars[kVZEROChannelMultCalib+iCh] = kFALSE; // will not be filled in histograms by the histogram manager
+             ctx.fUsedVars[kVZEROChannelMultCalib+iCh] = kFALSE; // will not be filled in histograms by the histogram manager
       }
       event->GetVZEROQvector(qvecVZEROA, EVENTPLANE::kVZEROA, calibVZEROMult);
       event->GetVZEROQvector(qvecVZEROC, EVENTPLANE::kVZEROC, calibVZEROMult);
@@ -927,7 +929,7 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
        values[kVZEROQvecY+2*6+ih] = qvecVZEROA[ih][1] + qvecVZEROC[ih][1];
        values[kVZERORP   +2*6+ih] = TMath::ATan2(values[kVZEROQvecY+2*6+ih], values[kVZEROQvecX+2*6+ih])/Double_t(ih+1);
      
-       if(fgUsedVars[kVZEROQaQcSP+ih]) {
+       if(ctx.fUsedVars[kVZEROQaQcSP+ih]) {
           values[kVZEROQaQcSP+ih] = TMath::Cos((ih+1)*(values[kVZERORP+0*6+ih]-values[kVZERORP+1*6+ih]));
           values[kVZEROQaQcSP+ih] *= TMath::Sqrt(values[kVZEROQvecX+0*6+ih]*values[kVZEROQvecX+0*6+ih]+
           values[kVZEROQvecY+0*6+ih]*values[kVZEROQvecY+0*6+ih]);
@@ -941,25 +943,25 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
        values[kVZEROQvecY+1*6+ih]*values[kVZEROQvecY+1*6+ih]);
        values[kVZERORP   +2*6+ih] = TMath::ATan2(values[kVZEROQvecY+2*6+ih],values[kVZEROQvecX+2*6+ih])/Double_t(ih+1);
        // cos (n*(psi_A-psi_C))
-       if(fgUsedVars[kVZERORPres + ih]) {
+       if(ctx.fUsedVars[kVZERORPres + ih]) {
           values[kVZERORPres + ih] = DeltaPhi(values[kVZERORP+0*6+ih], values[kVZERORP+1*6+ih]);
           values[kVZERORPres + ih] = TMath::Cos(values[kVZERORPres + ih]*(ih+1));
        }
        // Qx,Qy correlations for VZERO
-       if(fgUsedVars[kVZEROXaXc+ih]) 
+       if(ctx.fUsedVars[kVZEROXaXc+ih]) 
           values[kVZEROXaXc+ih] = qvecVZEROA[ih][0]*qvecVZEROC[ih][0];
-       if(fgUsedVars[kVZEROXaYa+ih]) 
+       if(ctx.fUsedVars[kVZEROXaYa+ih]) 
           values[kVZEROXaYa+ih] = qvecVZEROA[ih][0]*qvecVZEROA[ih][1];
-       if(fgUsedVars[kVZEROXaYc+ih]) 
+       if(ctx.fUsedVars[kVZEROXaYc+ih]) 
           values[kVZEROXaYc+ih] = qvecVZEROA[ih][0]*qvecVZEROC[ih][1];
-       if(fgUsedVars[kVZEROYaXc+ih]) 
+       if(ctx.fUsedVars[kVZEROYaXc+ih]) 
           values[kVZEROYaXc+ih] = qvecVZEROA[ih][1]*qvecVZEROC[ih][0];
-       if(fgUsedVars[kVZEROYaYc+ih]) 
+       if(ctx.fUsedVars[kVZEROYaYc+ih]) 
           values[kVZEROYaYc+ih] = qvecVZEROA[ih][1]*qvecVZEROC[ih][1];
-       if(fgUsedVars[kVZEROXcYc+ih]) 
+       if(ctx.fUsedVars[kVZEROXcYc+ih]) 
           values[kVZEROXcYc+ih] = qvecVZEROC[ih][0]*qvecVZEROC[ih][1];
        // Psi_A - Psi_C
-       if(fgUsedVars[kVZEROdeltaRPac+ih])
+       if(ctx.fUsedVars[kVZEROdeltaRPac+ih])
           values[kVZEROdeltaRPac+ih] = DeltaPhi(values[kVZERORP+0*6+ih], values[kVZERORP+1*6+ih]);
     }    // end loop over harmonics
   }
@@ -1013,32 +1015,32 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
      }
      
       // TPC VZERO Q-vector correlations
-     if(fgUsedVars[kRPXtpcXvzeroa+ih]) 
+     if(ctx.fUsedVars[kRPXtpcXvzeroa+ih]) 
 	values[kRPXtpcXvzeroa+ih] = values[kTPCQvecXtree+ih]*values[kVZEROQvecX+ih];
-     if(fgUsedVars[kRPXtpcXvzeroc+ih]) 
+     if(ctx.fUsedVars[kRPXtpcXvzeroc+ih]) 
 	values[kRPXtpcXvzeroc+ih] = values[kTPCQvecXtree+ih]*values[kVZEROQvecX+6+ih];
-     if(fgUsedVars[kRPYtpcYvzeroa+ih]) 
+     if(ctx.fUsedVars[kRPYtpcYvzeroa+ih]) 
 	values[kRPYtpcYvzeroa+ih] = values[kTPCQvecYtree+ih]*values[kVZEROQvecY+ih];
-     if(fgUsedVars[kRPYtpcYvzeroc+ih]) 
+     if(ctx.fUsedVars[kRPYtpcYvzeroc+ih]) 
 	values[kRPYtpcYvzeroc+ih] = values[kTPCQvecYtree+ih]*values[kVZEROQvecY+6+ih];
-     if(fgUsedVars[kRPXtpcYvzeroa+ih]) 
+     if(ctx.fUsedVars[kRPXtpcYvzeroa+ih]) 
 	values[kRPXtpcYvzeroa+ih] = values[kTPCQvecXtree+ih]*values[kVZEROQvecY+ih];
-     if(fgUsedVars[kRPXtpcYvzeroc+ih]) 
+     if(ctx.fUsedVars[kRPXtpcYvzeroc+ih]) 
 	values[kRPXtpcYvzeroc+ih] = values[kTPCQvecXtree+ih]*values[kVZEROQvecY+6+ih];
-     if(fgUsedVars[kRPYtpcXvzeroa+ih]) 
+     if(ctx.fUsedVars[kRPYtpcXvzeroa+ih]) 
 	values[kRPYtpcXvzeroa+ih] = values[kTPCQvecYtree+ih]*values[kVZEROQvecX+ih];
-     if(fgUsedVars[kRPYtpcXvzeroc+ih]) 
+     if(ctx.fUsedVars[kRPYtpcXvzeroc+ih]) 
 	values[kRPYtpcXvzeroc+ih] = values[kTPCQvecYtree+ih]*values[kVZEROQvecX+6+ih];
       // Psi_TPC - Psi_VZERO A/C      
-     if(fgUsedVars[kRPdeltaVZEROAtpc+ih]) 
+     if(ctx.fUsedVars[kRPdeltaVZEROAtpc+ih]) 
 	values[kRPdeltaVZEROAtpc+ih] = DeltaPhi(values[kVZERORP+0*6+ih], values[kTPCRPtree+ih]);
-     if(fgUsedVars[kRPdeltaVZEROCtpc+ih])
+     if(ctx.fUsedVars[kRPdeltaVZEROCtpc+ih])
         values[kRPdeltaVZEROCtpc+ih] = DeltaPhi(values[kVZERORP+1*6+ih], values[kTPCRPtree+ih]);
      
      
      // cos(n(EPtpc-EPvzero A/C))
      for(Int_t iVZEROside=0; iVZEROside<2; ++iVZEROside) {
-          if(fgUsedVars[kTPCRPres+iVZEROside*6+ih]) {
+          if(ctx.fUsedVars[kTPCRPres+iVZEROside*6+ih]) {
 	  values[kTPCRPres+iVZEROside*6+ih] = DeltaPhi(values[kTPCRPtree+ih], values[kVZERORP+iVZEROside*6+ih]);
           values[kTPCRPres+iVZEROside*6+ih] = TMath::Cos(values[kTPCRPres+iVZEROside*6+ih]*(ih+1));
 	}
@@ -1048,7 +1050,7 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
 //      cout<<values[kTPCRPres+1*6+ih]<<endl;
 //      cout<<values[kVZERORPres+ih]<<endl;
       //resolution of V0A, V0C or TPC as reference detector
-      if(fgOptionEventRes && (fgUsedVars[kVZEROARPres+ih]||fgUsedVars[kVZEROCRPres+ih]||fgUsedVars[kVZEROTPCRPres+ih])){
+      if(fgOptionEventRes && (ctx.fUsedVars[kVZEROARPres+ih]||ctx.fUsedVars[kVZEROCRPres+ih]||ctx.fUsedVars[kVZEROTPCRPres+ih])){
          
          if(values[kTPCRPres+1*6+ih]>1.0e-7 && values[kTPCRPres+0*6+ih]>1.0e-7 && values[kVZERORPres+ih]>1.0e-7){
     
@@ -1079,20 +1081,20 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
      for(Int_t iVZEROside=0; iVZEROside<2; ++iVZEROside) {
        values[kVZEROQvecX+iVZEROside*6+ih] = eventF->Qx(EVENTPLANE::kVZEROA+iVZEROside, ih+1);
        values[kVZEROQvecY+iVZEROside*6+ih] = eventF->Qy(EVENTPLANE::kVZEROA+iVZEROside, ih+1);
-       if(fgUsedVars[kVZERORP+iVZEROside*6+ih]) 
+       if(ctx.fUsedVars[kVZERORP+iVZEROside*6+ih]) 
         values[kVZERORP+iVZEROside*6+ih] = eventF->EventPlane(EVENTPLANE::kVZEROA+iVZEROside, ih+1);
-	if(fgUsedVars[kVZEROQvecX+2*6+ih])
+	if(ctx.fUsedVars[kVZEROQvecX+2*6+ih])
 	  values[kVZEROQvecX+2*6+ih] += values[kVZEROQvecX+iVZEROside*6+ih];
-	if(fgUsedVars[kVZEROQvecY+2*6+ih])
+	if(ctx.fUsedVars[kVZEROQvecY+2*6+ih])
 	  values[kVZEROQvecY+2*6+ih] += values[kVZEROQvecY+iVZEROside*6+ih];
 	// cos(n(EPtpc-EPvzero A/C))	
-        if(fgUsedVars[kTPCRPres+iVZEROside*6+ih]) {
+        if(ctx.fUsedVars[kTPCRPres+iVZEROside*6+ih]) {
 	  values[kTPCRPres+iVZEROside*6+ih] = DeltaPhi(eventF->EventPlane(EVENTPLANE::kTPC, ih+1), eventF->EventPlane(EVENTPLANE::kVZEROA+iVZEROside, ih+1));
           values[kTPCRPres+iVZEROside*6+ih] = TMath::Cos(values[kTPCRPres+iVZEROside*6+ih]*(ih+1));
 	}
       }
       
-      if(fgUsedVars[kVZEROQaQcSP+ih]) {
+      if(ctx.fUsedVars[kVZEROQaQcSP+ih]) {
         values[kVZEROQaQcSP+ih] = TMath::Cos((ih+1)*(values[kVZERORP+0*6+ih]-values[kVZERORP+1*6+ih]));
         values[kVZEROQaQcSP+ih] *= TMath::Sqrt(values[kVZEROQvecX+0*6+ih]*values[kVZEROQvecX+0*6+ih]+
                                                values[kVZEROQvecY+0*6+ih]*values[kVZEROQvecY+0*6+ih]);
@@ -1106,66 +1108,66 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
                                              values[kVZEROQvecY+1*6+ih]*values[kVZEROQvecY+1*6+ih]);
       values[kVZERORP   +2*6+ih] = TMath::ATan2(values[kVZEROQvecY+2*6+ih],values[kVZEROQvecX+2*6+ih])/Double_t(ih+1);
       // cos (n*(psi_A-psi_C))
-      if(fgUsedVars[kVZERORPres + ih]) {
+      if(ctx.fUsedVars[kVZERORPres + ih]) {
 	values[kVZERORPres + ih] = DeltaPhi(eventF->EventPlane(EVENTPLANE::kVZEROA, ih+1), 
 					    eventF->EventPlane(EVENTPLANE::kVZEROC, ih+1));
         values[kVZERORPres + ih] = TMath::Cos(values[kVZERORPres + ih]*(ih+1));
       }
       // Qx,Qy correlations for VZERO
-      if(fgUsedVars[kVZEROXaXc+ih]) 
+      if(ctx.fUsedVars[kVZEROXaXc+ih]) 
 	values[kVZEROXaXc+ih] = eventF->Qx(EVENTPLANE::kVZEROA, ih+1)*eventF->Qx(EVENTPLANE::kVZEROC, ih+1);
-      if(fgUsedVars[kVZEROXaYa+ih]) 
+      if(ctx.fUsedVars[kVZEROXaYa+ih]) 
 	values[kVZEROXaYa+ih] = eventF->Qx(EVENTPLANE::kVZEROA, ih+1)*eventF->Qy(EVENTPLANE::kVZEROA, ih+1);
-      if(fgUsedVars[kVZEROXaYc+ih]) 
+      if(ctx.fUsedVars[kVZEROXaYc+ih]) 
 	values[kVZEROXaYc+ih] = eventF->Qx(EVENTPLANE::kVZEROA, ih+1)*eventF->Qy(EVENTPLANE::kVZEROC, ih+1);
-      if(fgUsedVars[kVZEROYaXc+ih]) 
+      if(ctx.fUsedVars[kVZEROYaXc+ih]) 
 	values[kVZEROYaXc+ih] = eventF->Qy(EVENTPLANE::kVZEROA, ih+1)*eventF->Qx(EVENTPLANE::kVZEROC, ih+1);
-      if(fgUsedVars[kVZEROYaYc+ih]) 
+      if(ctx.fUsedVars[kVZEROYaYc+ih]) 
 	values[kVZEROYaYc+ih] = eventF->Qy(EVENTPLANE::kVZEROA, ih+1)*eventF->Qy(EVENTPLANE::kVZEROC, ih+1);
-      if(fgUsedVars[kVZEROXcYc+ih]) 
+      if(ctx.fUsedVars[kVZEROXcYc+ih]) 
 	values[kVZEROXcYc+ih] = eventF->Qx(EVENTPLANE::kVZEROC, ih+1)*eventF->Qy(EVENTPLANE::kVZEROC, ih+1);
       // Psi_A - Psi_C
-      if(fgUsedVars[kVZEROdeltaRPac+ih])
+      if(ctx.fUsedVars[kVZEROdeltaRPac+ih])
         values[kVZEROdeltaRPac+ih] = DeltaPhi(eventF->EventPlane(EVENTPLANE::kVZEROA, ih+1), 
 	  				      eventF->EventPlane(EVENTPLANE::kVZEROC, ih+1));
       
       // TPC event plane
       values[kTPCQvecX+ih] = eventF->Qx(EVENTPLANE::kTPC, ih+1);
       values[kTPCQvecY+ih] = eventF->Qy(EVENTPLANE::kTPC, ih+1);
-      if(fgUsedVars[kTPCRP+ih]) 
+      if(ctx.fUsedVars[kTPCRP+ih]) 
 	values[kTPCRP+ih] = eventF->EventPlane(EVENTPLANE::kTPC, ih+1);
       // TPC VZERO Q-vector correlations
-      if(fgUsedVars[kRPXtpcXvzeroa+ih]) 
+      if(ctx.fUsedVars[kRPXtpcXvzeroa+ih]) 
 	values[kRPXtpcXvzeroa+ih] = values[kTPCQvecX+ih]*values[kVZEROQvecX+ih];
-      if(fgUsedVars[kRPXtpcXvzeroc+ih]) 
+      if(ctx.fUsedVars[kRPXtpcXvzeroc+ih]) 
 	values[kRPXtpcXvzeroc+ih] = values[kTPCQvecX+ih]*values[kVZEROQvecX+6+ih];
-      if(fgUsedVars[kRPYtpcYvzeroa+ih]) 
+      if(ctx.fUsedVars[kRPYtpcYvzeroa+ih]) 
 	values[kRPYtpcYvzeroa+ih] = values[kTPCQvecY+ih]*values[kVZEROQvecY+ih];
-      if(fgUsedVars[kRPYtpcYvzeroc+ih]) 
+      if(ctx.fUsedVars[kRPYtpcYvzeroc+ih]) 
 	values[kRPYtpcYvzeroc+ih] = values[kTPCQvecY+ih]*values[kVZEROQvecY+6+ih];
-      if(fgUsedVars[kRPXtpcYvzeroa+ih]) 
+      if(ctx.fUsedVars[kRPXtpcYvzeroa+ih]) 
 	values[kRPXtpcYvzeroa+ih] = values[kTPCQvecX+ih]*values[kVZEROQvecY+ih];
-      if(fgUsedVars[kRPXtpcYvzeroc+ih]) 
+      if(ctx.fUsedVars[kRPXtpcYvzeroc+ih]) 
 	values[kRPXtpcYvzeroc+ih] = values[kTPCQvecX+ih]*values[kVZEROQvecY+6+ih];
-      if(fgUsedVars[kRPYtpcXvzeroa+ih]) 
+      if(ctx.fUsedVars[kRPYtpcXvzeroa+ih]) 
 	values[kRPYtpcXvzeroa+ih] = values[kTPCQvecY+ih]*values[kVZEROQvecX+ih];
-      if(fgUsedVars[kRPYtpcXvzeroc+ih]) 
+      if(ctx.fUsedVars[kRPYtpcXvzeroc+ih]) 
 	values[kRPYtpcXvzeroc+ih] = values[kTPCQvecY+ih]*values[kVZEROQvecX+6+ih];
       // Psi_TPC - Psi_VZERO A/C      
-      if(fgUsedVars[kRPdeltaVZEROAtpc+ih]) 
+      if(ctx.fUsedVars[kRPdeltaVZEROAtpc+ih]) 
 	values[kRPdeltaVZEROAtpc+ih] = DeltaPhi(values[kVZERORP+0*6+ih], values[kTPCRP+ih]);
-      if(fgUsedVars[kRPdeltaVZEROCtpc+ih])
+      if(ctx.fUsedVars[kRPdeltaVZEROCtpc+ih])
         values[kRPdeltaVZEROCtpc+ih] = DeltaPhi(values[kVZERORP+1*6+ih], values[kTPCRP+ih]);
       // TPC event planes with sub-event method
       values[kTPCQvecXleft+ih] = eventF->Qx(EVENTPLANE::kTPCneg, ih+1);
       values[kTPCQvecYleft+ih] = eventF->Qy(EVENTPLANE::kTPCneg, ih+1);
-      if(fgUsedVars[kTPCRPleft+ih])
+      if(ctx.fUsedVars[kTPCRPleft+ih])
 	values[kTPCRPleft+ih] = eventF->EventPlane(EVENTPLANE::kTPCneg, ih+1);
       values[kTPCQvecXright+ih] = eventF->Qx(EVENTPLANE::kTPCpos, ih+1);
       values[kTPCQvecYright+ih] = eventF->Qy(EVENTPLANE::kTPCpos, ih+1);
-      if(fgUsedVars[kTPCRPright+ih])
+      if(ctx.fUsedVars[kTPCRPright+ih])
         values[kTPCRPright+ih] = eventF->EventPlane(EVENTPLANE::kTPCpos, ih+1); 
-      if(fgUsedVars[kTPCsubResCos+ih]) 
+      if(ctx.fUsedVars[kTPCsubResCos+ih]) 
 	values[kTPCsubResCos+ih] = TMath::Cos(Double_t(ih+1)*(values[kTPCRPleft+ih]-values[kTPCRPright+ih]));
     }  // end loop over harmonics
     
@@ -1173,7 +1175,7 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
     Double_t vzeroChannelPhi[8] = {0.3927, 1.1781, 1.9635, 2.7489, -2.7489, -1.9635, -1.1781, -0.3927};
     
     for(Int_t ich=0; ich<64; ++ich) {
-      if(fgUsedVars[kVZEROflowV2TPC+ich])
+      if(ctx.fUsedVars[kVZEROflowV2TPC+ich])
 	values[kVZEROflowV2TPC+ich] = values[kVZEROChannelMult+ich]*
                                       TMath::Cos(2.0*DeltaPhi(vzeroChannelPhi[ich%8],values[kTPCRP+1]));
     } 
@@ -1225,7 +1227,7 @@ void AliReducedVarManager::FillITSlayerFlag(TRACK* track, Int_t layer, Float_t*
   // fill the ITS layer hit
   //
   values[kITSlayerHit] = -1.0*(layer+1);
-  if(fgUsedVars[kITSlayerHit] && track->ITSLayerHit(layer)) values[kITSlayerHit] = layer+1;
+  if(fgContext->fUsedVars[kITSlayerHit] && track->ITSLayerHit(layer)) values[kITSlayerHit] = layer+1;
 }
 
 //_________________________________________________________________
@@ -1234,41 +1236,44 @@ void AliReducedVarManager::FillITSsharedLayerFlag(TRACK* track, Int_t layer, Flo
    // fill the ITS layer having shared cluster
    //
    values[kITSlayerShared] = -1.0*(layer+1);
-   if(fgUsedVars[kITSlayerShared] && track->ITSLayerHit(layer) && track->ITSClusterIsShared(layer)) values[kITSlayerShared] = layer+1;
+   if(fgContext->fUsedVars[kITSlayerShared] && track->ITSLayerHit(layer) && track->ITSClusterIsShared(layer)) values[kITSlayerShared] = layer+1;
 }
 
 //_________________________________________________________________
 void AliReducedVarManager::FillL0TriggerInputs(EVENT* event, Int_t input, Float_t* values, Int_t input2 /*=999*/) {
+  Context& ctx = *fgContext;
   //
   // fill the L0 trigger inputs
   //
   values[kL0TriggerInput] = -1.0;
-  if(fgUsedVars[kL0TriggerInput] && event->L0TriggerInput(input)) values[kL0TriggerInput] = input;
+  if(ctx.fUsedVars[kL0TriggerInput] && event->L0TriggerInput(input)) values[kL0TriggerInput] = input;
   values[kL0TriggerInput2] = -1.0;
-  if(fgUsedVars[kL0TriggerInput2] && event->L0TriggerInput(input2)) values[kL0TriggerInput2] = input2;
+  if(ctx.fUsedVars[kL0TriggerInput2] && event->L0TriggerInput(input2)) values[kL0TriggerInput2] = input2;
 }
 
 
 //_________________________________________________________________
 void AliReducedVarManager::FillL1TriggerInputs(EVENT* event, Int_t input, Float_t* values, Int_t input2 /*=999*/) {
+  Context& ctx = *fgContext;
   //
   // fill the L1 trigger inputs
   //
   values[kL1TriggerInput] = -1.0;
-  if(fgUsedVars[kL1TriggerInput] && event->L1TriggerInput(input)) values[kL1TriggerInput] = input;
+  if(ctx.fUsedVars[kL1TriggerInput] && event->L1TriggerInput(input)) values[kL1TriggerInput] = input;
   values[kL1TriggerInput2] = -1.0;
-  if(fgUsedVars[kL1TriggerInput2] && event->L1TriggerInput(input2)) values[kL1TriggerInput2] = input2;
+  if(ctx.fUsedVars[kL1TriggerInput2] && event->L1TriggerInput(input2)) values[kL1TriggerInput2] = input2;
 }
 
 //_________________________________________________________________
 void AliReducedVarManager::FillL2TriggerInputs(EVENT* event, Int_t input, Float_t* values, Int_t input2 /*=999*/) {
+  Context& ctx = *fgContext;
   //
   // fill the L2 trigger inputs
   //
   values[kL2TriggerInput] = -1.0;
-  if(fgUsedVars[kL2TriggerInput] && event->L2TriggerInput(input)) values[kL2TriggerInput] = input;
+  if(ctx.fUsedVars[kL2TriggerInput] && event->L2TriggerInput(input)) values[kL2TriggerInput] = input;
   values[kL2TriggerInput2] = -1.0;
-  if(fgUsedVars[kL2TriggerInput2] && event->L2TriggerInput(input2)) values[kL2TriggerInput2] = input2;
+  if(ctx.fUsedVars[kL2TriggerInput2] && event->L2TriggerInput(input2)) values[kL2TriggerInput2] = input2;
 }
 
 //_________________________________________________________________
@@ -1277,7 +1282,7 @@ void AliReducedVarManager::FillEventTagInput(BASEEVENT* event, Int_t input, Floa
   // fill the event tag inputs
   //
   values[kEventTag] = -1.0;
-  if(fgUsedVars[kEventTag] && event->EventTag(input)) values[kEventTag] = input;
+  if(fgContext->fUsedVars[kEventTag] && event->EventTag(input)) values[kEventTag] = input;
 }
 
 //_________________________________________________________________
@@ -1286,7 +1291,7 @@ void AliReducedVarManager::FillTPCclusterBitFlag(TRACK* track, Int_t bit, Float_
   // fill the TPC cluster map
   //
   values[kTPCclusBitFired] = -1;
-  if(fgUsedVars[kTPCclusBitFired] && track->TPCClusterMapBitFired(bit)) values[kTPCclusBitFired] = bit;
+  if(fgContext->fUsedVars[kTPCclusBitFired] && track->TPCClusterMapBitFired(bit)) values[kTPCclusBitFired] = bit;
 }
 
 
@@ -1354,17 +1359,18 @@ void AliReducedVarManager::FillEventOnlineTriggers(AliReducedEventInfo* event, F
 
 //_________________________________________________________________
 void AliReducedVarManager::FillEventOnlineTrigger(UShort_t triggerBit, Float_t* values, UShort_t triggerBit2 /*=999*/) {
+  Context& ctx = *fgContext;
   //
   // fill the trigger bit input
   //  The second trigger bit (triggerBit2) is used for correlation histograms between the different trigger inputs
   //
   if(triggerBit>=64) return;
-  if(!fgEvent) return;
+  if(!ctx.fEvent) return;
   values[kOnlineTrigger] = triggerBit;
-  values[kOnlineTriggerFired] = (((AliReducedEventInfo*)fgEvent)->TriggerMask()&(ULong_t(1)<<triggerBit) ? triggerBit : -1.0);
+  values[kOnlineTriggerFired] = (((AliReducedEventInfo*)ctx.fEvent)->TriggerMask()&(ULong_t(1)<<triggerBit) ? triggerBit : -1.0);
   values[kOnlineTriggerFired2] = 0.0;
   if(triggerBit<64)
-     values[kOnlineTriggerFired2] = (((AliReducedEventInfo*)fgEvent)->TriggerMask()&(ULong_t(1)<<triggerBit2) ? triggerBit2 : -1.0);
+     values[kOnlineTriggerFired2] = (((AliReducedEventInfo*)ctx.fEvent)->TriggerMask()&(ULong_t(1)<<triggerBit2) ? triggerBit2 : -1.0);
 }
 
 //________________________________________________________________
@@ -1386,41 +1392,42 @@ void AliReducedVarManager::FillV0Channel(Int_t ich, Float_t* values) {
 
 //_________________________________________________________________
 void AliReducedVarManager::FillMCTruthInfo(TRACK* p, Float_t* values, TRACK* leg1 /* = 0x0 */, TRACK* leg2 /* = 0x0 */) {
+  Context& ctx = *fgContext;
    //
    //  Fill pure MC truth information
    //
-   if(fgUsedVars[kPtMC]) values[kPtMC] = p->PtMC();
-   if(fgUsedVars[kPMC]) values[kPMC] = p->PMC();
+   if(ctx.fUsedVars[kPtMC]) values[kPtMC] = p->PtMC();
+   if(ctx.fUsedVars[kPMC]) values[kPMC] = p->PMC();
    values[kPxMC] = p->MCmom(0);
    values[kPyMC] = p->MCmom(1);
    values[kPzMC] = p->MCmom(2);
-   if(fgUsedVars[kPt_weight]) values[kPt_weight] =  CalculateWeightFactor(values[kPtMC],values[kCentVZERO]);
+   if(ctx.fUsedVars[kPt_weight]) values[kPt_weight] =  CalculateWeightFactor(values[kPtMC],values[kCentVZERO]);
    
-   if(fgUsedVars[kThetaMC]) values[kThetaMC] = p->ThetaMC();
-   if(fgUsedVars[kEtaMC]) values[kEtaMC] = p->EtaMC();
-   if(fgUsedVars[kPhiMC]) values[kPhiMC] = p->PhiMC();
-   if(fgUsedVars[kMassMC]) {
+   if(ctx.fUsedVars[kThetaMC]) values[kThetaMC] = p->ThetaMC();
+   if(ctx.fUsedVars[kEtaMC]) values[kEtaMC] = p->EtaMC();
+   if(ctx.fUsedVars[kPhiMC]) values[kPhiMC] = p->PhiMC();
+   if(ctx.fUsedVars[kMassMC]) {
       if(TMath::Abs(p->MCPdg(0))==443)
          values[kMassMC] = fgkPairMass[AliReducedPairInfo::kJpsiToEE];  
       if(TMath::Abs(p->MCPdg(0))==100443)
          values[kMassMC] = fgkPairMass[AliReducedPairInfo::kPsi2SToEE];  
    }
-   if(fgUsedVars[kRapMC]) {
+   if(ctx.fUsedVars[kRapMC]) {
       if(TMath::Abs(p->MCPdg(0))==443)
          values[kRapMC] = p->RapidityMC(fgkPairMass[AliReducedPairInfo::kJpsiToEE]); 
       if(TMath::Abs(p->MCPdg(0))==100443)
          values[kRapMC] = p->RapidityMC(fgkPairMass[AliReducedPairInfo::kPsi2SToEE]); 
    }
-  if(fgUsedVars[kRapMCAbs]) {
+  if(ctx.fUsedVars[kRapMCAbs]) {
     if(TMath::Abs(p->MCPdg(0))==443)
       values[kRapMCAbs] = TMath::Abs(p->RapidityMC(fgkPairMass[AliReducedPairInfo::kJpsiToEE]));
     if(TMath::Abs(p->MCPdg(0))==100443)
        values[kRapMCAbs] = TMath::Abs(p->RapidityMC(fgkPairMass[AliReducedPairInfo::kPsi2SToEE]));
   }
 
-  if(fgUsedVars[kPseudoProperDecayTimeMC]){
-     if(fgEvent->IsA()==EVENT::Class()){
-     EVENT* eventInfo = (EVENT*)fgEvent;
+  if(ctx.fUsedVars[kPseudoProperDecayTimeMC]){
+     if(ctx.fEvent->IsA()==EVENT::Class()){
+     EVENT* eventInfo = (EVENT*)ctx.fEvent;
      Double_t lxyMC = ( (p->MCFreezeout(0) - eventInfo->VertexMC(0)) * p->MCmom(0) + (p->MCFreezeout(1) - eventInfo->VertexMC(1)) * p->MCmom(1) ) / p->PtMC();
      values[kPseudoProperDecayTimeMC] = lxyMC * (fgkPairMass[AliReducedPairInfo::kJpsiToEE])/p->PtMC();
      }
@@ -1428,11 +1435,11 @@ void AliReducedVarManager::FillMCTruthInfo(TRACK* p, Float_t* values, TRACK* leg
    // compute MC truth variables from decay legs, e.g. from the 2 electrons of a J/psi decay
    // NOTE: this may be different from the kinematics of the mother, if not all decay legs are considered / tracked
    Bool_t requestMCfromLegs = kFALSE;
-   if(fgUsedVars[kPtMCfromLegs] || fgUsedVars[kPMCfromLegs] || 
-      fgUsedVars[kPxMCfromLegs] || fgUsedVars[kPyMCfromLegs] || fgUsedVars[kPzMCfromLegs] ||
-      fgUsedVars[kThetaMCfromLegs] || fgUsedVars[kEtaMCfromLegs] || fgUsedVars[kPhiMCfromLegs] ||
-      fgUsedVars[kMassMCfromLegs] || fgUsedVars[kRapMCfromLegs] ||
-      fgUsedVars[kPairLegPtMC] || fgUsedVars[kPairLegPtMC+1] || fgUsedVars[kPairLegPtMCSum]) 
+   if(ctx.fUsedVars[kPtMCfromLegs] || ctx.fUsedVars[kPMCfromLegs] || 
+      ctx.fUsedVars[kPxMCfromLegs] || ctx.fUsedVars[kPyMCfromLegs] || ctx.fUsedVars[kPzMCfromLegs] ||
+      ctx.fUsedVars[kThetaMCfromLegs] || ctx.fUsedVars[kEtaMCfromLegs] || ctx.fUsedVars[kPhiMCfromLegs] ||
+      ctx.fUsedVars[kMassMCfromLegs] || ctx.fUsedVars[kRapMCfromLegs] ||
+      ctx.fUsedVars[kPairLegPtMC] || ctx.fUsedVars[kPairLegPtMC+1] || ctx.fUsedVars[kPairLegPtMCSum]) 
       requestMCfromLegs = kTRUE;
    
    if(leg1 && leg2 && requestMCfromLegs) {
@@ -1480,7 +1487,7 @@ void AliReducedVarManager::FillMCTruthInfo(TRACK* p, Float_t* values, TRACK* leg
    
    // polarization variables
    Bool_t usePolarization=kFALSE;
-   if(leg1 && leg2 && (fgUsedVars[kPairThetaCS] || fgUsedVars[kPairThetaHE] || fgUsedVars[kPairPhiCS] || fgUsedVars[kPairPhiHE]))
+   if(leg1 && leg2 && (ctx.fUsedVars[kPairThetaCS] || ctx.fUsedVars[kPairThetaHE] || ctx.fUsedVars[kPairPhiCS] || ctx.fUsedVars[kPairPhiHE]))
       usePolarization = kTRUE;
    if(usePolarization)
       GetThetaPhiCM(leg1, leg2, values[kPairThetaHE], values[kPairPhiHE], values[kPairThetaCS], values[kPairPhiCS]);
@@ -1489,6 +1496,7 @@ void AliReducedVarManager::FillMCTruthInfo(TRACK* p, Float_t* values, TRACK* leg
 
 //_________________________________________________________________
 void AliReducedVarManager::FillMCTruthInfo(TRACK* leg1, TRACK* leg2, Float_t* values) {
+  Context& ctx = *fgContext;
    //
    // Compute MC truth variables from decay legs only, no mother assumption used
    // NOTE: This function is done specifically for pairs of MC particles which do not have any mother in the stack, e.g. electrons from gamma-gamma processes produced with Starlight
@@ -1546,7 +1554,7 @@ void AliReducedVarManager::FillMCTruthInfo(TRACK* leg1, TRACK* leg2, Float_t* va
       
    // polarization variables
    Bool_t usePolarization=kFALSE;
-   if(leg1 && leg2 && (fgUsedVars[kPairThetaCS] || fgUsedVars[kPairThetaHE] || fgUsedVars[kPairPhiCS] || fgUsedVars[kPairPhiHE]))
+   if(leg1 && leg2 && (ctx.fUsedVars[kPairThetaCS] || ctx.fUsedVars[kPairThetaHE] || ctx.fUsedVars[kPairPhiCS] || ctx.fUsedVars[kPairPhiHE]))
       usePolarization = kTRUE;
    if(usePolarization)
       GetThetaPhiCM(leg1, leg2, values[kPairThetaHE], values[kPairPhiHE], values[kPairThetaCS], values[kPairPhiCS]);
@@ -1555,31 +1563,32 @@ void AliReducedVarManager::FillMCTruthInfo(TRACK* leg1, TRACK* leg2, Float_t* va
 
 //_________________________________________________________________
 void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
+  Context& ctx = *fgContext;
   //
   // fill track information
   //
   
   // Fill base track information
-  if(fgUsedVars[kPt])        values[kPt]        = p->Pt();
-  if(fgUsedVars[kPtSquared]) values[kPtSquared] = values[kPt]*values[kPt];
-  if(fgUsedVars[kOneOverSqrtPt]) {
+  if(ctx.fUsedVars[kPt])        values[kPt]        = p->Pt();
+  if(ctx.fUsedVars[kPtSquared]) values[kPtSquared] = values[kPt]*values[kPt];
+  if(ctx.fUsedVars[kOneOverSqrtPt]) {
     values[kOneOverSqrtPt] = values[kPt] > 0. ? 1./TMath::Sqrt(values[kPt]) : 999.;
   }
-  if(fgUsedVars[kP])         values[kP]         = p->P();
-  if(fgUsedVars[kPx])        values[kPx]        = p->Px();
-  if(fgUsedVars[kPy])        values[kPy]        = p->Py();
-  if(fgUsedVars[kPz])        values[kPz]        = p->Pz();
-  if(fgUsedVars[kTheta])     values[kTheta]     = p->Theta();
-  if(fgUsedVars[kPhi])       values[kPhi]       = p->Phi();
-  if(fgUsedVars[kEta])       values[kEta]       = p->Eta();
+  if(ctx.fUsedVars[kP])         values[kP]         = p->P();
+  if(ctx.fUsedVars[kPx])        values[kPx]        = p->Px();
+  if(ctx.fUsedVars[kPy])        values[kPy]        = p->Py();
+  if(ctx.fUsedVars[kPz])        values[kPz]        = p->Pz();
+  if(ctx.fUsedVars[kTheta])     values[kTheta]     = p->Theta();
+  if(ctx.fUsedVars[kPhi])       values[kPhi]       = p->Phi();
+  if(ctx.fUsedVars[kEta])       values[kEta]       = p->Eta();
   for(Int_t ih=1; ih<=6; ++ih) {
-     if(fgUsedVars[kCosNPhi+ih-1]) values[kCosNPhi+ih-1] = TMath::Cos(p->Phi()*ih);
-     if(fgUsedVars[kSinNPhi+ih-1]) values[kSinNPhi+ih-1] = TMath::Sin(p->Phi()*ih);
+     if(ctx.fUsedVars[kCosNPhi+ih-1]) values[kCosNPhi+ih-1] = TMath::Cos(p->Phi()*ih);
+     if(ctx.fUsedVars[kSinNPhi+ih-1]) values[kSinNPhi+ih-1] = TMath::Sin(p->Phi()*ih);
   }
   values[kCharge] = p->Charge();
   
   //pair efficiency variables
-  if((fgUsedVars[kPairEff] || fgUsedVars[kOneOverPairEff] || fgUsedVars[kOneOverPairEffSq]) && fgPairEffMap) {
+  if((ctx.fUsedVars[kPairEff] || ctx.fUsedVars[kOneOverPairEff] || ctx.fUsedVars[kOneOverPairEffSq]) && fgPairEffMap) {
     Int_t binX = 0;
     if (fgEffMapVarDependencyX!=kNothing) {
       binX = fgPairEffMap->GetXaxis()->FindBin(values[fgEffMapVarDependencyX]);
@@ -1615,11 +1624,11 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   // Fill VZERO flow variables
   for(Int_t iVZEROside=0; iVZEROside<3; ++iVZEROside) {
      for(Int_t ih=0; ih<6; ++ih) {
-        if(fgUsedVars[kVZEROFlowVn+iVZEROside*6+ih])
+        if(ctx.fUsedVars[kVZEROFlowVn+iVZEROside*6+ih])
            values[kVZEROFlowVn+iVZEROside*6+ih] = TMath::Cos((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
-        if(fgUsedVars[kVZEROFlowSine+iVZEROside*6+ih])
+        if(ctx.fUsedVars[kVZEROFlowSine+iVZEROside*6+ih])
            values[kVZEROFlowSine+iVZEROside*6+ih] = TMath::Sin((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
-        if(fgUsedVars[kVZERODeltaPhiPsiN+iVZEROside*6+ih]) {
+        if(ctx.fUsedVars[kVZERODeltaPhiPsiN+iVZEROside*6+ih]) {
            // compute delta phi = phi - Psi
            values[kVZERODeltaPhiPsiN+iVZEROside*6+ih] = values[kPhi] - values[kVZERORP+iVZEROside*6+ih];
            // transform to the interval [0; 2*pi/n]
@@ -1630,12 +1639,12 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
              values[kVZERODeltaPhiPsiN+iVZEROside*6+ih] = 2.0*TMath::Pi()/Double_t(ih+1) - values[kVZERODeltaPhiPsiN+iVZEROside*6+ih];
         }
         if(iVZEROside<2) {
-           if(fgUsedVars[kVZEROuQ+iVZEROside*6+ih]) {
+           if(ctx.fUsedVars[kVZEROuQ+iVZEROside*6+ih]) {
               values[kVZEROuQ+iVZEROside*6+ih] = TMath::Cos((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
               values[kVZEROuQ+iVZEROside*6+ih] *= TMath::Sqrt(values[kVZEROQvecX+iVZEROside*6+ih]*values[kVZEROQvecX+iVZEROside*6+ih] +
               values[kVZEROQvecY+iVZEROside*6+ih]*values[kVZEROQvecY+iVZEROside*6+ih]); 
            }
-           if(fgUsedVars[kVZEROuQsine+iVZEROside*6+ih]) {
+           if(ctx.fUsedVars[kVZEROuQsine+iVZEROside*6+ih]) {
               values[kVZEROuQsine+iVZEROside*6+ih] = TMath::Sin((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
               values[kVZEROuQsine+iVZEROside*6+ih] *= TMath::Sqrt(values[kVZEROQvecX+iVZEROside*6+ih]*values[kVZEROQvecX+iVZEROside*6+ih] +
               values[kVZEROQvecY+iVZEROside*6+ih]*values[kVZEROQvecY+iVZEROside*6+ih]); 
@@ -1648,11 +1657,11 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   // Subtract the q vector of the track or of the pair legs from the event q-vector 
   Bool_t tpcEPUsed = kFALSE;
   for(Int_t ih=0; ih<6; ++ih) {
-     if(fgUsedVars[kTPCFlowVn+ih]) {tpcEPUsed = kTRUE; break;}
-     if(fgUsedVars[kTPCFlowSine+ih]) {tpcEPUsed = kTRUE; break;}
-     if(fgUsedVars[kTPCuQ+ih]) {tpcEPUsed = kTRUE; break;}
-     if(fgUsedVars[kTPCuQsine+ih]) {tpcEPUsed = kTRUE; break;}
-     if(fgUsedVars[kTPCDeltaPhiPsiN+ih]) {tpcEPUsed = kTRUE; break;}
+     if(ctx.fUsedVars[kTPCFlowVn+ih]) {tpcEPUsed = kTRUE; break;}
+     if(ctx.fUsedVars[kTPCFlowSine+ih]) {tpcEPUsed = kTRUE; break;}
+     if(ctx.fUsedVars[kTPCuQ+ih]) {tpcEPUsed = kTRUE; break;}
+     if(ctx.fUsedVars[kTPCuQsine+ih]) {tpcEPUsed = kTRUE; break;}
+     if(ctx.fUsedVars[kTPCDeltaPhiPsiN+ih]) {tpcEPUsed = kTRUE; break;}
   }
 
   if(tpcEPUsed) {
@@ -1660,7 +1669,7 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
 //      Double_t qVec[6][2] = {{0.0}};
 //      for(Int_t ih=0; ih<6; ++ih) {qVec[ih][0]=values[kTPCQvecXtotal+ih]; qVec[ih][1]=values[kTPCQvecYtotal+ih];}
 //      EVENT* eventInfo = NULL;
-//      if(fgEvent->IsA()==EVENT::Class()) eventInfo = (EVENT*)fgEvent;
+//      if(ctx.fEvent->IsA()==EVENT::Class()) eventInfo = (EVENT*)ctx.fEvent;
 //      if((p->IsA() == AliReducedTrackInfo::Class()) && eventInfo) {
 //         eventInfo->SubtractParticleFromQvector((AliReducedTrackInfo*)p,qVec,EVENTPLANE::kTPC,-0.8,-0.5*fgkTPCQvecRapGap);
 //         eventInfo->SubtractParticleFromQvector((AliReducedTrackInfo*)p,qVec,EVENTPLANE::kTPC,0.5*fgkTPCQvecRapGap,0.8);
@@ -1680,15 +1689,15 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
 //         tpcEPsubtracted[ih] = TMath::ATan2(qVec[ih][1], qVec[ih][0])/Double_t(ih+1);
 //      for(Int_t ih=0; ih<6; ++ih) {
 //         // vn using Psi_n
-//         if(fgUsedVars[kTPCFlowVn+ih])
+//         if(ctx.fUsedVars[kTPCFlowVn+ih])
 //            values[kTPCFlowVn+ih] = TMath::Cos(DeltaPhi(values[kPhi],tpcEPsubtracted[ih])*(ih+1));
-//         if(fgUsedVars[kTPCFlowSine+ih]) 
+//         if(ctx.fUsedVars[kTPCFlowSine+ih]) 
 //            values[kTPCFlowSine+ih] = TMath::Sin(DeltaPhi(values[kPhi],tpcEPsubtracted[ih])*(ih+1));
-//         if(fgUsedVars[kTPCuQ+ih]) {
+//         if(ctx.fUsedVars[kTPCuQ+ih]) {
 //            values[kTPCuQ+ih] = TMath::Cos((values[kPhi]-tpcEPsubtracted[ih])*(ih+1));
 //            values[kTPCuQ+ih] *= TMath::Sqrt(qVec[ih][0]*qVec[ih][0] + qVec[ih][1]*qVec[ih][1]);
 //         }
-//         if(fgUsedVars[kTPCuQsine+ih]) {
+//         if(ctx.fUsedVars[kTPCuQsine+ih]) {
 //            values[kTPCuQsine+ih] = TMath::Sin((values[kPhi]-tpcEPsubtracted[ih])*(ih+1));
 //            values[kTPCuQsine+ih] *= TMath::Sqrt(qVec[ih][0]*qVec[ih][0] + qVec[ih][1]*qVec[ih][1]);
 //         }
@@ -1696,9 +1705,9 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
 
         for(Int_t ih=0; ih<6; ++ih) {
         // vn using Psi_n
-        if(fgUsedVars[kTPCFlowVn+ih])
+        if(ctx.fUsedVars[kTPCFlowVn+ih])
            values[kTPCFlowVn+ih] = TMath::Cos(DeltaPhi(values[kPhi],values[kTPCRPtree+ih])*(ih+1));
-        if(fgUsedVars[kTPCDeltaPhiPsiN+ih]) {
+        if(ctx.fUsedVars[kTPCDeltaPhiPsiN+ih]) {
            // compute delta phi = phi - Psi
            values[kTPCDeltaPhiPsiN+ih] = values[kPhi] - values[kTPCRPtree+ih];
            // transform to the interval [0; 2*pi/n]
@@ -1710,13 +1719,13 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
         }
             
            //values[kTPCDeltaPhiPsiN+ih] = (values[kPhi]>TMath::Pi() ? values[kPhi]-2.0*TMath::Pi() : values[kPhi])/Double_t(ih+1)-values[kTPCRPtree+ih];  
-        if(fgUsedVars[kTPCFlowSine+ih]) 
+        if(ctx.fUsedVars[kTPCFlowSine+ih]) 
            values[kTPCFlowSine+ih] = TMath::Sin(DeltaPhi(values[kPhi],values[kTPCRPtree+ih])*(ih+1));
-        if(fgUsedVars[kTPCuQ+ih]) {
+        if(ctx.fUsedVars[kTPCuQ+ih]) {
            values[kTPCuQ+ih] = TMath::Cos((values[kPhi]-values[kTPCRPtree+ih])*(ih+1));
            values[kTPCuQ+ih] *= TMath::Sqrt(values[kVZEROQvecX+ih]*values[kVZEROQvecX+ih] + values[kVZEROQvecY+ih]*values[kVZEROQvecY+ih]);
         }
-        if(fgUsedVars[kTPCuQsine+ih]) {
+        if(ctx.fUsedVars[kTPCuQsine+ih]) {
            values[kTPCuQsine+ih] = TMath::Sin((values[kPhi]-values[kTPCRPtree+ih])*(ih+1));
            values[kTPCuQsine+ih] *= TMath::Sqrt(values[kVZEROQvecX+ih]*values[kVZEROQvecX+ih] + values[kVZEROQvecY+ih]*values[kVZEROQvecY+ih]);
         }
@@ -1738,34 +1747,34 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   values[kDcaXYTPC]    = pinfo->DCAxyTPC();
   values[kDcaZTPC]     = pinfo->DCAzTPC();
 
-  if(fgUsedVars[kITSncls]) values[kITSncls] = pinfo->ITSncls();
+  if(ctx.fUsedVars[kITSncls]) values[kITSncls] = pinfo->ITSncls();
   values[kITSsignal] = pinfo->ITSsignal();
   values[kITSchi2] = pinfo->ITSchi2();
 
-  if(fgUsedVars[kITSnclsShared]) values[kITSnclsShared] = pinfo->ITSnSharedCls();
+  if(ctx.fUsedVars[kITSnclsShared]) values[kITSnclsShared] = pinfo->ITSnSharedCls();
   values[kTPCncls] = pinfo->TPCncls();
 
-  if(fgUsedVars[kNclsSFracITS])
+  if(ctx.fUsedVars[kNclsSFracITS])
   values[kNclsSFracITS] = (pinfo-> ITSncls()>0 ? Float_t (pinfo->ITSnSharedCls())/Float_t(pinfo->ITSncls()) :0.0) ;
-  if(fgUsedVars[kTPCnclsRatio]) 
+  if(ctx.fUsedVars[kTPCnclsRatio]) 
     values[kTPCnclsRatio] = (pinfo->TPCFindableNcls()>0 ? Float_t(pinfo->TPCncls())/Float_t(pinfo->TPCFindableNcls()) : 0.0);
-  if(fgUsedVars[kTPCnclsRatio2]) 
+  if(ctx.fUsedVars[kTPCnclsRatio2]) 
     values[kTPCnclsRatio2] = (pinfo->TPCCrossedRows()>0 ? Float_t(pinfo->TPCncls())/Float_t(pinfo->TPCCrossedRows()) : 0.0);
 
-  if(fgUsedVars[kTPCcrossedRowsOverFindableClusters]) { 
+  if(ctx.fUsedVars[kTPCcrossedRowsOverFindableClusters]) { 
      if(pinfo->TPCFindableNcls()>0)
        values[kTPCcrossedRowsOverFindableClusters] = Float_t(pinfo->TPCCrossedRows()) / Float_t(pinfo->TPCFindableNcls());
      else 
         values[kTPCcrossedRowsOverFindableClusters] = 0.0;
   }
-  if(fgUsedVars[kTPCnclsSharedRatio]) {
+  if(ctx.fUsedVars[kTPCnclsSharedRatio]) {
      if(pinfo->TPCncls()>0) 
         values[kTPCnclsSharedRatio] = Float_t(pinfo->TPCnclsShared()) / Float_t(pinfo->TPCncls());
      else
         values[kTPCnclsSharedRatio] = 0.0;
   }
 
-  if(fgUsedVars[kTPCnclsRatio3])
+  if(ctx.fUsedVars[kTPCnclsRatio3])
     values[kTPCnclsRatio3] = (pinfo->TPCFindableNcls()>0 ? Float_t(pinfo->TPCCrossedRows())/Float_t(pinfo->TPCFindableNcls()) : 0.0);
 
   values[kTPCnclsF]       = pinfo->TPCFindableNcls();
@@ -1781,8 +1790,8 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
      values[kTPCdEdxQmaxOverQtot+i] = ( values[kTPCdEdxQtot+i]>1.0e-7 ? values[kTPCdEdxQmax+i] / values[kTPCdEdxQtot+i] : -999. );
   }
   values[kTPCchi2] = pinfo->TPCchi2();
-  if(fgUsedVars[kTPCNclusBitsFired]) values[kTPCNclusBitsFired] = pinfo->TPCClusterMapBitsFired();
-  if(fgUsedVars[kTPCclustersPerBit]) {
+  if(ctx.fUsedVars[kTPCNclusBitsFired]) values[kTPCNclusBitsFired] = pinfo->TPCClusterMapBitsFired();
+  if(ctx.fUsedVars[kTPCclustersPerBit]) {
     Int_t nbits = pinfo->TPCClusterMapBitsFired();
     values[kTPCclustersPerBit] = (nbits>0 ? values[kTPCncls]/Float_t(nbits) : 0.0);
   }
@@ -1801,7 +1810,7 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
     values[kTOFnSig+specie] = pinfo->TOFnSig(specie);
     values[kBayes+specie]   = pinfo->GetBayesProb(specie);
   }
-  if(fgUsedVars[kTPCnSigCorrected+kElectron] && fgTPCelectronCentroidMap && fgTPCelectronWidthMap) {
+  if(ctx.fUsedVars[kTPCnSigCorrected+kElectron] && fgTPCelectronCentroidMap && fgTPCelectronWidthMap) {
      Int_t binX = fgTPCelectronCentroidMap->GetXaxis()->FindBin(values[fgVarDependencyX]);
      if(binX==0) binX = 1;
      if(binX==fgTPCelectronCentroidMap->GetXaxis()->GetNbins()+1) binX -= 1;
@@ -1815,7 +1824,7 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   }
   
   
-  if(fgUsedVars[kTPCnSigCorrected+kElectron] && fgTPCpidCalibCentroid[0] && fgTPCpidCalibWidth[0] && fgTPCpidCalibStatus[0]) {
+  if(ctx.fUsedVars[kTPCnSigCorrected+kElectron] && fgTPCpidCalibCentroid[0] && fgTPCpidCalibWidth[0] && fgTPCpidCalibStatus[0]) {
      Int_t bin[4];
      for(Int_t i=0; i<4; i++) {
         bin[i] = fgTPCpidCalibCentroid[0]->GetAxis(i)->FindBin(values[fgTPCpidCalibVars[i]]);
@@ -1832,7 +1841,7 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
         values[kTPCnSigCorrected+kElectron] = (values[kTPCnSig+kElectron] - centroid)/width;
      }
   }
-  if(fgUsedVars[kTPCnSigCorrected+kPion] && fgTPCpidCalibCentroid[1] && fgTPCpidCalibWidth[1] && fgTPCpidCalibStatus[1]) {
+  if(ctx.fUsedVars[kTPCnSigCorrected+kPion] && fgTPCpidCalibCentroid[1] && fgTPCpidCalibWidth[1] && fgTPCpidCalibStatus[1]) {
      Int_t bin[4];
      for(Int_t i=0; i<4; i++) {
         bin[i] = fgTPCpidCalibCentroid[1]->GetAxis(i)->FindBin(values[fgTPCpidCalibVars[i]]);
@@ -1849,7 +1858,7 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
         values[kTPCnSigCorrected+kPion] = (values[kTPCnSig+kPion] - centroid)/width;
      }
   }
-  if(fgUsedVars[kTPCnSigCorrected+kProton] && fgTPCpidCalibCentroid[2] && fgTPCpidCalibWidth[2] && fgTPCpidCalibStatus[2]) {
+  if(ctx.fUsedVars[kTPCnSigCorrected+kProton] && fgTPCpidCalibCentroid[2] && fgTPCpidCalibWidth[2] && fgTPCpidCalibStatus[2]) {
      Int_t bin[4];
      for(Int_t i=0; i<4; i++) {
         bin[i] = fgTPCpidCalibCentroid[2]->GetAxis(i)->FindBin(values[fgTPCpidCalibVars[i]]);
@@ -1884,26 +1893,26 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   FillTrackingStatus(pinfo,values);
   //FillTrackingFlags(pinfo,values);
 
-  if(fgUsedVars[kPtMC]) values[kPtMC] = pinfo->PtMC();
-  if(fgUsedVars[kPMC]) values[kPMC] = pinfo->PMC();
+  if(ctx.fUsedVars[kPtMC]) values[kPtMC] = pinfo->PtMC();
+  if(ctx.fUsedVars[kPMC]) values[kPMC] = pinfo->PMC();
   values[kPxMC] = pinfo->MCmom(0);
   values[kPyMC] = pinfo->MCmom(1);
   values[kPzMC] = pinfo->MCmom(2);
-  if(fgUsedVars[kThetaMC]) values[kThetaMC] = pinfo->ThetaMC();
-  if(fgUsedVars[kEtaMC]) values[kEtaMC] = pinfo->EtaMC();
-  if(fgUsedVars[kPhiMC]) values[kPhiMC] = pinfo->PhiMC();
+  if(ctx.fUsedVars[kThetaMC]) values[kThetaMC] = pinfo->ThetaMC();
+  if(ctx.fUsedVars[kEtaMC]) values[kEtaMC] = pinfo->EtaMC();
+  if(ctx.fUsedVars[kPhiMC]) values[kPhiMC] = pinfo->PhiMC();
   //TODO: add also the massMC and RapMC   
   values[kPdgMC] = pinfo->MCPdg(0);
   values[kPdgMC+1] = pinfo->MCPdg(1);
   values[kPdgMC+2] = pinfo->MCPdg(2);
   values[kPdgMC+3] = pinfo->MCPdg(3);
   
-  if(fgUsedVars[kRap] && pinfo->IsMCKineParticle())  {
+  if(ctx.fUsedVars[kRap] && pinfo->IsMCKineParticle())  {
      if(pinfo->MCPdg(0)==443) values[kRap] = p->Rapidity(fgkPairMass[AliReducedPairInfo::kJpsiToEE]);
      if(pinfo->MCPdg(0)==100443) values[kRap] = p->Rapidity(fgkPairMass[AliReducedPairInfo::kPsi2SToEE]);
      if(TMath::Abs(pinfo->MCPdg(0))==11) values[kRap] = p->Rapidity(fgkParticleMass[AliReducedVarManager::kElectron]);
   }
-  if(fgUsedVars[kRapAbs] && pinfo->IsMCKineParticle())  {
+  if(ctx.fUsedVars[kRapAbs] && pinfo->IsMCKineParticle())  {
     if(pinfo->MCPdg(0)==443) values[kRapAbs] = TMath::Abs(p->Rapidity(fgkPairMass[AliReducedPairInfo::kJpsiToEE]));
     if(pinfo->MCPdg(0)==100443) values[kRapAbs] = TMath::Abs(p->Rapidity(fgkPairMass[AliReducedPairInfo::kPsi2SToEE]));
     if(TMath::Abs(pinfo->MCPdg(0))==11) values[kRapAbs] = TMath::Abs(p->Rapidity(fgkParticleMass[AliReducedVarManager::kElectron]));
@@ -1912,19 +1921,20 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
 
 //_________________________________________________________________
 void AliReducedVarManager::FillClusterMatchedTrackInfo(AliReducedBaseTrack* p, Float_t* values, TList* clusterList/*=0x0*/, AliReducedCaloClusterTrackMatcher* matcher/*=0x0*/) {
+  Context& ctx = *fgContext;
   //
   // fill calorimeter cluster matched track info
   //
   if(p->IsA()!=TRACK::Class()) return;
   TRACK* pinfo = (TRACK*)p;
 
-  if (!fgUsedVars[kEMCALmatchedEnergy] &&
-      !fgUsedVars[kEMCALmatchedEOverP] &&
-      !fgUsedVars[kEMCALmatchedM02] &&
-      !fgUsedVars[kEMCALmatchedM20] &&
-      !fgUsedVars[kEMCALmatchedClusterId]) return;
+  if (!ctx.fUsedVars[kEMCALmatchedEnergy] &&
+      !ctx.fUsedVars[kEMCALmatchedEOverP] &&
+      !ctx.fUsedVars[kEMCALmatchedM02] &&
+      !ctx.fUsedVars[kEMCALmatchedM20] &&
+      !ctx.fUsedVars[kEMCALmatchedClusterId]) return;
 
-  if (fgEvent && (fgEvent->IsA()==EVENT::Class())) {
+  if (ctx.fEvent && (ctx.fEvent->IsA()==EVENT::Class())) {
     CLUSTER* cluster = NULL;
     if (clusterList) {
       for (Int_t i=0; i<clusterList->GetEntries(); ++i) {
@@ -1933,7 +1943,7 @@ void AliReducedVarManager::FillClusterMatchedTrackInfo(AliReducedBaseTrack* p, F
         cluster = NULL;
       }
     } else {
-      cluster = ((EVENT*)fgEvent)->GetCaloClusterFromID(pinfo->CaloClusterId());
+      cluster = ((EVENT*)ctx.fEvent)->GetCaloClusterFromID(pinfo->CaloClusterId());
     }
     // track matcher:
     Float_t deltaPhi  = -9999.;
@@ -1942,17 +1952,17 @@ void AliReducedVarManager::FillClusterMatchedTrackInfo(AliReducedBaseTrack* p, F
     if (matcher) {
       if (!matcher->IsClusterMatchedToTrack(pinfo, cluster, deltaPhi, deltaEta, dist)) cluster = NULL;
     }
-    if (fgUsedVars[kEMCALmatchedClusterId])       values[kEMCALmatchedClusterId]      = (cluster ? pinfo->CaloClusterId() : -9999.);
-    if (fgUsedVars[kEMCALmatchedEnergy])          values[kEMCALmatchedEnergy]         = (cluster ? cluster->Energy() : -9999.);
-    if (fgUsedVars[kEMCALmatchedM02])             values[kEMCALmatchedM02]            = (cluster ? cluster->M02() : -9999.);
-    if (fgUsedVars[kEMCALmatchedM20])             values[kEMCALmatchedM20]            = (cluster ? cluster->M20() : -9999.);
-    if (fgUsedVars[kEMCALmatchedNCells])          values[kEMCALmatchedNCells]         = (cluster ? cluster->NCells() : -9999.);
-    if (fgUsedVars[kEMCALmatchedNMatchedTracks])  values[kEMCALmatchedNMatchedTracks] = (cluster ? cluster->NMatchedTracks() : -9999.);
-    if (fgUsedVars[kEMCALmatchedNSigmaElectron])  values[kEMCALmatchedNSigmaElectron] = (cluster ? pinfo->EMCALnSigEle() : -9999.);
-    if (fgUsedVars[kEMCALmatchedDeltaPhi])        values[kEMCALmatchedDeltaPhi]       = (cluster ? deltaPhi : -9999.);
-    if (fgUsedVars[kEMCALmatchedDeltaEta])        values[kEMCALmatchedDeltaEta]       = (cluster ? deltaEta : -9999.);
-    if (fgUsedVars[kEMCALmatchedDistance])        values[kEMCALmatchedDistance]       = (cluster ? dist : -9999.);
-    if (fgUsedVars[kEMCALmatchedEOverP]) {
+    if (ctx.fUsedVars[kEMCALmatchedClusterId])       values[kEMCALmatchedClusterId]      = (cluster ? pinfo->CaloClusterId() : -9999.);
+    if (ctx.fUsedVars[kEMCALmatchedEnergy])          values[kEMCALmatchedEnergy]         = (cluster ? cluster->Energy() : -9999.);
+    if (ctx.fUsedVars[kEMCALmatchedM02])             values[kEMCALmatchedM02]            = (cluster ? cluster->M02() : -9999.);
+    if (ctx.fUsedVars[kEMCALmatchedM20])             values[kEMCALmatchedM20]            = (cluster ? cluster->M20() : -9999.);
+    if (ctx.fUsedVars[kEMCALmatchedNCells])          values[kEMCALmatchedNCells]         = (cluster ? cluster->NCells() : -9999.);
+    if (ctx.fUsedVars[kEMCALmatchedNMatchedTracks])  values[kEMCALmatchedNMatchedTracks] = (cluster ? cluster->NMatchedTracks() : -9999.);
+    if (ctx.fUsedVars[kEMCALmatchedNSigmaElectron])  values[kEMCALmatchedNSigmaElectron] = (cluster ? pinfo->EMCALnSigEle() : -9999.);
+    if (ctx.fUsedVars[kEMCALmatchedDeltaPhi])        values[kEMCALmatchedDeltaPhi]       = (cluster ? deltaPhi : -9999.);
+    if (ctx.fUsedVars[kEMCALmatchedDeltaEta])        values[kEMCALmatchedDeltaEta]       = (cluster ? deltaEta : -9999.);
+    if (ctx.fUsedVars[kEMCALmatchedDistance])        values[kEMCALmatchedDistance]       = (cluster ? dist : -9999.);
+    if (ctx.fUsedVars[kEMCALmatchedEOverP]) {
       Float_t               mom = 0.0;
       if (pinfo->PonCalo()) mom = pinfo->PonCalo();
       else                  mom = pinfo->P();
@@ -2047,6 +2057,7 @@ void AliReducedVarManager::GetLegMassAssumption(Int_t id, Float_t& m1, Float_t&
 
 //_________________________________________________________________
 void AliReducedVarManager::FillPairInfo(PAIR* p, Float_t* values) {
+  Context& ctx = *fgContext;
   //
   // fill pair information
   //
@@ -2056,7 +2067,7 @@ void AliReducedVarManager::FillPairInfo(PAIR* p, Float_t* values) {
   values[kPairType]      = p->PairType();
   values[kPairTypeSPD]      = p->PairTypeSPD();
   values[kPairChisquare] = p->Chi2();
-  if(fgUsedVars[kMass]) {
+  if(ctx.fUsedVars[kMass]) {
     values[kMass] = p->Mass();
     if(p->CandidateId()==PAIR::kLambda0ToPPi)  values[kMass] = p->Mass(1);
     if(p->CandidateId()==PAIR::kALambda0ToPPi) values[kMass] = p->Mass(2);
@@ -2071,24 +2082,25 @@ void AliReducedVarManager::FillPairInfo(PAIR* p, Float_t* values) {
   values[kMassV0+2] = p->Mass(2);
   values[kMassV0+3] = p->Mass(3);
   
-  if(fgUsedVars[kRap])    values[kRap]              = p->Rapidity();
-  if(fgUsedVars[kRapAbs]) values[kRapAbs]           = TMath::Abs(p->Rapidity());
+  if(ctx.fUsedVars[kRap])    values[kRap]              = p->Rapidity();
+  if(ctx.fUsedVars[kRapAbs]) values[kRapAbs]           = TMath::Abs(p->Rapidity());
                           values[kPairLxy]          = p->Lxy();
                           values[kPairPointingAngle]= p->PointingAngle();
 
   // polarization variables
   Bool_t usePolarization=kFALSE;
-  if(fgUsedVars[kPairThetaCS] || fgUsedVars[kPairThetaHE] || fgUsedVars[kPairPhiCS] || fgUsedVars[kPairPhiHE])
+  if(ctx.fUsedVars[kPairThetaCS] || ctx.fUsedVars[kPairThetaHE] || ctx.fUsedVars[kPairPhiCS] || ctx.fUsedVars[kPairPhiHE])
     usePolarization = kTRUE;
   if(usePolarization)
-    GetThetaPhiCM(fgEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(0)), 
-		  fgEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(1)), 
+    GetThetaPhiCM(ctx.fEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(0)), 
+		  ctx.fEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(1)), 
 		  values[kPairThetaHE], values[kPairPhiHE], values[kPairThetaCS], values[kPairPhiCS], m1, m2);
 }
 
 
 //_________________________________________________________________
 void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type, Float_t* values) {
+  Context& ctx = *fgContext;
   //
   // fill pair information from 2 tracks
   //
@@ -2115,7 +2127,7 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
   Float_t m1 = 0.0; Float_t m2 = 0.0;
   GetLegMassAssumption(type,m1,m2); 
     
-  if(fgUsedVars[kMass]) {     
+  if(ctx.fUsedVars[kMass]) {     
     values[kMass] = m1*m1+m2*m2 + 
                     2.0*(TMath::Sqrt(m1*m1+t1->P()*t1->P())*TMath::Sqrt(m2*m2+t2->P()*t2->P()) - 
                          t1->Px()*t2->Px() - t1->Py()*t2->Py() - t1->Pz()*t2->Pz());
@@ -2132,8 +2144,8 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
     p.SetMass(values[kMass]);
   }
 
-  if(fgUsedVars[kRap])    values[kRap]    = p.Rapidity();
-  if(fgUsedVars[kRapAbs]) values[kRapAbs] = TMath::Abs(p.Rapidity());
+  if(ctx.fUsedVars[kRap])    values[kRap]    = p.Rapidity();
+  if(ctx.fUsedVars[kRapAbs]) values[kRapAbs] = TMath::Abs(p.Rapidity());
   values[kPairLegPt+0] = t1->Pt();
   values[kPairLegPt+1] = t2->Pt();
   values[kPairLegPtSum] = t1->Pt()+t2->Pt();
@@ -2147,42 +2159,42 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
   
   // polarization variables
   Bool_t usePolarization=kFALSE;
-  if(fgUsedVars[kPairThetaCS] || fgUsedVars[kPairThetaHE] || fgUsedVars[kPairPhiCS] || fgUsedVars[kPairPhiHE])
+  if(ctx.fUsedVars[kPairThetaCS] || ctx.fUsedVars[kPairThetaHE] || ctx.fUsedVars[kPairPhiCS] || ctx.fUsedVars[kPairPhiHE])
     usePolarization = kTRUE;
   if(usePolarization)
     GetThetaPhiCM(t1, t2, values[kPairThetaHE], values[kPairPhiHE], values[kPairThetaCS], values[kPairPhiCS]);
   
-  if(fgUsedVars[kDMA] && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
+  if(ctx.fUsedVars[kDMA] && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
      TRACK* ti1=(TRACK*)t1; TRACK* ti2=(TRACK*)t2;
      values[kDMA]=TMath::Sqrt((ti1->HelixX()-ti2->HelixX())*(ti1->HelixX()-ti2->HelixX())+(ti1->HelixY()-ti2->HelixY())*(ti1->HelixY()-ti2->HelixY()))-ti1->HelixR()-ti2->HelixR();   
   }
   
-  if((fgUsedVars[kPairLegTPCchi2] || fgUsedVars[kPairLegTPCchi2+1]) && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
+  if((ctx.fUsedVars[kPairLegTPCchi2] || ctx.fUsedVars[kPairLegTPCchi2+1]) && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
      TRACK* ti1=(TRACK*)t1; TRACK* ti2=(TRACK*)t2;
      values[kPairLegTPCchi2] = ti1->TPCchi2();
      values[kPairLegTPCchi2+1] = ti2->TPCchi2();
   }
-  if((fgUsedVars[kPairLegITSchi2] || fgUsedVars[kPairLegITSchi2+1]) && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
+  if((ctx.fUsedVars[kPairLegITSchi2] || ctx.fUsedVars[kPairLegITSchi2+1]) && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
      TRACK* ti1=(TRACK*)t1; TRACK* ti2=(TRACK*)t2;
     values[kPairLegITSchi2] = ti1->ITSchi2();
     values[kPairLegITSchi2+1] = ti2->ITSchi2();
   }
   
-  if((fgUsedVars[kPseudoProperDecayTime] || fgUsedVars[kPairLxy]) &&  
+  if((ctx.fUsedVars[kPseudoProperDecayTime] || ctx.fUsedVars[kPairLxy]) &&  
      (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class()) && 
-     (fgEvent->IsA()==EVENT::Class())) {
+     (ctx.fEvent->IsA()==EVENT::Class())) {
      TRACK* ti1=(TRACK*)t1; 
      TRACK* ti2=(TRACK*)t2;
      AliKFParticle pairKF = BuildKFcandidate(ti1,m1,ti2,m2);
      Double_t errPseudoProperTime2;
-     EVENT* eventInfo = (EVENT*)fgEvent;
+     EVENT* eventInfo = (EVENT*)ctx.fEvent;
      AliKFParticle primVtx = BuildKFvertex(eventInfo);
-     if(fgUsedVars[kPseudoProperDecayTime]) 
+     if(ctx.fUsedVars[kPseudoProperDecayTime]) 
         values[kPseudoProperDecayTime] = pairKF.GetPseudoProperDecayTime(primVtx, fgkPairMass[type], &errPseudoProperTime2);
-     if(fgUsedVars[kPairLxy]) values[kPairLxy] =  ( (pairKF.X() - primVtx.X())*p.Px() + (pairKF.Y() - primVtx.Y())*p.Py() )/p.Pt(); // = values[kPseudoProperDecayTime]*(p.Pt()/PAIR::fgkPairMass[type]);
+     if(ctx.fUsedVars[kPairLxy]) values[kPairLxy] =  ( (pairKF.X() - primVtx.X())*p.Px() + (pairKF.Y() - primVtx.Y())*p.Py() )/p.Pt(); // = values[kPseudoProperDecayTime]*(p.Pt()/PAIR::fgkPairMass[type]);
   }
 
-  if ((fgUsedVars[kPairLegEMCALmatchedEnergy] || fgUsedVars[kPairLegEMCALmatchedEnergy+1]) &&
+  if ((ctx.fUsedVars[kPairLegEMCALmatchedEnergy] || ctx.fUsedVars[kPairLegEMCALmatchedEnergy+1]) &&
       (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
     TRACK* ti1=(TRACK*)t1;
     TRACK* ti2=(TRACK*)t2;
@@ -2204,18 +2216,18 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
         pMC.PxPyPz(t1->Px()+t2->Px(), t1->Py()+t2->Py(), t1->Pz()+t2->Pz());
      pMC.CandidateId(type);
      
-     if(fgUsedVars[kPtMC]) values[kPtMC] = pMC.Pt();
-     if(fgUsedVars[kPMC]) values[kPMC] = pMC.P();
+     if(ctx.fUsedVars[kPtMC]) values[kPtMC] = pMC.Pt();
+     if(ctx.fUsedVars[kPMC]) values[kPMC] = pMC.P();
      values[kPxMC] = pMC.Px();
      values[kPyMC] = pMC.Py();
      values[kPzMC] = pMC.Pz();
      values[kPt_weight]=0.0;
-     if(fgUsedVars[kPt_weight]) values[kPt_weight] =  CalculateWeightFactor(values[kPtMC],values[kCentVZERO]);
+     if(ctx.fUsedVars[kPt_weight]) values[kPt_weight] =  CalculateWeightFactor(values[kPtMC],values[kCentVZERO]);
      
-     if(fgUsedVars[kThetaMC]) values[kThetaMC] = pMC.Theta();
-     if(fgUsedVars[kEtaMC]) values[kEtaMC] = pMC.Eta();
-     if(fgUsedVars[kPhiMC]) values[kPhiMC] = pMC.Phi();
-     if(fgUsedVars[kMassMC]) {
+     if(ctx.fUsedVars[kThetaMC]) values[kThetaMC] = pMC.Theta();
+     if(ctx.fUsedVars[kEtaMC]) values[kEtaMC] = pMC.Eta();
+     if(ctx.fUsedVars[kPhiMC]) values[kPhiMC] = pMC.Phi();
+     if(ctx.fUsedVars[kMassMC]) {
         if(pinfo1 && pinfo2 && !pinfo1->IsMCTruth() && !pinfo2->IsMCTruth())
            values[kMassMC] = m1*m1+m2*m2 + 
               2.0*(TMath::Sqrt(m1*m1+pinfo1->PMC()*pinfo1->PMC())*TMath::Sqrt(m2*m2+pinfo2->PMC()*pinfo2->PMC()) - 
@@ -2235,14 +2247,14 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
      }
      
      // TODO: think about whether to use the PDG mass or the calculated mass from the legs for rapidity
-     if(fgUsedVars[kRapMC]) {
+     if(ctx.fUsedVars[kRapMC]) {
        pMC.SetMass(values[kMassMC]);
        values[kRapMC] = pMC.Rapidity();   
      }
-     if(fgUsedVars[kRapMCAbs]) values[kRapMCAbs] = TMath::Abs(pMC.Rapidity());
+     if(ctx.fUsedVars[kRapMCAbs]) values[kRapMCAbs] = TMath::Abs(pMC.Rapidity());
   }
 
-   if( fgUsedVars[kPairPhiV] ){
+   if( ctx.fUsedVars[kPairPhiV] ){
     // implementation taken from AliDielectronPair.cxx
     Double_t px1=-9999.,py1=-9999.,pz1=-9999.;
     Double_t px2=-9999.,py2=-9999.,pz2=-9999.;
@@ -2353,7 +2365,7 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
     values[kPairPhiV] = phiv;
   }
 
-  if( fgUsedVars[kPairOpeningAngle] ){
+  if( ctx.fUsedVars[kPairOpeningAngle] ){
     TVector3 v1(t1->Px(), t1->Py(), t1->Pz());
     TVector3 v2(t2->Px(), t2->Py(), t2->Pz());
     values[kPairOpeningAngle] = v1.Angle(v2);
@@ -2363,22 +2375,22 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
     TRACK* ti1=(TRACK*)t1;
     TRACK* ti2=(TRACK*)t2;
 
-    if( fgUsedVars[kPairDca]   ) values[kPairDca]   = TMath::Sqrt(ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() + ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz());
-    if( fgUsedVars[kPairDcaXY] ) values[kPairDcaXY] = TMath::Sqrt( ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() );
-    if( fgUsedVars[kPairDcaZ]  ) values[kPairDcaZ]  = TMath::Sqrt(ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz() );
+    if( ctx.fUsedVars[kPairDca]   ) values[kPairDca]   = TMath::Sqrt(ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() + ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz());
+    if( ctx.fUsedVars[kPairDcaXY] ) values[kPairDcaXY] = TMath::Sqrt( ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() );
+    if( ctx.fUsedVars[kPairDcaZ]  ) values[kPairDcaZ]  = TMath::Sqrt(ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz() );
 
-    if( fgUsedVars[kPairDcaSqrt]   ) values[kPairDcaSqrt]   = TMath::Power(ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() + ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz(), 0.25);
-    if( fgUsedVars[kPairDcaXYSqrt] ) values[kPairDcaXYSqrt] = TMath::Power( ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy(), 0.25);
-    if( fgUsedVars[kPairDcaZSqrt]  ) values[kPairDcaZSqrt]  = TMath::Power(ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz(), 0.25);
+    if( ctx.fUsedVars[kPairDcaSqrt]   ) values[kPairDcaSqrt]   = TMath::Power(ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() + ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz(), 0.25);
+    if( ctx.fUsedVars[kPairDcaXYSqrt] ) values[kPairDcaXYSqrt] = TMath::Power( ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy(), 0.25);
+    if( ctx.fUsedVars[kPairDcaZSqrt]  ) values[kPairDcaZSqrt]  = TMath::Power(ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz(), 0.25);
 
-    if( fgUsedVars[kOpAngDcaPtCorr] ) {
+    if( ctx.fUsedVars[kOpAngDcaPtCorr] ) {
       Float_t a = -1.56316e-03;
       Float_t b =  1.22515e-02;
       Float_t c =  3.39455e-03;
       Float_t d =  1.00681e-01;
       values[kOpAngDcaPtCorr] = values[kPairOpeningAngle] - a - b * values[kPairDcaXYSqrt] - c * values[kOneOverSqrtPt] -  d * values[kPairDcaXYSqrt]  * values[kOneOverSqrtPt];
     }
-    if( fgUsedVars[kMassDcaPtCorr] ) {
+    if( ctx.fUsedVars[kMassDcaPtCorr] ) {
       Float_t a =  1.87774e-03;
       Float_t b =  4.53156e-02;
       Float_t c = -9.72947e-05;
@@ -2391,6 +2403,7 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
 
 //_________________________________________________________________
 void AliReducedVarManager::FillPairInfoME(BASETRACK* t1, BASETRACK* t2, Int_t type, Float_t* values) {
+  Context& ctx = *fgContext;
   //
   // Lightweight fill pair information from 2 base track objects.
   // NOTE: Mostly intended for making pairing during event mixing.
@@ -2418,7 +2431,7 @@ void AliReducedVarManager::FillPairInfoME(BASETRACK* t1, BASETRACK* t2, Int_t ty
   Float_t m1 = 0.0; Float_t m2 = 0.0;
   GetLegMassAssumption(type,m1,m2); 
     
-  if(fgUsedVars[kMass]) {     
+  if(ctx.fUsedVars[kMass]) {     
     values[kMass] = m1*m1+m2*m2 + 
                     2.0*(TMath::Sqrt(m1*m1+t1->P()*t1->P())*TMath::Sqrt(m2*m2+t2->P()*t2->P()) - 
                     t1->Px()*t2->Px() - t1->Py()*t2->Py() - t1->Pz()*t2->Pz());
@@ -2438,21 +2451,21 @@ void AliReducedVarManager::FillPairInfoME(BASETRACK* t1, BASETRACK* t2, Int_t ty
   values[kPx] = p.Px();
   values[kPy] = p.Py();
   values[kPz] = p.Pz();
-  if(fgUsedVars[kPt] || fgUsedVars[kPtSquared]) {
+  if(ctx.fUsedVars[kPt] || ctx.fUsedVars[kPtSquared]) {
     values[kPt] = p.Pt();
-    if(fgUsedVars[kPtSquared]) values[kPtSquared] = values[kPt]*values[kPt];
+    if(ctx.fUsedVars[kPtSquared]) values[kPtSquared] = values[kPt]*values[kPt];
   }
   values[kPairLegPt] = t1->Pt();
   values[kPairLegPt+1] = t2->Pt();
   values[kPairLegPtSum] = t1->Pt() + t2->Pt();
-  if(fgUsedVars[kP])      values[kP]      = p.P();
-  if(fgUsedVars[kEta])    values[kEta]    = p.Eta();
-  if(fgUsedVars[kRap])    values[kRap]    = p.Rapidity();
-  if(fgUsedVars[kRapAbs]) values[kRapAbs] = TMath::Abs(p.Rapidity());
-  if(fgUsedVars[kPhi])    values[kPhi]    = p.Phi();
-  if(fgUsedVars[kTheta])  values[kTheta]  = p.Theta();
+  if(ctx.fUsedVars[kP])      values[kP]      = p.P();
+  if(ctx.fUsedVars[kEta])    values[kEta]    = p.Eta();
+  if(ctx.fUsedVars[kRap])    values[kRap]    = p.Rapidity();
+  if(ctx.fUsedVars[kRapAbs]) values[kRapAbs] = TMath::Abs(p.Rapidity());
+  if(ctx.fUsedVars[kPhi])    values[kPhi]    = p.Phi();
+  if(ctx.fUsedVars[kTheta])  values[kTheta]  = p.Theta();
   
-  if ((fgUsedVars[kPairLegEMCALmatchedEnergy] || fgUsedVars[kPairLegEMCALmatchedEnergy+1]) &&
+  if ((ctx.fUsedVars[kPairLegEMCALmatchedEnergy] || ctx.fUsedVars[kPairLegEMCALmatchedEnergy+1]) &&
       (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
     TRACK* ti1=(TRACK*)t1;
     TRACK* ti2=(TRACK*)t2;
@@ -2460,7 +2473,7 @@ void AliReducedVarManager::FillPairInfoME(BASETRACK* t1, BASETRACK* t2, Int_t ty
     values[kPairLegEMCALmatchedEnergy+1]  = ti2->MatchedEMCalClusterEnergy();
   }
 
-  if((fgUsedVars[kPairEff] || fgUsedVars[kOneOverPairEff] || fgUsedVars[kOneOverPairEffSq]) && fgPairEffMap) {
+  if((ctx.fUsedVars[kPairEff] || ctx.fUsedVars[kOneOverPairEff] || ctx.fUsedVars[kOneOverPairEffSq]) && fgPairEffMap) {
     Int_t binX = 0;
     if (fgEffMapVarDependencyX!=kNothing) {
       binX = fgPairEffMap->GetXaxis()->FindBin(values[fgEffMapVarDependencyX]); //make sure the values[XVar] are filled for EM
@@ -2498,6 +2511,7 @@ void AliReducedVarManager::FillPairInfoME(BASETRACK* t1, BASETRACK* t2, Int_t ty
 
 //____________________________________________________________________________________
 void AliReducedVarManager::FillPairMEflow(BASETRACK* t1, BASETRACK* t2, Float_t* values/*, Int_t idx /*=0*/) {
+  Context& ctx = *fgContext;
     //
     // make flow calculations for mixed event pairs
     // NOTE: this function assumes that the function FillPairInfoME() was run just in front of this one
@@ -2509,7 +2523,7 @@ void AliReducedVarManager::FillPairMEflow(BASETRACK* t1, BASETRACK* t2, Float_t*
     // full method
     TRACK* track1 = (TRACK*)t1;
     TRACK* track2 = (TRACK*)t2;
-    if(fgUsedVars[kPairVZEROFlowSPNom+0*6+1] || fgUsedVars[kPairVZEROFlowSPDenom+0*6+1]) {
+    if(ctx.fUsedVars[kPairVZEROFlowSPNom+0*6+1] || ctx.fUsedVars[kPairVZEROFlowSPDenom+0*6+1]) {
         values[kPairVZEROFlowSPNom+0*6+1] = TMath::Cos(2.0*(t1->Phi()-values[kPhi]))*(TMath::Cos(2.0*t1->Phi())*track1->CovMatrix(0)+TMath::Sin(2.0*t1->Phi())*track1->CovMatrix(1));
         values[kPairVZEROFlowSPNom+0*6+1] += TMath::Cos(2.0*(t2->Phi()-values[kPhi]))*(TMath::Cos(2.0*t2->Phi())*track2->CovMatrix(0)+TMath::Sin(2.0*t2->Phi())*track2->CovMatrix(1));
         values[kPairVZEROFlowSPDenom+0*6+1] = 1.0 + 
@@ -2518,7 +2532,7 @@ void AliReducedVarManager::FillPairMEflow(BASETRACK* t1, BASETRACK* t2, Float_t*
                TMath::Cos(2.0*(t1->Phi()-t2->Phi()));
     }
     
-    if(fgUsedVars[kPairVZEROFlowSPNom+1*6+1] || fgUsedVars[kPairVZEROFlowSPDenom+1*6+1]) {
+    if(ctx.fUsedVars[kPairVZEROFlowSPNom+1*6+1] || ctx.fUsedVars[kPairVZEROFlowSPDenom+1*6+1]) {
         values[kPairVZEROFlowSPNom+1*6+1] = TMath::Cos(2.0*(t1->Phi()-values[kPhi]))*(TMath::Cos(2.0*t1->Phi())*track1->CovMatrix(2)+TMath::Sin(2.0*t1->Phi())*track1->CovMatrix(3));
         values[kPairVZEROFlowSPNom+1*6+1] += TMath::Cos(2.0*(t2->Phi()-values[kPhi]))*(TMath::Cos(2.0*t2->Phi())*track2->CovMatrix(2)+TMath::Sin(2.0*t2->Phi())*track2->CovMatrix(3));
         values[kPairVZEROFlowSPDenom+1*6+1] = 1.0 + 
@@ -2527,7 +2541,7 @@ void AliReducedVarManager::FillPairMEflow(BASETRACK* t1, BASETRACK* t2, Float_t*
                TMath::Cos(2.0*(t1->Phi()-t2->Phi()));
     }
     
-    if(fgUsedVars[kPairTPCFlowSPNom+1] || fgUsedVars[kPairTPCFlowSPDenom+1]) {
+    if(ctx.fUsedVars[kPairTPCFlowSPNom+1] || ctx.fUsedVars[kPairTPCFlowSPDenom+1]) {
         values[kPairTPCFlowSPNom+1] = TMath::Cos(2.0*(t1->Phi()-values[kPhi]))*(TMath::Cos(2.0*t1->Phi())*track1->CovMatrix(4)+TMath::Sin(2.0*t1->Phi())*track1->CovMatrix(5));
         values[kPairTPCFlowSPNom+1] += TMath::Cos(2.0*(t2->Phi()-values[kPhi]))*(TMath::Cos(2.0*t2->Phi())*track2->CovMatrix(4)+TMath::Sin(2.0*t2->Phi())*track2->CovMatrix(5));
         values[kPairTPCFlowSPDenom+1] = 1.0 + 
@@ -2557,7 +2571,7 @@ void AliReducedVarManager::FillPairInfo(PAIR* t1, BASETRACK* t2, Int_t type, Flo
   Float_t m1 = 0.0; Float_t m2 = 0.0;
   GetLegMassAssumption(type,m1,m2); 
   
-  if(fgUsedVars[kMass]) {     
+  if(fgContext->fUsedVars[kMass]) {     
     values[kMass] = m1*m1+m2*m2 + 
                     2.0*(TMath::Sqrt(m1*m1+t1->P()*t1->P())*TMath::Sqrt(m2*m2+t2->P()*t2->P()) - 
                     t1->Px()*t2->Px() - t1->Py()*t2->Py() - t1->Pz()*t2->Pz());
@@ -2584,30 +2598,31 @@ void AliReducedVarManager::FillPairInfo(PAIR* t1, BASETRACK* t2, Int_t type, Flo
 
 //__________________________________________________________________
 void AliReducedVarManager::FillPsiPrimeInfo(BASETRACK* trig, BASETRACK* pion1, BASETRACK* pion2, Float_t* values) {
+  Context& ctx = *fgContext;
   //
   // Fill psi prime information
   // NOTE: decay channel used here is psi' -> jpsi + pi + pi
-  // note pion1 is positive (see calling FillPsiPrimeInfo in AliReducedAnalysisPsiPrime)  if(fgUsedVars[kTriggerPt]) values[kTriggerPt] = trig->Pt();
+  // note pion1 is positive (see calling FillPsiPrimeInfo in AliReducedAnalysisPsiPrime)  if(ctx.fUsedVars[kTriggerPt]) values[kTriggerPt] = trig->Pt();
   
-  if(fgUsedVars[kTriggerRap] && (trig->IsA()==PAIR::Class())) 	  values[kTriggerRap]     = ((PAIR*)trig)->Rapidity();
-  if(fgUsedVars[kTriggerRapAbs] && (trig->IsA()==PAIR::Class()))  values[kTriggerRapAbs]  = TMath::Abs(((PAIR*)trig)->Rapidity());
+  if(ctx.fUsedVars[kTriggerRap] && (trig->IsA()==PAIR::Class())) 	  values[kTriggerRap]     = ((PAIR*)trig)->Rapidity();
+  if(ctx.fUsedVars[kTriggerRapAbs] && (trig->IsA()==PAIR::Class()))  values[kTriggerRapAbs]  = TMath::Abs(((PAIR*)trig)->Rapidity());
   
-  if(fgUsedVars[kAssociatedPt]) values[kAssociatedPt] = pion1->Pt();
-  if(fgUsedVars[kAssociatedEta]) values[kAssociatedEta] = pion1->Eta();
-  if(fgUsedVars[kAssociatedPhi]) values[kAssociatedPhi] = pion1->Phi();
+  if(ctx.fUsedVars[kAssociatedPt]) values[kAssociatedPt] = pion1->Pt();
+  if(ctx.fUsedVars[kAssociatedEta]) values[kAssociatedEta] = pion1->Eta();
+  if(ctx.fUsedVars[kAssociatedPhi]) values[kAssociatedPhi] = pion1->Phi();
 
-  if(fgUsedVars[kPPosPi]) values[kPPosPi] = pion1->P();
-  if(fgUsedVars[kPtPosPi]) values[kPtPosPi] = pion1->Pt();//same as kAssociatedPt
+  if(ctx.fUsedVars[kPPosPi]) values[kPPosPi] = pion1->P();
+  if(ctx.fUsedVars[kPtPosPi]) values[kPtPosPi] = pion1->Pt();//same as kAssociatedPt
 
-  if(fgUsedVars[kAssociated2Pt]) values[kAssociated2Pt] = pion2->Pt();
-  if(fgUsedVars[kAssociated2Eta]) values[kAssociated2Eta] = pion2->Eta();
-  if(fgUsedVars[kAssociated2Phi]) values[kAssociated2Phi] = pion2->Phi();
+  if(ctx.fUsedVars[kAssociated2Pt]) values[kAssociated2Pt] = pion2->Pt();
+  if(ctx.fUsedVars[kAssociated2Eta]) values[kAssociated2Eta] = pion2->Eta();
+  if(ctx.fUsedVars[kAssociated2Phi]) values[kAssociated2Phi] = pion2->Phi();
   
-  if(fgUsedVars[kPNegPi]) values[kPNegPi] = pion2->P();
-  if(fgUsedVars[kPtNegPi]) values[kPtNegPi] = pion2->Pt();
+  if(ctx.fUsedVars[kPNegPi]) values[kPNegPi] = pion2->P();
+  if(ctx.fUsedVars[kPtNegPi]) values[kPtNegPi] = pion2->Pt();
   
-  if(fgUsedVars[kPJPsi]) values[kPJPsi] = trig->P();
-  if(fgUsedVars[kPtJPsi]) values[kPtJPsi] = trig->Pt();
+  if(ctx.fUsedVars[kPJPsi]) values[kPJPsi] = trig->P();
+  if(ctx.fUsedVars[kPtJPsi]) values[kPtJPsi] = trig->Pt();
   
   if (trig->IsA()==PAIR::Class() ) {    
     TLorentzVector trigVec;
@@ -2692,22 +2707,23 @@ void AliReducedVarManager::FillPsiPrimeInfo(BASETRACK* trig, BASETRACK* pion1, B
 
 //__________________________________________________________________
 void AliReducedVarManager::FillCorrelationInfo(BASETRACK* trig, BASETRACK* assoc, Float_t* values) {
+  Context& ctx = *fgContext;
   //
   // fill pair-track correlation information
   // NOTE:  Add here only NEEDED information because this function is called during event mixing in the innermost loop
   //
-  if(fgUsedVars[kTriggerPt]) values[kTriggerPt] = trig->Pt();
-  if(fgUsedVars[kTriggerRap] && (trig->IsA()==PAIR::Class())) 	  values[kTriggerRap]     = ((PAIR*)trig)->Rapidity();
-  if(fgUsedVars[kTriggerRapAbs] && (trig->IsA()==PAIR::Class()))  values[kTriggerRapAbs]  = TMath::Abs(((PAIR*)trig)->Rapidity());
-  if(fgUsedVars[kTriggerPseudoProperDecayTime] && (trig->IsA()==PAIR::Class())) values[kTriggerPseudoProperDecayTime] = ((PAIR*)trig)->PsProper();
-  if(fgUsedVars[kTriggerPairTypeSPD] && (trig->IsA()==PAIR::Class()))           values[kTriggerPairTypeSPD]           = ((PAIR*)trig)->PairTypeSPD();
-  if(fgUsedVars[kAssociatedPt]) values[kAssociatedPt] = assoc->Pt();
-  if(fgUsedVars[kAssociatedEta]) values[kAssociatedEta] = assoc->Eta();
-  if(fgUsedVars[kAssociatedPhi]) values[kAssociatedPhi] = assoc->Phi();
+  if(ctx.fUsedVars[kTriggerPt]) values[kTriggerPt] = trig->Pt();
+  if(ctx.fUsedVars[kTriggerRap] && (trig->IsA()==PAIR::Class())) 	  values[kTriggerRap]     = ((PAIR*)trig)->Rapidity();
+  if(ctx.fUsedVars[kTriggerRapAbs] && (trig->IsA()==PAIR::Class()))  values[kTriggerRapAbs]  = TMath::Abs(((PAIR*)trig)->Rapidity());
+  if(ctx.fUsedVars[kTriggerPseudoProperDecayTime] && (trig->IsA()==PAIR::Class())) values[kTriggerPseudoProperDecayTime] = ((PAIR*)trig)->PsProper();
+  if(ctx.fUsedVars[kTriggerPairTypeSPD] && (trig->IsA()==PAIR::Class()))           values[kTriggerPairTypeSPD]           = ((PAIR*)trig)->PairTypeSPD();
+  if(ctx.fUsedVars[kAssociatedPt]) values[kAssociatedPt] = assoc->Pt();
+  if(ctx.fUsedVars[kAssociatedEta]) values[kAssociatedEta] = assoc->Eta();
+  if(ctx.fUsedVars[kAssociatedPhi]) values[kAssociatedPhi] = assoc->Phi();
 
   // associated pT / transverse trigger gamma
   if (trig->IsA()==PAIR::Class() &&
-      (fgUsedVars[kAssociatedPtOverTriggerGammaT] || fgUsedVars[kTriggerGammaT])) {
+      (ctx.fUsedVars[kAssociatedPtOverTriggerGammaT] || ctx.fUsedVars[kTriggerGammaT])) {
 
     // NOTE:  only interested in transverse beta (gamma) -> eta is set to zero for beta vector calculation
     //        gives same result as 'manual' calculation, i.e.:  betaT  = pT / (m^2 + pT^2)
@@ -2719,14 +2735,14 @@ void AliReducedVarManager::FillCorrelationInfo(BASETRACK* trig, BASETRACK* assoc
     Float_t betaT   = betaVec.Mag();
     Float_t gammaT  = 1./TMath::Sqrt(1-betaT*betaT);
 
-    if (fgUsedVars[kTriggerGammaT])                 values[kTriggerGammaT]                  = gammaT;
-    if (fgUsedVars[kAssociatedPtOverTriggerGammaT]) values[kAssociatedPtOverTriggerGammaT]  = assoc->Pt()/gammaT;
+    if (ctx.fUsedVars[kTriggerGammaT])                 values[kTriggerGammaT]                  = gammaT;
+    if (ctx.fUsedVars[kAssociatedPtOverTriggerGammaT]) values[kAssociatedPtOverTriggerGammaT]  = assoc->Pt()/gammaT;
   }
 
   // values after boost of hadrons to pair rest frame
   if (trig->IsA()==PAIR::Class() &&
-      (fgUsedVars[kDeltaPhiBoosted] || fgUsedVars[kDeltaPhiSymBoosted] || fgUsedVars[kDeltaThetaBoosted] || fgUsedVars[kDeltaEtaBoosted] ||
-       fgUsedVars[kDeltaEtaAbsBoosted] || fgUsedVars[kAssociatedPtBoosted] || fgUsedVars[kAssociatedEtaBoosted] || fgUsedVars[kAssociatedPhiBoosted])) {
+      (ctx.fUsedVars[kDeltaPhiBoosted] || ctx.fUsedVars[kDeltaPhiSymBoosted] || ctx.fUsedVars[kDeltaThetaBoosted] || ctx.fUsedVars[kDeltaEtaBoosted] ||
+       ctx.fUsedVars[kDeltaEtaAbsBoosted] || ctx.fUsedVars[kAssociatedPtBoosted] || ctx.fUsedVars[kAssociatedEtaBoosted] || ctx.fUsedVars[kAssociatedPhiBoosted])) {
 
     // get boost vector
     TLorentzVector trigVec;
@@ -2738,48 +2754,48 @@ void AliReducedVarManager::FillCorrelationInfo(BASETRACK* trig, BASETRACK* assoc
     assocVec.SetPtEtaPhiM(assoc->Pt(), assoc->Eta(), assoc->Phi(), 0.13957061); // NOTE: pion mass from PDG
     assocVec.Boost(-boostVec);
 
-    if(fgUsedVars[kAssociatedPtBoosted]) values[kAssociatedPtBoosted] = assocVec.Pt();
-    if(fgUsedVars[kAssociatedEtaBoosted]) values[kAssociatedEtaBoosted] = assocVec.Eta();
-    if(fgUsedVars[kAssociatedPhiBoosted]) values[kAssociatedPhiBoosted] = assocVec.Phi();
+    if(ctx.fUsedVars[kAssociatedPtBoosted]) values[kAssociatedPtBoosted] = assocVec.Pt();
+    if(ctx.fUsedVars[kAssociatedEtaBoosted]) values[kAssociatedEtaBoosted] = assocVec.Eta();
+    if(ctx.fUsedVars[kAssociatedPhiBoosted]) values[kAssociatedPhiBoosted] = assocVec.Phi();
 
-    if(fgUsedVars[kDeltaPhiBoosted]) {
+    if(ctx.fUsedVars[kDeltaPhiBoosted]) {
       Double_t delta = trig->Phi() - assocVec.Phi();
       if(delta>3.0/2.0*TMath::Pi()) delta -= 2.0*TMath::Pi();
       if(delta<-0.5*TMath::Pi()) delta += 2.0*TMath::Pi();
       values[kDeltaPhiBoosted] = delta;
     }
-    if(fgUsedVars[kDeltaPhiSymBoosted]) {
+    if(ctx.fUsedVars[kDeltaPhiSymBoosted]) {
       Double_t delta = TMath::Abs(trig->Phi() - assocVec.Phi());
       if(delta>TMath::Pi()) delta = 2*TMath::Pi()-delta;
       values[kDeltaPhiSymBoosted] = delta;
     }
 
-    if(fgUsedVars[kDeltaThetaBoosted]) values[kDeltaThetaBoosted] = trig->Theta() - assocVec.Theta();
+    if(ctx.fUsedVars[kDeltaThetaBoosted]) values[kDeltaThetaBoosted] = trig->Theta() - assocVec.Theta();
 
-    if(fgUsedVars[kDeltaEtaBoosted])     values[kDeltaEtaBoosted]     = trig->Eta() - assocVec.Eta();
-    if(fgUsedVars[kDeltaEtaAbsBoosted])  values[kDeltaEtaAbsBoosted]  = TMath::Abs(trig->Eta() - assocVec.Eta());
+    if(ctx.fUsedVars[kDeltaEtaBoosted])     values[kDeltaEtaBoosted]     = trig->Eta() - assocVec.Eta();
+    if(ctx.fUsedVars[kDeltaEtaAbsBoosted])  values[kDeltaEtaAbsBoosted]  = TMath::Abs(trig->Eta() - assocVec.Eta());
   }
 
-  if(fgUsedVars[kDeltaPhi]) {
+  if(ctx.fUsedVars[kDeltaPhi]) {
     Double_t delta = trig->Phi() - assoc->Phi();
     if(delta>3.0/2.0*TMath::Pi()) delta -= 2.0*TMath::Pi();
     if(delta<-0.5*TMath::Pi()) delta += 2.0*TMath::Pi();
     values[kDeltaPhi] = delta;
   }
-  if(fgUsedVars[kDeltaPhiSym]) {
+  if(ctx.fUsedVars[kDeltaPhiSym]) {
     Double_t delta = TMath::Abs(trig->Phi() - assoc->Phi());
     if(delta>TMath::Pi()) delta = 2*TMath::Pi()-delta;
     values[kDeltaPhiSym] = delta;
   }
 
-  if(fgUsedVars[kDeltaTheta]) values[kDeltaTheta] = trig->Theta() - assoc->Theta();
+  if(ctx.fUsedVars[kDeltaTheta]) values[kDeltaTheta] = trig->Theta() - assoc->Theta();
   
-  if(fgUsedVars[kDeltaEta])     values[kDeltaEta]     = trig->Eta() - assoc->Eta();
-  if(fgUsedVars[kDeltaEtaAbs])  values[kDeltaEtaAbs]  = TMath::Abs(trig->Eta() - assoc->Eta());
-  if(fgUsedVars[kMass] && (trig->IsA()==PAIR::Class())) values[kMass] = ((PAIR*)trig)->Mass();
+  if(ctx.fUsedVars[kDeltaEta])     values[kDeltaEta]     = trig->Eta() - assoc->Eta();
+  if(ctx.fUsedVars[kDeltaEtaAbs])  values[kDeltaEtaAbs]  = TMath::Abs(trig->Eta() - assoc->Eta());
+  if(ctx.fUsedVars[kMass] && (trig->IsA()==PAIR::Class())) values[kMass] = ((PAIR*)trig)->Mass();
 
   // J/psi efficiency variables
-  if ((fgUsedVars[kTriggerEff] || fgUsedVars[kOneOverTriggerEff]) && fgPairEffMap) {
+  if ((ctx.fUsedVars[kTriggerEff] || ctx.fUsedVars[kOneOverTriggerEff]) && fgPairEffMap) {
     Int_t binX = 0;
     if (fgEffMapVarDependencyXCorr!=kNothing) {
       binX = fgPairEffMap->GetXaxis()->FindBin(values[fgEffMapVarDependencyXCorr]);
@@ -2812,7 +2828,7 @@ void AliReducedVarManager::FillCorrelationInfo(BASETRACK* trig, BASETRACK* assoc
   }
 
   // hadron efficiency variables
-  if ((fgUsedVars[kAssocHadronEff] || fgUsedVars[kOneOverAssocHadronEff]) && fgAssocHadronEffMap) {
+  if ((ctx.fUsedVars[kAssocHadronEff] || ctx.fUsedVars[kOneOverAssocHadronEff]) && fgAssocHadronEffMap) {
     Int_t binX = 0;
     if (fgAssocHadronEffMapVarDependencyX!=kNothing) {
       binX = fgAssocHadronEffMap->GetXaxis()->FindBin(values[fgAssocHadronEffMapVarDependencyX]);
@@ -2845,7 +2861,7 @@ void AliReducedVarManager::FillCorrelationInfo(BASETRACK* trig, BASETRACK* assoc
   }
 
   // J/psi x hadron efficiency variables
-  if ((fgUsedVars[kTriggerEffTimesAssocHadronEff] || fgUsedVars[kOneOverTriggerEffTimesAssocHadronEff]) &&
+  if ((ctx.fUsedVars[kTriggerEffTimesAssocHadronEff] || ctx.fUsedVars[kOneOverTriggerEffTimesAssocHadronEff]) &&
       fgPairEffMap && fgAssocHadronEffMap) {
     values[kTriggerEffTimesAssocHadronEff]        = values[kTriggerEff]*values[kAssocHadronEff];
     values[kOneOverTriggerEffTimesAssocHadronEff] = values[kOneOverTriggerEff]*values[kOneOverAssocHadronEff];
@@ -3812,6 +3828,7 @@ void AliReducedVarManager::SetTPCpidCalibMaps(Int_t pid, THnF* centroidMap, THnF
 
 //____________________________________________________________________________________
 void AliReducedVarManager::SetTPCpidCalibDepVars(Variables vars[]) {
+  Context& ctx = *fgContext;
    //
    //
    //
@@ -3821,14 +3838,14 @@ void AliReducedVarManager::SetTPCpidCalibDepVars(Variables vars[]) {
          return;
       }
       fgTPCpidCalibVars[i] = vars[i];
-      fgUsedVars[vars[i]] = kTRUE;
+      ctx.fUsedVars[vars[i]] = kTRUE;
       if(vars[i]==kTPCpileupZA || vars[i]==kTPCpileupZC) {
-         fgUsedVars[kTPCpileupZA] = kTRUE;
-         fgUsedVars[kTPCpileupZC] = kTRUE;
+         ctx.fUsedVars[kTPCpileupZA] = kTRUE;
+         ctx.fUsedVars[kTPCpileupZC] = kTRUE;
       }
       if(vars[i]==kTPCpileupContributorsA || vars[i]==kTPCpileupContributorsC) {
-         fgUsedVars[kTPCpileupContributorsA] = kTRUE;
-         fgUsedVars[kTPCpileupContributorsC] = kTRUE;
+         ctx.fUsedVars[kTPCpileupContributorsA] = kTRUE;
+         ctx.fUsedVars[kTPCpileupContributorsC] = kTRUE;
       }
    }
 }
@@ -768,6 +768,33 @@ class AliReducedVarManager : public TObject {
   
   static const Double_t fgkSPDEtaCutsVsVtxZ[20][2];      // eta interval coverage for the SPDntracklets estimator as a function of vtx 
     
+  // Per configuration state of the fill functions: the current event and event plane, and the flags of the
+  // used variables. The static API works on a default context. Several configurations in one process use one
+  // context each, through the fill functions taking a context or through a ContextScope (e.g. around SetUseVars()
+  // when configuring). The run-wise state (current run number, GRP information, VZERO/TPC recentering and
+  // multiplicity calibrations) is process-wide and reloaded by FillEventInfo() on a run change: contexts used
+  // on different threads are not safe against each other when the run changes.
+  class Context {
+  public:
+    Context() : fEvent(0x0), fEventPlane(0x0) { for(Int_t i=0;i<kNVars;++i) fUsedVars[i]=kFALSE; }
+    AliReducedBaseEvent* fEvent;            // pointer to the current event
+    AliReducedEventPlaneInfo* fEventPlane;  // pointer to the current event plane
+    Bool_t fUsedVars[kNVars];               // array of flags toggled when the corresponding variable is required (e.g., in the histogram manager, in cuts, mixing handler, etc.) 
+  private:
+    Context(const Context &c);
+    Context &operator=(const Context &c);
+  };
+  // Makes a context the current one of this thread, until the scope is left
+  class ContextScope {
+  public:
+    ContextScope(Context &ctx) : fPrevious(fgContext) { fgContext=&ctx; }
+    ~ContextScope() { fgContext=fPrevious; }
+  private:
+    Context* fPrevious;
+    ContextScope(const ContextScope &c);
+    ContextScope &operator=(const ContextScope &c);
+  };
+  
   AliReducedVarManager();
   AliReducedVarManager(const Char_t* name);
   virtual ~AliReducedVarManager();
@@ -775,16 +802,16 @@ class AliReducedVarManager : public TObject {
   static void SetBeamMomentum(Float_t beamMom) {fgBeamMomentum = beamMom;}
   static Float_t GetBeamMomentum() {return fgBeamMomentum;}
   
-  static void SetEvent(AliReducedBaseEvent* const ev) {fgEvent = ev;};
-  static void SetEventPlane(AliReducedEventPlaneInfo* const ev) {fgEventPlane = ev;};
-  static void SetUseVariable(Int_t var) {fgUsedVars[var] = kTRUE; SetVariableDependencies();}
+  static void SetEvent(AliReducedBaseEvent* const ev) {fgContext->fEvent = ev;};
+  static void SetEventPlane(AliReducedEventPlaneInfo* const ev) {fgContext->fEventPlane = ev;};
+  static void SetUseVariable(Int_t var) {fgContext->fUsedVars[var] = kTRUE; SetVariableDependencies();}
   static void SetUseVars(const Bool_t* usedVars) {
     for(Int_t i=0;i<kNVars;++i) {
-      if(usedVars[i]) fgUsedVars[i]=kTRUE;    // overwrite only the variables that are being used since there are more channels to modify the used variables array, independently
+      if(usedVars[i]) fgContext->fUsedVars[i]=kTRUE;    // overwrite only the variables that are being used since there are more channels to modify the used variables array, independently
     }
     SetVariableDependencies();
   }
-  static Bool_t GetUsedVar(Variables var) {return fgUsedVars[var];}
+  static Bool_t GetUsedVar(Variables var) {return fgContext->fUsedVars[var];}
   
   static void FillEventInfo(Float_t* values);
   static void FillEventInfo(AliReducedBaseEvent* event, Float_t* values, AliReducedEventPlaneInfo* eventPlane=0x0);
@@ -817,6 +844,14 @@ class AliReducedVarManager : public TObject {
   static void FillMCTruthInfo(AliReducedTrackInfo* p, Float_t* values, AliReducedTrackInfo* leg1 = 0x0, AliReducedTrackInfo* leg2 = 0x0);
   static void FillMCTruthInfo(AliReducedTrackInfo* leg1, AliReducedTrackInfo* leg2, Float_t* values);
   static void FillMCEventInfo(AliReducedEventInfo* event, Float_t* values);
+  // fill functions working on an explicit context
+  static void FillEventInfo(Context& ctx, AliReducedBaseEvent* event, Float_t* values, AliReducedEventPlaneInfo* eventPlane=0x0) {ContextScope scope(ctx); FillEventInfo(event, values, eventPlane);}
+  static void FillTrackInfo(Context& ctx, AliReducedBaseTrack* p, Float_t* values) {ContextScope scope(ctx); FillTrackInfo(p, values);}
+  static void FillPairInfo(Context& ctx, AliReducedPairInfo* p, Float_t* values) {ContextScope scope(ctx); FillPairInfo(p, values);}
+  static void FillPairInfo(Context& ctx, AliReducedBaseTrack* t1, AliReducedBaseTrack* t2, Int_t type, Float_t* values) {ContextScope scope(ctx); FillPairInfo(t1, t2, type, values);}
+  static void FillPairInfoME(Context& ctx, AliReducedBaseTrack* t1, AliReducedBaseTrack* t2, Int_t type, Float_t* values) {ContextScope scope(ctx); FillPairInfoME(t1, t2, type, values);}
+  static void FillCorrelationInfo(Context& ctx, AliReducedBaseTrack* p, AliReducedBaseTrack* t, Float_t* values) {ContextScope scope(ctx); FillCorrelationInfo(p, t, values);}
+  static Context& GetContext() {return *fgContext;}
   
   static void PrintTrackFlags(AliReducedTrackInfo* track);
   static void PrintBits(ULong_t mask, Int_t maxBit=64);
@@ -853,10 +888,12 @@ class AliReducedVarManager : public TObject {
  private:
   static Int_t     fgCurrentRunNumber;               // current run number
   static Float_t fgBeamMomentum;                  // beam energy (needed when calculating polarization angles) 
-  static AliReducedBaseEvent* fgEvent;            // pointer to the current event
-  static AliReducedEventPlaneInfo* fgEventPlane;  // pointer to the current event plane
-  static Bool_t fgUsedVars[kNVars];              // array of flags toggled when the corresponding variable is required (e.g., in the histogram manager, in cuts, mixing handler, etc.) 
-                                                 //   when a variable is used
+  static Context fgDefaultContext;                // context of the static API
+#if defined(__CINT__) && !defined(__CLING__)
+  static Context* fgContext;                      // (ROOT5 dictionary: no thread_local)
+#else
+  static thread_local Context* fgContext;         // current context of this thread
+#endif
   static void SetVariableDependencies();       // toggle those variables on which other used variables might depend 
   
 
@@ -69,6 +69,7 @@ AliAnalysisTaskGammaCalo::AliAnalysisTaskGammaCalo(): AliAnalysisTaskSE(),
   fV0ReaderName("V0ReaderV1"),
   fCorrTaskSetting(""),
   fBGHandler(NULL),
+  fBGPhotonPool(NULL),
   fInputEvent(NULL),
   fMCEvent(NULL),
   fCutFolder(NULL),
@@ -481,6 +482,7 @@ AliAnalysisTaskGammaCalo::AliAnalysisTaskGammaCalo(const char *name):
   fV0ReaderName("V0ReaderV1"),
   fCorrTaskSetting(""),
   fBGHandler(NULL),
+  fBGPhotonPool(NULL),
   fInputEvent(NULL),
   fMCEvent(NULL),
   fCutFolder(NULL),
@@ -908,6 +910,10 @@ AliAnalysisTaskGammaCalo::~AliAnalysisTaskGammaCalo()
     delete[] fBGHandler;
     fBGHandler = 0x0;
   }
+  if(fBGPhotonPool){
+    delete fBGPhotonPool;
+    fBGPhotonPool = 0x0;
+  }
 }
 //___________________________________________________________
 void AliAnalysisTaskGammaCalo::InitBack(){
@@ -923,7 +929,8 @@ void AliAnalysisTaskGammaCalo::InitBack(){
     }
 
   fBGHandler = new AliGammaConversionAODBGHandler*[fnCuts];
-
+  // the clusters of all cuts are stored once in a shared photon pool, bit iCut
+  fBGPhotonPool = new AliGammaConversionPhotonPool(fnCuts);
 
   for(Int_t iCut = 0; iCut<fnCuts;iCut++){
     if (((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->DoBGCalculation()){
@@ -981,6 +988,7 @@ void AliAnalysisTaskGammaCalo::InitBack(){
                                     ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->UseTrackMultiplicity(),
                                     4,8,7);
         }
+        fBGHandler[iCut]->SetPhotonPool(fBGPhotonPool,iCut);
       }
     }
   }
@@ -3354,6 +3362,7 @@ void AliAnalysisTaskGammaCalo::UserExec(Option_t *)
   AliEventplane *EventPlane = fInputEvent->GetEventplane();
   if(fIsHeavyIon ==1)fEventPlaneAngle = EventPlane->GetEventplane("V0",fInputEvent,2);
   else fEventPlaneAngle=0.0;
+  if(fBGPhotonPool) fBGPhotonPool->NewEvent();
   for(Int_t iCut = 0; iCut<fnCuts; iCut++){
 
     fiCut = iCut;
@@ -6786,11 +6795,12 @@ void AliAnalysisTaskGammaCalo::CalculateBackground(){
 
   if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()){
     for(Int_t nEventsInBG=0;nEventsInBG<fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-      AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
+      AliGammaConversionPhotonPool::View previousEventV0s = fBGHandler[fiCut]->GetBGPoolPhotons(zbin,mbin,nEventsInBG);
       for(Int_t iCurrent=0;iCurrent<fClusterCandidates->GetEntries();iCurrent++){
         AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fClusterCandidates->At(iCurrent));
-        for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-          AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+        for(UInt_t iPrevious=0;iPrevious<previousEventV0s.size();iPrevious++){
+          AliAODConversionPhoton previousGoodV0;
+          AliGammaConversionPhotonPool::FillPhoton(previousEventV0s.at(iPrevious),previousGoodV0);
           AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
           backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
 
@@ -6837,8 +6847,8 @@ void AliAnalysisTaskGammaCalo::CalculateBackground(){
     Bool_t acceptedPtMax    = kFALSE;
 
     for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-      AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
-      if(previousEventV0s){
+      AliGammaConversionPhotonPool::View previousEventV0s = fBGHandler[fiCut]->GetBGPoolPhotons(zbin,mbin,nEventsInBG);
+      if(previousEventV0s.size()){
         acceptedPtMax = kFALSE;
         currentPtMax = 0; previousPtMax = 0;
         currentAvePt = 0; previousAvePt = 0; currentAveEta = 0; previousAveEta = 0; currentAvePhi = 0; previousAvePhi = 0;
@@ -6852,16 +6862,17 @@ void AliAnalysisTaskGammaCalo::CalculateBackground(){
         currentAveEta /= currentAvePt;
         currentAvePhi /= currentAvePt;
         currentAvePt /= fClusterCandidates->GetEntries();
-        for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-            AliAODConversionPhoton *previousV0 = (AliAODConversionPhoton*)(previousEventV0s->at(iPrevious));
-            previousAvePt += previousV0->GetPhotonPt();
-            previousAveEta += previousV0->GetPhotonPt()*previousV0->GetPhotonEta();
-            previousAvePhi += previousV0->GetPhotonPt()*previousV0->GetPhotonPhi();
-            if(previousV0->GetPhotonPt() > previousPtMax){ previousPtMax = previousV0->GetPhotonPt(); }
+        for(UInt_t iPrevious=0;iPrevious<previousEventV0s.size();iPrevious++){
+            AliAODConversionPhoton previousV0;
+            AliGammaConversionPhotonPool::FillPhoton(previousEventV0s.at(iPrevious),previousV0);
+            previousAvePt += previousV0.GetPhotonPt();
+            previousAveEta += previousV0.GetPhotonPt()*previousV0.GetPhotonEta();
+            previousAvePhi += previousV0.GetPhotonPt()*previousV0.GetPhotonPhi();
+            if(previousV0.GetPhotonPt() > previousPtMax){ previousPtMax = previousV0.GetPhotonPt(); }
         }
         previousAveEta /= previousAvePt;
         previousAvePhi /= previousAvePt;
-        previousAvePt /= previousEventV0s->size();
+        previousAvePt /= previousEventV0s.size();
         if(currentPtMax > 0. && previousPtMax > 0.){
          //if(TMath::Sqrt(pow((currentEta-previousEta),2)+pow((currentPhi-previousPhi),2)) < 0.2) acceptedPtMax = kTRUE;
          if(TMath::Abs(previousAveEta-currentAveEta)<0.4 && TMath::Abs(previousAvePhi-currentAvePhi)<0.6 && (previousAvePt/currentAvePt)<4. && (previousAvePt/currentAvePt)>0.25) acceptedPtMax = kTRUE;
@@ -6869,8 +6880,9 @@ void AliAnalysisTaskGammaCalo::CalculateBackground(){
         if(acceptedPtMax){
           for(Int_t iCurrent=0;iCurrent<fClusterCandidates->GetEntries();iCurrent++){
             AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fClusterCandidates->At(iCurrent));
-            for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-              AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+            for(UInt_t iPrevious=0;iPrevious<previousEventV0s.size();iPrevious++){
+              AliAODConversionPhoton previousGoodV0;
+              AliGammaConversionPhotonPool::FillPhoton(previousEventV0s.at(iPrevious),previousGoodV0);
               AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
               backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
 
@@ -6895,13 +6907,13 @@ void AliAnalysisTaskGammaCalo::CalculateBackground(){
   } else if( ((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->DoSectorMixing() ) {
     if(fClusterCandidates->GetEntries()>0){
       for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-        AliGammaConversionAODVector *previousEventV0s = NULL;
-        previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
-        if(previousEventV0s && previousEventV0s->size()>0){
+        AliGammaConversionPhotonPool::View previousEventV0s = fBGHandler[fiCut]->GetBGPoolPhotons(zbin,mbin,nEventsInBG);
+        if(previousEventV0s.size()>0){
               for(Int_t iCurrent=0;iCurrent<fClusterCandidates->GetEntries();iCurrent++){
                 AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fClusterCandidates->At(iCurrent));
-                for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-                  AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+                for(UInt_t iPrevious=0;iPrevious<previousEventV0s.size();iPrevious++){
+                  AliAODConversionPhoton previousGoodV0;
+                  AliGammaConversionPhotonPool::FillPhoton(previousEventV0s.at(iPrevious),previousGoodV0);
                   AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
                   backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
 
@@ -6980,9 +6992,9 @@ void AliAnalysisTaskGammaCalo::CalculateBackground(){
             }
             Int_t zbinJets = fBGHandler[fiCut]->GetZBinIndex(2);
             for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-              AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbinJets,mbinJets,nEventsInBG);
+              AliGammaConversionPhotonPool::View previousEventV0s = fBGHandler[fiCut]->GetBGPoolPhotons(zbinJets,mbinJets,nEventsInBG);
               AliGammaConversionAODBGHandler::GammaConversionVertex* BGVertex = fBGHandler[fiCut]->GetBGEventVertex(zbinJets,mbinJets,nEventsInBG);
-              if(previousEventV0s){
+              if(previousEventV0s.size()){
                 Double_t BGJetEta = BGVertex->fX;
                 Double_t BGJetPhi = BGVertex->fY;
                 Int_t EtaSwap = 1;
@@ -7002,8 +7014,9 @@ void AliAnalysisTaskGammaCalo::CalculateBackground(){
                 }
                 Double_t EtaShift = fVectorJetEta.at(MaxPtPlace) - BGJetEta*EtaSwap;
                 Double_t PhiShift = fVectorJetPhi.at(MaxPtPlace) - BGJetPhi;
-                for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-                  AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+                for(UInt_t iPrevious=0;iPrevious<previousEventV0s.size();iPrevious++){
+                  AliAODConversionPhoton previousGoodV0;
+                  AliGammaConversionPhotonPool::FillPhoton(previousEventV0s.at(iPrevious),previousGoodV0);
                   Double_t EtaBackgroundAdjusted = previousGoodV0.Eta()*EtaSwap + EtaShift;
                   Double_t PhiBackgroundAdjusted = 0.;
                   if(DoPhiSwap){
@@ -7037,13 +7050,14 @@ void AliAnalysisTaskGammaCalo::CalculateBackground(){
     }
   } else {
     for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-      AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
-      if(previousEventV0s){
+      AliGammaConversionPhotonPool::View previousEventV0s = fBGHandler[fiCut]->GetBGPoolPhotons(zbin,mbin,nEventsInBG);
+      if(previousEventV0s.size()){
         for(Int_t iCurrent=0;iCurrent<fClusterCandidates->GetEntries();iCurrent++){
           AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fClusterCandidates->At(iCurrent));
-          for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
+          for(UInt_t iPrevious=0;iPrevious<previousEventV0s.size();iPrevious++){
 
-            AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+            AliAODConversionPhoton previousGoodV0;
+            AliGammaConversionPhotonPool::FillPhoton(previousEventV0s.at(iPrevious),previousGoodV0);
             std::unique_ptr<AliAODConversionMother> backgroundCandidate (new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0));
             backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
 
@@ -135,6 +135,7 @@ class AliAnalysisTaskGammaCalo : public AliAnalysisTaskSE {
     TString               fV0ReaderName;
     TString               fCorrTaskSetting;
     AliGammaConversionAODBGHandler**  fBGHandler;                               // BG handler for Conversion
+    AliGammaConversionPhotonPool*     fBGPhotonPool;                            //! clusters stored by fBGHandler of all cuts
     AliVEvent*            fInputEvent;                                          // current event
     AliMCEvent*           fMCEvent;                                             // corresponding MC event
     TList**               fCutFolder;                                           // Array of lists for containers belonging to cut
@@ -565,7 +566,7 @@ class AliAnalysisTaskGammaCalo : public AliAnalysisTaskSE {
     AliAnalysisTaskGammaCalo(const AliAnalysisTaskGammaCalo&);                  // Prevent copy-construction
     AliAnalysisTaskGammaCalo &operator=(const AliAnalysisTaskGammaCalo&);       // Prevent assignment
 
-    ClassDef(AliAnalysisTaskGammaCalo, 79);
+    ClassDef(AliAnalysisTaskGammaCalo, 80);
 };
 
 #endif
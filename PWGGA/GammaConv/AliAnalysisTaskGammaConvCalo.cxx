@@ -73,6 +73,7 @@ AliAnalysisTaskGammaConvCalo::AliAnalysisTaskGammaConvCalo(): AliAnalysisTaskSE(
   fBGClusHandlerRP(NULL),
   fBGHBTTrueGammaHandler(NULL),
   fBGHBTGenGammaHandler(NULL),
+  fBGPhotonPool(NULL),
   fInputEvent(NULL),
   fMCEvent(NULL),
   fCutFolder(NULL),
@@ -476,6 +477,7 @@ AliAnalysisTaskGammaConvCalo::AliAnalysisTaskGammaConvCalo(const char *name):
   fBGClusHandlerRP(NULL),
   fBGHBTTrueGammaHandler(NULL),
   fBGHBTGenGammaHandler(NULL),
+  fBGPhotonPool(NULL),
   fInputEvent(NULL),
   fMCEvent(NULL),
   fCutFolder(NULL),
@@ -910,6 +912,10 @@ AliAnalysisTaskGammaConvCalo::~AliAnalysisTaskGammaConvCalo()
     delete[] fBGHBTGenGammaHandler;
     fBGHBTGenGammaHandler = 0x0;
   }
+  if(fBGPhotonPool){
+    delete fBGPhotonPool;
+    fBGPhotonPool = 0x0;
+  }
   if(fTrueGammaCandidatesConv){
     delete[] fTrueGammaCandidatesConv;
     fTrueGammaCandidatesConv = 0x0;
@@ -941,6 +947,8 @@ void AliAnalysisTaskGammaConvCalo::InitBack(){
 
   fBGClusHandler = new AliGammaConversionAODBGHandler*[fnCuts];
   fBGClusHandlerRP = new AliConversionAODBGHandlerRP*[fnCuts];
+  // conversion photons and clusters of all cuts share one photon pool, bits iCut and fnCuts+iCut
+  fBGPhotonPool = new AliGammaConversionPhotonPool(2*fnCuts);
 
   if(fIsMC>0 && fDoHBTHistoOutput){
     fBGHBTTrueGammaHandler  = new AliGammaConversionAODBGHandler*[fnCuts];
@@ -1001,6 +1009,8 @@ void AliAnalysisTaskGammaConvCalo::InitBack(){
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->GetNumberOfBGEvents(),
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->UseTrackMultiplicity(),
                                   2,8,5);
+        fBGHandler[iCut]->SetPhotonPool(fBGPhotonPool,iCut);
+        fBGClusHandler[iCut]->SetPhotonPool(fBGPhotonPool,fnCuts+iCut);
         fBGHandlerRP[iCut] = NULL;
         if(fIsMC>0 && fDoHBTHistoOutput){
           fBGHBTTrueGammaHandler[iCut] = new AliGammaConversionAODBGHandler(
@@ -3231,6 +3241,7 @@ void AliAnalysisTaskGammaConvCalo::UserExec(Option_t *)
     fV0Reader->RelabelAODs(kTRUE);
   }
 
+  if(fBGPhotonPool) fBGPhotonPool->NewEvent();
   for(Int_t iCut = 0; iCut<fnCuts; iCut++){
 
     fiCut = iCut;
@@ -6636,15 +6647,16 @@ void AliAnalysisTaskGammaConvCalo::CalculateBackground(){
   AliGammaConversionAODBGHandler::GammaConversionVertex *bgEventVertex = NULL;
   if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()){
     for(Int_t nEventsInBG=0;nEventsInBG<fBGClusHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-      AliGammaConversionAODVector *previousEventV0s = fBGClusHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
+      AliGammaConversionPhotonPool::View previousEventV0s = fBGClusHandler[fiCut]->GetBGPoolPhotons(zbin,mbin,nEventsInBG);
       if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
         bgEventVertex = fBGClusHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
       }
 
       for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
         AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
-        for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-          AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+        for(UInt_t iPrevious=0;iPrevious<previousEventV0s.size();iPrevious++){
+          AliAODConversionPhoton previousGoodV0;
+          AliGammaConversionPhotonPool::FillPhoton(previousEventV0s.at(iPrevious),previousGoodV0);
           if(fMoveParticleAccordingToVertex == kTRUE){
             if (bgEventVertex){
               MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
@@ -6703,9 +6715,9 @@ void AliAnalysisTaskGammaConvCalo::CalculateBackground(){
           }
           Int_t zbinJets = fBGHandler[fiCut]->GetZBinIndex(2);
           for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-            AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbinJets,mbinJets,nEventsInBG);
+            AliGammaConversionPhotonPool::View previousEventV0s = fBGHandler[fiCut]->GetBGPoolPhotons(zbinJets,mbinJets,nEventsInBG);
             AliGammaConversionAODBGHandler::GammaConversionVertex* BGVertex = fBGHandler[fiCut]->GetBGEventVertex(zbinJets,mbinJets,nEventsInBG);
-            if(previousEventV0s){
+            if(previousEventV0s.size()){
               Double_t BGJetEta = BGVertex->fX;
               Double_t BGJetPhi = BGVertex->fY;
               Int_t EtaSwap = 1;
@@ -6725,8 +6737,9 @@ void AliAnalysisTaskGammaConvCalo::CalculateBackground(){
               }
               Double_t EtaShift = fVectorJetEta.at(MaxPtPlace) - BGJetEta*EtaSwap;
               Double_t PhiShift = fVectorJetPhi.at(MaxPtPlace) - BGJetPhi;
-              for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-                AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+              for(UInt_t iPrevious=0;iPrevious<previousEventV0s.size();iPrevious++){
+                AliAODConversionPhoton previousGoodV0;
+                AliGammaConversionPhotonPool::FillPhoton(previousEventV0s.at(iPrevious),previousGoodV0);
                 Double_t EtaBackgroundAdjusted = previousGoodV0.Eta()*EtaSwap + EtaShift;
                 Double_t PhiBackgroundAdjusted = 0.;
                 if(DoPhiSwap){
@@ -6763,16 +6776,17 @@ void AliAnalysisTaskGammaConvCalo::CalculateBackground(){
   } else {
     // mixing current conversion photons with previous clusters
     for(Int_t nEventsInBG=0;nEventsInBG <fBGClusHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-      AliGammaConversionAODVector *previousEventV0s = fBGClusHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
-      if(previousEventV0s){
+      AliGammaConversionPhotonPool::View previousEventV0s = fBGClusHandler[fiCut]->GetBGPoolPhotons(zbin,mbin,nEventsInBG);
+      if(previousEventV0s.size()){
         if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0 ){
           bgEventVertex = fBGClusHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
         }
         for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
           AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
-          for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
+          for(UInt_t iPrevious=0;iPrevious<previousEventV0s.size();iPrevious++){
 
-            AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+            AliAODConversionPhoton previousGoodV0;
+            AliGammaConversionPhotonPool::FillPhoton(previousEventV0s.at(iPrevious),previousGoodV0);
 
             if(fMoveParticleAccordingToVertex == kTRUE){
               if (bgEventVertex){
@@ -6809,16 +6823,17 @@ void AliAnalysisTaskGammaConvCalo::CalculateBackground(){
     if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->DoConvCaloMixing())){
       // mixing current clusters with previous conversion photons
       for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-        AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
-        if(previousEventV0s){
+        AliGammaConversionPhotonPool::View previousEventV0s = fBGHandler[fiCut]->GetBGPoolPhotons(zbin,mbin,nEventsInBG);
+        if(previousEventV0s.size()){
           if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0 ){
             bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
           }
           for(Int_t iCurrent=0;iCurrent<fClusterCandidates->GetEntries();iCurrent++){
             AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fClusterCandidates->At(iCurrent));
-            for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
+            for(UInt_t iPrevious=0;iPrevious<previousEventV0s.size();iPrevious++){
 
-              AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+              AliAODConversionPhoton previousGoodV0;
+              AliGammaConversionPhotonPool::FillPhoton(previousEventV0s.at(iPrevious),previousGoodV0);
 
               if(fMoveParticleAccordingToVertex == kTRUE){
                 if (bgEventVertex){
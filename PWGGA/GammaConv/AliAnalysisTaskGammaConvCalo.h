@@ -160,6 +160,7 @@ class AliAnalysisTaskGammaConvCalo : public AliAnalysisTaskSE {
     AliConversionAODBGHandlerRP**       fBGClusHandlerRP;       //! BG handler for Cluster (possibility to mix with respect to RP)
     AliGammaConversionAODBGHandler**    fBGHBTTrueGammaHandler; //! BG handler for HBTTrueGamma
     AliGammaConversionAODBGHandler**    fBGHBTGenGammaHandler;  //! BG handler for HBTGenGamma
+    AliGammaConversionPhotonPool*       fBGPhotonPool;          //! photons stored by fBGHandler and fBGClusHandler of all cuts
     AliVEvent*                          fInputEvent;            //! current event
     AliMCEvent*                         fMCEvent;               //! corresponding MC event
     TList**                             fCutFolder;             //! Array of lists for containers belonging to cut
@@ -591,7 +592,7 @@ class AliAnalysisTaskGammaConvCalo : public AliAnalysisTaskSE {
     AliAnalysisTaskGammaConvCalo(const AliAnalysisTaskGammaConvCalo&); // Prevent copy-construction
     AliAnalysisTaskGammaConvCalo &operator=(const AliAnalysisTaskGammaConvCalo&); // Prevent assignment
 
-    ClassDef(AliAnalysisTaskGammaConvCalo, 63);
+    ClassDef(AliAnalysisTaskGammaConvCalo, 64);
 };
 
 #endif
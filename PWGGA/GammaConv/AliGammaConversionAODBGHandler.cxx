@@ -47,7 +47,11 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler() :
 	fBGEvents(),
 	fBGEventsENeg(),
 	fBGEventsMeson(),
-	fBGEventsMCParticle()
+	fBGEventsMCParticle(),
+	fPhotonPool(NULL),
+	fPhotonPoolBit(0),
+	fPhotonPoolSlot(),
+	fPhotonPoolView()
 {
 	// constructor
 }
@@ -70,7 +74,11 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t binsZ,Int_t
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
-	fBGEventsMCParticle(binsZ,AliGammaMCParticleMultipicityVector(binsMultiplicity,AliGammaMCParticleBGEventVector(nEvents)))
+	fBGEventsMCParticle(binsZ,AliGammaMCParticleMultipicityVector(binsMultiplicity,AliGammaMCParticleBGEventVector(nEvents))),
+	fPhotonPool(NULL),
+	fPhotonPoolBit(0),
+	fPhotonPoolSlot(),
+	fPhotonPoolView()
 {
 	// constructor
 }
@@ -95,7 +103,11 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t collisionSy
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
-	fBGEventsMCParticle(binsZ,AliGammaMCParticleMultipicityVector(binsMultiplicity,AliGammaMCParticleBGEventVector(nEvents)))
+	fBGEventsMCParticle(binsZ,AliGammaMCParticleMultipicityVector(binsMultiplicity,AliGammaMCParticleBGEventVector(nEvents))),
+	fPhotonPool(NULL),
+	fPhotonPoolBit(0),
+	fPhotonPoolSlot(),
+	fPhotonPoolView()
 {
 	// constructor
     if(fNBinsMultiplicity>5) fNBinsMultiplicity = 5;
@@ -400,9 +412,17 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(const AliGammaCon
 	fBGEvents(original.fBGEvents),
 	fBGEventsENeg(original.fBGEventsENeg),
 	fBGEventsMeson(original.fBGEventsMeson),
-	fBGEventsMCParticle(original.fBGEventsMCParticle)
+	fBGEventsMCParticle(original.fBGEventsMCParticle),
+	fPhotonPool(original.fPhotonPool),
+	fPhotonPoolBit(original.fPhotonPoolBit),
+	fPhotonPoolSlot(original.fPhotonPoolSlot),
+	fPhotonPoolView(original.fPhotonPoolView)
 {
-	//copy constructor	
+	//copy constructor
+	// the copy shares the pool slots of the original, it releases them when overwritten or destroyed
+	if(fPhotonPool){
+		for(UInt_t i=0;i<fPhotonPoolSlot.size();i++) fPhotonPool->AddRef(fPhotonPoolSlot[i]);
+	}
 }
 
 //_____________________________________________________________________________________________________________________________
@@ -415,6 +435,13 @@ AliGammaConversionAODBGHandler & AliGammaConversionAODBGHandler::operator = (con
 //_____________________________________________________________________________________________________________________________
 AliGammaConversionAODBGHandler::~AliGammaConversionAODBGHandler(){
 
+	// the stored events go back to the shared pool (which has to outlive the handlers)
+	if(fPhotonPool){
+		for(UInt_t i=0;i<fPhotonPoolSlot.size();i++) fPhotonPool->Release(fPhotonPoolSlot[i]);
+		fPhotonPoolSlot.clear();
+		fPhotonPool = NULL;
+	}
+
 	if(fBGEventCounter){
 		for(Int_t z=0;z<fNBinsZ;z++){
 			delete[] fBGEventCounter[z];
@@ -655,6 +682,14 @@ void AliGammaConversionAODBGHandler::AddEvent(TList* const eventGammas,Double_t
 	//  cout<<"Checking the entries: Z="<<z<<", M="<<m<<", eventCounter="<<eventCounter<<endl;
 
 	//  cout<<"The size of this vector is: "<<fBGEvents[z][m][eventCounter].size()<<endl;
+	if(fPhotonPool){
+		// the photons are stored once in the shared pool, the slot previously stored here is released
+		Int_t index = (z*fNBinsMultiplicity+m)*fNEvents+eventCounter;
+		fPhotonPool->Release(fPhotonPoolSlot[index]);
+		fPhotonPoolSlot[index] = fPhotonPool->AddPhotons(eventGammas,fPhotonPoolBit,fPhotonPoolView[index]);
+		fBGEventCounter[z][m]++;
+		return;
+	}
     for(UInt_t d=0;d<fBGEvents[z][m][eventCounter].size();d++){
 		delete (AliAODConversionPhoton*)(fBGEvents[z][m][eventCounter][d]);
 	}
@@ -789,6 +824,23 @@ void AliGammaConversionAODBGHandler::AddMCParticleEvent(TList* const eventGammas
 	}
 	fBGMCParticleEventCounter[z][m]++;
 }
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionAODBGHandler::SetPhotonPool(AliGammaConversionPhotonPool *pool, Int_t bit){
+	// see header file for documentation
+	fPhotonPool = pool;
+	fPhotonPoolBit = bit;
+	fPhotonPoolSlot.assign(fNBinsZ*fNBinsMultiplicity*fNEvents,-1);
+	fPhotonPoolView.assign(fNBinsZ*fNBinsMultiplicity*fNEvents,-1);
+}
+
+//_____________________________________________________________________________________________________________________________
+AliGammaConversionPhotonPool::View AliGammaConversionAODBGHandler::GetBGPoolPhotons(Int_t zbin, Int_t mbin, Int_t event) const{
+	// photons of a stored event from the shared pool, empty if no pool is used
+	if(!fPhotonPool) return AliGammaConversionPhotonPool::View();
+	Int_t index = (zbin*fNBinsMultiplicity+mbin)*fNEvents+event;
+	return fPhotonPool->GetView(fPhotonPoolSlot[index],fPhotonPoolView[index]);
+}
+
 //_____________________________________________________________________________________________________________________________
 AliGammaConversionAODVector* AliGammaConversionAODBGHandler::GetBGGoodV0s(Int_t zbin, Int_t mbin, Int_t event){
 	//see headerfile for documentation
@@ -21,6 +21,7 @@
 #include "TClonesArray.h"
 #include "AliESDVertex.h"
 #include "AliAODMCParticle.h"
+#include "AliGammaConversionPhotonPool.h"
 
 typedef std::vector<AliAODConversionPhoton*> AliGammaConversionAODVector;
 typedef std::vector<AliAODConversionMother*> AliGammaConversionMotherAODVector;
@@ -74,6 +75,11 @@ class AliGammaConversionAODBGHandler : public TObject {
 
 	Int_t GetNBGEvents()const {return fNEvents;}
 
+	// store the photons of AddEvent in a pool shared with the handlers of other cuts, the pool is not owned
+	void SetPhotonPool(AliGammaConversionPhotonPool *pool, Int_t bit);
+	Bool_t HasPhotonPool() const {return fPhotonPool != NULL;}
+	AliGammaConversionPhotonPool::View GetBGPoolPhotons(Int_t zbin, Int_t mbin, Int_t event) const;
+
 	// Get BG photons
 	AliGammaConversionAODVector* GetBGGoodV0s(Int_t zbin, Int_t mbin, Int_t event);
         AliAODMCParticleVector* GetBGGoodV0sMC(Int_t zbin, Int_t mbin, Int_t event);
@@ -108,7 +114,11 @@ class AliGammaConversionAODBGHandler : public TObject {
 		AliGammaConversionBGVector 			fBGEventsENeg; 					// electron background electron events
 		AliGammaConversionMotherBGVector                fBGEventsMeson; 				// neutral meson background events
 		AliAODMCParticleBGVector 	                fBGEventsMCParticle; 				// MC Particle background events
+		AliGammaConversionPhotonPool*		fPhotonPool;					//! shared photon pool, replaces fBGEvents if set
+		Int_t								fPhotonPoolBit;					// bit of this handler in the photon pool
+		std::vector<Int_t>					fPhotonPoolSlot;				//! pool slot of each (z,m,event), -1 if empty
+		std::vector<Int_t>					fPhotonPoolView;				//! pool view of each (z,m,event)
 		
-	ClassDef(AliGammaConversionAODBGHandler,8)
+	ClassDef(AliGammaConversionAODBGHandler,9)
 };
 #endif
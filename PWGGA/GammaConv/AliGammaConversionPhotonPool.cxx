@@ -0,0 +1,187 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+////////////////////////////////////////////////
+//---------------------------------------------
+// Photon storage shared by the mixed event handlers of all cuts of a task.
+// Every photon of an input event is stored once as a value record, with a
+// bitmask of the cuts (handlers) which added it. The event slots are
+// recycled once no handler refers to them anymore, such that the record
+// vectors keep their capacity and no photon is allocated on the heap.
+//---------------------------------------------
+////////////////////////////////////////////////
+
+#include "AliGammaConversionPhotonPool.h"
+#include "AliAODConversionPhoton.h"
+#include "AliLog.h"
+#include "TList.h"
+
+ClassImp(AliGammaConversionPhotonPool)
+
+//_____________________________________________________________________________________________________________________________
+AliGammaConversionPhotonPool::AliGammaConversionPhotonPool(Int_t nBits) :
+  TObject(),
+  fNBits(nBits > 0 ? nBits : 1),
+  fNWords((fNBits+63)/64),
+  fCurrentSlot(-1),
+  fSlots(),
+  fFreeSlots()
+{
+  // default constructor
+}
+
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionPhotonPool::NewEvent(){
+  // a slot which was not kept by any handler goes back to the free slots
+  if(fCurrentSlot >= 0 && fSlots[fCurrentSlot].fNRefs == 0) fFreeSlots.push_back(fCurrentSlot);
+  fCurrentSlot = -1;
+}
+
+//_____________________________________________________________________________________________________________________________
+Int_t AliGammaConversionPhotonPool::AddPhotons(TList* const photons, Int_t bit, Int_t &view){
+  if(bit < 0 || bit >= fNBits){
+    AliFatal(Form("Bit %d out of range, the pool was created for %d bits",bit,fNBits));
+  }
+
+  if(fCurrentSlot < 0){
+    if(fFreeSlots.size()){
+      fCurrentSlot = fFreeSlots.back();
+      fFreeSlots.pop_back();
+    } else {
+      fCurrentSlot = fSlots.size();
+      fSlots.push_back(Slot());
+    }
+    Slot &slot = fSlots[fCurrentSlot];
+    slot.fPhotons.clear();
+    slot.fLookup.clear();
+    slot.fMasks.clear();
+    slot.fViewIndex.clear();
+    slot.fViewFirst.assign(1,0);
+    slot.fNRefs = 0;
+  }
+  Slot &slot = fSlots[fCurrentSlot];
+
+  const Int_t word = bit/64;
+  const ULong64_t mask = 1ULL << (bit%64);
+  // an already stored photon is looked up by its identity, the full record is compared
+  // for the (few) stored photons with the same key only
+  PhotonRecord record;
+  for(Int_t i=0; i<photons->GetEntries(); i++){
+    MakeRecord((AliAODConversionPhoton*)photons->At(i),record);
+    const PhotonKey key(record);
+    Int_t found = -1;
+    typedef std::multimap<PhotonKey,Int_t>::const_iterator LookupIter;
+    const std::pair<LookupIter,LookupIter> candidates = slot.fLookup.equal_range(key);
+    for(LookupIter it = candidates.first; it != candidates.second; ++it){
+      const Int_t k = it->second;
+      if(slot.fMasks[k*fNWords+word] & mask) continue; // already used by this cut
+      if(IsSamePhoton(slot.fPhotons[k],record)){
+        found = k;
+        break;
+      }
+    }
+    if(found < 0){
+      found = slot.fPhotons.size();
+      slot.fPhotons.push_back(record);
+      slot.fLookup.insert(std::make_pair(key,found));
+      slot.fMasks.resize(slot.fMasks.size()+fNWords,0);
+    }
+    slot.fMasks[found*fNWords+word] |= mask;
+    slot.fViewIndex.push_back(found);
+  }
+  view = slot.fViewFirst.size()-1;
+  slot.fViewFirst.push_back(slot.fViewIndex.size());
+  slot.fNRefs++;
+  return fCurrentSlot;
+}
+
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionPhotonPool::AddRef(Int_t slot){
+  if(slot < 0 || slot >= (Int_t)fSlots.size()) return;
+  fSlots[slot].fNRefs++;
+}
+
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionPhotonPool::Release(Int_t slot){
+  if(slot < 0 || slot >= (Int_t)fSlots.size()) return;
+  if(--fSlots[slot].fNRefs == 0 && slot != fCurrentSlot) fFreeSlots.push_back(slot);
+}
+
+//_____________________________________________________________________________________________________________________________
+AliGammaConversionPhotonPool::View AliGammaConversionPhotonPool::GetView(Int_t slot, Int_t view) const{
+  if(slot < 0 || slot >= (Int_t)fSlots.size()) return View();
+  const Slot &s = fSlots[slot];
+  if(view < 0 || view+1 >= (Int_t)s.fViewFirst.size()) return View();
+  const Int_t first = s.fViewFirst[view];
+  const Int_t n = s.fViewFirst[view+1]-first;
+  if(n == 0) return View();
+  return View(&s.fPhotons[0],&s.fViewIndex[first],n);
+}
+
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionPhotonPool::MakeRecord(const AliAODConversionPhoton *photon, PhotonRecord &record){
+  AliAODConversionPhoton *p = const_cast<AliAODConversionPhoton*>(photon); // some getters are not const
+  record.fPx = p->Px();
+  record.fPy = p->Py();
+  record.fPz = p->Pz();
+  record.fE  = p->E();
+  record.fConversionPoint[0] = p->GetConversionX();
+  record.fConversionPoint[1] = p->GetConversionY();
+  record.fConversionPoint[2] = p->GetConversionZ();
+  record.fLabel[0] = p->GetTrackLabelPositive();
+  record.fLabel[1] = p->GetTrackLabelNegative();
+  record.fV0Index = p->GetV0Index();
+  record.fCaloClusterRef = p->GetCaloClusterRef();
+  record.fCaloPhotonMCLabel = p->GetCaloPhotonMCLabel(0);
+  record.fQuality = p->GetPhotonQuality();
+  record.fCaloPhoton = p->GetIsCaloPhoton();
+}
+
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionPhotonPool::FillPhoton(const PhotonRecord &record, AliAODConversionPhoton &photon){
+  photon.SetPxPyPzE(record.fPx,record.fPy,record.fPz,record.fE);
+  Double_t conversionPoint[3] = {record.fConversionPoint[0],record.fConversionPoint[1],record.fConversionPoint[2]};
+  photon.SetConversionPoint(conversionPoint);
+  photon.SetTrackLabels(record.fLabel[0],record.fLabel[1]);
+  photon.SetV0Index(record.fV0Index);
+  photon.SetCaloClusterRef(record.fCaloClusterRef);
+  photon.SetCaloPhotonMCLabel(0,record.fCaloPhotonMCLabel);
+  photon.SetPhotonQuality(record.fQuality);
+  photon.SetIsCaloPhoton(record.fCaloPhoton);
+}
+
+//_____________________________________________________________________________________________________________________________
+AliGammaConversionPhotonPool::PhotonKey::PhotonKey(const PhotonRecord &record) :
+  fV0Index(record.fV0Index),
+  fCaloClusterRef(record.fCaloClusterRef)
+{
+  fLabel[0] = record.fLabel[0];
+  fLabel[1] = record.fLabel[1];
+}
+
+//_____________________________________________________________________________________________________________________________
+Bool_t AliGammaConversionPhotonPool::PhotonKey::operator<(const PhotonKey &other) const{
+  if(fLabel[0] != other.fLabel[0]) return fLabel[0] < other.fLabel[0];
+  if(fLabel[1] != other.fLabel[1]) return fLabel[1] < other.fLabel[1];
+  if(fV0Index != other.fV0Index) return fV0Index < other.fV0Index;
+  return fCaloClusterRef < other.fCaloClusterRef;
+}
+
+//_____________________________________________________________________________________________________________________________
+Bool_t AliGammaConversionPhotonPool::IsSamePhoton(const PhotonRecord &a, const PhotonRecord &b){
+  return a.fLabel[0] == b.fLabel[0] && a.fLabel[1] == b.fLabel[1] && a.fV0Index == b.fV0Index &&
+         a.fCaloClusterRef == b.fCaloClusterRef && a.fCaloPhotonMCLabel == b.fCaloPhotonMCLabel &&
+         a.fQuality == b.fQuality && a.fCaloPhoton == b.fCaloPhoton &&
+         a.fPx == b.fPx && a.fPy == b.fPy && a.fPz == b.fPz && a.fE == b.fE &&
+         a.fConversionPoint[0] == b.fConversionPoint[0] && a.fConversionPoint[1] == b.fConversionPoint[1] &&
+         a.fConversionPoint[2] == b.fConversionPoint[2];
+}
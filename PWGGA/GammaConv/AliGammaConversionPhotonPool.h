@@ -0,0 +1,107 @@
+//-*- Mode: C++ -*-
+#ifndef ALIGAMMACONVERSIONPHOTONPOOL_H
+#define ALIGAMMACONVERSIONPHOTONPOOL_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice     */
+
+////////////////////////////////////////////////
+//---------------------------------------------
+// Photon storage shared by the mixed event
+// handlers of all cuts of a task
+//---------------------------------------------
+////////////////////////////////////////////////
+
+#include <map>
+#include <vector>
+
+#include <TObject.h>
+
+class TList;
+class AliAODConversionPhoton;
+
+class AliGammaConversionPhotonPool : public TObject {
+
+  public:
+    // value copy of the photon properties used in the mixing loops
+    struct PhotonRecord {
+      Double_t fPx;
+      Double_t fPy;
+      Double_t fPz;
+      Double_t fE;
+      Double_t fConversionPoint[3];
+      Int_t    fLabel[2];             // V0 daughter track labels
+      Int_t    fV0Index;              // V0 index, leading cell ID for clusters
+      Long_t   fCaloClusterRef;       // cluster reference
+      Long_t   fCaloPhotonMCLabel;    // leading MC label of calo photons
+      UChar_t  fQuality;              // photon quality
+      Char_t   fCaloPhoton;           // calo photon type
+    };
+
+    // photons added by one cut (bit) in one stored event, in the order of the input list
+    class View {
+      public:
+        View() : fPhotons(NULL), fIndex(NULL), fN(0) {}
+        View(const PhotonRecord *photons, const Int_t *index, Int_t n) : fPhotons(photons), fIndex(index), fN(n) {}
+        UInt_t size() const { return fN; }
+        const PhotonRecord& at(UInt_t i) const { return fPhotons[fIndex[i]]; }
+      private:
+        const PhotonRecord *fPhotons;
+        const Int_t        *fIndex;
+        Int_t               fN;
+    };
+
+    AliGammaConversionPhotonPool(Int_t nBits = 64);
+    virtual ~AliGammaConversionPhotonPool() {}
+
+    // to be called once per input event before the handlers add their photons
+    void NewEvent();
+
+    // adds the photons of the list for the given bit to the current event, returns its slot and the view index
+    Int_t AddPhotons(TList* const photons, Int_t bit, Int_t &view);
+    // an additional handler entry points to the slot (copied handler), to be balanced by a Release
+    void AddRef(Int_t slot);
+    void Release(Int_t slot);
+
+    View GetView(Int_t slot, Int_t view) const;
+
+    Int_t GetNBits() const { return fNBits; }
+    Int_t GetNSlots() const { return fSlots.size(); }
+    Int_t GetNFreeSlots() const { return fFreeSlots.size(); }
+
+    static void MakeRecord(const AliAODConversionPhoton *photon, PhotonRecord &record);
+    static void FillPhoton(const PhotonRecord &record, AliAODConversionPhoton &photon);
+
+  private:
+    // identity of a photon: V0 daughter track labels, V0 index and cluster reference
+    struct PhotonKey {
+      Int_t  fLabel[2];
+      Int_t  fV0Index;
+      Long_t fCaloClusterRef;
+      PhotonKey(const PhotonRecord &record);
+      Bool_t operator<(const PhotonKey &other) const;
+    };
+
+    // one stored event: photon records with their bitmasks and the views of the cuts
+    struct Slot {
+      std::vector<PhotonRecord> fPhotons;    // photon records
+      std::multimap<PhotonKey,Int_t> fLookup; // photon indices by identity, to find the photons added by other cuts
+      std::vector<ULong64_t>    fMasks;      // fNWords bitmask words per photon
+      std::vector<Int_t>        fViewIndex;  // concatenated photon indices of all views
+      std::vector<Int_t>        fViewFirst;  // first entry of each view in fViewIndex, size nViews+1
+      Int_t                     fNRefs;      // number of handler entries pointing to this slot
+    };
+
+    AliGammaConversionPhotonPool(const AliGammaConversionPhotonPool&); // not implemented
+    AliGammaConversionPhotonPool& operator=(const AliGammaConversionPhotonPool&); // not implemented
+
+    static Bool_t IsSamePhoton(const PhotonRecord &a, const PhotonRecord &b);
+
+    Int_t               fNBits;          // number of views (cuts) sharing the pool
+    Int_t               fNWords;         // number of 64 bit words of the bitmask
+    Int_t               fCurrentSlot;    //! slot of the current input event, -1 if none yet
+    std::vector<Slot>   fSlots;          //! event slots, recycled through fFreeSlots
+    std::vector<Int_t>  fFreeSlots;      //! unused slots
+
+    ClassDef(AliGammaConversionPhotonPool,1)
+};
+#endif
@@ -7,6 +7,7 @@
 // User tasks
 #pragma link C++ class AliAnalysisTaskPi0v2+;
 #pragma link C++ class AliGammaConversionAODBGHandler+;
+#pragma link C++ class AliGammaConversionPhotonPool+;
 #pragma link C++ class AliAnalysisTaskGammaConvV1+;
 #pragma link C++ class AliAnalysisTaskGammaConvDalitzV1+;
 #pragma link C++ class AliAnalysisTaskConversionQA+;
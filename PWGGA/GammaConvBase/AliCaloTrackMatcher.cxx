@@ -36,6 +36,7 @@
 #include "TH1F.h"
 #include "TF1.h"
 
+#include <algorithm>
 #include <vector>
 #include <map>
 #include <utility>
@@ -60,11 +61,22 @@ AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType, In
   fGeomEMCAL(NULL),
   fGeomPHOS(NULL),
   fArrClusters(NULL),
-  fMapTrackToCluster(),
-  fMapClusterToTrack(),
+  fDoGridValidation(kFALSE),
+  fGridNZ(0),
+  fGridZMin(0),
+  fGridZCellSize(0),
+  fGridMinR(0),
+  fGridClusters(),
+  fGridClusterPos(),
+  fGridCellFirst(),
+  fGridCellClusters(),
+  fGridCandidates(),
+  fGridCandidatesCheck(),
+  fVecTrackToCluster(),
+  fVecClusterToTrack(),
   fNEntries(1),
   fVectorDeltaEtaDeltaPhi(0),
-  fMap_TrID_ClID_ToIndex(),
+  fVec_TrID_ClID_ToIndex(),
   fSecMapTrackToCluster(),
   fSecMapClusterToTrack(),
   fSecNEntries(1),
@@ -86,10 +98,10 @@ AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType, In
 //________________________________________________________________________
 AliCaloTrackMatcher::~AliCaloTrackMatcher(){
     // default deconstructor
-    fMapTrackToCluster.clear();
-    fMapClusterToTrack.clear();
+    fVecTrackToCluster.clear();
+    fVecClusterToTrack.clear();
     fVectorDeltaEtaDeltaPhi.clear();
-    fMap_TrID_ClID_ToIndex.clear();
+    fVec_TrID_ClID_ToIndex.clear();
 
     fSecMapTrackToCluster.clear();
     fSecMapClusterToTrack.clear();
@@ -108,10 +120,10 @@ AliCaloTrackMatcher::~AliCaloTrackMatcher(){
 
 //________________________________________________________________________
 void AliCaloTrackMatcher::Terminate(Option_t *){
-  fMapTrackToCluster.clear();
-  fMapClusterToTrack.clear();
+  fVecTrackToCluster.clear();
+  fVecClusterToTrack.clear();
   fVectorDeltaEtaDeltaPhi.clear();
-  fMap_TrID_ClID_ToIndex.clear();
+  fVec_TrID_ClID_ToIndex.clear();
 
   fSecMapTrackToCluster.clear();
   fSecMapClusterToTrack.clear();
@@ -167,11 +179,11 @@ void AliCaloTrackMatcher::UserCreateOutputObjects(){
 //________________________________________________________________________
 void AliCaloTrackMatcher::Initialize(Int_t runNumber){
   // Initialize function to be called once before analysis
-  fMapTrackToCluster.clear();
-  fMapClusterToTrack.clear();
+  fVecTrackToCluster.clear();
+  fVecClusterToTrack.clear();
   fNEntries = 1;
   fVectorDeltaEtaDeltaPhi.clear();
-  fMap_TrID_ClID_ToIndex.clear();
+  fVec_TrID_ClID_ToIndex.clear();
 
   fSecMapTrackToCluster.clear();
   fSecMapClusterToTrack.clear();
@@ -287,6 +299,9 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
     }
   }
 
+  // cache the cluster positions and bin them in (phi,z) once per event
+  BuildClusterGrid(event, nClus);
+
   for (Int_t itr=0;itr<event->GetNumberOfTracks();itr++){
     AliExternalTrackParam *trackParam = 0;
     AliVTrack *inTrack = 0x0;
@@ -434,52 +449,35 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
     // cout << inTrack->GetID() << " - " << trackParam << endl;
     // cout << "eta/phi: " << eta << ", " << phi << endl;
     // cout << "nClus: " << nClus << endl;
+    // only the clusters in the grid cells which can lie within the matching window are refined,
+    // they are visited in the order of the full cluster loop
+    GetClusterCandidates(exPos, fGridCandidates);
+    if(fDoGridValidation){
+      GetClusterCandidatesFullLoop(exPos, fGridCandidatesCheck);
+      if(fGridCandidates != fGridCandidatesCheck)
+        AliError(Form("Cluster grid and full cluster loop disagree for track %i: %i vs %i candidates",inTrack->GetID(),(Int_t)fGridCandidates.size(),(Int_t)fGridCandidatesCheck.size()));
+    }
+
     Int_t nClusterMatchesToTrack = 0;
-    for(Int_t iclus=0;iclus < nClus;iclus++){
-      AliVCluster* cluster = NULL;
-      if(fArrClusters){
-        if(esdev){
-          if(fArrClusters)
-            cluster = new AliESDCaloCluster(*(AliESDCaloCluster*)fArrClusters->At(iclus));
-        } else if(aodev){
-          if(fArrClusters)
-            cluster = new AliAODCaloCluster(*(AliAODCaloCluster*)fArrClusters->At(iclus));
-        }
-      }
-      else
-        cluster = event->GetCaloCluster(iclus);
-      if (!cluster){
-        if(fArrClusters) delete cluster;
-        continue;
-      }
+    for(UInt_t icand=0;icand < fGridCandidates.size();icand++){
+      Int_t iclus = fGridCandidates[icand];
+      AliVCluster* cluster = fGridClusters[iclus];
       // cout << "-------------------------LOOPING: " << iclus << ", " << cluster->GetID() << endl;
-      cluster->GetPosition(clsPos);
-      Double_t dR = TMath::Sqrt(TMath::Power(exPos[0]-clsPos[0],2)+TMath::Power(exPos[1]-clsPos[1],2)+TMath::Power(exPos[2]-clsPos[2],2));
-      //cout << "dR: " << dR << endl;
-      if (dR > fMatchingWindow){
-        if(fArrClusters) delete cluster;
-        continue;
-      }
+      clsPos[0] = fGridClusterPos[3*iclus];
+      clsPos[1] = fGridClusterPos[3*iclus+1];
+      clsPos[2] = fGridClusterPos[3*iclus+2];
       Double_t clusterR = TMath::Sqrt( clsPos[0]*clsPos[0] + clsPos[1]*clsPos[1] );
       AliExternalTrackParam trackParamTmp(emcParam);//Retrieve the starting point every time before the extrapolation
       if(fClusterType == 1 || fClusterType == 3 || fClusterType == 4){
-        if (!cluster->IsEMCAL()){
-          if(fArrClusters) delete cluster;
-          continue;
-        }
+        if (!cluster->IsEMCAL()) continue;
         if(!AliEMCALRecoUtils::ExtrapolateTrackToCluster(&trackParamTmp, cluster, 0.139, 5., dEta, dPhi)){
           FillfHistControlMatches(4.,inTrack->Pt());
-          if(fArrClusters) delete cluster;
           continue;
         }
       }else if(fClusterType == 2){
-        if (!cluster->IsPHOS()){
-          if(fArrClusters) delete cluster;
-          continue;
-        }
+        if (!cluster->IsPHOS()) continue;
         if(!AliTrackerBase::PropagateTrackToBxByBz(&trackParamTmp, clusterR, 0.139, 5., kTRUE, 0.8, -1)){
           FillfHistControlMatches(4.,inTrack->Pt());
-          if(fArrClusters) delete cluster;
           continue;
         }
         Double_t trkPos[3] = {0,0,0};
@@ -493,31 +491,160 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
       Float_t dR2 = dPhi*dPhi + dEta*dEta;
 
       //cout << dEta << " - " << dPhi << " - " << dR2 << endl;
-      if(dR2 > fMatchingResidual){
-        if(fArrClusters) delete cluster;
-        continue;
-      }
+      if(dR2 > fMatchingResidual) continue;
       nClusterMatchesToTrack++;
       if(aodev){
-        fMapTrackToCluster.insert(make_pair(itr,cluster->GetID()));
-        fMapClusterToTrack.insert(make_pair(cluster->GetID(),itr));
+        fVecTrackToCluster.push_back(make_pair(itr,cluster->GetID()));
+        fVecClusterToTrack.push_back(make_pair(cluster->GetID(),itr));
       }else{
-        fMapTrackToCluster.insert(make_pair(inTrack->GetID(),cluster->GetID()));
-        fMapClusterToTrack.insert(make_pair(cluster->GetID(),inTrack->GetID()));
+        fVecTrackToCluster.push_back(make_pair(inTrack->GetID(),cluster->GetID()));
+        fVecClusterToTrack.push_back(make_pair(cluster->GetID(),inTrack->GetID()));
       }
       fVectorDeltaEtaDeltaPhi.push_back(make_pair(dEta,dPhi));
-      fMap_TrID_ClID_ToIndex[make_pair(inTrack->GetID(),cluster->GetID())] = fNEntries++;
+      fVec_TrID_ClID_ToIndex.push_back(make_pair(make_pair(inTrack->GetID(),cluster->GetID()),fNEntries++));
       if( (Int_t)fVectorDeltaEtaDeltaPhi.size() != (fNEntries-1)) AliFatal("Fatal error in AliCaloTrackMatcher, vector and map are not in sync!");
-      if(fArrClusters) delete cluster;
     }
     if(nClusterMatchesToTrack == 0) FillfHistControlMatches(5.,inTrack->Pt());
     else FillfHistControlMatches(6.,inTrack->Pt());
     delete trackParam;
   }
+  SortMatches();
+
+  return;
+}
+
+//________________________________________________________________________
+void AliCaloTrackMatcher::BuildClusterGrid(AliVEvent *event, Int_t nClus){
+  fGridClusters.assign(nClus,(AliVCluster*)NULL);
+  fGridClusterPos.assign(3*nClus,0.);
+  fGridMinR = -1;
+  Float_t zMin = 0, zMax = 0;
+  Bool_t first = kTRUE;
+  for(Int_t iclus=0;iclus < nClus;iclus++){
+    AliVCluster* cluster = NULL;
+    if(fArrClusters) cluster = dynamic_cast<AliVCluster*>(fArrClusters->At(iclus));
+    else cluster = event->GetCaloCluster(iclus);
+    if(!cluster) continue;
+    fGridClusters[iclus] = cluster;
+    Float_t *clsPos = &fGridClusterPos[3*iclus];
+    cluster->GetPosition(clsPos);
+    Float_t clusterR = TMath::Sqrt(clsPos[0]*clsPos[0] + clsPos[1]*clsPos[1]);
+    if(first || clusterR < fGridMinR) fGridMinR = clusterR;
+    if(first || clsPos[2] < zMin) zMin = clsPos[2];
+    if(first || clsPos[2] > zMax) zMax = clsPos[2];
+    first = kFALSE;
+  }
+
+  // z cells of a quarter of the matching window (at least 10 cm)
+  fGridZMin = zMin;
+  fGridZCellSize = TMath::Max(fMatchingWindow/4.,10.);
+  fGridNZ = TMath::Min((Int_t)((zMax-zMin)/fGridZCellSize)+1,kGridMaxNZ);
+  if((zMax-zMin)/fGridZCellSize >= kGridMaxNZ) fGridZCellSize = (zMax-zMin)/kGridMaxNZ*1.0001;
+
+  // counting sort of the clusters into the cells
+  Int_t nCells = kGridNPhi*fGridNZ;
+  vector<Int_t> cellOfCluster(nClus,-1);
+  fGridCellFirst.assign(nCells+1,0);
+  for(Int_t iclus=0;iclus < nClus;iclus++){
+    if(!fGridClusters[iclus]) continue;
+    const Float_t *clsPos = &fGridClusterPos[3*iclus];
+    Double_t phi = TMath::ATan2(clsPos[1],clsPos[0]);
+    if(phi < 0) phi += TMath::TwoPi();
+    Int_t iPhi = TMath::Min((Int_t)(phi/TMath::TwoPi()*kGridNPhi),kGridNPhi-1);
+    Int_t iZ = TMath::Min((Int_t)((clsPos[2]-fGridZMin)/fGridZCellSize),fGridNZ-1);
+    cellOfCluster[iclus] = iPhi*fGridNZ+iZ;
+    fGridCellFirst[cellOfCluster[iclus]+1]++;
+  }
+  for(Int_t iCell=0;iCell < nCells;iCell++) fGridCellFirst[iCell+1] += fGridCellFirst[iCell];
+  fGridCellClusters.resize(fGridCellFirst[nCells]);
+  vector<Int_t> cellFill(fGridCellFirst.begin(),fGridCellFirst.end()-1);
+  for(Int_t iclus=0;iclus < nClus;iclus++){
+    if(cellOfCluster[iclus] < 0) continue;
+    fGridCellClusters[cellFill[cellOfCluster[iclus]]++] = iclus;
+  }
+  return;
+}
 
+//________________________________________________________________________
+void AliCaloTrackMatcher::GetClusterCandidates(const Double_t *exPos, vector<Int_t> &candidates){
+  // clusters within fMatchingWindow (3D distance) of the extrapolated track position.
+  // The z distance is a lower bound of the 3D distance, the same holds for the chord
+  // 2*sqrt(rTrack*rCluster)*sin(dPhi/2), which gives a conservative phi window.
+  candidates.clear();
+  if(fGridCellClusters.empty()) return;
+  Double_t trackR = TMath::Sqrt(exPos[0]*exPos[0] + exPos[1]*exPos[1]);
+  Int_t iPhiMin = 0, iPhiMax = kGridNPhi-1;
+  Double_t chord = 2*TMath::Sqrt(trackR*fGridMinR);
+  if(chord > 0 && fMatchingWindow < chord){
+    Double_t phi = TMath::ATan2(exPos[1],exPos[0]);
+    if(phi < 0) phi += TMath::TwoPi();
+    Double_t dPhiWindow = 2*TMath::ASin(fMatchingWindow/chord) + 1e-4;
+    Double_t cellPhi = TMath::TwoPi()/kGridNPhi;
+    iPhiMin = TMath::FloorNint((phi-dPhiWindow)/cellPhi);
+    iPhiMax = TMath::FloorNint((phi+dPhiWindow)/cellPhi);
+    if(iPhiMax-iPhiMin >= kGridNPhi-1){
+      iPhiMin = 0;
+      iPhiMax = kGridNPhi-1;
+    }
+  }
+  Int_t iZMin = TMath::Max(TMath::FloorNint((exPos[2]-fMatchingWindow-fGridZMin)/fGridZCellSize),0);
+  Int_t iZMax = TMath::Min(TMath::FloorNint((exPos[2]+fMatchingWindow-fGridZMin)/fGridZCellSize),fGridNZ-1);
+  for(Int_t iPhi=iPhiMin;iPhi <= iPhiMax;iPhi++){
+    Int_t iPhiCell = ((iPhi % kGridNPhi) + kGridNPhi) % kGridNPhi;
+    for(Int_t iZ=iZMin;iZ <= iZMax;iZ++){
+      Int_t iCell = iPhiCell*fGridNZ+iZ;
+      for(Int_t iEntry=fGridCellFirst[iCell];iEntry < fGridCellFirst[iCell+1];iEntry++){
+        Int_t iclus = fGridCellClusters[iEntry];
+        const Float_t *clsPos = &fGridClusterPos[3*iclus];
+        Double_t dR = TMath::Sqrt(TMath::Power(exPos[0]-clsPos[0],2)+TMath::Power(exPos[1]-clsPos[1],2)+TMath::Power(exPos[2]-clsPos[2],2));
+        if (dR > fMatchingWindow) continue;
+        candidates.push_back(iclus);
+      }
+    }
+  }
+  sort(candidates.begin(),candidates.end());
   return;
 }
 
+//________________________________________________________________________
+void AliCaloTrackMatcher::GetClusterCandidatesFullLoop(const Double_t *exPos, vector<Int_t> &candidates){
+  // reference for GetClusterCandidates, loops over all clusters of the event
+  candidates.clear();
+  for(Int_t iclus=0;iclus < (Int_t)fGridClusters.size();iclus++){
+    if(!fGridClusters[iclus]) continue;
+    const Float_t *clsPos = &fGridClusterPos[3*iclus];
+    Double_t dR = TMath::Sqrt(TMath::Power(exPos[0]-clsPos[0],2)+TMath::Power(exPos[1]-clsPos[1],2)+TMath::Power(exPos[2]-clsPos[2],2));
+    if (dR > fMatchingWindow) continue;
+    candidates.push_back(iclus);
+  }
+  return;
+}
+
+//________________________________________________________________________
+namespace {
+  template<class T> Bool_t CompareFirst(const T &a, const T &b) { return a.first < b.first; }
+}
+
+//________________________________________________________________________
+void AliCaloTrackMatcher::SortMatches(){
+  // stable sorts keep the insertion order for equal keys, as the former multimaps did
+  stable_sort(fVecTrackToCluster.begin(),fVecTrackToCluster.end(),CompareFirst<pairInt>);
+  stable_sort(fVecClusterToTrack.begin(),fVecClusterToTrack.end(),CompareFirst<pairInt>);
+  stable_sort(fVec_TrID_ClID_ToIndex.begin(),fVec_TrID_ClID_ToIndex.end(),CompareFirst<pairIntIndex>);
+  return;
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::FindMatchIndex(Int_t trackID, Int_t clusterID){
+  // index (starting at 1) in fVectorDeltaEtaDeltaPhi, 0 if not matched; the last entry wins as for a map
+  pairIntIndex key(make_pair(trackID,clusterID),0);
+  vector<pairIntIndex>::iterator it = upper_bound(fVec_TrID_ClID_ToIndex.begin(),fVec_TrID_ClID_ToIndex.end(),key,CompareFirst<pairIntIndex>);
+  if(it == fVec_TrID_ClID_ToIndex.begin()) return 0;
+  --it;
+  if(it->first != key.first) return 0;
+  return it->second;
+}
+
 //________________________________________________________________________
 Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliVTrack* inSecTrack, AliVCluster* cluster, AliVEvent* event, Float_t &dEta, Float_t &dPhi){
 
@@ -747,7 +874,7 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
 //________________________________________________________________________
 //________________________________________________________________________
 Bool_t AliCaloTrackMatcher::GetTrackClusterMatchingResidual(Int_t trackID, Int_t clusterID, Float_t &dEta, Float_t &dPhi){
-  Int_t position = fMap_TrID_ClID_ToIndex[make_pair(trackID,clusterID)];
+  Int_t position = FindMatchIndex(trackID,clusterID);
   if(position == 0) return kFALSE;
 
   pairFloat tempEtaPhi = fVectorDeltaEtaDeltaPhi.at(position-1);
@@ -758,20 +885,18 @@ Bool_t AliCaloTrackMatcher::GetTrackClusterMatchingResidual(Int_t trackID, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
-        }
+  pair<vector<pairInt>::iterator,vector<pairInt>::iterator> range = equal_range(fVecClusterToTrack.begin(),fVecClusterToTrack.end(),make_pair(clusterID,0),CompareFirst<pairInt>);
+  for (vector<pairInt>::iterator it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
       }
     }
   }
@@ -782,23 +907,21 @@ Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )matched++;
-      }
+  pair<vector<pairInt>::iterator,vector<pairInt>::iterator> range = equal_range(fVecClusterToTrack.begin(),fVecClusterToTrack.end(),make_pair(clusterID,0),CompareFirst<pairInt>);
+  for (vector<pairInt>::iterator it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )matched++;
     }
   }
   return matched;
@@ -807,15 +930,13 @@ Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t
 //________________________________________________________________________
 Int_t AliCaloTrackMatcher::GetNMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dR){
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
+  pair<vector<pairInt>::iterator,vector<pairInt>::iterator> range = equal_range(fVecClusterToTrack.begin(),fVecClusterToTrack.end(),make_pair(clusterID,0),CompareFirst<pairInt>);
+  for (vector<pairInt>::iterator it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
     }
   }
   return matched;
@@ -837,20 +958,18 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
   }else TrackPos = trackID; // for ESD just take trackID
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
-        }
+  pair<vector<pairInt>::iterator,vector<pairInt>::iterator> range = equal_range(fVecTrackToCluster.begin(),fVecTrackToCluster.end(),make_pair(TrackPos,0),CompareFirst<pairInt>);
+  for (vector<pairInt>::iterator it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) matched++;
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) matched++;
       }
     }
   }
@@ -872,24 +991,22 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
   }else TrackPos = trackID; // for ESD just take trackID
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
+  pair<vector<pairInt>::iterator,vector<pairInt>::iterator> range = equal_range(fVecTrackToCluster.begin(),fVecTrackToCluster.end(),make_pair(TrackPos,0),CompareFirst<pairInt>);
+  for (vector<pairInt>::iterator it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
 
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
 
-        if (match_dPhi && match_dEta )matched++;
+      if (match_dPhi && match_dEta )matched++;
 
-      }
     }
   }
   return matched;
@@ -910,15 +1027,13 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
   }else TrackPos = trackID; // for ESD just take trackID
 
   Int_t matched = 0;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return matched;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
-      }
+  pair<vector<pairInt>::iterator,vector<pairInt>::iterator> range = equal_range(fVecTrackToCluster.begin(),fVecTrackToCluster.end(),make_pair(TrackPos,0),CompareFirst<pairInt>);
+  for (vector<pairInt>::iterator it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) matched++;
     }
   }
   return matched;
@@ -927,20 +1042,18 @@ Int_t AliCaloTrackMatcher::GetNMatchedClusterIDsForTrack(AliVEvent *event, Int_t
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedTracks.push_back(it->second);
-        }
+  pair<vector<pairInt>::iterator,vector<pairInt>::iterator> range = equal_range(fVecClusterToTrack.begin(),fVecClusterToTrack.end(),make_pair(clusterID,0),CompareFirst<pairInt>);
+  for (vector<pairInt>::iterator it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedTracks.push_back(it->second);
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedTracks.push_back(it->second);
       }
     }
   }
@@ -950,24 +1063,22 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID,  TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
+  pair<vector<pairInt>::iterator,vector<pairInt>::iterator> range = equal_range(fVecClusterToTrack.begin(),fVecClusterToTrack.end(),make_pair(clusterID,0),CompareFirst<pairInt>);
+  for (vector<pairInt>::iterator it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )tempMatchedTracks.push_back(it->second);
 
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedTracks.push_back(it->second);
-
-      }
     }
   }
   return tempMatchedTracks;
@@ -976,15 +1087,13 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event
 //________________________________________________________________________
 vector<Int_t> AliCaloTrackMatcher::GetMatchedTrackIDsForCluster(AliVEvent *event, Int_t clusterID,  Float_t dR){
   vector<Int_t> tempMatchedTracks;
-  multimap<Int_t,Int_t>::iterator it;
-  for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it){
-    if(it->first == clusterID){
-      Float_t tempDEta, tempDPhi;
-      AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
-      if(!tempTrack) continue;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(it->second);
-      }
+  pair<vector<pairInt>::iterator,vector<pairInt>::iterator> range = equal_range(fVecClusterToTrack.begin(),fVecClusterToTrack.end(),make_pair(clusterID,0),CompareFirst<pairInt>);
+  for (vector<pairInt>::iterator it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(it->second));
+    if(!tempTrack) continue;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->first,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedTracks.push_back(it->second);
     }
   }
   return tempMatchedTracks;
@@ -1005,20 +1114,18 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event
   }else TrackPos = trackID; // for ESD just take trackID
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if(tempTrack->Charge()>0){
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }else if(tempTrack->Charge()<0){
-          dPhiMin*=-1;
-          dPhiMax*=-1;
-          if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedClusters.push_back(it->second);
-        }
+  pair<vector<pairInt>::iterator,vector<pairInt>::iterator> range = equal_range(fVecTrackToCluster.begin(),fVecTrackToCluster.end(),make_pair(TrackPos,0),CompareFirst<pairInt>);
+  for (vector<pairInt>::iterator it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      if(tempTrack->Charge()>0){
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin < tempDPhi) && (tempDPhi < dPhiMax) ) tempMatchedClusters.push_back(it->second);
+      }else if(tempTrack->Charge()<0){
+        dPhiMin*=-1;
+        dPhiMax*=-1;
+        if( (dEtaMin < tempDEta) && (tempDEta < dEtaMax) && (dPhiMin > tempDPhi) && (tempDPhi > dPhiMax) ) tempMatchedClusters.push_back(it->second);
       }
     }
   }
@@ -1041,23 +1148,21 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event
   }else TrackPos = trackID; // for ESD just take trackID
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        Bool_t match_dEta = kFALSE;
-        Bool_t match_dPhi = kFALSE;
-        if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
-        else match_dEta = kFALSE;
-
-        if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
-        else match_dPhi = kFALSE;
-
-        if (match_dPhi && match_dEta )tempMatchedClusters.push_back(it->second);
-      }
+  pair<vector<pairInt>::iterator,vector<pairInt>::iterator> range = equal_range(fVecTrackToCluster.begin(),fVecTrackToCluster.end(),make_pair(TrackPos,0),CompareFirst<pairInt>);
+  for (vector<pairInt>::iterator it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      Bool_t match_dEta = kFALSE;
+      Bool_t match_dPhi = kFALSE;
+      if( TMath::Abs(tempDEta) < fFuncPtDepEta->Eval(tempTrack->Pt())) match_dEta = kTRUE;
+      else match_dEta = kFALSE;
+
+      if( TMath::Abs(tempDPhi) < fFuncPtDepPhi->Eval(tempTrack->Pt())) match_dPhi = kTRUE;
+      else match_dPhi = kFALSE;
+
+      if (match_dPhi && match_dEta )tempMatchedClusters.push_back(it->second);
     }
   }
   return tempMatchedClusters;
@@ -1078,15 +1183,13 @@ vector<Int_t> AliCaloTrackMatcher::GetMatchedClusterIDsForTrack(AliVEvent *event
   }else TrackPos = trackID; // for ESD just take trackID
 
   vector<Int_t> tempMatchedClusters;
-  multimap<Int_t,Int_t>::iterator it;
   AliVTrack* tempTrack  = dynamic_cast<AliVTrack*>(event->GetTrack(TrackPos));
   if(!tempTrack) return tempMatchedClusters;
-  for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it){
-    if(it->first == TrackPos){
-      Float_t tempDEta, tempDPhi;
-      if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
-        if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(it->second);
-      }
+  pair<vector<pairInt>::iterator,vector<pairInt>::iterator> range = equal_range(fVecTrackToCluster.begin(),fVecTrackToCluster.end(),make_pair(TrackPos,0),CompareFirst<pairInt>);
+  for (vector<pairInt>::iterator it=range.first; it!=range.second; ++it){
+    Float_t tempDEta, tempDPhi;
+    if(GetTrackClusterMatchingResidual(tempTrack->GetID(),it->second,tempDEta,tempDPhi)){
+      if (TMath::Sqrt(tempDEta*tempDEta + tempDPhi*tempDPhi) < dR ) tempMatchedClusters.push_back(it->second);
     }
   }
   return tempMatchedClusters;
@@ -1537,8 +1640,8 @@ void AliCaloTrackMatcher::DebugMatching(){
     cout << "vector etaphi:" << endl;
     cout << fVectorDeltaEtaDeltaPhi.size() << endl;
     cout << "multimap" << endl;
-    mapT::iterator iter = fMap_TrID_ClID_ToIndex.begin();
-    for (iter = fMap_TrID_ClID_ToIndex.begin(); iter != fMap_TrID_ClID_ToIndex.end(); ++iter){
+    vector<pairIntIndex>::iterator iter;
+    for (iter = fVec_TrID_ClID_ToIndex.begin(); iter != fVec_TrID_ClID_ToIndex.end(); ++iter){
       Float_t dEta, dPhi = 0;
       if(!GetTrackClusterMatchingResidual(iter->first.first,iter->first.second,dEta,dPhi)) continue;
       cout << "  [" << iter->first.first << "/" << iter->first.second << ", " << iter->second << "] - (" << dEta << "/" << dPhi << ")" << endl;
@@ -1554,11 +1657,11 @@ void AliCaloTrackMatcher::DebugMatching(){
       cout << itr << " (" << tCharge << ") - " << GetNMatchedClusterIDsForTrack(fInputEvent,inTrack->GetID(),5,-5,0.2,-0.4) << "\t\t";
     }
     cout << endl;
-    multimap<Int_t,Int_t>::iterator it;
-    for (it=fMapTrackToCluster.begin(); it!=fMapTrackToCluster.end(); ++it) cout << it->first << " => " << it->second << '\n';
+    vector<pairInt>::iterator it;
+    for (it=fVecTrackToCluster.begin(); it!=fVecTrackToCluster.end(); ++it) cout << it->first << " => " << it->second << '\n';
     cout << "mapClusterToTrack" << endl;
-    Int_t tempClus = it->second;
-    for (it=fMapClusterToTrack.begin(); it!=fMapClusterToTrack.end(); ++it) cout << it->first << " => " << it->second << '\n';
+    Int_t tempClus = fVecTrackToCluster.back().second;
+    for (it=fVecClusterToTrack.begin(); it!=fVecClusterToTrack.end(); ++it) cout << it->first << " => " << it->second << '\n';
     vector<Int_t> tempTracks = GetMatchedTrackIDsForCluster(fInputEvent,tempClus, 5, -5, 0.2, -0.4);
     for(UInt_t iJ=0; iJ<tempTracks.size();iJ++){
       cout << tempClus << " - " << tempTracks.at(iJ) << endl;
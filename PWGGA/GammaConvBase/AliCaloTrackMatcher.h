@@ -31,6 +31,7 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     void SetAnalysisTrainMode(TString mode){fAnalysisTrainMode = mode; return;}
     void SetMatchingResidual(Float_t res) {fMatchingResidual = res; return;}
     void SetMatchingWindow(Float_t win) {fMatchingWindow = win; return;}
+    void SetValidateClusterGrid(Bool_t flag) {fDoGridValidation = flag; return;}
 
     // for cluster <-> primary matching
     Bool_t GetTrackClusterMatchingResidual(Int_t trackID, Int_t clusterID, Float_t &dEta, Float_t &dPhi);
@@ -82,6 +83,7 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     typedef pair<Int_t, Int_t> pairInt;
     typedef pair<Float_t, Float_t> pairFloat;
     typedef map<pairInt, Int_t> mapT;
+    typedef pair<pairInt, Int_t> pairIntIndex;
 
     AliCaloTrackMatcher (const AliCaloTrackMatcher&); // not implemented
     AliCaloTrackMatcher & operator=(const AliCaloTrackMatcher&); // not implemented
@@ -90,6 +92,11 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     void Initialize(Int_t runNumber);
     void ProcessEvent(AliVEvent *event);
     void SetLogBinningYTH2(TH2* histoRebin);
+    void BuildClusterGrid(AliVEvent *event, Int_t nClus);
+    void GetClusterCandidates(const Double_t *exPos, vector<Int_t> &candidates);
+    void GetClusterCandidatesFullLoop(const Double_t *exPos, vector<Int_t> &candidates);
+    void SortMatches();
+    Int_t FindMatchIndex(Int_t trackID, Int_t clusterID);
 
     // debug methods
     void DebugMatching();
@@ -117,12 +124,28 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
 
     TClonesArray*         fArrClusters;            //! array with clusters
 
-    multimap<Int_t,Int_t> fMapTrackToCluster;      //! connects a given track ID with all associated cluster IDs
-    multimap<Int_t,Int_t> fMapClusterToTrack;      //! connects a given cluster ID with all associated track IDs
+    // cluster grid in (phi,z) at the calorimeter surface, filled once per event
+    static const Int_t    kGridNPhi = 72;          // number of phi cells of the cluster grid
+    static const Int_t    kGridMaxNZ = 100;        // maximum number of z cells of the cluster grid
+    Bool_t                fDoGridValidation;       // compare the grid candidates with the full cluster loop for every track
+    Int_t                 fGridNZ;                 //! number of z cells of the cluster grid in the current event
+    Float_t               fGridZMin;               //! lower z edge of the cluster grid
+    Float_t               fGridZCellSize;          //! z size of the cells of the cluster grid
+    Float_t               fGridMinR;               //! smallest transverse radius of the clusters in the current event
+    vector<AliVCluster*>  fGridClusters;           //! pointers to the clusters of the current event, NULL if not available
+    vector<Float_t>       fGridClusterPos;         //! x,y,z of the clusters of the current event
+    vector<Int_t>         fGridCellFirst;          //! first entry of each cell in fGridCellClusters, size nCells+1
+    vector<Int_t>         fGridCellClusters;       //! cluster indices ordered by cell
+    vector<Int_t>         fGridCandidates;         //! candidate clusters of the current track
+    vector<Int_t>         fGridCandidatesCheck;    //! candidate clusters of the current track from the full loop
+
+    // matches are appended during the event and sorted (stable on the first ID) at its end
+    vector<pairInt>       fVecTrackToCluster;      //! connects a given track ID with all associated cluster IDs
+    vector<pairInt>       fVecClusterToTrack;      //! connects a given cluster ID with all associated track IDs
 
     Int_t                 fNEntries;               //! number of current TrackID/ClusterID -> Eta/Phi connections
     vector<pairFloat>     fVectorDeltaEtaDeltaPhi; //! vector of all matching residuals for a specific TrackID/ClusterID
-    mapT                  fMap_TrID_ClID_ToIndex;  //! map tuple of (trackID,clusterID) to index in vector fVectorDeltaEtaDeltaPhi
+    vector<pairIntIndex>  fVec_TrID_ClID_ToIndex;  //! tuples of (trackID,clusterID) with index in vector fVectorDeltaEtaDeltaPhi
 
     // for cluster <-> V0-track matching (running with different mass hypthesis)
     multimap<Int_t,Int_t> fSecMapTrackToCluster;      //! connects a given secondary track ID with all associated cluster IDs
@@ -140,7 +163,7 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
 
     Bool_t                fDoLightOutput;          // switch for running light output, kFALSE -> normal mode, kTRUE -> light mode
 
-    ClassDef(AliCaloTrackMatcher,8)
+    ClassDef(AliCaloTrackMatcher,9)
 };
 
 #endif
@@ -70,6 +70,7 @@
 #include "AliCodeTimer.h"
 #include "AliMultSelection.h"
 #include <cstring>
+#include <vector>
 
 /// \cond CLASSIMP
 ClassImp(AliAnalysisVertexingHF);
@@ -571,7 +572,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   AliESDtrack *negtrack1 = 0;
   AliESDtrack *negtrack2 = 0;
   AliESDtrack *trackPi   = 0;
-  Double_t mompos1[3],mompos2[3],momneg1[3],momneg2[3];
+  Double_t mompos1[3],momneg1[3];
   Float_t dcaMax = fCutsD0toKpi->GetDCACut();
   if(fCutsJpsitoee) dcaMax=TMath::Max(dcaMax,fCutsJpsitoee->GetDCACut());
   if(fCutsDplustoKpipi) dcaMax=TMath::Max(dcaMax,fCutsDplustoKpipi->GetDCACut());
@@ -629,6 +630,18 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   AliDebug(1,Form(" Selected tracks: %d",nSeleTrks));
   fnSeleTrksTotal += nSeleTrks;
 
+  // charge and momentum at the primary vertex of the selected tracks, computed once
+  // per event for the invariant mass and pt preselection of the 3 and 4 prong
+  // combinations, which is applied before the track-to-track DCAs
+  std::vector<Short_t>  trkCharge(nSeleTrks);
+  std::vector<Double_t> trkPx(nSeleTrks),trkPy(nSeleTrks),trkPz(nSeleTrks);
+  Double_t momAtVtx[3];
+  for(Int_t iTrk=0; iTrk<nSeleTrks; iTrk++) {
+    ((AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrk))->GetPxPyPz(momAtVtx);
+    trkPx[iTrk]=momAtVtx[0]; trkPy[iTrk]=momAtVtx[1]; trkPz[iTrk]=momAtVtx[2];
+    trkCharge[iTrk]=((AliESDtrack*)seleTrksArray.UncheckedAt(iTrk))->Charge();
+  }
+
 
   TObjArray *twoTrackArray1    = new TObjArray(2);
   TObjArray *twoTrackArray2    = new TObjArray(2);
@@ -834,7 +847,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
     }
 
     if(!TESTBIT(seleFlags[iTrkP1],kBitDispl)) continue;
-    if(postrack1->Charge()<0 && !fLikeSign) continue;
+    if(trkCharge[iTrkP1]<0 && !fLikeSign) continue;
 
     // LOOP ON  NEGATIVE  TRACKS
     for(iTrkN1=0; iTrkN1<nSeleTrks; iTrkN1++) {
@@ -847,7 +860,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
       // get track from tracks array
       negtrack1 = (AliESDtrack*)seleTrksArray.UncheckedAt(iTrkN1);
 
-      if(negtrack1->Charge()>0 && !fLikeSign) continue;
+      if(trkCharge[iTrkN1]>0 && !fLikeSign) continue;
 
       if(!TESTBIT(seleFlags[iTrkN1],kBitDispl)) continue;
 
@@ -855,13 +868,13 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	if(evtNumber[iTrkP1]==evtNumber[iTrkN1]) continue;
       }
 
-      if(postrack1->Charge()==negtrack1->Charge()) { // like-sign
+      if(trkCharge[iTrkP1]==trkCharge[iTrkN1]) { // like-sign
 	isLikeSign2Prong=kTRUE;
 	if(!fLikeSign)    continue;
 	if(iTrkN1<iTrkP1) continue; // this is needed to avoid double-counting of like-sign
       } else { // unlike-sign
 	isLikeSign2Prong=kFALSE;
-	if(postrack1->Charge()<0 || negtrack1->Charge()>0) continue;  // this is needed to avoid double-counting of unlike-sign
+	if(trkCharge[iTrkP1]<0 || trkCharge[iTrkN1]>0) continue;  // this is needed to avoid double-counting of unlike-sign
 	if(fMixEvent) {
 	  if(evtNumber[iTrkP1]==evtNumber[iTrkN1]) continue;
 	}
@@ -1056,6 +1069,9 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	continue;
       }
 
+      // 4 prong candidates are built only from unlike-sign pairs passing the D0->Kpipipi DCA cut
+      Bool_t may4Prong = f4Prong && !isLikeSign2Prong && dcap1n1 < fCutsD0toKpipipi->GetDCACut();
+
 
       // 2nd LOOP  ON  POSITIVE  TRACKS
       for(iTrkP2=iTrkP1+1; iTrkP2<nSeleTrks; iTrkP2++) {
@@ -1067,7 +1083,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	// get track from tracks array
 	postrack2 = (AliESDtrack*)seleTrksArray.UncheckedAt(iTrkP2);
 
-	if(postrack2->Charge()<0) continue;
+	if(trkCharge[iTrkP2]<0) continue;
 
 	if(!TESTBIT(seleFlags[iTrkP2],kBitDispl)) continue;
 
@@ -1084,7 +1100,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
 	if(isLikeSign2Prong) { // like-sign pair -> have to build only like-sign triplet
 	  if(!fLikeSign3prong) continue;
-	  if(postrack1->Charge()>0) { // ok: like-sign triplet (+++)
+	  if(trkCharge[iTrkP1]>0) { // ok: like-sign triplet (+++)
 	    isLikeSign3Prong=kTRUE;
 	  } else { // not ok
 	    continue;
@@ -1139,15 +1155,24 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
 	//printf("********** %d %d %d\n",postrack1->GetID(),postrack2->GetID(),negtrack1->GetID());
 
+	// check invariant mass cuts for D+,Ds,Lc before the track-to-track DCAs,
+	// a triplet failing them is still needed if it can make a 4 prong
+        massCutOK=kTRUE;
+	if(f3Prong && fMassCutBeforeVertexing){
+	  Double_t pxDau[3]={mompos1[0],momneg1[0],trkPx[iTrkP2]};
+	  Double_t pyDau[3]={mompos1[1],momneg1[1],trkPy[iTrkP2]};
+	  Double_t pzDau[3]={mompos1[2],momneg1[2],trkPz[iTrkP2]};
+	  massCutOK = SelectInvMassAndPt3prong(pxDau,pyDau,pzDau,pidLcStatus);
+	  if(!massCutOK && !may4Prong) { postrack2=0; continue; }
+	}
+
 	dcap2n1 = postrack2->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
 	if(dcap2n1>dcaMax) { postrack2=0; continue; }
 	dcap1p2 = postrack2->GetDCA(postrack1,fBzkG,xdummy,ydummy);
 	if(dcap1p2>dcaMax) { postrack2=0; continue; }
 
-	// check invariant mass cuts for D+,Ds,Lc
-        massCutOK=kTRUE;
 	if(f3Prong) {
-	  if(postrack2->Charge()>0) {
+	  if(trkCharge[iTrkP2]>0) {
 	    threeTrackArray->AddAt(postrack1,0);
 	    threeTrackArray->AddAt(negtrack1,1);
 	    threeTrackArray->AddAt(postrack2,2);
@@ -1156,14 +1181,6 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    threeTrackArray->AddAt(postrack1,1);
 	    threeTrackArray->AddAt(postrack2,2);
 	  }
-	  if(fMassCutBeforeVertexing){
-	    postrack2->GetPxPyPz(mompos2);
-	    Double_t pxDau[3]={mompos1[0],momneg1[0],mompos2[0]};
-	    Double_t pyDau[3]={mompos1[1],momneg1[1],mompos2[1]};
-	    Double_t pzDau[3]={mompos1[2],momneg1[2],mompos2[2]};
-	    //	    massCutOK = SelectInvMassAndPt3prong(threeTrackArray);
-	    massCutOK = SelectInvMassAndPt3prong(pxDau,pyDau,pzDau,pidLcStatus);
-	  }
 	}
 
 	if(f3Prong && !massCutOK) {
@@ -1225,11 +1242,10 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	}
 
 	// 4 prong candidates
-	if(f4Prong
-	   // don't make 4 prong with like-sign pairs and triplets
-	   && !isLikeSign2Prong && !isLikeSign3Prong
+	if(may4Prong
+	   // don't make 4 prong with like-sign triplets
+	   && !isLikeSign3Prong
 	   // track-to-track dca cuts already now
-	   && dcap1n1 < fCutsD0toKpipipi->GetDCACut()
 	   && dcap2n1 < fCutsD0toKpipipi->GetDCACut()) {
 	  // back to primary vertex
 	  //	  postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
@@ -1255,7 +1271,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    // get track from tracks array
 	    negtrack2 = (AliESDtrack*)seleTrksArray.UncheckedAt(iTrkN2);
 
-	    if(negtrack2->Charge()>0) continue;
+	    if(trkCharge[iTrkN2]>0) continue;
 
 	    if(!TESTBIT(seleFlags[iTrkN2],kBitDispl)) continue;
 	    if(fMixEvent){
@@ -1277,6 +1293,19 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    SetParametersAtVertex(postrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkP2));
 	    SetParametersAtVertex(negtrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN2));
 
+	    // check invariant mass cuts for D0 before the track-to-track DCAs
+	    massCutOK=kTRUE;
+	    if(fMassCutBeforeVertexing){
+	      Double_t pxDau[4]={trkPx[iTrkP1],trkPx[iTrkN1],trkPx[iTrkP2],trkPx[iTrkN2]};
+	      Double_t pyDau[4]={trkPy[iTrkP1],trkPy[iTrkN1],trkPy[iTrkP2],trkPy[iTrkN2]};
+	      Double_t pzDau[4]={trkPz[iTrkP1],trkPz[iTrkN1],trkPz[iTrkP2],trkPz[iTrkN2]};
+	      massCutOK = SelectInvMassAndPt4prong(pxDau,pyDau,pzDau);
+	    }
+	    if(!massCutOK) {
+	      negtrack2=0;
+	      continue;
+	    }
+
 	    dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
 	    if(dcap1n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
             dcap2n2 = postrack2->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
@@ -1288,17 +1317,6 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    fourTrackArray->AddAt(postrack2,2);
 	    fourTrackArray->AddAt(negtrack2,3);
 
-	    // check invariant mass cuts for D0
-	    massCutOK=kTRUE;
-	    if(fMassCutBeforeVertexing)
-	      massCutOK = SelectInvMassAndPt4prong(fourTrackArray);
-
-	    if(!massCutOK) {
-	      fourTrackArray->Clear();
-	      negtrack2=0;
-	      continue;
-	    }
-
 	    // Vertexing
 	    AliAODVertex* secVert4PrAOD = ReconstructSecondaryVertex(fourTrackArray,dispersion);
 	    io4Prong = Make4Prong(fourTrackArray,event,secVert4PrAOD,vertexp1n1,vertexp1n1p2,dcap1n1,dcap1n2,dcap2n1,dcap2n2,ok4Prong);
@@ -1343,7 +1361,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	// get track from tracks array
 	negtrack2 = (AliESDtrack*)seleTrksArray.UncheckedAt(iTrkN2);
 
-	if(negtrack2->Charge()>0) continue;
+	if(trkCharge[iTrkN2]>0) continue;
 
 	if(!TESTBIT(seleFlags[iTrkN2],kBitDispl)) continue;
 
@@ -1360,7 +1378,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
 	if(isLikeSign2Prong) { // like-sign pair -> have to build only like-sign triplet
 	  if(!fLikeSign3prong) continue;
-	  if(postrack1->Charge()<0) { // ok: like-sign triplet (---)
+	  if(trkCharge[iTrkP1]<0) { // ok: like-sign triplet (---)
 	    isLikeSign3Prong=kTRUE;
 	  } else { // not ok
 	    continue;
@@ -1410,31 +1428,28 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	SetParametersAtVertex(negtrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN2));
 	//printf("********** %d %d %d\n",postrack1->GetID(),negtrack1->GetID(),negtrack2->GetID());
 
-	dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
-	if(dcap1n2>dcaMax) { negtrack2=0; continue; }
-	dcan1n2 = negtrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
-	if(dcan1n2>dcaMax) { negtrack2=0; continue; }
-
-	threeTrackArray->AddAt(negtrack1,0);
-	threeTrackArray->AddAt(postrack1,1);
-	threeTrackArray->AddAt(negtrack2,2);
-
-	// check invariant mass cuts for D+,Ds,Lc
+	// check invariant mass cuts for D+,Ds,Lc before the track-to-track DCAs
         massCutOK=kTRUE;
 	if(fMassCutBeforeVertexing && f3Prong){
-	  negtrack2->GetPxPyPz(momneg2);
-	  Double_t pxDau[3]={momneg1[0],mompos1[0],momneg2[0]};
-	  Double_t pyDau[3]={momneg1[1],mompos1[1],momneg2[1]};
-	  Double_t pzDau[3]={momneg1[2],mompos1[2],momneg2[2]};
-	  //	  massCutOK = SelectInvMassAndPt3prong(threeTrackArray);
+	  Double_t pxDau[3]={momneg1[0],mompos1[0],trkPx[iTrkN2]};
+	  Double_t pyDau[3]={momneg1[1],mompos1[1],trkPy[iTrkN2]};
+	  Double_t pzDau[3]={momneg1[2],mompos1[2],trkPz[iTrkN2]};
 	  massCutOK = SelectInvMassAndPt3prong(pxDau,pyDau,pzDau,pidLcStatus);
 	}
 	if(!massCutOK) {
-	  threeTrackArray->Clear();
 	  negtrack2=0;
 	  continue;
 	}
 
+	dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	if(dcap1n2>dcaMax) { negtrack2=0; continue; }
+	dcan1n2 = negtrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
+	if(dcan1n2>dcaMax) { negtrack2=0; continue; }
+
+	threeTrackArray->AddAt(negtrack1,0);
+	threeTrackArray->AddAt(postrack1,1);
+	threeTrackArray->AddAt(negtrack2,2);
+
 	// Vertexing
 	twoTrackArray2->AddAt(postrack1,0);
 	twoTrackArray2->AddAt(negtrack2,1);
@@ -121,6 +121,8 @@ class AliAODv0;
 #include "AliEventCuts.h"
 #include "AliV0Result.h"
 #include "AliCascadeResult.h"
+#include "AliV0SelectionTable.h"
+#include "AliCascadeSelectionTable.h"
 #include "AliAnalysisTaskStrangenessVsMultiplicityAODRun2.h"
 #include "AliNanoAODHeader.h"
 
@@ -132,6 +134,7 @@ ClassImp(AliAnalysisTaskStrangenessVsMultiplicityAODRun2)
 AliAnalysisTaskStrangenessVsMultiplicityAODRun2::AliAnalysisTaskStrangenessVsMultiplicityAODRun2()
 : AliAnalysisTaskSE(), fListHist(0), fListK0Short(0), fListLambda(0), fListAntiLambda(0),
 fListXiMinus(0), fListXiPlus(0), fListOmegaMinus(0), fListOmegaPlus(0),
+fV0SelectionTable(0), fCascadeSelectionTable(0),
 fTreeEvent(0), fTreeV0(0), fTreeCascade(0),
 fPIDResponse(0), fESDtrackCuts(0),
 fESDtrackCutsITSsa2010(0), fESDtrackCutsGlobal2015(0),
@@ -475,6 +478,7 @@ fHistCentrality(0)
 AliAnalysisTaskStrangenessVsMultiplicityAODRun2::AliAnalysisTaskStrangenessVsMultiplicityAODRun2(Bool_t lSaveEventTree, Bool_t lSaveV0Tree, Bool_t lSaveCascadeTree, const char *name, TString lExtraOptions)
 : AliAnalysisTaskSE(name), fListHist(0), fListK0Short(0), fListLambda(0), fListAntiLambda(0),
 fListXiMinus(0), fListXiPlus(0), fListOmegaMinus(0), fListOmegaPlus(0),
+fV0SelectionTable(0), fCascadeSelectionTable(0),
 fTreeEvent(0), fTreeV0(0), fTreeCascade(0),
 fPIDResponse(0), fESDtrackCuts(0),
 fESDtrackCutsITSsa2010(0), fESDtrackCutsGlobal2015(0),
@@ -915,6 +919,14 @@ AliAnalysisTaskStrangenessVsMultiplicityAODRun2::~AliAnalysisTaskStrangenessVsMu
         delete fListOmegaPlus;
         fListOmegaPlus = 0x0;
     }
+    if (fV0SelectionTable) {
+        delete fV0SelectionTable;
+        fV0SelectionTable = 0x0;
+    }
+    if (fCascadeSelectionTable) {
+        delete fCascadeSelectionTable;
+        fCascadeSelectionTable = 0x0;
+    }
     if (fTreeEvent) {
         delete fTreeEvent;
         fTreeEvent = 0x0;
@@ -1407,6 +1419,20 @@ void AliAnalysisTaskStrangenessVsMultiplicityAODRun2::UserCreateOutputObjects()
     
     AliWarning( Form("Initialized %i cascade output objects!", lTotalCfgs));
     
+    //Compile the cuts of all configurations into tables (order as in the lists)
+    if ( !fV0SelectionTable ) fV0SelectionTable = new AliV0SelectionTable();
+    fV0SelectionTable->Clear();
+    fV0SelectionTable->AddConfigurations(fListK0Short);
+    fV0SelectionTable->AddConfigurations(fListLambda);
+    fV0SelectionTable->AddConfigurations(fListAntiLambda);
+    
+    if ( !fCascadeSelectionTable ) fCascadeSelectionTable = new AliCascadeSelectionTable();
+    fCascadeSelectionTable->Clear();
+    fCascadeSelectionTable->AddConfigurations(fListXiMinus);
+    fCascadeSelectionTable->AddConfigurations(fListXiPlus);
+    fCascadeSelectionTable->AddConfigurations(fListOmegaMinus);
+    fCascadeSelectionTable->AddConfigurations(fListOmegaPlus);
+    
     //Regular Output: Slots 1-8
     PostData(1, fListHist    );
     PostData(2, fListK0Short    );
@@ -1963,25 +1989,24 @@ void AliAnalysisTaskStrangenessVsMultiplicityAODRun2::UserExec(Option_t *)
         TH3F *histoout         = 0x0;
         AliV0Result *lV0Result = 0x0;
         
-        //pointers to valid results
-        AliV0Result *lPointers[50000];
-        Long_t lValidConfigurations=0;
-        
-        for( Int_t icfg=0; icfg<fListK0Short->GetEntries(); icfg++ ){
-            lPointers[lValidConfigurations] = (AliV0Result*) fListK0Short->At(icfg);
-            lValidConfigurations++;
-        }
-        for( Int_t icfg=0; icfg<fListLambda->GetEntries(); icfg++ ){
-            lPointers[lValidConfigurations] = (AliV0Result*) fListLambda->At(icfg);
-            lValidConfigurations++;
-        }
-        for( Int_t icfg=0; icfg<fListAntiLambda->GetEntries(); icfg++ ){
-            lPointers[lValidConfigurations] = (AliV0Result*) fListAntiLambda->At(icfg);
-            lValidConfigurations++;
-        }
+        //configurations passing the compiled table cuts
+        AliV0SelectionTable::Candidate lV0Candidate;
+        lV0Candidate.fOnFlyStatus                       = lOnFlyStatus;
+        lV0Candidate.fNegEta                            = fTreeVariableNegEta;
+        lV0Candidate.fPosEta                            = fTreeVariablePosEta;
+        lV0Candidate.fV0Radius                          = fTreeVariableV0Radius;
+        lV0Candidate.fDcaNegToPrimVertex                = fTreeVariableDcaNegToPrimVertex;
+        lV0Candidate.fDcaPosToPrimVertex                = fTreeVariableDcaPosToPrimVertex;
+        lV0Candidate.fDcaV0Daughters                    = fTreeVariableDcaV0Daughters;
+        lV0Candidate.fV0CosineOfPointingAngle           = fTreeVariableV0CosineOfPointingAngle;
+        lV0Candidate.fLeastNbrCrossedRows               = fTreeVariableLeastNbrCrossedRows;
+        lV0Candidate.fLeastRatioCrossedRowsOverFindable = fTreeVariableLeastRatioCrossedRowsOverFindable;
+        
+        Long_t lPassed[50000];
+        Long_t lValidConfigurations = fV0SelectionTable->Select( lV0Candidate, lPassed );
         
         for(Int_t lcfg=0; lcfg<lValidConfigurations; lcfg++){
-            lV0Result = lPointers[lcfg];
+            lV0Result = fV0SelectionTable->GetConfiguration( lPassed[lcfg] );
             histoout  = lV0Result->GetHistogram();
             
             Float_t lMass = 0;
@@ -2873,33 +2898,34 @@ void AliAnalysisTaskStrangenessVsMultiplicityAODRun2::UserExec(Option_t *)
         TH3F *histoout         = 0x0;
         AliCascadeResult *lCascadeResult = 0x0;
         
-        //pointers to valid results
-        AliCascadeResult *lPointers[50000];
-        Long_t lValidConfigurations=0;
-        
-        if( lValidXiMinus )
-            for( Int_t icfg=0; icfg<fListXiMinus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiMinus->At(icfg);
-                lValidConfigurations++;
-            }
-        if( lValidXiPlus )
-            for( Int_t icfg=0; icfg<fListXiPlus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListXiPlus->At(icfg);
-                lValidConfigurations++;
-            }
-        if( lValidOmegaMinus )
-            for( Int_t icfg=0; icfg<fListOmegaMinus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaMinus->At(icfg);
-                lValidConfigurations++;
-            }
-        if( lValidOmegaPlus )
-            for( Int_t icfg=0; icfg<fListOmegaPlus->GetEntries(); icfg++ ){
-                lPointers[lValidConfigurations] = (AliCascadeResult*) fListOmegaPlus->At(icfg);
-                lValidConfigurations++;
-            }
+        //configurations passing the compiled table cuts
+        AliCascadeSelectionTable::Candidate lCascCandidate;
+        lCascCandidate.fValidList[0]         = lValidXiMinus;
+        lCascCandidate.fValidList[1]         = lValidXiPlus;
+        lCascCandidate.fValidList[2]         = lValidOmegaMinus;
+        lCascCandidate.fValidList[3]         = lValidOmegaPlus;
+        lCascCandidate.fCharge               = fTreeCascVarCharge;
+        lCascCandidate.fNegEta               = fTreeCascVarNegEta;
+        lCascCandidate.fPosEta               = fTreeCascVarPosEta;
+        lCascCandidate.fBachEta              = fTreeCascVarBachEta;
+        lCascCandidate.fDCANegToPrimVtx      = fTreeCascVarDCANegToPrimVtx;
+        lCascCandidate.fDCAPosToPrimVtx      = fTreeCascVarDCAPosToPrimVtx;
+        lCascCandidate.fDCAV0Daughters       = fTreeCascVarDCAV0Daughters;
+        lCascCandidate.fV0CosPointingAngle   = fTreeCascVarV0CosPointingAngle;
+        lCascCandidate.fV0Radius             = fTreeCascVarV0Radius;
+        lCascCandidate.fDCAV0ToPrimVtx       = fTreeCascVarDCAV0ToPrimVtx;
+        lCascCandidate.fDCABachToPrimVtx     = fTreeCascVarDCABachToPrimVtx;
+        lCascCandidate.fDCACascDaughters     = fTreeCascVarDCACascDaughters;
+        lCascCandidate.fCascCosPointingAngle = fTreeCascVarCascCosPointingAngle;
+        lCascCandidate.fCascRadius           = fTreeCascVarCascRadius;
+        lCascCandidate.fLeastNbrClusters     = fTreeCascVarLeastNbrClusters;
+        lCascCandidate.fDCABachToBaryon      = fTreeCascVarDCABachToBaryon;
+        
+        Long_t lPassed[50000];
+        Long_t lValidConfigurations = fCascadeSelectionTable->Select( lCascCandidate, lPassed );
         
         for(Int_t lcfg=0; lcfg<lValidConfigurations; lcfg++){
-            lCascadeResult = lPointers[lcfg];
+            lCascadeResult = fCascadeSelectionTable->GetConfiguration( lPassed[lcfg] );
             Bool_t lTheOne = fkConfigToSave.EqualTo( lCascadeResult->GetName() );
             histoout  = lCascadeResult->GetHistogram();
             
@@ -44,6 +44,8 @@ class AliPIDResponse;
 class AliCFContainer;
 class AliV0Result;
 class AliCascadeResult;
+class AliV0SelectionTable;
+class AliCascadeSelectionTable;
 class AliExternalTrackParam;
 
 //#include "TString.h"
@@ -242,6 +244,8 @@ private:
     TList  *fListXiPlus;   // List of XiPlus outputs
     TList  *fListOmegaMinus;   // List of XiMinus outputs
     TList  *fListOmegaPlus;   // List of XiPlus outputs
+    AliV0SelectionTable      *fV0SelectionTable;      //! Compiled cuts of the V0 configurations
+    AliCascadeSelectionTable *fCascadeSelectionTable; //! Compiled cuts of the cascade configurations
     TTree  *fTreeEvent;              //! Output Tree, Events
     TTree  *fTreeV0;              //! Output Tree, V0s
     TTree  *fTreeCascade;              //! Output Tree, Cascades
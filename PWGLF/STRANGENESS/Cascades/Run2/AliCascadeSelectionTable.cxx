@@ -0,0 +1,134 @@
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Cut table compiled from a set of AliCascadeResult configurations
+//
+// As for AliV0SelectionTable, only necessary conditions of the full
+// cascade selection are compiled. The variable V0 and cascade cosPA
+// cuts can only be tighter than the constant ones, and the variable
+// cascade DCA daughters cut can only be tighter than the constant one.
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+#include "TList.h"
+#include "AliLog.h"
+#include "AliCascadeResult.h"
+#include "AliV0SelectionTable.h"
+#include "AliCascadeSelectionTable.h"
+
+ClassImp(AliCascadeSelectionTable);
+
+//________________________________________________________________
+AliCascadeSelectionTable::AliCascadeSelectionTable() :
+TObject(),
+fkUseSwapBachelorCharge(kTRUE), fNLists(0),
+fResults(),
+fList(), fCharge(), fMinEtaTracks(), fMaxEtaTracks(),
+fDCANegToPV(), fDCAPosToPV(), fDCAV0Daughters(), fV0CosPA(), fV0Radius(),
+fDCAV0ToPV(), fDCABachToPV(), fDCACascDaughters(), fCascCosPA(), fCascRadius(),
+fLeastNumberOfClusters(), fDCABachToBaryon(),
+fPass()
+{
+    // Empty table
+}
+
+//________________________________________________________________
+AliCascadeSelectionTable::~AliCascadeSelectionTable(){
+    // Configurations are owned by their lists
+}
+
+//________________________________________________________________
+void AliCascadeSelectionTable::Clear(Option_t*)
+{
+    fNLists = 0;
+    fResults.clear();
+    fList.clear();
+    fCharge.clear();
+    fMinEtaTracks.clear();
+    fMaxEtaTracks.clear();
+    fDCANegToPV.clear();
+    fDCAPosToPV.clear();
+    fDCAV0Daughters.clear();
+    fV0CosPA.clear();
+    fV0Radius.clear();
+    fDCAV0ToPV.clear();
+    fDCABachToPV.clear();
+    fDCACascDaughters.clear();
+    fCascCosPA.clear();
+    fCascRadius.clear();
+    fLeastNumberOfClusters.clear();
+    fDCABachToBaryon.clear();
+    fPass.clear();
+}
+
+//________________________________________________________________
+void AliCascadeSelectionTable::AddConfigurations( TList *lList )
+{
+    if( fNLists >= kMaxLists ){
+        AliFatal(Form("At most %i configuration lists are supported!", kMaxLists));
+        return;
+    }
+    const Int_t lListIndex = fNLists++;
+    if( !lList ) return;
+    for( Int_t icfg=0; icfg<lList->GetEntries(); icfg++ ){
+        AliCascadeResult *lCascadeResult = (AliCascadeResult*) lList->At(icfg);
+        
+        //Expected charge, as in the analysis tasks
+        Int_t lCharge = -2;
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus ||
+            lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus ) lCharge = -1;
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiPlus ||
+            lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus  ) lCharge = +1;
+        if ( fkUseSwapBachelorCharge && lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
+        
+        fResults.push_back( lCascadeResult );
+        fList.push_back( lListIndex );
+        fCharge.push_back( lCharge );
+        fMinEtaTracks.push_back( lCascadeResult->GetCutMinEtaTracks() );
+        fMaxEtaTracks.push_back( lCascadeResult->GetCutMaxEtaTracks() );
+        fDCANegToPV.push_back( lCascadeResult->GetCutDCANegToPV() );
+        fDCAPosToPV.push_back( lCascadeResult->GetCutDCAPosToPV() );
+        fDCAV0Daughters.push_back( lCascadeResult->GetCutDCAV0Daughters() );
+        fV0CosPA.push_back( lCascadeResult->GetCutV0CosPA() );
+        fV0Radius.push_back( lCascadeResult->GetCutV0Radius() );
+        fDCAV0ToPV.push_back( lCascadeResult->GetCutDCAV0ToPV() );
+        fDCABachToPV.push_back( lCascadeResult->GetCutDCABachToPV() );
+        fDCACascDaughters.push_back( lCascadeResult->GetCutDCACascDaughters() );
+        fCascCosPA.push_back( lCascadeResult->GetCutCascCosPA() );
+        fCascRadius.push_back( lCascadeResult->GetCutCascRadius() );
+        fLeastNumberOfClusters.push_back( lCascadeResult->GetCutLeastNumberOfClusters() );
+        fDCABachToBaryon.push_back( lCascadeResult->GetCutDCABachToBaryon() );
+    }
+    fPass.resize( fResults.size() );
+}
+
+//________________________________________________________________
+Long_t AliCascadeSelectionTable::Select( const Candidate &lCandidate, Long_t *lPassed )
+{
+    const Long_t lN = fResults.size();
+    if( lN == 0 ) return 0;
+    
+    //Candidate values are promoted as in the comparisons of the analysis tasks
+    UChar_t *lPass = &fPass[0];
+    AliV0SelectionTable::KeepIfEqual( lN, lPass, &fCharge[0],                lCandidate.fCharge );
+    AliV0SelectionTable::KeepIfAbove( lN, lPass, &fMinEtaTracks[0],          lCandidate.fPosEta );
+    AliV0SelectionTable::KeepIfBelow( lN, lPass, &fMaxEtaTracks[0],          lCandidate.fPosEta );
+    AliV0SelectionTable::KeepIfAbove( lN, lPass, &fMinEtaTracks[0],          lCandidate.fNegEta );
+    AliV0SelectionTable::KeepIfBelow( lN, lPass, &fMaxEtaTracks[0],          lCandidate.fNegEta );
+    AliV0SelectionTable::KeepIfAbove( lN, lPass, &fMinEtaTracks[0],          lCandidate.fBachEta );
+    AliV0SelectionTable::KeepIfBelow( lN, lPass, &fMaxEtaTracks[0],          lCandidate.fBachEta );
+    AliV0SelectionTable::KeepIfAbove( lN, lPass, &fDCANegToPV[0],            lCandidate.fDCANegToPrimVtx );
+    AliV0SelectionTable::KeepIfAbove( lN, lPass, &fDCAPosToPV[0],            lCandidate.fDCAPosToPrimVtx );
+    AliV0SelectionTable::KeepIfBelow( lN, lPass, &fDCAV0Daughters[0],        lCandidate.fDCAV0Daughters );
+    AliV0SelectionTable::KeepIfAbove( lN, lPass, &fV0CosPA[0],               lCandidate.fV0CosPointingAngle );
+    AliV0SelectionTable::KeepIfAbove( lN, lPass, &fV0Radius[0],              lCandidate.fV0Radius );
+    AliV0SelectionTable::KeepIfAbove( lN, lPass, &fDCAV0ToPV[0],             lCandidate.fDCAV0ToPrimVtx );
+    AliV0SelectionTable::KeepIfAbove( lN, lPass, &fDCABachToPV[0],           lCandidate.fDCABachToPrimVtx );
+    AliV0SelectionTable::KeepIfBelow( lN, lPass, &fDCACascDaughters[0],      lCandidate.fDCACascDaughters );
+    AliV0SelectionTable::KeepIfAbove( lN, lPass, &fCascCosPA[0],             lCandidate.fCascCosPointingAngle );
+    AliV0SelectionTable::KeepIfAbove( lN, lPass, &fCascRadius[0],            lCandidate.fCascRadius );
+    AliV0SelectionTable::KeepIfAbove( lN, lPass, &fLeastNumberOfClusters[0], lCandidate.fLeastNbrClusters );
+    AliV0SelectionTable::KeepIfAbove( lN, lPass, &fDCABachToBaryon[0],       lCandidate.fDCABachToBaryon );
+    
+    //List validity: a gather, hence last
+    for( Long_t icfg=0; icfg<lN; icfg++ ) lPass[icfg] &= lCandidate.fValidList[fList[icfg]];
+    
+    return AliV0SelectionTable::Compress( lN, lPass, lPassed );
+}
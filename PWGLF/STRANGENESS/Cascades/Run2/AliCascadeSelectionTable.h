@@ -0,0 +1,97 @@
+#ifndef AliCascadeSelectionTable_H
+#define AliCascadeSelectionTable_H
+#include <vector>
+#include <TObject.h>
+
+class TList;
+class AliCascadeResult;
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Cut table compiled from a set of AliCascadeResult configurations
+//
+// Counterpart of AliV0SelectionTable for cascades: charge, acceptance
+// and topological threshold cuts of all configurations are evaluated
+// column-wise for one candidate (with the kernels of AliV0SelectionTable),
+// the remaining cuts are left to the analysis task for the configurations
+// passing the table.
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+class AliCascadeSelectionTable : public TObject {
+    
+public:
+    enum { kMaxLists = 4 };
+    
+    //Candidate properties entering the table selection
+    struct Candidate {
+        Bool_t  fValidList[kMaxLists]; //configurations of list i are considered at all
+        Int_t   fCharge;
+        Float_t fNegEta;
+        Float_t fPosEta;
+        Float_t fBachEta;
+        Float_t fDCANegToPrimVtx;
+        Float_t fDCAPosToPrimVtx;
+        Float_t fDCAV0Daughters;
+        Float_t fV0CosPointingAngle;
+        Float_t fV0Radius;
+        Float_t fDCAV0ToPrimVtx;
+        Float_t fDCABachToPrimVtx;
+        Float_t fDCACascDaughters;
+        Float_t fCascCosPointingAngle;
+        Float_t fCascRadius;
+        Int_t   fLeastNbrClusters;
+        Float_t fDCABachToBaryon;
+    };
+    
+    AliCascadeSelectionTable();
+    ~AliCascadeSelectionTable();
+    
+    void Clear(Option_t* = "");
+    
+    //Whether AliCascadeResult::GetSwapBachelorCharge() flips the expected charge
+    //(to be set before adding configurations)
+    void SetUseSwapBachelorCharge( Bool_t lOpt = kTRUE ) { fkUseSwapBachelorCharge = lOpt; }
+    
+    //Appends all configurations of the list, in list order; lists are
+    //numbered in the order they are added (see Candidate::fValidList)
+    void AddConfigurations( TList *lList );
+    
+    Long_t GetNConfigurations() const { return fResults.size(); }
+    AliCascadeResult *GetConfiguration( Long_t lcfg ) const { return fResults[lcfg]; }
+    
+    //Stores the indices of the configurations passing the table cuts in lPassed
+    //(to be sized for GetNConfigurations() entries) and returns their number
+    Long_t Select( const Candidate &lCandidate, Long_t *lPassed );
+    
+private:
+    AliCascadeSelectionTable(const AliCascadeSelectionTable&);            // not implemented
+    AliCascadeSelectionTable& operator=(const AliCascadeSelectionTable&); // not implemented
+    
+    Bool_t fkUseSwapBachelorCharge; // expected charge follows GetSwapBachelorCharge()
+    Int_t  fNLists;                 //! number of lists added so far
+    
+    std::vector<AliCascadeResult*> fResults; //! configurations, not owned
+    
+    //Cut columns, one entry per configuration
+    std::vector<Int_t>    fList;                 //! list index
+    std::vector<Int_t>    fCharge;               //! expected charge
+    std::vector<Double_t> fMinEtaTracks;         //!
+    std::vector<Double_t> fMaxEtaTracks;         //!
+    std::vector<Double_t> fDCANegToPV;           //!
+    std::vector<Double_t> fDCAPosToPV;           //!
+    std::vector<Double_t> fDCAV0Daughters;       //!
+    std::vector<Float_t>  fV0CosPA;              //! as Float_t, like the task-level cut
+    std::vector<Double_t> fV0Radius;             //!
+    std::vector<Double_t> fDCAV0ToPV;            //!
+    std::vector<Double_t> fDCABachToPV;          //!
+    std::vector<Float_t>  fDCACascDaughters;     //! as Float_t, like the task-level cut
+    std::vector<Float_t>  fCascCosPA;            //! as Float_t, like the task-level cut
+    std::vector<Double_t> fCascRadius;           //!
+    std::vector<Double_t> fLeastNumberOfClusters;//!
+    std::vector<Double_t> fDCABachToBaryon;      //!
+    
+    std::vector<UChar_t>  fPass;                 //! per-configuration pass flags
+    
+    ClassDef(AliCascadeSelectionTable, 1)
+    // 1 - original implementation
+};
+#endif
@@ -0,0 +1,98 @@
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Cut table compiled from a set of AliV0Result configurations
+//
+// Only cuts which are a necessary condition of the full V0 selection
+// of the analysis tasks are compiled into the table, with the same
+// precision as there: a configuration rejected by the table would have
+// been rejected by the full selection as well. Variable (pT-dependent)
+// cosPA cuts can only be tighter than the constant one, which therefore
+// is still a valid prefilter for them.
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+#include "TList.h"
+#include "AliV0Result.h"
+#include "AliV0SelectionTable.h"
+
+ClassImp(AliV0SelectionTable);
+
+//________________________________________________________________
+AliV0SelectionTable::AliV0SelectionTable() :
+TObject(),
+fResults(),
+fUseOnTheFly(), fMinEtaTracks(), fMaxEtaTracks(), fV0Radius(), fMaxV0Radius(),
+fDCANegToPV(), fDCAPosToPV(), fDCAV0Daughters(), fV0CosPA(),
+fLeastNbrCrossedRows(), fLeastRatioCrossedRows(),
+fPass()
+{
+    // Empty table
+}
+
+//________________________________________________________________
+AliV0SelectionTable::~AliV0SelectionTable(){
+    // Configurations are owned by their lists
+}
+
+//________________________________________________________________
+void AliV0SelectionTable::Clear(Option_t*)
+{
+    fResults.clear();
+    fUseOnTheFly.clear();
+    fMinEtaTracks.clear();
+    fMaxEtaTracks.clear();
+    fV0Radius.clear();
+    fMaxV0Radius.clear();
+    fDCANegToPV.clear();
+    fDCAPosToPV.clear();
+    fDCAV0Daughters.clear();
+    fV0CosPA.clear();
+    fLeastNbrCrossedRows.clear();
+    fLeastRatioCrossedRows.clear();
+    fPass.clear();
+}
+
+//________________________________________________________________
+void AliV0SelectionTable::AddConfigurations( TList *lList )
+{
+    if( !lList ) return;
+    for( Int_t icfg=0; icfg<lList->GetEntries(); icfg++ ){
+        AliV0Result *lV0Result = (AliV0Result*) lList->At(icfg);
+        fResults.push_back( lV0Result );
+        fUseOnTheFly.push_back( lV0Result->GetUseOnTheFly() );
+        fMinEtaTracks.push_back( lV0Result->GetCutMinEtaTracks() );
+        fMaxEtaTracks.push_back( lV0Result->GetCutMaxEtaTracks() );
+        fV0Radius.push_back( lV0Result->GetCutV0Radius() );
+        fMaxV0Radius.push_back( lV0Result->GetCutMaxV0Radius() );
+        fDCANegToPV.push_back( lV0Result->GetCutDCANegToPV() );
+        fDCAPosToPV.push_back( lV0Result->GetCutDCAPosToPV() );
+        fDCAV0Daughters.push_back( lV0Result->GetCutDCAV0Daughters() );
+        fV0CosPA.push_back( lV0Result->GetCutV0CosPA() );
+        fLeastNbrCrossedRows.push_back( lV0Result->GetCutLeastNumberOfCrossedRows() );
+        fLeastRatioCrossedRows.push_back( lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable() );
+    }
+    fPass.resize( fResults.size() );
+}
+
+//________________________________________________________________
+Long_t AliV0SelectionTable::Select( const Candidate &lCandidate, Long_t *lPassed )
+{
+    const Long_t lN = fResults.size();
+    if( lN == 0 ) return 0;
+    
+    //Candidate values are promoted as in the comparisons of the analysis tasks
+    UChar_t *lPass = &fPass[0];
+    KeepIfEqual( lN, lPass, &fUseOnTheFly[0],           lCandidate.fOnFlyStatus );
+    KeepIfAbove( lN, lPass, &fMinEtaTracks[0],          lCandidate.fNegEta );
+    KeepIfBelow( lN, lPass, &fMaxEtaTracks[0],          lCandidate.fNegEta );
+    KeepIfAbove( lN, lPass, &fMinEtaTracks[0],          lCandidate.fPosEta );
+    KeepIfBelow( lN, lPass, &fMaxEtaTracks[0],          lCandidate.fPosEta );
+    KeepIfAbove( lN, lPass, &fV0Radius[0],              lCandidate.fV0Radius );
+    KeepIfBelow( lN, lPass, &fMaxV0Radius[0],           lCandidate.fV0Radius );
+    KeepIfAbove( lN, lPass, &fDCANegToPV[0],            lCandidate.fDcaNegToPrimVertex );
+    KeepIfAbove( lN, lPass, &fDCAPosToPV[0],            lCandidate.fDcaPosToPrimVertex );
+    KeepIfBelow( lN, lPass, &fDCAV0Daughters[0],        lCandidate.fDcaV0Daughters );
+    KeepIfAbove( lN, lPass, &fV0CosPA[0],               lCandidate.fV0CosineOfPointingAngle );
+    KeepIfAbove( lN, lPass, &fLeastNbrCrossedRows[0],   lCandidate.fLeastNbrCrossedRows );
+    KeepIfAbove( lN, lPass, &fLeastRatioCrossedRows[0], lCandidate.fLeastRatioCrossedRowsOverFindable );
+    
+    return Compress( lN, lPass, lPassed );
+}
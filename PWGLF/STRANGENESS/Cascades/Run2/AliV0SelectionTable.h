@@ -0,0 +1,101 @@
+#ifndef AliV0SelectionTable_H
+#define AliV0SelectionTable_H
+#include <vector>
+#include <TObject.h>
+
+class TList;
+class AliV0Result;
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Cut table compiled from a set of AliV0Result configurations
+//
+// The simple threshold cuts of all configurations are stored column-wise
+// and evaluated for one candidate with one pass per cut column, which
+// yields the list of configurations still to be checked in full. The
+// remaining (hypothesis-dependent) cuts are left to the analysis task.
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+class AliV0SelectionTable : public TObject {
+    
+public:
+    //Candidate properties entering the table selection
+    struct Candidate {
+        Int_t   fOnFlyStatus;
+        Float_t fNegEta;
+        Float_t fPosEta;
+        Float_t fV0Radius;
+        Float_t fDcaNegToPrimVertex;
+        Float_t fDcaPosToPrimVertex;
+        Float_t fDcaV0Daughters;
+        Float_t fV0CosineOfPointingAngle;
+        Int_t   fLeastNbrCrossedRows;
+        Float_t fLeastRatioCrossedRowsOverFindable;
+    };
+    
+    AliV0SelectionTable();
+    ~AliV0SelectionTable();
+    
+    void Clear(Option_t* = "");
+    
+    //Appends all configurations of the list, in list order
+    void AddConfigurations( TList *lList );
+    
+    Long_t GetNConfigurations() const { return fResults.size(); }
+    AliV0Result *GetConfiguration( Long_t lcfg ) const { return fResults[lcfg]; }
+    
+    //Stores the indices of the configurations passing the table cuts in lPassed
+    //(to be sized for GetNConfigurations() entries) and returns their number
+    Long_t Select( const Candidate &lCandidate, Long_t *lPassed );
+    
+    //Column kernels: one branch-free (auto-vectorizable) loop per cut,
+    //lPass[i] is set/kept only if lValue compares as required to lCut[i]
+    static void KeepIfEqual( Long_t lN, UChar_t *lPass, const Int_t *lCut, Int_t lValue ){
+        for( Long_t i=0; i<lN; i++ ) lPass[i] = ( lValue == lCut[i] );
+    }
+    static void KeepIfAbove( Long_t lN, UChar_t *lPass, const Double_t *lCut, Double_t lValue ){
+        for( Long_t i=0; i<lN; i++ ) lPass[i] &= ( lValue > lCut[i] );
+    }
+    static void KeepIfAbove( Long_t lN, UChar_t *lPass, const Float_t *lCut, Float_t lValue ){
+        for( Long_t i=0; i<lN; i++ ) lPass[i] &= ( lValue > lCut[i] );
+    }
+    static void KeepIfBelow( Long_t lN, UChar_t *lPass, const Double_t *lCut, Double_t lValue ){
+        for( Long_t i=0; i<lN; i++ ) lPass[i] &= ( lValue < lCut[i] );
+    }
+    static void KeepIfBelow( Long_t lN, UChar_t *lPass, const Float_t *lCut, Float_t lValue ){
+        for( Long_t i=0; i<lN; i++ ) lPass[i] &= ( lValue < lCut[i] );
+    }
+    //Stores the indices i with lPass[i] set into lPassed, returns their number
+    static Long_t Compress( Long_t lN, const UChar_t *lPass, Long_t *lPassed ){
+        Long_t lNPassed = 0;
+        for( Long_t i=0; i<lN; i++ ){
+            lPassed[lNPassed] = i;
+            lNPassed += lPass[i];
+        }
+        return lNPassed;
+    }
+    
+private:
+    AliV0SelectionTable(const AliV0SelectionTable&);            // not implemented
+    AliV0SelectionTable& operator=(const AliV0SelectionTable&); // not implemented
+    
+    std::vector<AliV0Result*> fResults; //! configurations, not owned
+    
+    //Cut columns, one entry per configuration
+    std::vector<Int_t>    fUseOnTheFly;                //!
+    std::vector<Double_t> fMinEtaTracks;               //!
+    std::vector<Double_t> fMaxEtaTracks;               //!
+    std::vector<Double_t> fV0Radius;                   //!
+    std::vector<Double_t> fMaxV0Radius;                //!
+    std::vector<Double_t> fDCANegToPV;                 //!
+    std::vector<Double_t> fDCAPosToPV;                 //!
+    std::vector<Double_t> fDCAV0Daughters;             //!
+    std::vector<Float_t>  fV0CosPA;                    //! as Float_t, like the task-level cut
+    std::vector<Double_t> fLeastNbrCrossedRows;        //!
+    std::vector<Double_t> fLeastRatioCrossedRows;      //!
+    
+    std::vector<UChar_t>  fPass;                       //! per-configuration pass flags
+    
+    ClassDef(AliV0SelectionTable, 1)
+    // 1 - original implementation
+};
+#endif
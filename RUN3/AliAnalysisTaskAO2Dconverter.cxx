@@ -21,6 +21,9 @@
 #include <TChain.h>
 #include <TTree.h>
 #include <TMath.h>
+#include <TROOT.h>
+#include <TH2D.h>
+#include <chrono>
 #include "AliAnalysisTask.h"
 #include "AliAnalysisManager.h"
 #include "AliESDEvent.h"
@@ -74,6 +77,14 @@ ULong64_t GetEventIdAsLong(AliVHeader *header)
 
 } // namespace
 
+AliAnalysisTaskAO2Dconverter::AliAnalysisTaskAO2Dconverter()
+    : AliAnalysisTaskSE()
+{
+  // All the groups, also for the objects streamed from versions without fMantissaBits
+  for (Int_t i = 0; i < kPrecisions; i++)
+    fMantissaBits[i] = -1;
+}
+
 AliAnalysisTaskAO2Dconverter::AliAnalysisTaskAO2Dconverter(const char* name)
     : AliAnalysisTaskSE(name)
     , fTrackFilter(Form("AO2Dconverter%s", name), Form("fTrackFilter%s", name))
@@ -100,6 +111,8 @@ AliAnalysisTaskAO2Dconverter::AliAnalysisTaskAO2Dconverter(const char* name)
     , v0s()
     , cascs()
 {
+  for (Int_t i = 0; i < kPrecisions; i++)
+    fMantissaBits[i] = -1;
   DefineInput(0, TChain::Class());
   DefineOutput(1, TList::Class());
   for (Int_t i = 0; i < kTrees; i++) {
@@ -121,11 +134,45 @@ const TString AliAnalysisTaskAO2Dconverter::TreeName[kTrees] = { "O2collision",
 
 const TString AliAnalysisTaskAO2Dconverter::TreeTitle[kTrees] = { "Collision tree", "Collision extra", "Barrel tracks", "Calorimeter cells", "Calorimeter triggers", "MUON tracks", "MUON clusters", "ZDC", "Run2 V0", "FDD", "V0s", "Cascades", "TOF hits", "Kinematics", "MC collisions", "MC track labels", "MC calo labels", "MC collision labels", "BC info" };
 
+const Int_t AliAnalysisTaskAO2Dconverter::TruncatedMantissaBits[kPrecisions] = {
+  19, // kCollisionPosition
+  10, // kCollisionPositionCov
+  19, // kTrackX
+  19, // kTrackAlpha
+  15, // kTrackSnp
+  15, // kTrackTgl
+  13, // kTrack1Pt, including the momentum at the inner wall of TPC
+  15, // kTrackCovDiag, including the chi2
+  7,  // kTrackCovOffDiag
+  15, // kTrackSignal, PID signals and track length
+  15, // kTracklets
+  19, // kMcParticleW
+  19, // kMcParticlePos
+  19, // kMcParticleMom
+  15, // kCaloAmp
+  15, // kCaloTime
+  13, // kMuonTr1P
+  15, // kMuonTrThetaX
+  15, // kMuonTrThetaY
+  19, // kMuonTrZmu
+  19, // kMuonTrBend
+  19, // kMuonTrNonBend
+  7,  // kMuonTrCov, covariance matrix and chi2
+  15, // kMuonCl, position and charge
+  7,  // kMuonClErr
+  11  // kADTime
+};
+
 const TClass* AliAnalysisTaskAO2Dconverter::Generator[kGenerators] = { AliGenEventHeader::Class(), AliGenCocktailEventHeader::Class(), AliGenDPMjetEventHeader::Class(), AliGenEpos3EventHeader::Class(), AliGenEposEventHeader::Class(), AliGenEventHeaderTunedPbPb::Class(), AliGenGeVSimEventHeader::Class(), AliGenHepMCEventHeader::Class(), AliGenHerwigEventHeader::Class(), AliGenHijingEventHeader::Class(), AliGenPythiaEventHeader::Class(), AliGenToyEventHeader::Class() };
 
 TTree* AliAnalysisTaskAO2Dconverter::CreateTree(TreeIndex t)
 {
   fTree[t] = new TTree(TreeName[t], TreeTitle[t]);
+#ifdef R__USE_IMT
+  // The branches of a table are filled and their baskets compressed in parallel
+  // at each flush. The table layout is the same as in the serial mode.
+  fTree[t]->SetImplicitMT(fNumberOfWriterThreads > 0);
+#endif
   return fTree[t];
 }
 
@@ -136,11 +183,39 @@ void AliAnalysisTaskAO2Dconverter::PostTree(TreeIndex t)
   PostData(t + 2, fTree[t]);
 }
 
+void AliAnalysisTaskAO2Dconverter::AddIndexColumn(TreeIndex t, const char *name, Int_t *address)
+{
+  if (!fTreeStatus[t] || !fTree[t])
+    return;
+  if (!fDeltaEncoding) {
+    fTree[t]->Branch(name, address, Form("%s/I", name));
+    return;
+  }
+  // The encoded column gets its own name, so that it cannot be read as the absolute index
+  TString encoded = DeltaColumnName(name);
+  fTree[t]->Branch(encoded, address, Form("%s/I", encoded.Data()));
+  fDeltaColumns[t].push_back(std::make_pair(address, 0));
+}
+
 void AliAnalysisTaskAO2Dconverter::FillTree(TreeIndex t)
 {
   if (!fTreeStatus[t])
     return;
-  fTree[t]->Fill();
+  // Store the difference to the previous entry and restore the value after the fill
+  for (auto &column : fDeltaColumns[t]) {
+    Int_t value = *column.first;
+    *column.first = value - column.second;
+    column.second = value;
+  }
+  if (!fWriterStatistics) {
+    fTree[t]->Fill();
+  } else {
+    auto start = std::chrono::steady_clock::now();
+    fTree[t]->Fill();
+    fFillTime[t] += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+  for (auto &column : fDeltaColumns[t])
+    *column.first = column.second;
 }
 
 void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
@@ -161,6 +236,29 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
     break;
   }
 
+#ifdef R__USE_IMT
+  // Implicit MT is a process-wide switch: a pool already enabled by the steering macro is kept as it is
+  if (fNumberOfWriterThreads > 0) {
+    if (!ROOT::IsImplicitMTEnabled())
+      ROOT::EnableImplicitMT(fNumberOfWriterThreads);
+    else if (ROOT::GetImplicitMTPoolSize() != (UInt_t)fNumberOfWriterThreads)
+      AliWarning(Form("ROOT implicit MT already enabled with %u threads, %d requested", ROOT::GetImplicitMTPoolSize(), fNumberOfWriterThreads));
+  }
+#else
+  if (fNumberOfWriterThreads > 0)
+    AliWarning("ROOT built without implicit MT support, the tables are written serially");
+#endif
+
+  // Index columns increasing monotonically within the time frame are delta encoded if requested
+  for (Int_t i = 0; i < kTrees; i++)
+    fDeltaColumns[i].clear();
+
+  // Float masks of the column groups: the explicit mantissa bits win over the global truncation
+  for (Int_t i = 0; i < kPrecisions; i++) {
+    Int_t bits = fMantissaBits[i] >= 0 ? fMantissaBits[i] : (fTruncate ? TruncatedMantissaBits[i] : 23);
+    fPrecisionMask[i] = 0xFFFFFFFF << (23 - TMath::Min(bits, 23));
+  }
+
   // Reset the offsets
   fOffsetMuTrackID = 0;
   fOffsetTrackID = 0;
@@ -181,6 +279,17 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
   fOutputList->Add(fCentralityHist);
   fOutputList->Add(fCentralityINT7);
   fOutputList->Add(fHistPileupEvents);
+  if (fWriterStatistics) {
+    // Summed over the subjobs when merging: rates are obtained dividing the MB and entries by the fill time
+    fHistWriterStats = new TH2D("writerStats", "Writer statistics", kTrees, 0, kTrees, 4, 0, 4);
+    for (Int_t i = 0; i < kTrees; i++)
+      fHistWriterStats->GetXaxis()->SetBinLabel(i + 1, TreeName[i]);
+    fHistWriterStats->GetYaxis()->SetBinLabel(1, "events");
+    fHistWriterStats->GetYaxis()->SetBinLabel(2, "entries");
+    fHistWriterStats->GetYaxis()->SetBinLabel(3, "MB");
+    fHistWriterStats->GetYaxis()->SetBinLabel(4, "fill time (s)");
+    fOutputList->Add(fHistWriterStats);
+  }
   if (fSkipTPCPileup || fSkipPileup || fUseEventCuts) fEventCuts.AddQAplotsToList(fOutputList);
   if (fSkipTPCPileup) fEventCuts.SetRejectTPCPileupWithITSTPCnCluCorr(true);
 
@@ -190,7 +299,7 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
   TTree* tEvents = CreateTree(kEvents);
   tEvents->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kEvents]) {
-    tEvents->Branch("fBCsID", &collision.fBCsID, "fBCsID/I");
+    AddIndexColumn(kEvents, "fBCsID", &collision.fBCsID);
     tEvents->Branch("fPosX", &collision.fPosX, "fPosX/F");
     tEvents->Branch("fPosY", &collision.fPosY, "fPosY/F");
     tEvents->Branch("fPosZ", &collision.fPosZ, "fPosZ/F");
@@ -233,7 +342,7 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
   TTree* tTracks = CreateTree(kTracks);
   tTracks->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kTracks]) {
-    tTracks->Branch("fCollisionsID", &tracks.fCollisionsID, "fCollisionsID/I");
+    AddIndexColumn(kTracks, "fCollisionsID", &tracks.fCollisionsID);
     tTracks->Branch("fTrackType", &tracks.fTrackType, "fTrackType/b");
     //    tTracks->Branch("fTOFclsIndex", &tracks.fTOFclsIndex, "fTOFclsIndex/I");
     //    tTracks->Branch("fNTOFcls", &tracks.fNTOFcls, "fNTOFcls/I");
@@ -285,7 +394,7 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
   TTree* tCalo = CreateTree(kCalo);
   tCalo->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kCalo]) {
-    tCalo->Branch("fBCsID", &calo.fBCsID, "fBCsID/I");
+    AddIndexColumn(kCalo, "fBCsID", &calo.fBCsID);
     tCalo->Branch("fCellNumber", &calo.fCellNumber, "fCellNumber/S");
     tCalo->Branch("fAmplitude", &calo.fAmplitude, "fAmplitude/F");
     tCalo->Branch("fTime", &calo.fTime, "fTime/F");
@@ -297,7 +406,7 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
   TTree *tCaloTrigger = CreateTree(kCaloTrigger);
   tCaloTrigger->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kCaloTrigger]) {
-    tCaloTrigger->Branch("fBCsID", &calotrigger.fBCsID, "fBCsID/I");
+    AddIndexColumn(kCaloTrigger, "fBCsID", &calotrigger.fBCsID);
     tCaloTrigger->Branch("fFastOrAbsID", &calotrigger.fFastOrAbsID, "fFastOrAbsID/S");
     tCaloTrigger->Branch("fL0Amplitude", &calotrigger.fL0Amplitude, "fL0Amplitude/F");
     tCaloTrigger->Branch("fL1TimeSum", &calotrigger.fL1TimeSum, "fL1TimeSum/F");
@@ -330,7 +439,7 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
   TTree* tMuonCls = CreateTree(kMuonCls);
   tMuonCls->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kMuonCls]) {
-    tMuonCls->Branch("fMuonsID",&mucls.fMuonsID,"fMuonsID/I");
+    AddIndexColumn(kMuonCls, "fMuonsID", &mucls.fMuonsID);
     tMuonCls->Branch("fX",&mucls.fX,"fX/F");
     tMuonCls->Branch("fY",&mucls.fY,"fY/F");
     tMuonCls->Branch("fZ",&mucls.fZ,"fZ/F");
@@ -345,7 +454,7 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
   TTree* tZdc = CreateTree(kZdc);
   tZdc->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kZdc]) {
-    tZdc->Branch("fBCsID",           &zdc.fBCsID          , "fBCsID/I");
+    AddIndexColumn(kZdc, "fBCsID", &zdc.fBCsID);
     tZdc->Branch("fEnergyZEM1",      &zdc.fEnergyZEM1     , "fEnergyZEM1/F");
     tZdc->Branch("fEnergyZEM2",      &zdc.fEnergyZEM2     , "fEnergyZEM2/F");
     tZdc->Branch("fEnergyCommonZNA", &zdc.fEnergyCommonZNA, "fEnergyCommonZNA/F");
@@ -387,7 +496,7 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
   TTree* tFDD = CreateTree(kFDD);
   tFDD->SetAutoFlush(fNumberOfEventsPerCluster);
   if (fTreeStatus[kFDD]) {
-    tFDD->Branch("fBCsID", &fdd.fBCsID, "fBCsID/I");
+    AddIndexColumn(kFDD, "fBCsID", &fdd.fBCsID);
     tFDD->Branch("fAmplitude", fdd.fAmplitude, "fAmplitude[8]/F");
     tFDD->Branch("fTimeA", &fdd.fTimeA, "fTimeA/F");
     tFDD->Branch("fTimeC", &fdd.fTimeC, "fTimeC/F");
@@ -432,7 +541,7 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
     TTree * tMCvtx = CreateTree(kMcCollision);
     tMCvtx->SetAutoFlush(fNumberOfEventsPerCluster);
     if(fTreeStatus[kMcCollision]) {
-      tMCvtx->Branch("fBCsID", &mccollision.fBCsID, "fBCsID/I");
+      AddIndexColumn(kMcCollision, "fBCsID", &mccollision.fBCsID);
       tMCvtx->Branch("fGeneratorsID", &mccollision.fGeneratorsID, "fGeneratorsID/S");
       tMCvtx->Branch("fPosX", &mccollision.fPosX, "fPosX/F");
       tMCvtx->Branch("fPosY", &mccollision.fPosY, "fPosY/F");
@@ -447,7 +556,7 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
     TTree* Kinematics = CreateTree(kMcParticle);
     Kinematics->SetAutoFlush(fNumberOfEventsPerCluster);
     if (fTreeStatus[kMcParticle]) {
-      Kinematics->Branch("fMcCollisionsID", &mcparticle.fMcCollisionsID, "fMcCollisionsID/I");
+      AddIndexColumn(kMcParticle, "fMcCollisionsID", &mcparticle.fMcCollisionsID);
 
       Kinematics->Branch("fPdgCode", &mcparticle.fPdgCode, "fPdgCode/I");
       Kinematics->Branch("fStatusCode", &mcparticle.fStatusCode, "fStatusCode/I");
@@ -499,7 +608,6 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
     PostTree(kMcCaloLabel);
 }
 
-
   Prune(); //Removing all unwanted branches (if any)
 }
 
@@ -514,7 +622,8 @@ void AliAnalysisTaskAO2Dconverter::Prune()
       TObjArray* branches = fTree[j]->GetListOfBranches();
       for (Int_t k = 0; k < branches->GetEntries(); k++) {
         TString bname = branches->At(k)->GetName();
-        if (!bname.EqualTo(arr->At(i)->GetName()))
+        // A delta encoded index column is pruned under its original name as well
+        if (!bname.EqualTo(arr->At(i)->GetName()) && !bname.EqualTo(DeltaColumnName(arr->At(i)->GetName())))
           continue;
         fTree[j]->SetBranchStatus(bname, 0);
         found = kTRUE;
@@ -528,82 +637,43 @@ void AliAnalysisTaskAO2Dconverter::Prune()
 
 void AliAnalysisTaskAO2Dconverter::UserExec(Option_t *)
 {
-  // Set up the precision masks used to truncate the corresponding float data members
+  // Precision masks used to truncate the corresponding float data members (see UserCreateOutputObjects)
+  const UInt_t mCollisionPosition = fPrecisionMask[kCollisionPosition];       // Position in x,y,z
+  const UInt_t mCollisionPositionCov = fPrecisionMask[kCollisionPositionCov]; // Covariance matrix and chi2
+
+  const UInt_t mTrackX = fPrecisionMask[kTrackX];
+  const UInt_t mTrackAlpha = fPrecisionMask[kTrackAlpha];
+  const UInt_t mtrackSnp = fPrecisionMask[kTrackSnp];
+  const UInt_t mTrackTgl = fPrecisionMask[kTrackTgl];
+  const UInt_t mTrack1Pt = fPrecisionMask[kTrack1Pt]; // Including the momentun at the inner wall of TPC
+  const UInt_t mTrackCovDiag = fPrecisionMask[kTrackCovDiag]; // Including the chi2
+  const UInt_t mTrackCovOffDiag = fPrecisionMask[kTrackCovOffDiag];
+  const UInt_t mTrackSignal = fPrecisionMask[kTrackSignal]; // PID signals and track length
+
+  const UInt_t mTracklets = fPrecisionMask[kTracklets]; // tracklet members
+
+  const UInt_t mMcParticleW = fPrecisionMask[kMcParticleW];     // Precision for weight
+  const UInt_t mMcParticlePos = fPrecisionMask[kMcParticlePos]; // Precision for (x,y,z,t)
+  const UInt_t mMcParticleMom = fPrecisionMask[kMcParticleMom]; // Precision for (Px,Py,Pz,E)
+
+  const UInt_t mCaloAmp = fPrecisionMask[kCaloAmp];
+  const UInt_t mCaloTime = fPrecisionMask[kCaloTime];
+
+  const UInt_t mMuonTr1P = fPrecisionMask[kMuonTr1P];
+  const UInt_t mMuonTrThetaX = fPrecisionMask[kMuonTrThetaX];
+  const UInt_t mMuonTrThetaY = fPrecisionMask[kMuonTrThetaY];
+  const UInt_t mMuonTrZmu = fPrecisionMask[kMuonTrZmu];
+  const UInt_t mMuonTrBend = fPrecisionMask[kMuonTrBend];
+  const UInt_t mMuonTrNonBend = fPrecisionMask[kMuonTrNonBend];
+  const UInt_t mMuonTrCov = fPrecisionMask[kMuonTrCov]; // Covariance matrix and chi2
+
+  const UInt_t mMuonCl = fPrecisionMask[kMuonCl]; // Position and charge
+  const UInt_t mMuonClErr = fPrecisionMask[kMuonClErr];
+
+  const UInt_t mADTime = fPrecisionMask[kADTime];
 
-  // Without truncation
-  
-  UInt_t mCollisionPosition = 0xFFFFFFFF;    // Position in x,y,z
-  UInt_t mCollisionPositionCov = 0xFFFFFFFF; // Covariance matrix and chi2
-
-  UInt_t mTrackX =  0xFFFFFFFF;
-  UInt_t mTrackAlpha = 0xFFFFFFFF;
-  UInt_t mtrackSnp = 0xFFFFFFFF;
-  UInt_t mTrackTgl = 0xFFFFFFFF;
-  UInt_t mTrack1Pt = 0xFFFFFFFF; // Including the momentun at the inner wall of TPC
-  UInt_t mTrackCovDiag = 0xFFFFFFFF; // Including the chi2
-  UInt_t mTrackCovOffDiag = 0xFFFFFFFF;
-  UInt_t mTrackSignal = 0xFFFFFFFF; // PID signals and track length
-
-  UInt_t mTracklets = 0xFFFFFFFF; // tracklet members
-
-  UInt_t mMcParticleW   = 0xFFFFFFFF; // Precision for weight
-  UInt_t mMcParticlePos = 0xFFFFFFFF; // Precision for (x,y,z,t)
-  UInt_t mMcParticleMom = 0xFFFFFFFF; // Precision for (Px,Py,Pz,E)
-
-  UInt_t mCaloAmp = 0xFFFFFFFF;
-  UInt_t mCaloTime = 0xFFFFFFFF;
-
-  UInt_t mMuonTr1P = 0xFFFFFFFF;
-  UInt_t mMuonTrThetaX = 0xFFFFFFFF;
-  UInt_t mMuonTrThetaY = 0xFFFFFFFF;
-  UInt_t mMuonTrZmu = 0xFFFFFFFF;
-  UInt_t mMuonTrBend = 0xFFFFFFFF;
-  UInt_t mMuonTrNonBend = 0xFFFFFFFF;
-  UInt_t mMuonTrCov = 0xFFFFFFFF; // Covariance matrix and chi2
-
-  UInt_t mMuonCl = 0xFFFFFFFF; // Position and charge
-  UInt_t mMuonClErr = 0xFFFFFFFF;
-
-  UInt_t mADTime = 0xFFFFFFFF;
-  
   // No compression for ZDC and Run2 VZERO for the moment
 
-  if (fTruncate) {
-    mCollisionPosition = 0xFFFFFFF0; // 19 bits mantissa
-    mCollisionPositionCov = 0xFFFFE000; // 10 bits mantissa
-
-    mTrackX =  0xFFFFFFF0; // 19 bits
-    mTrackAlpha = 0xFFFFFFF0; // 19 bits
-    mtrackSnp = 0xFFFFFF00; // 15 bits
-    mTrackTgl = 0xFFFFFF00; // 15 bits
-    mTrack1Pt = 0xFFFFFC00; // 13 bits
-    mTrackCovDiag = 0xFFFFFF00; // 15 bits
-    mTrackCovOffDiag = 0xFFFF0000; // 7 bits
-    mTrackSignal = 0xFFFFFF00; // 15 bits
-
-    mTracklets = 0xFFFFFF00; // 15 bits
-
-    mMcParticleW   = 0xFFFFFFF0; // 19 bits
-    mMcParticlePos = 0xFFFFFFF0; // 19 bits
-    mMcParticleMom = 0xFFFFFFF0; // 19 bits
-
-    mCaloAmp = 0xFFFFFF00; // 15 bits
-    mCaloTime = 0xFFFFFF00; // 15 bits
-
-    mMuonTr1P = 0xFFFFFC00; // 13 bits 
-    mMuonTrThetaX = 0xFFFFFF00; // 15 bits
-    mMuonTrThetaY = 0xFFFFFF00; // 15 bits
-    mMuonTrZmu = 0xFFFFFFF0; // 19 bits
-    mMuonTrBend = 0xFFFFFFF0; // 19 bits
-    mMuonTrNonBend = 0xFFFFFFF0; // 19 bits
-    mMuonTrCov = 0xFFFF0000; // 7 bits
-
-    mMuonCl = 0xFFFFFF00; // 15 bits
-    mMuonClErr = 0xFFFF0000; // 7 bits
-    
-    mADTime = 0xFFFFF000; // 11 bits
-  }
-  
   // Initialisation
 
   const char *kPileupRejType[2] = {"PU_rej", "PU_TPC_rej"};
@@ -1427,6 +1497,26 @@ void AliAnalysisTaskAO2Dconverter::UserExec(Option_t *)
   fOffsetV0ID += nv0_filled;
 }
 
+void AliAnalysisTaskAO2Dconverter::FinishTaskOutput()
+{
+  // Report the writing throughput of each table, used to size the converter jobs
+  if (!fWriterStatistics)
+    return;
+  for (Int_t i = 0; i < kTrees; i++) {
+    if (!fTreeStatus[i] || !fTree[i])
+      continue;
+    Double_t mbytes = fTree[i]->GetTotBytes() / 1024. / 1024.;
+    fHistWriterStats->Fill(i, 0., fEventCount);
+    fHistWriterStats->Fill(i, 1., fTree[i]->GetEntries());
+    fHistWriterStats->Fill(i, 2., mbytes);
+    fHistWriterStats->Fill(i, 3., fFillTime[i]);
+    if (fFillTime[i] > 0)
+      AliInfo(Form("%-20s %10lld entries %9.1f events/s %8.2f MB/s (uncompressed)", TreeName[i].Data(),
+                   fTree[i]->GetEntries(), fEventCount / fFillTime[i], mbytes / fFillTime[i]));
+  }
+  PostData(1, fOutputList);
+}
+
 void AliAnalysisTaskAO2Dconverter::Terminate(Option_t *)
 {
   // terminate
@@ -15,12 +15,16 @@
 
 #include <Rtypes.h>
 
+#include <utility>
+#include <vector>
+
 class AliESDEvent;
+class TH2D;
 
 class AliAnalysisTaskAO2Dconverter : public AliAnalysisTaskSE
 {
 public:
-  AliAnalysisTaskAO2Dconverter() = default;
+  AliAnalysisTaskAO2Dconverter();
   AliAnalysisTaskAO2Dconverter(const char *name);
   virtual ~AliAnalysisTaskAO2Dconverter();
 
@@ -33,11 +37,51 @@ public:
   virtual void Init() {}
   virtual void UserCreateOutputObjects();
   virtual void UserExec(Option_t *option);
+  virtual void FinishTaskOutput();
   virtual void Terminate(Option_t *option);
 
   void SetNumberOfEventsPerCluster(int n) { fNumberOfEventsPerCluster = n; }
+  void SetNumberOfWriterThreads(int n) { fNumberOfWriterThreads = n; } // Compress the table baskets in parallel with n threads if n > 0
+  void SetWriterStatistics(Bool_t flag = kTRUE) { fWriterStatistics = flag; } // Measure the per-table writing throughput
 
   virtual void SetTruncation(Bool_t trunc=kTRUE) {fTruncate = trunc;}
+  enum ColumnPrecision { // Groups of float columns sharing the same mantissa precision
+    kCollisionPosition = 0,
+    kCollisionPositionCov,
+    kTrackX,
+    kTrackAlpha,
+    kTrackSnp,
+    kTrackTgl,
+    kTrack1Pt,
+    kTrackCovDiag,
+    kTrackCovOffDiag,
+    kTrackSignal,
+    kTracklets,
+    kMcParticleW,
+    kMcParticlePos,
+    kMcParticleMom,
+    kCaloAmp,
+    kCaloTime,
+    kMuonTr1P,
+    kMuonTrThetaX,
+    kMuonTrThetaY,
+    kMuonTrZmu,
+    kMuonTrBend,
+    kMuonTrNonBend,
+    kMuonTrCov,
+    kMuonCl,
+    kMuonClErr,
+    kADTime,
+    kPrecisions
+  };
+  // Number of mantissa bits (0-23) kept for a group of columns, overrides SetTruncation for this group
+  void SetMantissaBits(ColumnPrecision c, Int_t bits) { fMantissaBits[c] = bits; }
+  // Store the monotonic index columns (fBCsID, fCollisionsID, ...) as differences to the previous entry.
+  // The encoded columns are written under DeltaColumnName(name), hence the output is not a standard AO2D:
+  // standard readers do not find the index columns, see readIndexColumn in read.C for the decoding
+  void SetDeltaEncoding(Bool_t flag = kTRUE) { fDeltaEncoding = flag; }
+  static TString DeltaColumnName(const char *name) { return TString(name) + "_delta"; }
+  static const Int_t TruncatedMantissaBits[kPrecisions]; //! Mantissa bits used by SetTruncation
 
   static AliAnalysisTaskAO2Dconverter* AddTask(TString suffix = "");
   enum TreeIndex { // Index of the output trees
@@ -119,11 +163,15 @@ private:
   TTree* fTree[kTrees] = { nullptr }; //! Array with all the output trees
   void Prune();                       // Function to perform tree pruning
   void FillTree(TreeIndex t);         // Function to fill the trees (only the active ones)
+  void AddIndexColumn(TreeIndex t, const char *name, Int_t *address); // Branch of an index column, delta encoded if requested
 
   // Task configuration variables
   TString fPruneList = "";                // Names of the branches that will not be saved to output file
   Bool_t fTreeStatus[kTrees] = { kTRUE }; // Status of the trees i.e. kTRUE (enabled) or kFALSE (disabled)
   int fNumberOfEventsPerCluster = 1000;   // Maximum basket size of the trees
+  int fNumberOfWriterThreads = 0;         // > 0: size of the ROOT implicit MT pool compressing the table baskets
+  Bool_t fWriterStatistics = kFALSE;      // Measure the time spent filling and compressing each table
+  Double_t fFillTime[kTrees] = { 0. };    //! Wall time spent in TTree::Fill for each table (s)
 
   TaskModes fTaskMode = kStandard; // Running mode of the task. Useful to set for e.g. MC mode
 
@@ -453,14 +501,19 @@ private:
 
   /// Set truncation
   Bool_t fTruncate = kFALSE;
+  Int_t fMantissaBits[kPrecisions];           /// Mantissa bits per column group, -1 (set in the ctors): given by fTruncate
+  UInt_t fPrecisionMask[kPrecisions] = { 0 }; //! Float masks computed from the mantissa bits
+  Bool_t fDeltaEncoding = kFALSE;             /// Delta encoding of the index columns
+  std::vector<std::pair<Int_t *, Int_t>> fDeltaColumns[kTrees]; //! Delta encoded columns and their last value
   Bool_t fSkipPileup = kFALSE;       /// Skip pileup events
   Bool_t fSkipTPCPileup = kFALSE;    /// Skip TPC pileup (SetRejectTPCPileupWithITSTPCnCluCorr)
   TString fCentralityMethod = "V0M"; /// Centrality method
   TH1F *fCentralityHist = nullptr; ///! Centrality histogram
   TH1F *fCentralityINT7 = nullptr; ///! Centrality histogram for the INT7 triggers
   TH1I *fHistPileupEvents = nullptr; ///! Counter histogram for pileup events
+  TH2D *fHistWriterStats = nullptr;  ///! Per-table entries, MB and fill time of the writer
   
-  ClassDef(AliAnalysisTaskAO2Dconverter, 10);
+  ClassDef(AliAnalysisTaskAO2Dconverter, 12);
 };
 
 #endif